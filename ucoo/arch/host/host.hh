@@ -27,6 +27,7 @@
 
 #include <string>
 #include <list>
+#include <map>
 #include <memory>
 
 namespace ucoo {
@@ -59,7 +60,7 @@ class Host
     /// Instance name, from default or from command line.
     std::string instance_name_;
     /// Mex node, or 0 if not connected yet.
-    std::auto_ptr<mex::Node> node_;
+    std::unique_ptr<mex::Node> node_;
     /// Store options definitions and values.
     struct Option
     {
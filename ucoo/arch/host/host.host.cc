@@ -37,6 +37,8 @@ Host::Host (const std::string &default_instance_name)
     : program_name_ ("program"), option_parsed_ (false)
 {
     add_option ('i', "NAME", "instance name", default_instance_name);
+    add_option ('m', "ADDRESS", "mex hub address, HOST:PORT, unix:PATH or "
+                "shm:NAME", "");
     add_option ('h', "display this help message");
 }
 
@@ -63,7 +65,10 @@ mex::Node &
 Host::get_node ()
 {
     if (!node_.get ())
-        node_.reset (new mex::Node);
+    {
+        // Options may not be parsed, use default value in this case.
+        node_.reset (new mex::Node (options_.find ('m')->second.value));
+    }
     return *node_;
 }
 
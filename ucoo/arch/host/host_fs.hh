@@ -0,0 +1,172 @@
+#ifndef ucoo_arch_host_host_fs_hh
+#define ucoo_arch_host_host_fs_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/intf/file_system.hh"
+#include "ucoo/utils/pool.hh"
+#include "ucoo/common.hh"
+
+#include "config/ucoo/arch/host.hh"
+
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+namespace ucoo {
+
+/// File system giving access to the files of a host directory.  This can
+/// replace a RomFS or a LogFS when running on host, using the same
+/// interface.
+///
+/// Files open for reading are mapped in memory, data can be read without
+/// copy using peek.  Files open for writing are written to a temporary file
+/// in the same directory, through a buffer of fs_buffer_size bytes (see
+/// configuration), which replaces the previous version when the file is
+/// flushed or closed.  This way, a reader or a mapping of the previous
+/// version is not disturbed.  When writing continues after a flush, the
+/// content is copied to a new temporary file, so that the published
+/// version is never modified.
+///
+/// File names are relative to the root directory, they can not go outside
+/// of it.  Only regular files of the root directory are listed, hidden
+/// files (starting with a dot) are ignored.
+class HostFS : public FileSystem
+{
+    /// Stream from a host file.
+    class HostFSStream : public Stream
+    {
+      public:
+        /// Constructor for reading, from mapped memory.
+        HostFSStream (const char *begin, int size);
+        /// Constructor for writing, to a temporary file which will be renamed
+        /// to PATH.
+        HostFSStream (int fd, const std::string &tmp_path,
+                      const std::string &path);
+        /// Destructor, unmap or close file.
+        ~HostFSStream ();
+        /// See Stream::read.
+        int read (char *buf, int count) override;
+        /// See Stream::write.  Return -1 on error, the file is then
+        /// discarded.
+        int write (const char *buf, int count) override;
+        /// See Stream::poll.
+        int poll () override;
+        /// See Stream::seek.  Files open for writing can only tell their
+        /// position.
+        int seek (int offset, Whence whence = Whence::SET) override;
+        /// See Stream::size.
+        int size () override;
+        /// See Stream::flush.  Write buffered data and make the new file
+        /// version visible.
+        bool flush () override;
+      private:
+        /// Continue writing to a new temporary file, after the previous one
+        /// was renamed, return false on error.
+        bool reopen ();
+        /// Write buffered data to file, return false on error.
+        bool write_buffer ();
+      private:
+        friend class HostFS;
+        /// Mapped file content and size, for reading.
+        const char *data_;
+        /// Read or write position.
+        int pos_;
+        /// File size, for reading.
+        int size_;
+        /// File descriptor, or -1 for reading.
+        int fd_;
+        /// Temporary file path, empty once renamed, until next write.
+        std::string tmp_path_;
+        /// Final file path.
+        std::string path_;
+        /// Set on write error, the file is then discarded on close.
+        bool error_;
+        /// Number of buffered bytes.
+        int buffered_;
+        /// Write buffer.
+        char buf_[CONFIG_UCOO_ARCH_HOST_FS_BUFFER_SIZE];
+    };
+    /// Memory mapped file, kept until destruction.
+    struct Mapping
+    {
+        /// File name, device and inode.
+        std::string filename;
+        dev_t dev;
+        ino_t ino;
+        /// Mapped content and size.
+        const char *data;
+        int size;
+    };
+  public:
+    /// Constructor, takes root directory.
+    HostFS (const char *root);
+    /// Destructor, unmap mapped files.
+    ~HostFS ();
+    /// See FileSystem::open.
+    Stream *open (const char *filename, Mode mode, Error &error) override;
+    Stream *open (const char *filename, Mode mode = Mode::READ)
+    {
+        return FileSystem::open (filename, mode);
+    }
+    /// See FileSystem::close.  A file open for writing is flushed, on write
+    /// error, the previous version is kept.
+    void close (Stream *file) override;
+    /// See FileSystem::map.  The file is mapped in memory, the same mapping
+    /// is returned as long as the file is not replaced.
+    const char *map (const char *filename, int &size, Error &error)
+        override;
+    const char *map (const char *filename, int &size)
+    {
+        return FileSystem::map (filename, size);
+    }
+    /// See FileSystem::stat.
+    bool stat (const char *filename, Stat &stat, Error &error) override;
+    /// See FileSystem::list.
+    int list (const char *prefix, const ListCallback &callback) override;
+    /// See FileSystem::unlink.
+    void unlink (const char *filename) override;
+    /// Give direct access to the data of FILE, open for reading, at the
+    /// current position.  Return a pointer to data and store the number of
+    /// available bytes in COUNT, or return nullptr at end of file.  Data
+    /// stays valid until the file is closed, use seek to consume it.
+    const char *peek (Stream *file, int &count);
+  private:
+    /// Make host path from file name, return false if it is not valid.
+    bool path (const char *filename, std::string &path, Error &error) const;
+    /// Map a file, return nullptr on failure.
+    const char *map_file (const std::string &path, int &size,
+                          Error &error);
+  private:
+    /// Root directory.
+    std::string root_;
+    /// Files mapped with map.
+    std::vector<Mapping> mappings_;
+    /// Pool of streams.
+    Pool<HostFSStream, CONFIG_UCOO_ARCH_HOST_FS_STREAMS> pool_;
+};
+
+} // namespace ucoo
+
+#endif // ucoo_arch_host_host_fs_hh
@@ -0,0 +1,480 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "host_fs.hh"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ucoo {
+
+/// Translate errno to file system error.
+static FileSystem::Error
+host_fs_error (int err)
+{
+    switch (err)
+    {
+    case ENOENT:
+    case ENOTDIR:
+    case EISDIR:
+        return FileSystem::Error::NO_SUCH_FILE;
+    case ENAMETOOLONG:
+        return FileSystem::Error::NAME_TOO_LONG;
+    case EMFILE:
+    case ENFILE:
+        return FileSystem::Error::TOO_MANY_OPEN_FILES;
+    case ENOSPC:
+    case EDQUOT:
+        return FileSystem::Error::NO_SPACE_LEFT;
+    case EROFS:
+        return FileSystem::Error::READ_ONLY;
+    default:
+        return FileSystem::Error::ACCESS_DENIED;
+    }
+}
+
+/// Create a hidden temporary file next to PATH, store its path in TMP.
+/// Return file descriptor or -1 on error.
+static int
+host_fs_mkstemp (const std::string &path, std::string &tmp)
+{
+    std::string::size_type slash = path.rfind ('/');
+    tmp = path.substr (0, slash + 1) + '.' + path.substr (slash + 1)
+        + ".XXXXXX";
+    int fd = mkstemp (&tmp[0]);
+    if (fd != -1)
+        fchmod (fd, 0644);
+    return fd;
+}
+
+HostFS::HostFSStream::HostFSStream (const char *begin, int size)
+    : data_ (begin), pos_ (0), size_ (size), fd_ (-1), error_ (false),
+      buffered_ (0)
+{
+}
+
+HostFS::HostFSStream::HostFSStream (int fd, const std::string &tmp_path,
+                                    const std::string &path)
+    : data_ (nullptr), pos_ (0), size_ (0), fd_ (fd), tmp_path_ (tmp_path),
+      path_ (path), error_ (false), buffered_ (0)
+{
+}
+
+HostFS::HostFSStream::~HostFSStream ()
+{
+    if (fd_ != -1)
+    {
+        ::close (fd_);
+        if (!tmp_path_.empty ())
+            ::unlink (tmp_path_.c_str ());
+    }
+    else if (size_)
+        munmap (const_cast<char *> (data_), size_);
+}
+
+int
+HostFS::HostFSStream::read (char *buf, int count)
+{
+    if (fd_ != -1)
+        return -1;
+    int l = std::min (count, size_ - pos_);
+    if (!l)
+        return -2;
+    std::memcpy (buf, data_ + pos_, l);
+    pos_ += l;
+    return l;
+}
+
+int
+HostFS::HostFSStream::write (const char *buf, int count)
+{
+    if (fd_ == -1 || error_)
+        return -1;
+    if (!count)
+        return 0;
+    if (tmp_path_.empty () && !reopen ())
+        return -1;
+    int done = 0;
+    while (done < count)
+    {
+        if (!buffered_ && count - done >= static_cast<int> (sizeof (buf_)))
+        {
+            // Large write, no need to copy to buffer.
+            int r = ::write (fd_, buf + done, count - done);
+            if (r <= 0)
+            {
+                if (r == -1 && errno == EINTR)
+                    continue;
+                error_ = true;
+                break;
+            }
+            done += r;
+        }
+        else
+        {
+            int l = std::min<int> (count - done, sizeof (buf_) - buffered_);
+            std::memcpy (buf_ + buffered_, buf + done, l);
+            buffered_ += l;
+            done += l;
+            if (buffered_ == sizeof (buf_) && !write_buffer ())
+                break;
+        }
+    }
+    if (error_)
+        return -1;
+    pos_ += done;
+    return done;
+}
+
+int
+HostFS::HostFSStream::poll ()
+{
+    return fd_ != -1 ? 0 : size_ - pos_;
+}
+
+int
+HostFS::HostFSStream::seek (int offset, Whence whence/*SET*/)
+{
+    if (fd_ != -1)
+        return offset == 0 && whence == Whence::CUR ? pos_ : -1;
+    int origin;
+    switch (whence)
+    {
+    case Whence::SET:
+        origin = 0;
+        break;
+    case Whence::CUR:
+        origin = pos_;
+        break;
+    case Whence::END:
+        origin = size_;
+        break;
+    default:
+        assert_unreachable ();
+    }
+    if (offset < -origin || offset > size_ - origin)
+        return -1;
+    pos_ = origin + offset;
+    return pos_;
+}
+
+int
+HostFS::HostFSStream::size ()
+{
+    return fd_ != -1 ? pos_ : size_;
+}
+
+bool
+HostFS::HostFSStream::flush ()
+{
+    if (fd_ == -1)
+        return true;
+    if (!write_buffer ())
+        return false;
+    if (!tmp_path_.empty ())
+    {
+        if (rename (tmp_path_.c_str (), path_.c_str ()) == -1)
+        {
+            error_ = true;
+            return false;
+        }
+        tmp_path_.clear ();
+    }
+    return true;
+}
+
+bool
+HostFS::HostFSStream::reopen ()
+{
+    std::string tmp;
+    int fd = host_fs_mkstemp (path_, tmp);
+    if (fd == -1)
+    {
+        error_ = true;
+        return false;
+    }
+    int from = fd_;
+    fd_ = fd;
+    tmp_path_ = tmp;
+    // Copy published content, using the empty write buffer.
+    int done = 0;
+    while (!error_ && done < pos_)
+    {
+        int r = pread (from, buf_, std::min<int> (pos_ - done, sizeof (buf_)),
+                       done);
+        if (r > 0)
+        {
+            buffered_ = r;
+            write_buffer ();
+            done += r;
+        }
+        else if (r == 0 || errno != EINTR)
+            error_ = true;
+    }
+    ::close (from);
+    return !error_;
+}
+
+bool
+HostFS::HostFSStream::write_buffer ()
+{
+    int done = 0;
+    while (!error_ && done < buffered_)
+    {
+        int r = ::write (fd_, buf_ + done, buffered_ - done);
+        if (r > 0)
+            done += r;
+        else if (r == 0 || errno != EINTR)
+            error_ = true;
+    }
+    buffered_ = 0;
+    return !error_;
+}
+
+HostFS::HostFS (const char *root)
+    : root_ (root)
+{
+    if (root_.empty () || root_.back () != '/')
+        root_ += '/';
+}
+
+HostFS::~HostFS ()
+{
+    for (Mapping &m : mappings_)
+    {
+        if (m.size)
+            munmap (const_cast<char *> (m.data), m.size);
+    }
+}
+
+Stream *
+HostFS::open (const char *filename, Mode mode, Error &error)
+{
+    std::string p;
+    if (!path (filename, p, error))
+        return nullptr;
+    HostFSStream *s;
+    if (mode == Mode::READ)
+    {
+        int size;
+        const char *data = map_file (p, size, error);
+        if (!data)
+            return nullptr;
+        s = pool_.construct (data, size);
+        if (!s && size)
+            munmap (const_cast<char *> (data), size);
+    }
+    else
+    {
+        // Write to a hidden temporary file next to the final one.
+        std::string tmp;
+        int fd = host_fs_mkstemp (p, tmp);
+        if (fd == -1)
+        {
+            error = host_fs_error (errno);
+            return nullptr;
+        }
+        s = pool_.construct (fd, tmp, p);
+        if (!s)
+        {
+            ::close (fd);
+            ::unlink (tmp.c_str ());
+        }
+    }
+    if (!s)
+        error = Error::TOO_MANY_OPEN_FILES;
+    return s;
+}
+
+void
+HostFS::close (Stream *file)
+{
+    HostFSStream *s = static_cast<HostFSStream *> (file);
+    s->flush ();
+    pool_.destroy (s);
+}
+
+const char *
+HostFS::map (const char *filename, int &size, Error &error)
+{
+    std::string p;
+    if (!path (filename, p, error))
+        return nullptr;
+    struct stat st;
+    if (::stat (p.c_str (), &st) == -1)
+    {
+        error = host_fs_error (errno);
+        return nullptr;
+    }
+    // Reuse mapping if the file was not replaced.  Previous mappings are
+    // kept, as content must stay available.
+    for (const Mapping &m : mappings_)
+    {
+        if (m.filename == filename && m.dev == st.st_dev
+            && m.ino == st.st_ino && m.size == st.st_size)
+        {
+            size = m.size;
+            return m.data;
+        }
+    }
+    const char *data = map_file (p, size, error);
+    if (data)
+        mappings_.push_back (Mapping { filename, st.st_dev, st.st_ino, data,
+                                       size });
+    return data;
+}
+
+bool
+HostFS::stat (const char *filename, Stat &stat, Error &error)
+{
+    std::string p;
+    if (!path (filename, p, error))
+        return false;
+    struct stat st;
+    if (::stat (p.c_str (), &st) == -1)
+    {
+        error = host_fs_error (errno);
+        return false;
+    }
+    if (!S_ISREG (st.st_mode))
+    {
+        error = Error::NO_SUCH_FILE;
+        return false;
+    }
+    stat.size = st.st_size;
+    return true;
+}
+
+int
+HostFS::list (const char *prefix, const ListCallback &callback)
+{
+    DIR *dir = opendir (root_.c_str ());
+    if (!dir)
+        return -1;
+    int prefix_size = std::strlen (prefix);
+    std::vector<std::string> names;
+    struct dirent *de;
+    while ((de = readdir (dir)))
+    {
+        if (de->d_name[0] == '.'
+            || std::strncmp (de->d_name, prefix, prefix_size) != 0)
+            continue;
+        struct stat st;
+        std::string p = root_ + de->d_name;
+        if (::stat (p.c_str (), &st) == -1 || !S_ISREG (st.st_mode))
+            continue;
+        names.push_back (de->d_name);
+    }
+    closedir (dir);
+    std::sort (names.begin (), names.end ());
+    int listed = 0;
+    for (const std::string &name : names)
+    {
+        listed++;
+        if (!callback (name.data (), name.size ()))
+            break;
+    }
+    return listed;
+}
+
+void
+HostFS::unlink (const char *filename)
+{
+    std::string p;
+    Error error;
+    if (path (filename, p, error))
+        ::unlink (p.c_str ());
+}
+
+const char *
+HostFS::peek (Stream *file, int &count)
+{
+    HostFSStream *s = static_cast<HostFSStream *> (file);
+    assert (s->fd_ == -1);
+    count = s->size_ - s->pos_;
+    return count ? s->data_ + s->pos_ : nullptr;
+}
+
+bool
+HostFS::path (const char *filename, std::string &path, Error &error) const
+{
+    // Refuse absolute names and parent directory components.
+    const char *c = filename;
+    if (*c == '/' || !*c)
+    {
+        error = Error::ACCESS_DENIED;
+        return false;
+    }
+    while (*c)
+    {
+        const char *e = std::strchr (c, '/');
+        int l = e ? e - c : std::strlen (c);
+        if (l == 2 && c[0] == '.' && c[1] == '.')
+        {
+            error = Error::ACCESS_DENIED;
+            return false;
+        }
+        c += e ? l + 1 : l;
+    }
+    path = root_ + filename;
+    return true;
+}
+
+const char *
+HostFS::map_file (const std::string &path, int &size, Error &error)
+{
+    int fd = ::open (path.c_str (), O_RDONLY);
+    if (fd == -1)
+    {
+        error = host_fs_error (errno);
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat (fd, &st) == -1 || !S_ISREG (st.st_mode))
+    {
+        error = Error::NO_SUCH_FILE;
+        ::close (fd);
+        return nullptr;
+    }
+    size = st.st_size;
+    const char *data = "";
+    if (size)
+    {
+        void *m = mmap (nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        data = m == MAP_FAILED ? nullptr : static_cast<const char *> (m);
+        if (!data)
+            error = host_fs_error (errno);
+    }
+    ::close (fd);
+    return data;
+}
+
+} // namespace ucoo
@@ -34,6 +34,9 @@ class HostStream : public Stream
     HostStream ();
     /// PTY constructor, will make a link to PTY at the given name.
     HostStream (const char *name);
+    /// File descriptors constructor, use the given input and output file
+    /// descriptors, which are closed on destruction.
+    HostStream (int fdi, int fdo);
     /// Close if needed.
     ~HostStream ();
     /// See Stream::block.
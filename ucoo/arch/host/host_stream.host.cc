@@ -81,6 +81,11 @@ HostStream::HostStream (const char *name)
     // slave_fd is left open.
 }
 
+HostStream::HostStream (int fdi, int fdo)
+    : fdi_ (fdi), fdo_ (fdo)
+{
+}
+
 HostStream::~HostStream ()
 {
     if (fdi_ != -1 && fdi_ != 0)
@@ -27,6 +27,8 @@
 
 #include "ucoo/arch/host/mex/mex.hh"
 
+#include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace ucoo {
@@ -37,6 +39,57 @@ class MsgPoper;
 class MsgReader;
 class MsgWriter;
 
+/// Message argument traits, for integer types of up to 32 bits, transmitted
+/// in big endian.
+template<typename T>
+struct MsgArg
+{
+    static_assert (std::is_integral<T>::value && sizeof (T) <= 4,
+                   "unsupported message argument type");
+    typedef T type;
+    typedef typename std::make_unsigned<T>::type utype;
+    static const int size = sizeof (T);
+    /// Encode V to P, using a single store.
+    static void encode (char *p, T v);
+    /// Decode from P, using a single load.
+    static T decode (const char *p);
+};
+
+/// Layout of a list of message arguments.
+template<typename... T>
+struct MsgLayout;
+
+template<>
+struct MsgLayout<>
+{
+    /// Total size in bytes.
+    static const int size = 0;
+    /// Encode nothing.
+    static void encode (char *p) { }
+    /// Decode nothing.
+    static std::tuple<> decode (const char *p) { return std::tuple<> (); }
+};
+
+template<typename T0, typename... T>
+struct MsgLayout<T0, T...>
+{
+    /// Total size in bytes.
+    static const int size = MsgArg<T0>::size + MsgLayout<T...>::size;
+    /// Encode V0 and VALUES to P.
+    static void encode (char *p, T0 v0, T... values)
+    {
+        MsgArg<T0>::encode (p, v0);
+        MsgLayout<T...>::encode (p + MsgArg<T0>::size, values...);
+    }
+    /// Decode values from P.
+    static std::tuple<T0, T...> decode (const char *p)
+    {
+        return std::tuple_cat (
+            std::make_tuple (MsgArg<T0>::decode (p)),
+            MsgLayout<T...>::decode (p + MsgArg<T0>::size));
+    }
+};
+
 /// Mex message.
 ///
 /// Format used for payload push and pop:
@@ -44,6 +97,18 @@ class MsgWriter;
 ///  - h: 16 bits.
 ///  - l: 32 bits.
 /// Uppercase is used for unsigned.
+///
+/// When the layout is known at compile time, the template push and pop are
+/// faster, for example:
+///
+///   msg.push<uint8_t, uint16_t, int32_t> (a, b, c);
+///   std::tie (a, b, c) = msg.pop<uint8_t, uint16_t, int32_t> ();
+///
+/// They use the same wire format as "BHl".
+///
+/// Payload buffers are taken from a pool of free buffers and given back on
+/// destruction, keeping their capacity, so that no allocation is done once
+/// enough buffers are in the pool.  Messages can be moved but not copied.
 class Msg
 {
   public:
@@ -51,6 +116,17 @@ class Msg
     explicit Msg (mtype_t mtype);
     /// Read a new message.
     explicit Msg (MsgReader &reader);
+    /// Move constructor, OTHER is left without payload buffer.
+    Msg (Msg &&other);
+    /// Move assignment, buffers are exchanged so that the replaced one goes
+    /// back to the pool when OTHER is destroyed.
+    Msg &operator= (Msg &&other);
+    Msg (const Msg &) = delete;
+    Msg &operator= (const Msg &) = delete;
+    /// Destructor, give buffer back to the pool.
+    ~Msg ();
+    /// Start a new message with the given MTYPE, reusing the buffer.
+    void reset (mtype_t mtype);
     /// Write a message.
     void write (MsgWriter &writer);
     /// Add data to the message payload.  FMT string describes the provided
@@ -59,6 +135,10 @@ class Msg
     MsgPusher push (const char *fmt);
     /// Add data to the message payload from a buffer.
     void push (const char *buffer, int size);
+    /// Add VALUES to the message payload, with a layout given by template
+    /// arguments, resolved at compile time.
+    template<typename... T>
+    void push (typename MsgArg<T>::type... values);
     /// Extract data from the message payload.  FMT string describes the
     /// requested data.  Return a poper which will do the actual pop, using
     /// the operator>>.
@@ -66,10 +146,18 @@ class Msg
     /// Pop buffer of given size.  Data is kept valid as long as this object
     /// is alive.
     const char *pop (int size);
+    /// Extract data from the message payload, with a layout given by
+    /// template arguments, resolved at compile time.
+    template<typename... T>
+    std::tuple<T...> pop ();
     /// Encapsulate a message in another one, adding header data.  Return a
     /// pusher which will do the actual header data push, using the
     /// operator<<.
     MsgPusher encapsulate (mtype_t mtype, const char *fmt);
+    /// Encapsulate a message in another one, adding header VALUES with a
+    /// layout given by template arguments.
+    template<typename... T>
+    void encapsulate (mtype_t mtype, typename MsgArg<T>::type... values);
     /// Decapsulate a message from payload.  The current payload becomes the
     /// full message.
     void decapsulate ();
@@ -145,4 +233,6 @@ class MsgWriter
 } // namespace mex
 } // namespace ucoo
 
+#include "ucoo/arch/host/mex/mex_msg.tcc"
+
 #endif // ucoo_arch_host_mex_mex_msg_hh
@@ -24,11 +24,41 @@
 #define __STDC_LIMIT_MACROS 1
 #include "mex_msg.hh"
 
+#include "config/ucoo/arch/host/mex.hh"
+
 namespace ucoo {
 namespace mex {
 
 const int default_head_skip = 3;
 
+/// Free payload buffers, cleared but with their capacity kept.
+static std::vector<char> msg_buffers[CONFIG_UCOO_ARCH_HOST_MEX_FREE_BUFFERS];
+
+/// Number of free buffers.
+static int msg_buffers_nb;
+
+/// Take a buffer from the pool, or prepare a new one.
+static void
+msg_buffer_get (std::vector<char> &payload)
+{
+    if (msg_buffers_nb)
+        payload.swap (msg_buffers[--msg_buffers_nb]);
+    else
+        payload.reserve (CONFIG_UCOO_ARCH_HOST_MEX_BUFFER_SIZE);
+}
+
+/// Give a buffer back to the pool, if it has one and there is room left.
+static void
+msg_buffer_put (std::vector<char> &payload)
+{
+    if (payload.capacity ()
+        && msg_buffers_nb < CONFIG_UCOO_ARCH_HOST_MEX_FREE_BUFFERS)
+    {
+        payload.clear ();
+        payload.swap (msg_buffers[msg_buffers_nb++]);
+    }
+}
+
 /// Compute needed size to store given format.
 static int
 calcsize (const char *fmt)
@@ -59,6 +89,7 @@ Msg::Msg (mtype_t mtype)
     : head_skip_ (default_head_skip),
       mtype_ (mtype)
 {
+    msg_buffer_get (payload_);
     payload_.resize (head_skip_);
 }
 
@@ -66,12 +97,44 @@ Msg::Msg (MsgReader &reader)
     : head_skip_ (default_head_skip),
       mtype_ (MTYPE_IDLE)
 {
+    msg_buffer_get (payload_);
     int size = reader.size ();
     payload_.resize (head_skip_ - 1 + size);
     reader.read (&payload_.front () + head_skip_ - 1);
     mtype_ = static_cast<mtype_t> (payload_[head_skip_ - 1]);
 }
 
+Msg::Msg (Msg &&other)
+    : payload_ (std::move (other.payload_)),
+      head_skip_ (other.head_skip_),
+      mtype_ (other.mtype_)
+{
+}
+
+Msg &
+Msg::operator= (Msg &&other)
+{
+    payload_.swap (other.payload_);
+    head_skip_ = other.head_skip_;
+    mtype_ = other.mtype_;
+    return *this;
+}
+
+Msg::~Msg ()
+{
+    msg_buffer_put (payload_);
+}
+
+void
+Msg::reset (mtype_t mtype)
+{
+    head_skip_ = default_head_skip;
+    mtype_ = mtype;
+    if (!payload_.capacity ())
+        msg_buffer_get (payload_);
+    payload_.resize (head_skip_);
+}
+
 void
 Msg::write (MsgWriter &writer)
 {
@@ -0,0 +1,89 @@
+#ifndef ucoo_arch_host_mex_mex_msg_tcc
+#define ucoo_arch_host_mex_mex_msg_tcc
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include <cstring>
+
+#include <endian.h>
+
+namespace ucoo {
+namespace mex {
+
+/// Convert to big endian, or back, for each supported size.
+inline uint8_t msg_arg_swap (uint8_t v) { return v; }
+inline uint16_t msg_arg_swap (uint16_t v) { return htobe16 (v); }
+inline uint32_t msg_arg_swap (uint32_t v) { return htobe32 (v); }
+
+template<typename T>
+inline void
+MsgArg<T>::encode (char *p, T v)
+{
+    utype u = msg_arg_swap (static_cast<utype> (v));
+    std::memcpy (p, &u, sizeof (u));
+}
+
+template<typename T>
+inline T
+MsgArg<T>::decode (const char *p)
+{
+    utype u;
+    std::memcpy (&u, p, sizeof (u));
+    return static_cast<T> (msg_arg_swap (u));
+}
+
+template<typename... T>
+inline void
+Msg::push (typename MsgArg<T>::type... values)
+{
+    int push_index = payload_.size ();
+    payload_.resize (push_index + MsgLayout<T...>::size);
+    MsgLayout<T...>::encode (&payload_[push_index], values...);
+}
+
+template<typename... T>
+inline std::tuple<T...>
+Msg::pop ()
+{
+    assert (MsgLayout<T...>::size <= len ());
+    int pop_index = head_skip_;
+    head_skip_ += MsgLayout<T...>::size;
+    return MsgLayout<T...>::decode (&payload_[pop_index]);
+}
+
+template<typename... T>
+inline void
+Msg::encapsulate (mtype_t mtype, typename MsgArg<T>::type... values)
+{
+    int head_size = MsgLayout<T...>::size + 1;
+    assert (head_size <= head_skip_);
+    payload_[head_skip_ - 1] = static_cast<int> (mtype_);
+    mtype_ = mtype;
+    head_skip_ -= head_size;
+    MsgLayout<T...>::encode (&payload_[head_skip_], values...);
+}
+
+} // namespace mex
+} // namespace ucoo
+
+#endif // ucoo_arch_host_mex_mex_msg_tcc
@@ -25,12 +25,12 @@
 // }}}
 #include "ucoo/common.hh"
 #include "mex_msg.hh"
-#include "mex_socket.hh"
+#include "mex_transport.hh"
+#include "ucoo/utils/function.hh"
 
 #include <memory>
-#include <map>
 #include <string>
-#include <tr1/functional>
+#include <type_traits>
 
 namespace ucoo {
 namespace mex {
@@ -40,33 +40,70 @@ class Node
 {
   public:
     /// Message handler type.
-    typedef std::tr1::function<void (Node &, Msg &)> Handler;
+    typedef Function<void (Node &, Msg &)> Handler;
+    /// Message handler type, without Node parameter.
+    typedef Function<void (Msg &)> MsgHandler;
   public:
-    /// Connect to mex hub.
-    Node ();
+    /// Connect to mex hub at ADDRESS, see Transport::connect.
+    explicit Node (const std::string &address = std::string ());
     /// Wait forever.
     void wait ();
-    /// Wait until date is reached.
+    /// Wait until date is reached.  All received messages are handled
+    /// before signaling IDLE state again, which is done once for all of
+    /// them.
     void wait (uint32_t date);
     /// Return current date.
     uint32_t date () const { return date_; }
-    /// Send a message.
+    /// Get connection to hub, for statistics.
+    const Transport &get_transport () const { return *transport_; }
+    /// Send a message.  Messages may be buffered until the node waits for
+    /// the hub.
     void send (Msg &msg);
-    /// Send a request and return response.
-    std::auto_ptr<Msg> request (Msg &msg);
+    /// Send a request and return response.  Other messages are dispatched
+    /// while waiting.
+    Msg request (Msg &msg);
+    /// Send a request without waiting for its response.  HANDLER is called
+    /// with the response once received, while the node is waiting.
+    /// Several requests can be in flight, responses are matched using the
+    /// request identifier and can come in any order.  Return request
+    /// identifier.
+    int request_async (Msg &msg, const Handler &handler);
+    /// Send a request without waiting, without Node parameter.
+    int request_async (Msg &msg, const MsgHandler &handler);
+    /// Send a request without waiting, member function version.
+    template<class T>
+    int request_async (Msg &msg, T &obj, void (T::*handler) (Node &, Msg &))
+    {
+        return request_async (msg, Handler (&obj, handler));
+    }
+    /// Send a request without waiting, member function version, without
+    /// Node parameter.
+    template<class T>
+    int request_async (Msg &msg, T &obj, void (T::*handler) (Msg &))
+    {
+        return request_async (msg, MsgHandler (&obj, handler));
+    }
+    /// Test whether request REQ is still waiting for its response.
+    bool request_pending (int req) const { return requests_[req].pending; }
+    /// Wait until the response to request REQ is handled, other messages
+    /// are dispatched while waiting.  The identifier can be reused for
+    /// another request once the response is handled.
+    void request_wait (int req);
     /// Send a response while handling a request.
     void response (Msg &msg);
     /// Reserve a message type.
     mtype_t reserve (const std::string &name);
-    /// Register a handler for a message type.
-    void handler_register (mtype_t mtype, Handler handler);
+    /// Register a handler for a message type.  Only one handler can be
+    /// registered for a given message type.
+    void handler_register (mtype_t mtype, const Handler &handler);
+    /// Register a handler for a message type, without Node parameter.
+    void handler_register (mtype_t mtype, const MsgHandler &handler);
     /// Register a handler for a message type, member function version.
     template<class T>
     void handler_register (mtype_t mtype, T &obj,
                            void (T::*handler) (Node &, Msg &))
     {
-        using namespace std::tr1::placeholders;
-        handler_register (mtype, std::tr1::bind (handler, &obj, _1, _2));
+        handler_register (mtype, Handler (&obj, handler));
     }
     /// Register a handler for a message type, member function version,
     /// without Node parameter.
@@ -74,28 +111,75 @@ class Node
     void handler_register (mtype_t mtype, T &obj,
                            void (T::*handler) (Msg &))
     {
-        using namespace std::tr1::placeholders;
-        handler_register (mtype, std::tr1::bind (handler, &obj, _2));
+        handler_register (mtype, MsgHandler (&obj, handler));
     }
+    /// Dispatch message to its registered handler, if any, as if it was
+    /// received from the hub.
+    void dispatch (Msg &msg);
   private:
     /// Receive one message.
-    std::auto_ptr<Msg> recv ();
-    /// Dispatch message to the right handler.
-    void dispatch (Msg &msg);
+    Msg recv ();
     /// Handle an incomming DATE message.
     void handle_date (Msg &msg);
     /// Handle an incomming REQ message.
     void handle_req (Msg &msg);
+    /// Handle an incomming RSP message.
+    void handle_rsp (Msg &msg);
+    /// Allocate a request identifier.
+    int request_alloc ();
+    /// Send request using allocated identifier.
+    void request_send (int req, Msg &msg);
+  private:
+    /// Registered handler.
+    struct Slot
+    {
+        /// Call handler, or nullptr if not registered.
+        void (*call) (const Slot &slot, Node &node, Msg &msg);
+        /// Handler, real type depends on call.
+        std::aligned_storage<sizeof (Handler), alignof (Handler)>::type
+            handler;
+    };
+    /// Request in flight.
+    struct Request
+    {
+        /// Whether the response is still expected.
+        bool pending;
+        /// Where to store the response of a synchronous request, or
+        /// nullptr.
+        Msg *rsp;
+        /// Handler to call with the response, if no storage is given.
+        Slot handler;
+    };
+    /// Number of possible message types.
+    static const int mtypes_nb = 256;
+    /// Number of possible request identifiers.
+    static const int requests_nb = 256;
+  private:
+    /// Store a Handler in a slot.
+    static void slot_set (Slot &slot, const Handler &handler);
+    /// Store a MsgHandler in a slot.
+    static void slot_set (Slot &slot, const MsgHandler &handler);
+    /// Call a Handler.
+    static void call_handler (const Slot &slot, Node &node, Msg &msg);
+    /// Call a MsgHandler.
+    static void call_msg_handler (const Slot &slot, Node &node, Msg &msg);
   private:
     /// Connection to hub.
-    Socket socket_;
+    std::unique_ptr<Transport> transport_;
+    /// IDLE message, reused for each wait loop.
+    Msg idle_;
     /// Current date.
     uint32_t date_;
-    /// When handling a request, this is the request identifier, else -1.
+    /// When handling a request, this is the identifier of the request to
+    /// respond to, else -1.
     int req_;
-    /// Registered handlers.
-    typedef std::map<mtype_t, Handler> Handlers;
-    Handlers handlers_;
+    /// Registered handlers, indexed by message type.
+    Slot handlers_[mtypes_nb];
+    /// Requests, indexed by identifier.
+    Request requests_[requests_nb];
+    /// Next request identifier to try, identifiers are used in turn to
+    /// make late responses easier to spot.
+    int requests_next_;
 };
 
 } // namespace mex
@@ -24,27 +24,32 @@
 #include "mex_node.hh"
 
 #include <cstring>
+#include <new>
 
 namespace ucoo {
 namespace mex {
 
-Node::Node ()
-    : date_ (0),
-      req_ (-1)
+Node::Node (const std::string &address/*""*/)
+    : transport_ (Transport::connect (address)),
+      idle_ (MTYPE_IDLE),
+      date_ (0),
+      req_ (-1),
+      handlers_ (),
+      requests_ (),
+      requests_next_ (0)
 {
-    // Connect.
-    socket_.connect ();
     // Setup default handlers.
     handler_register (MTYPE_DATE, *this, &Node::handle_date);
     handler_register (MTYPE_REQ, *this, &Node::handle_req);
+    handler_register (MTYPE_RSP, *this, &Node::handle_rsp);
     // Synchronise with the hub.
     bool sync = false;
     while (!sync)
     {
-        std::auto_ptr<Msg> msg = recv ();
-        if (msg->mtype () == MTYPE_DATE)
+        Msg msg = recv ();
+        if (msg.mtype () == MTYPE_DATE)
             sync = true;
-        dispatch (*msg);
+        dispatch (msg);
     }
 }
 
@@ -54,11 +59,15 @@ Node::wait ()
     while (1)
     {
         // Signal IDLE state.
-        Msg idle (MTYPE_IDLE);
-        send (idle);
-        // Receive and dispatch messages.
-        std::auto_ptr<Msg> msg = recv ();
-        dispatch (*msg);
+        idle_.reset (MTYPE_IDLE);
+        send (idle_);
+        // Receive and dispatch messages, the hub knows which ones were
+        // handled from the sequence number.
+        do
+        {
+            Msg msg = recv ();
+            dispatch (msg);
+        } while (transport_->pending ());
     }
 }
 
@@ -68,46 +77,70 @@ Node::wait (uint32_t date)
     while (date_ != date)
     {
         // Signal IDLE state.
-        Msg idle (MTYPE_IDLE);
-        idle.push ("L") << date;
-        send (idle);
-        // Receive and dispatch messages.
-        std::auto_ptr<Msg> msg = recv ();
-        dispatch (*msg);
+        idle_.reset (MTYPE_IDLE);
+        idle_.push<uint32_t> (date);
+        send (idle_);
+        // Receive and dispatch messages, the hub knows which ones were
+        // handled from the sequence number.
+        do
+        {
+            Msg msg = recv ();
+            dispatch (msg);
+        } while (date_ != date && transport_->pending ());
     }
 }
 
 void
 Node::send (Msg &msg)
 {
-    msg.write (socket_);
+    msg.write (*transport_);
 }
 
-std::auto_ptr<Msg>
+Msg
 Node::request (Msg &msg)
 {
-    // Send request.
-    msg.encapsulate (MTYPE_REQ, "B") << 0;
-    send (msg);
-    // Wait for response.
-    std::auto_ptr<Msg> rsp;
-    rsp = recv ();
-    while (rsp->mtype () != MTYPE_RSP)
+    Msg rsp (MTYPE_RSP);
+    int req = request_alloc ();
+    requests_[req].rsp = &rsp;
+    request_send (req, msg);
+    request_wait (req);
+    return rsp;
+}
+
+int
+Node::request_async (Msg &msg, const Handler &handler)
+{
+    int req = request_alloc ();
+    slot_set (requests_[req].handler, handler);
+    request_send (req, msg);
+    return req;
+}
+
+int
+Node::request_async (Msg &msg, const MsgHandler &handler)
+{
+    int req = request_alloc ();
+    slot_set (requests_[req].handler, handler);
+    request_send (req, msg);
+    return req;
+}
+
+void
+Node::request_wait (int req)
+{
+    assert (req >= 0 && req < requests_nb);
+    while (requests_[req].pending)
     {
-        dispatch (*rsp);
-        rsp = recv ();
+        Msg msg = recv ();
+        dispatch (msg);
     }
-    // Eat unused request identifier.
-    rsp->pop ("B");
-    rsp->decapsulate ();
-    return rsp;
 }
 
 void
 Node::response (Msg &msg)
 {
     assert (req_ != -1);
-    msg.encapsulate (MTYPE_RSP, "B") << req_;
+    msg.encapsulate<uint8_t> (MTYPE_RSP, req_);
     send (msg);
     req_ = -1;
 }
@@ -120,54 +153,137 @@ Node::reserve (const std::string &name)
     msg.push (name.data (), name.size ());
     send (msg);
     // Wait for response.
-    std::auto_ptr<Msg> rsp;
-    rsp = recv ();
-    while (rsp->mtype () != MTYPE_RES)
+    Msg rsp = recv ();
+    while (rsp.mtype () != MTYPE_RES)
     {
-        dispatch (*rsp);
+        dispatch (rsp);
         rsp = recv ();
     }
     // Return allocated message type.
-    int mtype;
-    rsp->pop ("B") >> mtype;
-    return static_cast<mtype_t> (mtype);
+    return static_cast<mtype_t> (std::get<0> (rsp.pop<uint8_t> ()));
+}
+
+void
+Node::handler_register (mtype_t mtype, const Handler &handler)
+{
+    Slot &slot = handlers_[mtype];
+    assert (!slot.call);
+    slot_set (slot, handler);
 }
 
 void
-Node::handler_register (mtype_t mtype, Handler handler)
+Node::handler_register (mtype_t mtype, const MsgHandler &handler)
 {
-    std::pair<Handlers::iterator, bool> r =
-        handlers_.insert (Handlers::value_type (mtype, handler));
-    assert (r.second);
+    Slot &slot = handlers_[mtype];
+    assert (!slot.call);
+    slot_set (slot, handler);
 }
 
-std::auto_ptr<Msg>
+Msg
 Node::recv ()
 {
-    return std::auto_ptr<Msg> (new Msg (socket_));
+    return Msg (*transport_);
 }
 
 void
 Node::dispatch (Msg &msg)
 {
-    Handlers::const_iterator it = handlers_.find (msg.mtype ());
-    if (it != handlers_.end ())
-        it->second (*this, msg);
+    const Slot &slot = handlers_[msg.mtype ()];
+    if (slot.call)
+        slot.call (slot, *this, msg);
 }
 
 void
 Node::handle_date (Msg &msg)
 {
-    msg.pop ("L") >> date_;
+    date_ = std::get<0> (msg.pop<uint32_t> ());
 }
 
 void
 Node::handle_req (Msg &msg)
 {
-    msg.pop ("B") >> req_;
+    // Handler may wait for its own requests and handle other requests
+    // meanwhile, restore identifier on return.
+    int outer_req = req_;
+    req_ = std::get<0> (msg.pop<uint8_t> ());
     msg.decapsulate ();
     dispatch (msg);
-    req_ = -1;
+    req_ = outer_req;
+}
+
+void
+Node::handle_rsp (Msg &msg)
+{
+    int req = std::get<0> (msg.pop<uint8_t> ());
+    Request &request = requests_[req];
+    // Ignore unexpected responses.
+    if (!request.pending)
+        return;
+    msg.decapsulate ();
+    request.pending = false;
+    if (request.rsp)
+        *request.rsp = std::move (msg);
+    else
+        request.handler.call (request.handler, *this, msg);
+}
+
+int
+Node::request_alloc ()
+{
+    for (int i = 0; i < requests_nb; i++)
+    {
+        int req = (requests_next_ + i) % requests_nb;
+        Request &request = requests_[req];
+        if (!request.pending)
+        {
+            requests_next_ = (req + 1) % requests_nb;
+            request.pending = true;
+            request.rsp = nullptr;
+            request.handler.call = nullptr;
+            return req;
+        }
+    }
+    // Too many requests in flight.
+    assert_unreachable ();
+}
+
+void
+Node::request_send (int req, Msg &msg)
+{
+    msg.encapsulate<uint8_t> (MTYPE_REQ, req);
+    send (msg);
+}
+
+void
+Node::slot_set (Slot &slot, const Handler &handler)
+{
+    slot.call = &Node::call_handler;
+    new (&slot.handler) Handler (handler);
+}
+
+void
+Node::slot_set (Slot &slot, const MsgHandler &handler)
+{
+    static_assert (sizeof (MsgHandler) == sizeof (Handler),
+                   "handler does not fit");
+    slot.call = &Node::call_msg_handler;
+    new (&slot.handler) MsgHandler (handler);
+}
+
+void
+Node::call_handler (const Slot &slot, Node &node, Msg &msg)
+{
+    const Handler &handler =
+        *reinterpret_cast<const Handler *> (&slot.handler);
+    handler (node, msg);
+}
+
+void
+Node::call_msg_handler (const Slot &slot, Node &, Msg &msg)
+{
+    const MsgHandler &handler =
+        *reinterpret_cast<const MsgHandler *> (&slot.handler);
+    handler (msg);
 }
 
 } // namespace mex
@@ -0,0 +1,87 @@
+#ifndef ucoo_arch_host_mex_mex_ring_hh
+#define ucoo_arch_host_mex_mex_ring_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "mex_transport.hh"
+
+#include <string>
+
+namespace ucoo {
+namespace mex {
+
+struct RingShared;
+struct RingPair;
+
+/// Mex transport using a pair of single producer, single consumer rings in
+/// shared memory, one for each direction.
+///
+/// The hub creates the shared memory and starts the node, which attaches to
+/// it.  A waiting side polls the ring, then yields the processor, then
+/// sleeps on a futex until woken up by the other side.  Messages are stored
+/// in the ring with the same header as on a socket: big endian 16 bit size
+/// and sequence number, followed by message bytes.
+class Ring : public Transport
+{
+  public:
+    /// Default constructor.
+    Ring () : pair_ (nullptr), in_ (nullptr), out_ (nullptr),
+              read_size_ (-1) { }
+    /// Destructor, signal end of connection and unmap.
+    ~Ring ();
+    /// Create shared memory with the given NAME, used on the hub side.
+    void create (const char *name);
+    /// Attach to shared memory with the given NAME, created by the hub.
+    void attach (const char *name);
+    /// See MsgReader::size.
+    int size ();
+    /// See MsgReader::read.
+    void read (char *buf);
+    /// See MsgWriter::write.
+    void write (const char *buf, int count);
+    /// See Transport::pending.
+    bool pending ();
+  private:
+    /// Map shared memory from file descriptor.
+    void map (int fd);
+    /// Wait until COUNT bytes can be read, exit if the other side is gone.
+    void wait_readable (int count);
+    /// Wait until COUNT bytes can be written.
+    void wait_writable (int count);
+    /// Copy COUNT bytes out of the input ring, and release them.
+    void consume (char *buf, int count);
+  private:
+    /// Shared memory, or nullptr if not open.
+    RingPair *pair_;
+    /// Input and output rings.
+    RingShared *in_, *out_;
+    /// Size of the next message to be read, or -1 if not known yet.
+    int read_size_;
+    /// Shared memory name on the hub side, to be removed on destruction.
+    std::string name_;
+};
+
+} // namespace mex
+} // namespace ucoo
+
+#endif // ucoo_arch_host_mex_mex_ring_hh
@@ -0,0 +1,307 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "mex_ring.hh"
+
+#include "ucoo/common.hh"
+
+#include "config/ucoo/arch/host/mex.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace ucoo {
+namespace mex {
+
+static const uint32_t ring_size = CONFIG_UCOO_ARCH_HOST_MEX_RING_SIZE;
+static_assert ((ring_size & (ring_size - 1)) == 0,
+               "ring size must be a power of two");
+static_assert (ring_size >= 0xffff + 3,
+               "ring size too small for the largest message");
+
+/// One direction, shared between processes.  Positions are free running
+/// byte counters, the writer only updates head and the reader only updates
+/// tail, each on its own cache line.  A side about to sleep raises its
+/// waiting flag, the other side then increments the wake counter, used as
+/// futex word, and wakes it up.
+struct RingShared
+{
+    /// Write position.
+    std::atomic<uint32_t> head;
+    /// Set when the reader is about to sleep.
+    std::atomic<uint32_t> reader_waiting;
+    /// Incremented to wake up the reader.
+    std::atomic<uint32_t> reader_wake;
+    /// Set when the writer is gone.
+    std::atomic<uint32_t> closed;
+    char pad0[48];
+    /// Read position.
+    std::atomic<uint32_t> tail;
+    /// Set when the writer is about to sleep.
+    std::atomic<uint32_t> writer_waiting;
+    /// Incremented to wake up the writer.
+    std::atomic<uint32_t> writer_wake;
+    char pad1[52];
+    /// Ring data.
+    char data[ring_size];
+};
+
+/// Shared memory content, zero initialised by creation.
+struct RingPair
+{
+    /// From node to hub.
+    RingShared to_hub;
+    /// From hub to node.
+    RingShared to_node;
+};
+
+static_assert (sizeof (std::atomic<uint32_t>) == sizeof (uint32_t)
+               && ATOMIC_INT_LOCK_FREE == 2,
+               "atomic can not be used as futex word");
+
+/// Sleep while the futex word is VAL.
+static void
+ring_futex_wait (std::atomic<uint32_t> &word, uint32_t val)
+{
+    syscall (SYS_futex, reinterpret_cast<uint32_t *> (&word), FUTEX_WAIT,
+             val, nullptr, nullptr, 0);
+}
+
+/// Wake up the other side if it is sleeping or about to sleep, return the
+/// number of system calls done.
+static int
+ring_wake (std::atomic<uint32_t> &wake, std::atomic<uint32_t> &waiting)
+{
+    if (waiting.load ())
+    {
+        wake.fetch_add (1);
+        syscall (SYS_futex, reinterpret_cast<uint32_t *> (&wake), FUTEX_WAKE,
+                 1, nullptr, nullptr, 0);
+        return 1;
+    }
+    return 0;
+}
+
+/// Hint the processor that we are spinning.
+static inline void
+ring_pause ()
+{
+#if defined (__i386__) || defined (__x86_64__)
+    __builtin_ia32_pause ();
+#else
+    std::atomic_signal_fence (std::memory_order_seq_cst);
+#endif
+}
+
+/// Wait until the CHECK condition is true, polling, then yielding, then
+/// sleeping on WAKE after raising WAITING.  Count system calls in
+/// SYSCALLS.
+template<typename Check>
+static void
+ring_wait (std::atomic<uint32_t> &wake, std::atomic<uint32_t> &waiting,
+           Check check, unsigned &syscalls)
+{
+    for (int i = 0; i < CONFIG_UCOO_ARCH_HOST_MEX_RING_SPIN; i++)
+    {
+        if (check ())
+            return;
+        ring_pause ();
+    }
+    for (int i = 0; i < CONFIG_UCOO_ARCH_HOST_MEX_RING_SPIN; i++)
+    {
+        if (check ())
+            return;
+        sched_yield ();
+        syscalls++;
+    }
+    while (!check ())
+    {
+        uint32_t val = wake.load ();
+        waiting.store (1);
+        if (!check ())
+        {
+            ring_futex_wait (wake, val);
+            syscalls++;
+        }
+        waiting.store (0);
+    }
+}
+
+Ring::~Ring ()
+{
+    if (pair_)
+    {
+        out_->closed.store (1);
+        ring_wake (out_->reader_wake, out_->reader_waiting);
+        munmap (pair_, sizeof (RingPair));
+        if (!name_.empty ())
+            shm_unlink (name_.c_str ());
+    }
+}
+
+void
+Ring::create (const char *name)
+{
+    assert (!pair_);
+    name_ = std::string ("/") + name;
+    int fd = shm_open (name_.c_str (), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    assert_perror (fd != -1);
+    int r = ftruncate (fd, sizeof (RingPair));
+    assert_perror (r != -1);
+    map (fd);
+    in_ = &pair_->to_hub;
+    out_ = &pair_->to_node;
+}
+
+void
+Ring::attach (const char *name)
+{
+    assert (!pair_);
+    std::string shm_name = std::string ("/") + name;
+    int fd = shm_open (shm_name.c_str (), O_RDWR, 0);
+    assert_perror (fd != -1);
+    struct stat st;
+    int r = fstat (fd, &st);
+    assert_perror (r != -1);
+    assert (st.st_size == sizeof (RingPair));
+    map (fd);
+    in_ = &pair_->to_node;
+    out_ = &pair_->to_hub;
+}
+
+int
+Ring::size ()
+{
+    assert (read_size_ == -1);
+    uint8_t header[3];
+    wait_readable (sizeof (header));
+    consume (reinterpret_cast<char *> (header), sizeof (header));
+    read_size_ = (header[0] << 8) | header[1];
+    seq_ = header[2];
+    return read_size_;
+}
+
+void
+Ring::read (char *buf)
+{
+    assert (read_size_ > 0);
+    wait_readable (read_size_);
+    consume (buf, read_size_);
+    read_size_ = -1;
+}
+
+void
+Ring::write (const char *buf, int count)
+{
+    assert (pair_);
+    assert (count > 0 && count <= 0xffff);
+    uint8_t header[3];
+    header[0] = count >> 8;
+    header[1] = count;
+    header[2] = seq_;
+    int total = sizeof (header) + count;
+    assert (total <= (int) ring_size);
+    wait_writable (total);
+    uint32_t head = out_->head.load (std::memory_order_relaxed);
+    const char *parts[] = { reinterpret_cast<const char *> (header), buf };
+    int parts_size[] = { sizeof (header), count };
+    for (int i = 0; i < 2; i++)
+    {
+        uint32_t index = head & (ring_size - 1);
+        int first = std::min<uint32_t> (parts_size[i], ring_size - index);
+        std::memcpy (out_->data + index, parts[i], first);
+        std::memcpy (out_->data, parts[i] + first, parts_size[i] - first);
+        head += parts_size[i];
+    }
+    out_->head.store (head);
+    syscalls_ += ring_wake (out_->reader_wake, out_->reader_waiting);
+}
+
+bool
+Ring::pending ()
+{
+    // Header and message are made visible at once.
+    uint32_t tail = in_->tail.load (std::memory_order_relaxed);
+    return in_->head.load () - tail >= 3;
+}
+
+void
+Ring::map (int fd)
+{
+    void *p = mmap (nullptr, sizeof (RingPair), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+    assert_perror (p != MAP_FAILED);
+    close (fd);
+    pair_ = static_cast<RingPair *> (p);
+}
+
+void
+Ring::wait_readable (int count)
+{
+    uint32_t tail = in_->tail.load (std::memory_order_relaxed);
+    RingShared &in = *in_;
+    auto readable = [&in, tail, count] () {
+        return in.head.load () - tail >= uint32_t (count)
+            || in.closed.load ();
+    };
+    ring_wait (in.reader_wake, in.reader_waiting, readable, syscalls_);
+    // Closed, but there may be data written before.
+    if (in.head.load (std::memory_order_acquire) - tail < uint32_t (count))
+        exit (0);
+}
+
+void
+Ring::wait_writable (int count)
+{
+    uint32_t head = out_->head.load (std::memory_order_relaxed);
+    RingShared &out = *out_;
+    auto writable = [&out, head, count] () {
+        return ring_size - (head - out.tail.load ()) >= uint32_t (count);
+    };
+    ring_wait (out.writer_wake, out.writer_waiting, writable, syscalls_);
+}
+
+void
+Ring::consume (char *buf, int count)
+{
+    uint32_t tail = in_->tail.load (std::memory_order_relaxed);
+    uint32_t index = tail & (ring_size - 1);
+    int first = std::min<uint32_t> (count, ring_size - index);
+    std::memcpy (buf, in_->data + index, first);
+    std::memcpy (buf + first, in_->data, count - first);
+    in_->tail.store (tail + count);
+    syscalls_ += ring_wake (in_->writer_wake, in_->writer_waiting);
+}
+
+} // namespace mex
+} // namespace ucoo
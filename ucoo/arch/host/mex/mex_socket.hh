@@ -23,34 +23,61 @@
 // DEALINGS IN THE SOFTWARE.
 //
 // }}}
-#include "mex_msg.hh"
+#include "mex_transport.hh"
+
+#include <vector>
 
 namespace ucoo {
 namespace mex {
 
-/// Mex socket, able to read and write messages.
-class Socket : public MsgReader, public MsgWriter
+/// Mex socket, able to read and write messages, using TCP or a Unix domain
+/// socket.
+///
+/// Written messages are buffered, and sent with a single system call when
+/// the socket needs to wait for incoming messages, or on flush.  Incoming
+/// data is read as much as available, so that all messages already received
+/// can be handled without further system call.
+class Socket : public Transport
 {
   public:
     /// Default constructor.
-    Socket () : fd_ (-1), read_size_ (-1) { }
-    /// Destructor, close the connection.
+    Socket ();
+    /// Constructor from an already connected socket, used on the hub side.
+    explicit Socket (int fd);
+    /// Destructor, flush and close the connection.
     ~Socket ();
-    /// Connect to Mex hub.
+    /// Connect to Mex hub, using default address from configuration.
     void connect ();
+    /// Connect to Mex hub using TCP.
+    void connect (const char *host, const char *port);
+    /// Connect to Mex hub using a Unix domain socket.
+    void connect_unix (const char *path);
     /// See MsgReader::size.
     int size ();
     /// See MsgReader::read.
     void read (char *buf);
     /// See MsgWriter::write.
     void write (const char *buf, int count);
+    /// See Transport::pending.
+    bool pending ();
+    /// Send buffered messages.
+    void flush ();
+  private:
+    /// Return the size of the message at the start of the input buffer,
+    /// including header, or 0 if not completely received.
+    int in_complete () const;
+    /// Send buffered messages, then wait for more input data.
+    void fill ();
   private:
     /// File descriptor to open socket, or -1 if not open.
     int fd_;
     /// Size of the next message to be read, or -1 if not known yet.
     int read_size_;
-    /// This socket sequence number.
-    int seq_;
+    /// Input buffer, received data is between in_begin_ and in_end_.
+    std::vector<char> in_;
+    int in_begin_, in_end_;
+    /// Output buffer, with messages waiting to be sent.
+    std::vector<char> out_;
 };
 
 } // namespace mex
@@ -29,38 +29,69 @@
 #include "socket.h"
 
 #include <unistd.h>
+#include <cerrno>
 #include <cstdlib>
+#include <cstring>
 
 namespace ucoo {
 namespace mex {
 
+Socket::Socket ()
+    : fd_ (-1), read_size_ (-1),
+      in_ (CONFIG_UCOO_ARCH_HOST_MEX_SOCKET_BUFFER_SIZE), in_begin_ (0),
+      in_end_ (0)
+{
+    out_.reserve (CONFIG_UCOO_ARCH_HOST_MEX_SOCKET_BUFFER_SIZE);
+}
+
+Socket::Socket (int fd)
+    : Socket ()
+{
+    fd_ = fd;
+}
+
 Socket::~Socket ()
 {
     if (fd_ != -1)
+    {
+        flush ();
         close (fd_);
+    }
 }
 
 void
 Socket::connect ()
 {
-    fd_ = socket_client CONFIG_UCOO_ARCH_HOST_MEX_DEFAULT_ADDRESS;
+    connect CONFIG_UCOO_ARCH_HOST_MEX_DEFAULT_ADDRESS;
+}
+
+void
+Socket::connect (const char *host, const char *port)
+{
+    assert (fd_ == -1);
+    fd_ = socket_client (host, port);
+}
+
+void
+Socket::connect_unix (const char *path)
+{
+    assert (fd_ == -1);
+    fd_ = socket_client_unix (path);
 }
 
 int
 Socket::size ()
 {
-    uint8_t header[3];
-    int r = ::read (fd_, header, sizeof (header));
-    assert_perror (r != -1);
-    if (r == 0)
-        exit (0);
-    else
-    {
-        assert (r == sizeof (header));
-        read_size_ = (header[0] << 8) | header[1];
-        seq_ = header[2];
-        return read_size_;
-    }
+    assert (fd_ != -1);
+    assert (read_size_ == -1);
+    while (!in_complete ())
+        fill ();
+    const uint8_t *header =
+        reinterpret_cast<const uint8_t *> (&in_[in_begin_]);
+    read_size_ = (header[0] << 8) | header[1];
+    seq_ = header[2];
+    in_begin_ += 3;
+    return read_size_;
 }
 
 void
@@ -68,9 +99,8 @@ Socket::read (char *buf)
 {
     assert (fd_ != -1);
     assert (read_size_ > 0);
-    int r = ::read (fd_, buf, read_size_);
-    assert_perror (r != -1);
-    assert (r == read_size_);
+    std::memcpy (buf, &in_[in_begin_], read_size_);
+    in_begin_ += read_size_;
     read_size_ = -1;
 }
 
@@ -79,16 +109,78 @@ Socket::write (const char *buf, int count)
 {
     assert (fd_ != -1);
     assert (read_size_ == -1);
-    uint8_t header[3];
+    assert (count <= 0xffff);
+    char header[3];
     header[0] = count >> 8;
     header[1] = count;
     header[2] = seq_;
-    int r = ::write (fd_, header, sizeof (header));
-    assert_perror (r != -1);
-    assert (r == sizeof (header));
-    r = ::write (fd_, buf, count);
+    out_.insert (out_.end (), header, header + sizeof (header));
+    out_.insert (out_.end (), buf, buf + count);
+}
+
+bool
+Socket::pending ()
+{
+    return in_complete ();
+}
+
+void
+Socket::flush ()
+{
+    int done = 0;
+    int size = out_.size ();
+    while (done < size)
+    {
+        int r = ::write (fd_, &out_[done], size - done);
+        syscalls_++;
+        if (r == -1 && errno == EINTR)
+            continue;
+        assert_perror (r != -1);
+        done += r;
+    }
+    out_.clear ();
+}
+
+int
+Socket::in_complete () const
+{
+    int available = in_end_ - in_begin_;
+    if (available < 3)
+        return 0;
+    const uint8_t *header =
+        reinterpret_cast<const uint8_t *> (&in_[in_begin_]);
+    int size = 3 + ((header[0] << 8) | header[1]);
+    return available >= size ? size : 0;
+}
+
+void
+Socket::fill ()
+{
+    // Nothing will come until buffered messages are sent.
+    flush ();
+    // Make room, keeping the partial message.
+    int available = in_end_ - in_begin_;
+    if (in_begin_)
+    {
+        std::memmove (&in_[0], &in_[in_begin_], available);
+        in_begin_ = 0;
+        in_end_ = available;
+    }
+    if (available >= 3)
+    {
+        const uint8_t *header = reinterpret_cast<const uint8_t *> (&in_[0]);
+        int size = 3 + ((header[0] << 8) | header[1]);
+        if (size > (int) in_.size ())
+            in_.resize (size);
+    }
+    int r = ::read (fd_, &in_[in_end_], in_.size () - in_end_);
+    syscalls_++;
+    if (r == -1 && errno == EINTR)
+        return;
     assert_perror (r != -1);
-    assert (r == count);
+    if (r == 0)
+        exit (0);
+    in_end_ += r;
 }
 
 } // namespace mex
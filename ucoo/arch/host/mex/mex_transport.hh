@@ -0,0 +1,73 @@
+#ifndef ucoo_arch_host_mex_mex_transport_hh
+#define ucoo_arch_host_mex_mex_transport_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "mex_msg.hh"
+
+#include <memory>
+#include <string>
+
+namespace ucoo {
+namespace mex {
+
+/// Connection to a Mex hub, able to read and write messages.
+///
+/// Each message is sent with a sequence number.  The hub numbers the
+/// messages it sends, and a node sends back the number of the last message
+/// it read, so that the hub knows which messages were handled when it
+/// receives an IDLE message.
+class Transport : public MsgReader, public MsgWriter
+{
+  public:
+    /// Default constructor.
+    Transport () : seq_ (0), syscalls_ (0) { }
+    /// Destructor, close the connection.
+    virtual ~Transport () { }
+    /// Return true if a complete message can be read without blocking.
+    virtual bool pending () = 0;
+    /// Get sequence number of the last read message.
+    int get_seq () const { return seq_; }
+    /// Set sequence number of the next written messages, used on the hub
+    /// side.
+    void set_seq (int seq) { seq_ = seq; }
+    /// Get number of system calls done, for statistics.
+    unsigned get_syscalls () const { return syscalls_; }
+    /// Open a connection to the hub at ADDRESS, which can be:
+    ///  - HOST:PORT or tcp:HOST:PORT, TCP socket,
+    ///  - unix:PATH, Unix domain socket,
+    ///  - shm:NAME, shared memory ring pair, created by the hub.
+    /// When ADDRESS is empty, use default_address from configuration.
+    static std::unique_ptr<Transport> connect (const std::string &address);
+  protected:
+    /// Sequence number of the last read message, used for written
+    /// messages.
+    int seq_;
+    /// Number of system calls done.
+    unsigned syscalls_;
+};
+
+} // namespace mex
+} // namespace ucoo
+
+#endif // ucoo_arch_host_mex_mex_transport_hh
@@ -0,0 +1,67 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "mex_transport.hh"
+#include "mex_socket.hh"
+#include "mex_ring.hh"
+
+namespace ucoo {
+namespace mex {
+
+std::unique_ptr<Transport>
+Transport::connect (const std::string &address)
+{
+    if (address.empty ())
+    {
+        std::unique_ptr<Socket> socket (new Socket);
+        socket->connect ();
+        return socket;
+    }
+    else if (address.compare (0, 5, "unix:") == 0)
+    {
+        std::unique_ptr<Socket> socket (new Socket);
+        socket->connect_unix (address.c_str () + 5);
+        return socket;
+    }
+    else if (address.compare (0, 4, "shm:") == 0)
+    {
+        std::unique_ptr<Ring> ring (new Ring);
+        ring->attach (address.c_str () + 4);
+        return ring;
+    }
+    else
+    {
+        std::string host = address.compare (0, 4, "tcp:") == 0
+            ? address.substr (4) : address;
+        std::string::size_type colon = host.rfind (':');
+        assert (colon != std::string::npos);
+        std::string port = host.substr (colon + 1);
+        host.erase (colon);
+        std::unique_ptr<Socket> socket (new Socket);
+        socket->connect (host.c_str (), port.c_str ());
+        return socket;
+    }
+}
+
+} // namespace mex
+} // namespace ucoo
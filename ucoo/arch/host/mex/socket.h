@@ -32,6 +32,10 @@ extern "C" {
 int
 socket_client (const char *addr, const char *port);
 
+/** Create and connect a Unix domain client socket. */
+int
+socket_client_unix (const char *path);
+
 #ifdef __cplusplus
 }
 #endif
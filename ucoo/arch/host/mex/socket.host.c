@@ -25,8 +25,10 @@
 #include "socket.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/un.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
@@ -86,3 +88,30 @@ socket_client (const char *addr, const char *port)
       }
     return s;
 }
+
+int
+socket_client_unix (const char *path)
+{
+    int s;
+    struct sockaddr_un saddr;
+    if (strlen (path) >= sizeof (saddr.sun_path))
+      {
+	fprintf (stderr, "Path %s too long\n", path);
+	exit (EXIT_FAILURE);
+      }
+    memset (&saddr, 0, sizeof (saddr));
+    saddr.sun_family = AF_UNIX;
+    strcpy (saddr.sun_path, path);
+    s = socket (AF_UNIX, SOCK_STREAM, 0);
+    if (s < 0)
+      {
+	perror ("socket");
+	exit (EXIT_FAILURE);
+      }
+    if (connect (s, (struct sockaddr *) &saddr, sizeof (saddr)) < 0)
+      {
+	perror ("connect");
+	exit (EXIT_FAILURE);
+      }
+    return s;
+}
@@ -0,0 +1,573 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/arch/host/mex/mex_msg.hh"
+#include "ucoo/arch/host/mex/mex_node.hh"
+#include "ucoo/arch/host/mex/mex_ring.hh"
+#include "ucoo/arch/host/mex/mex_socket.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/common.hh"
+
+#include "config/ucoo/arch/host/mex.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace ucoo::mex;
+
+/// Number of heap allocations, to check steady state behaviour.
+static unsigned allocs;
+
+/// Not inlined, else the compiler sees the free and complains about a
+/// mismatched deallocation.
+void operator delete (void *p) noexcept __attribute__ ((noinline));
+
+void *
+operator new (size_t size)
+{
+    allocs++;
+    void *p = std::malloc (size);
+    ucoo::assert (p);
+    return p;
+}
+
+void
+operator delete (void *p) noexcept
+{
+    std::free (p);
+}
+
+/// Reader returning always the same message.
+class RepeatReader : public MsgReader
+{
+  public:
+    template<int count>
+    RepeatReader (const char (&buf)[count])
+        : buf_ (buf), count_ (count) { }
+    int size () { return count_; }
+    void read (char *buf) { std::memcpy (buf, buf_, count_); }
+  private:
+    const char *buf_;
+    int count_;
+};
+
+/// Writer discarding everything.
+class NullWriter : public MsgWriter
+{
+  public:
+    void write (const char *buf, int count) { bytes += count; }
+  public:
+    uint64_t bytes = 0;
+};
+
+/// Number of messages per measure.
+static const int msgs_per_loop = 1000;
+
+/// Report allocations per message.
+static void
+allocs_info (ucoo::Bench &bench, unsigned allocs_start, int msgs)
+{
+    bench.info ("%.2f allocs per message",
+                double (allocs - allocs_start) / msgs);
+}
+
+/// Receive and decode messages, with runtime or compile time layout.
+static void
+bench_recv (ucoo::BenchSuite &bsuite, const char *name, bool typed)
+{
+    ucoo::Bench bench (bsuite, name);
+    static const char buf[] = { 0x20, 1, 0, 2, 0, 0, 0, 3 };
+    RepeatReader reader (buf);
+    uint32_t sum = 0;
+    unsigned allocs_start = allocs;
+    for (int j = 0; j < 64; j++)
+    {
+        uint64_t start = ucoo::bench_time_ns ();
+        for (int i = 0; i < msgs_per_loop; i++)
+        {
+            Msg m (reader);
+            if (typed)
+            {
+                uint8_t a;
+                uint16_t b;
+                uint32_t c;
+                std::tie (a, b, c) = m.pop<uint8_t, uint16_t, uint32_t> ();
+                sum += a + b + c;
+            }
+            else
+            {
+                uint32_t a, b, c;
+                m.pop ("BHL") >> a >> b >> c;
+                sum += a + b + c;
+            }
+        }
+        bench.add (ucoo::bench_time_ns () - start, msgs_per_loop);
+    }
+    allocs_info (bench, allocs_start, 64 * msgs_per_loop);
+    ucoo::assert (sum == 64 * msgs_per_loop * 6);
+}
+
+/// Encode and send messages, with runtime or compile time layout.
+static void
+bench_send (ucoo::BenchSuite &bsuite, const char *name, bool typed)
+{
+    ucoo::Bench bench (bsuite, name);
+    NullWriter writer;
+    unsigned allocs_start = allocs;
+    for (int j = 0; j < 64; j++)
+    {
+        uint64_t start = ucoo::bench_time_ns ();
+        for (int i = 0; i < msgs_per_loop; i++)
+        {
+            Msg m (MTYPE_USER_MIN);
+            if (typed)
+                m.push<uint8_t, uint16_t, uint32_t> (1, i, 3);
+            else
+                m.push ("BHL") << 1 << i << 3;
+            m.write (writer);
+        }
+        bench.add (ucoo::bench_time_ns () - start, msgs_per_loop,
+                   msgs_per_loop * 8);
+    }
+    allocs_info (bench, allocs_start, 64 * msgs_per_loop);
+}
+
+/// Encapsulate and decapsulate messages, as done for requests.
+static void
+bench_encapsulate (ucoo::BenchSuite &bsuite)
+{
+    ucoo::Bench bench (bsuite, "encapsulate");
+    NullWriter writer;
+    unsigned allocs_start = allocs;
+    for (int j = 0; j < 64; j++)
+    {
+        uint64_t start = ucoo::bench_time_ns ();
+        for (int i = 0; i < msgs_per_loop; i++)
+        {
+            Msg m (MTYPE_USER_MIN);
+            m.push ("BB") << 1 << 2;
+            m.encapsulate (MTYPE_REQ, "B") << 0;
+            m.write (writer);
+            m.pop ("B");
+            m.decapsulate ();
+        }
+        bench.add (ucoo::bench_time_ns () - start, msgs_per_loop);
+    }
+    allocs_info (bench, allocs_start, 64 * msgs_per_loop);
+}
+
+/// Minimal hub, for a single node.  Once the node is idle, send USERS
+/// messages then a DATE message, so that each date tick carries USERS
+/// messages.  The node is idle when it sends an IDLE message with the
+/// sequence number of the last sent message.  Requests are answered
+/// immediately with their own content.
+class BenchHub
+{
+  public:
+    BenchHub (int users)
+        : listen_fd_ (-1), users_ (users), date_ (0), seq_ (0) { }
+    /// Close listening socket if still open.
+    ~BenchHub () { if (listen_fd_ != -1) close (listen_fd_); }
+    /// Prepare hub side of ADDRESS, before the node is started, return
+    /// false on failure.
+    bool listen (const std::string &address);
+    /// Serve the node until it is gone, then exit.
+    void run ();
+  private:
+    /// Send a message with the next sequence number.
+    void send (Msg &msg);
+  private:
+    int listen_fd_;
+    std::unique_ptr<Transport> transport_;
+    int users_;
+    uint32_t date_;
+    /// Sequence number of the last sent message.
+    uint8_t seq_;
+};
+
+/// Extract port from address configuration.
+#define bench_port(addr, port) port
+#define bench_apply(m, args) m args
+
+bool
+BenchHub::listen (const std::string &address)
+{
+    if (address.compare (0, 4, "shm:") == 0)
+    {
+        Ring *ring = new Ring;
+        transport_.reset (ring);
+        ring->create (address.c_str () + 4);
+        return true;
+    }
+    int r;
+    int on = 1;
+    if (address.compare (0, 5, "unix:") == 0)
+    {
+        sockaddr_un saddr;
+        std::memset (&saddr, 0, sizeof (saddr));
+        saddr.sun_family = AF_UNIX;
+        std::strcpy (saddr.sun_path, address.c_str () + 5);
+        unlink (saddr.sun_path);
+        listen_fd_ = socket (AF_UNIX, SOCK_STREAM, 0);
+        r = bind (listen_fd_, reinterpret_cast<sockaddr *> (&saddr),
+                  sizeof (saddr));
+    }
+    else
+    {
+        sockaddr_in saddr;
+        std::memset (&saddr, 0, sizeof (saddr));
+        saddr.sin_family = AF_INET;
+        saddr.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+        saddr.sin_port = htons (std::atoi (
+                bench_apply (bench_port,
+                             CONFIG_UCOO_ARCH_HOST_MEX_DEFAULT_ADDRESS)));
+        listen_fd_ = socket (AF_INET, SOCK_STREAM, 0);
+        setsockopt (listen_fd_, SOL_SOCKET, SO_REUSEADDR, &on, sizeof (on));
+        r = bind (listen_fd_, reinterpret_cast<sockaddr *> (&saddr),
+                  sizeof (saddr));
+    }
+    return r == 0 && ::listen (listen_fd_, 1) == 0;
+}
+
+void
+BenchHub::run ()
+{
+    if (listen_fd_ != -1)
+    {
+        int fd = accept (listen_fd_, nullptr, nullptr);
+        ucoo::assert_perror (fd != -1);
+        int on = 1;
+        setsockopt (fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof (on));
+        transport_.reset (new Socket (fd));
+    }
+    Msg date (MTYPE_DATE);
+    date.push<uint32_t> (date_);
+    send (date);
+    // Transport exits when the node is gone.
+    while (true)
+    {
+        Msg msg (*transport_);
+        switch (msg.mtype ())
+        {
+        case MTYPE_IDLE:
+            if (transport_->get_seq () == seq_)
+            {
+                for (int i = 0; i < users_; i++)
+                {
+                    Msg user (MTYPE_USER_MIN);
+                    user.push<uint8_t, uint16_t, uint32_t> (1, 2, 3);
+                    send (user);
+                }
+                date.reset (MTYPE_DATE);
+                date.push<uint32_t> (++date_);
+                send (date);
+            }
+            break;
+        case MTYPE_REQ:
+            // Answer with the request itself.
+            {
+                uint8_t req = std::get<0> (msg.pop<uint8_t> ());
+                msg.decapsulate ();
+                msg.encapsulate<uint8_t> (MTYPE_RSP, req);
+                send (msg);
+            }
+            break;
+        case MTYPE_RES:
+            {
+                Msg res (MTYPE_RES);
+                res.push<uint8_t> (MTYPE_USER_MIN);
+                send (res);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void
+BenchHub::send (Msg &msg)
+{
+    transport_->set_seq (++seq_);
+    msg.write (*transport_);
+}
+
+/// Count received user messages.
+struct UserHandler
+{
+    uint32_t sum = 0;
+    void handle (Msg &msg)
+    {
+        uint32_t a, b, c;
+        msg.pop ("BHL") >> a >> b >> c;
+        sum += a + b + c;
+    }
+};
+
+/// Run a node against the bench hub using ADDRESS, each date tick carries
+/// USERS messages.
+static void
+bench_node (ucoo::BenchSuite &bsuite, const char *name,
+            const std::string &address, int users)
+{
+    static const int ticks = 2000;
+    ucoo::Bench bench (bsuite, name);
+    BenchHub hub (users);
+    if (!hub.listen (address))
+    {
+        bench.info ("can not listen, skipped");
+        return;
+    }
+    fflush (stdout);
+    int pid = fork ();
+    ucoo::assert_perror (pid != -1);
+    if (!pid)
+    {
+        hub.run ();
+    }
+    {
+        Node node (address.compare (0, 4, "tcp:") == 0 ? "" : address);
+        mtype_t mtype = node.reserve ("bench");
+        UserHandler handler;
+        node.handler_register (mtype, handler, &UserHandler::handle);
+        unsigned allocs_start = allocs;
+        unsigned syscalls_start = node.get_transport ().get_syscalls ();
+        for (int i = 0; i < ticks; i++)
+        {
+            bench.start ();
+            node.wait (node.date () + 1);
+            bench.stop ();
+        }
+        allocs_info (bench, allocs_start, ticks * (users + 1));
+        bench.info ("%.2f syscalls per tick",
+                    double (node.get_transport ().get_syscalls ()
+                            - syscalls_start) / ticks);
+        ucoo::assert (handler.sum == unsigned (ticks * users * 6));
+    }
+    int status;
+    waitpid (pid, &status, 0);
+}
+
+/// Sum responses.
+struct ResponseHandler
+{
+    uint32_t sum = 0;
+    void handle (Msg &msg)
+    {
+        sum += std::get<0> (msg.pop<uint32_t> ());
+    }
+};
+
+/// Run a node sending rounds of requests to the bench hub using ADDRESS,
+/// one at a time or all in flight at once.
+static void
+bench_request (ucoo::BenchSuite &bsuite, const char *name,
+               const std::string &address, bool async)
+{
+    static const int rounds = 2000;
+    static const int requests = 8;
+    ucoo::Bench bench (bsuite, name);
+    BenchHub hub (0);
+    if (!hub.listen (address))
+    {
+        bench.info ("can not listen, skipped");
+        return;
+    }
+    fflush (stdout);
+    int pid = fork ();
+    ucoo::assert_perror (pid != -1);
+    if (!pid)
+    {
+        hub.run ();
+    }
+    {
+        Node node (address.compare (0, 4, "tcp:") == 0 ? "" : address);
+        ResponseHandler handler;
+        unsigned allocs_start = allocs;
+        unsigned syscalls_start = node.get_transport ().get_syscalls ();
+        for (int i = 0; i < rounds; i++)
+        {
+            bench.start ();
+            if (async)
+            {
+                int reqs[requests];
+                for (int j = 0; j < requests; j++)
+                {
+                    Msg msg (MTYPE_USER_MIN);
+                    msg.push<uint32_t> (j);
+                    reqs[j] = node.request_async (msg, handler,
+                                                  &ResponseHandler::handle);
+                }
+                for (int j = 0; j < requests; j++)
+                    node.request_wait (reqs[j]);
+            }
+            else
+            {
+                for (int j = 0; j < requests; j++)
+                {
+                    Msg msg (MTYPE_USER_MIN);
+                    msg.push<uint32_t> (j);
+                    Msg rsp = node.request (msg);
+                    handler.handle (rsp);
+                }
+            }
+            bench.stop ();
+        }
+        allocs_info (bench, allocs_start, rounds * requests * 2);
+        bench.info ("%.2f syscalls per request",
+                    double (node.get_transport ().get_syscalls ()
+                            - syscalls_start) / (rounds * requests));
+        ucoo::assert (handler.sum
+                      == unsigned (rounds * requests * (requests - 1) / 2));
+    }
+    int status;
+    waitpid (pid, &status, 0);
+}
+
+/// Count dispatched messages.
+struct DispatchHandler
+{
+    unsigned count = 0;
+    void handle (Msg &) { count++; }
+};
+
+/// Dispatch messages to registered handlers, using the node handler table
+/// or, for comparison, a map of std::function.
+static void
+bench_dispatch (ucoo::BenchSuite &bsuite)
+{
+    static const int mtypes = 16;
+    static const char *address = "shm:bench_mex_dispatch";
+    BenchHub hub (0);
+    if (!hub.listen (address))
+    {
+        ucoo::Bench bench (bsuite, "table");
+        bench.info ("can not listen, skipped");
+        return;
+    }
+    fflush (stdout);
+    int pid = fork ();
+    ucoo::assert_perror (pid != -1);
+    if (!pid)
+    {
+        hub.run ();
+    }
+    {
+        Node node (address);
+        DispatchHandler handler;
+        std::vector<Msg> msgs;
+        msgs.reserve (mtypes);
+        for (int i = 0; i < mtypes; i++)
+        {
+            mtype_t mtype = mtype_t (MTYPE_USER_MIN + i);
+            node.handler_register (mtype, handler, &DispatchHandler::handle);
+            msgs.emplace_back (mtype);
+        }
+        {
+            ucoo::Bench bench (bsuite, "table");
+            unsigned allocs_start = allocs;
+            for (int j = 0; j < 64; j++)
+            {
+                uint64_t start = ucoo::bench_time_ns ();
+                for (int i = 0; i < msgs_per_loop; i++)
+                    node.dispatch (msgs[i % mtypes]);
+                bench.add (ucoo::bench_time_ns () - start, msgs_per_loop);
+            }
+            allocs_info (bench, allocs_start, 64 * msgs_per_loop);
+        }
+        {
+            ucoo::Bench bench (bsuite, "map");
+            typedef std::map<mtype_t, std::function<void (Node &, Msg &)> >
+                Handlers;
+            Handlers handlers;
+            for (int i = 0; i < mtypes; i++)
+                handlers[mtype_t (MTYPE_USER_MIN + i)] =
+                    std::bind (&DispatchHandler::handle, &handler,
+                               std::placeholders::_2);
+            for (int j = 0; j < 64; j++)
+            {
+                uint64_t start = ucoo::bench_time_ns ();
+                for (int i = 0; i < msgs_per_loop; i++)
+                {
+                    Msg &msg = msgs[i % mtypes];
+                    Handlers::const_iterator it = handlers.find (msg.mtype ());
+                    if (it != handlers.end ())
+                        it->second (node, msg);
+                }
+                bench.add (ucoo::bench_time_ns () - start, msgs_per_loop);
+            }
+        }
+        ucoo::assert (handler.count == 2 * 64 * msgs_per_loop);
+    }
+    int status;
+    waitpid (pid, &status, 0);
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::BenchSuite bsuite ("mex");
+    bsuite.group ("msg");
+    bench_recv (bsuite, "recv", false);
+    bench_recv (bsuite, "recv:typed", true);
+    bench_send (bsuite, "send", false);
+    bench_send (bsuite, "send:typed", true);
+    bench_encapsulate (bsuite);
+    bsuite.group ("dispatch");
+    bench_dispatch (bsuite);
+    bsuite.group ("node");
+    static const char *addresses[] = {
+        "tcp:", "unix:/tmp/bench_mex.sock", "shm:bench_mex" };
+    for (const char *address : addresses)
+    {
+        std::string transport (address, std::strchr (address, ':'));
+        std::string name = transport + ":tick:0";
+        bench_node (bsuite, name.c_str (), address, 0);
+        name = transport + ":tick:8";
+        bench_node (bsuite, name.c_str (), address, 8);
+    }
+    bsuite.group ("request");
+    for (const char *address : addresses)
+    {
+        std::string transport (address, std::strchr (address, ':'));
+        std::string name = transport + ":sync:8";
+        bench_request (bsuite, name.c_str (), address, false);
+        name = transport + ":async:8";
+        bench_request (bsuite, name.c_str (), address, true);
+    }
+    return 0;
+}
@@ -165,8 +165,47 @@ test_msg ()
         check (m.mtype (), 0x20, "mtype");
         check (m.len (), 2, "len");
     }
+    {
+        // Compile time layouts use the same wire format.
+        Msg m (MTYPE_DATE);
+        m.push<uint8_t, uint16_t, int32_t> (1, 2, 3);
+        m.push<int8_t, int16_t, uint32_t> (-1, -2, 0xfffefdfc);
+        const char w1b[] = { 0x01, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03,
+            static_cast<char> (0xff),
+            static_cast<char> (0xff), static_cast<char> (0xfe),
+            static_cast<char> (0xff), static_cast<char> (0xfe),
+            static_cast<char> (0xfd), static_cast<char> (0xfc) };
+        TestWriter w1 (w1b);
+        m.write (w1);
+        uint8_t a; uint16_t b; int32_t c;
+        std::tie (a, b, c) = m.pop<uint8_t, uint16_t, int32_t> ();
+        check (a, 1); check (b, 2); check (c, 3);
+        int8_t d; int16_t e; uint32_t f;
+        std::tie (d, e, f) = m.pop<int8_t, int16_t, uint32_t> ();
+        check (d, -1); check (e, -2); check (f, 0xfffefdfc);
+        check (m.len (), 0, "len");
+        m.push ("bb") << 1 << 2;
+        m.encapsulate<uint8_t> (static_cast<mtype_t> (0x21), 5);
+        const char w2b[] = { 0x21, 0x05, 0x01, 0x01, 0x02 };
+        TestWriter w2 (w2b);
+        m.write (w2);
+    }
 }
 
+/// Collect responses to pipelined requests.
+struct TestResponses
+{
+    int sum = 0;
+    int count = 0;
+    void handle (Msg &msg)
+    {
+        int r;
+        msg.pop ("l") >> r;
+        sum += r;
+        count++;
+    }
+};
+
 void
 test_node_1 ()
 {
@@ -180,10 +219,26 @@ test_node_1 ()
     node.send (hello);
     Msg world (world_mtype);
     world.push ("bh") << 12 << 5678;
-    std::auto_ptr<Msg> resp (node.request (world));
+    Msg resp = node.request (world);
     int sum;
-    resp->pop ("l") >> sum;
+    resp.pop ("l") >> sum;
     ucoo::assert (sum == 12 + 5678);
+    // Several requests in flight.
+    TestResponses responses;
+    Msg world_1 (world_mtype);
+    world_1.push ("bh") << 1 << 2;
+    int req_1 = node.request_async (world_1, responses,
+                                    &TestResponses::handle);
+    Msg world_2 (world_mtype);
+    world_2.push ("bh") << 3 << 4;
+    int req_2 = node.request_async (world_2, responses,
+                                    &TestResponses::handle);
+    ucoo::assert (req_1 != req_2);
+    node.request_wait (req_2);
+    node.request_wait (req_1);
+    ucoo::assert (!node.request_pending (req_1)
+                  && !node.request_pending (req_2));
+    ucoo::assert (responses.count == 2 && responses.sum == 1 + 2 + 3 + 4);
     node.wait (42 * 2);
 }
 
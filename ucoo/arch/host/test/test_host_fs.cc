@@ -0,0 +1,184 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/arch/host/host_fs.hh"
+#include "ucoo/arch/syscalls.host.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/fs_test.hh"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <unistd.h>
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("host_fs");
+    char root[] = "/tmp/test_host_fs.XXXXXX";
+    if (!mkdtemp (root))
+        return 1;
+    std::string big (10000, 'x');
+    for (int i = 0; i < static_cast<int> (big.size ()); i++)
+        big[i] = 'a' + i % 23;
+    do {
+        ucoo::Test test (tsuite, "write and read");
+        ucoo::HostFS fs (root);
+        for (int chunk : { 1, 100, 4096, 10000 })
+        {
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, "a", big.data (), big.size (),
+                                           chunk));
+            test_fail_break_unless (test, ucoo::test_fs_read (fs, "a") == big);
+        }
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "empty", "", 0, 1));
+        test_fail_break_unless (test, ucoo::test_fs_read (fs, "empty") == "");
+        ucoo::Stream *s = fs.open ("a");
+        char buf[10];
+        test_fail_break_unless (test, s && s->size () == 10000
+                                && s->seek (9995) == 9995
+                                && s->read (buf, sizeof (buf)) == 5
+                                && std::memcmp (buf, &big[9995], 5) == 0
+                                && s->read (buf, sizeof (buf)) == -2);
+        fs.close (s);
+        ucoo::FileSystem::Error error;
+        test_fail_break_unless (
+            test, !fs.open ("none", ucoo::FileSystem::Mode::READ, error)
+            && error == ucoo::FileSystem::Error::NO_SUCH_FILE);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "peek");
+        ucoo::HostFS fs (root);
+        ucoo::Stream *s = fs.open ("a");
+        test_fail_break_unless (test, s);
+        int count;
+        const char *p = fs.peek (s, count);
+        bool ok = p && count == 10000 && std::memcmp (p, big.data (),
+                                                      count) == 0;
+        s->seek (9000, ucoo::Stream::Whence::CUR);
+        p = fs.peek (s, count);
+        ok = ok && p && count == 1000 && p[0] == big[9000];
+        s->seek (0, ucoo::Stream::Whence::END);
+        ok = ok && !fs.peek (s, count) && count == 0;
+        fs.close (s);
+        test_fail_break_unless (test, ok);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "replace keeps readers");
+        ucoo::HostFS fs (root);
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "cal", "old", 3, 3));
+        int size;
+        const char *m = fs.map ("cal", size);
+        ucoo::Stream *r = fs.open ("cal");
+        ucoo::Stream *w = fs.open ("cal", ucoo::FileSystem::Mode::WRITE);
+        test_fail_break_unless (test, m && size == 3 && r && w);
+        test_fail_break_unless (test, w->write ("new!", 4) == 4
+                                && w->poll () == 0);
+        // Not visible before flush.
+        test_fail_break_unless (test, ucoo::test_fs_read (fs, "cal") == "old");
+        test_fail_break_unless (test, w->flush ()
+                                && ucoo::test_fs_read (fs, "cal") == "new!");
+        // Published version is not modified by later writes.
+        int size1;
+        const char *m1 = fs.map ("cal", size1);
+        test_fail_break_unless (test, m1 && w->write ("", 0) == 0
+                                && w->write ("v2", 2) == 2
+                                && w->write (big.data (), big.size ())
+                                == static_cast<int> (big.size ())
+                                && w->size () == 10006);
+        test_fail_break_unless (test, ucoo::test_fs_read (fs, "cal") == "new!");
+        fs.close (w);
+        test_fail_break_unless (test, size1 == 4
+                                && std::memcmp (m1, "new!", 4) == 0);
+        char buf[10];
+        test_fail_break_unless (test, r->read (buf, sizeof (buf)) == 3
+                                && std::memcmp (buf, "old", 3) == 0);
+        fs.close (r);
+        test_fail_break_unless (test, std::memcmp (m, "old", 3) == 0);
+        int size2;
+        const char *m2 = fs.map ("cal", size2);
+        test_fail_break_unless (test, m2 && size2 == 10006
+                                && std::memcmp (m2, "new!v2", 6) == 0
+                                && std::memcmp (m2 + 6, big.data (),
+                                                big.size ()) == 0
+                                && fs.map ("cal", size2) == m2);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "list, stat and unlink");
+        ucoo::HostFS fs (root);
+        // Open writer temporary file is hidden.
+        ucoo::Stream *w = fs.open ("z", ucoo::FileSystem::Mode::WRITE);
+        ucoo::TestFsLister lister;
+        int listed = fs.list ("", { &lister, &ucoo::TestFsLister::add });
+        test_fail_break_unless (test, listed == 3
+                                && lister.names == "a cal empty ");
+        fs.close (w);
+        lister.names.clear ();
+        listed = fs.list ("c", { &lister, &ucoo::TestFsLister::add });
+        test_fail_break_unless (test, listed == 1 && lister.names == "cal ");
+        ucoo::FileSystem::Stat st;
+        ucoo::FileSystem::Error error;
+        test_fail_break_unless (test, fs.stat ("a", st, error)
+                                && st.size == 10000);
+        fs.unlink ("a");
+        fs.unlink ("a");
+        test_fail_break_unless (test, !fs.stat ("a", st, error)
+                                && error
+                                == ucoo::FileSystem::Error::NO_SUCH_FILE);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "stay in root");
+        ucoo::HostFS fs (root);
+        ucoo::FileSystem::Error error;
+        test_fail_break_unless (
+            test, !fs.open ("../passwd", ucoo::FileSystem::Mode::READ, error)
+            && error == ucoo::FileSystem::Error::ACCESS_DENIED);
+        test_fail_break_unless (
+            test, !fs.open ("/etc/passwd", ucoo::FileSystem::Mode::READ,
+                            error)
+            && error == ucoo::FileSystem::Error::ACCESS_DENIED);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "enable");
+        ucoo::HostFS fs (root);
+        fs.enable ();
+        test_fail_break_unless (test, ucoo::syscalls_file_system == &fs);
+        ucoo::Stream *s = ucoo::syscalls_file_system->open ("cal");
+        test_fail_break_unless (test, s);
+        fs.close (s);
+        fs.disable ();
+        test_fail_break_unless (test, !ucoo::syscalls_file_system);
+    } while (0);
+    ucoo::HostFS fs (root);
+    fs.unlink ("cal");
+    fs.unlink ("empty");
+    fs.unlink ("z");
+    rmdir (root);
+    return tsuite.report () ? 0 : 1;
+}
@@ -51,6 +51,8 @@ struct DESIG_TypeDef
 };
 
 #undef SysTick
+#undef DWT
+#undef CoreDebug
 
 #undef TIM2
 #undef TIM3
@@ -114,6 +116,8 @@ namespace ucoo {
 namespace reg {
 
 constexpr auto SysTick = reinterpret_cast<SysTick_Type *> (SysTick_BASE);
+constexpr auto DWT = reinterpret_cast<DWT_Type *> (DWT_BASE);
+constexpr auto CoreDebug = reinterpret_cast<CoreDebug_Type *> (CoreDebug_BASE);
 
 constexpr auto TIM2 = reinterpret_cast<TIM_TypeDef *> (TIM2_BASE);
 constexpr auto TIM3 = reinterpret_cast<TIM_TypeDef *> (TIM3_BASE);
@@ -168,6 +168,8 @@ struct DESIG_TypeDef
 
 #undef FPU
 #undef SysTick
+#undef DWT
+#undef CoreDebug
 
 #undef TIM2
 #undef TIM3
@@ -278,6 +280,8 @@ namespace reg {
 
 constexpr auto FPU = reinterpret_cast<FPU_Type *> (FPU_BASE);
 constexpr auto SysTick = reinterpret_cast<SysTick_Type *> (SysTick_BASE);
+constexpr auto DWT = reinterpret_cast<DWT_Type *> (DWT_BASE);
+constexpr auto CoreDebug = reinterpret_cast<CoreDebug_Type *> (CoreDebug_BASE);
 
 constexpr auto TIM2 = reinterpret_cast<TIM_TypeDef *> (TIM2_BASE);
 constexpr auto TIM3 = reinterpret_cast<TIM_TypeDef *> (TIM3_BASE);
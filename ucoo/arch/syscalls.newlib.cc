@@ -31,6 +31,7 @@
 #include <time.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <string.h>
 
 ucoo::Stream *ucoo::syscalls_streams[8];
 
@@ -108,12 +109,63 @@ _kill_r (struct _reent *ptr, int pid, int sig)
     return -1;
 }
 
-/** Set position in a file, unimplemented. */
+/** Set position in a file. */
 extern "C" off_t
 _lseek_r (struct _reent *ptr, int fd, off_t pos, int whence)
 {
-    ptr->_errno = ENOSYS;
-    return -1;
+    if (fd < ucoo::lengthof (ucoo::syscalls_streams)
+        && ucoo::syscalls_streams[fd])
+    {
+        ucoo::Stream::Whence w;
+        if (whence == SEEK_SET)
+            w = ucoo::Stream::Whence::SET;
+        else if (whence == SEEK_CUR)
+            w = ucoo::Stream::Whence::CUR;
+        else if (whence == SEEK_END)
+            w = ucoo::Stream::Whence::END;
+        else
+        {
+            ptr->_errno = EINVAL;
+            return -1;
+        }
+        int r = ucoo::syscalls_streams[fd]->seek (pos, w);
+        if (r < 0)
+        {
+            ptr->_errno = ESPIPE;
+            return -1;
+        }
+        return r;
+    }
+    else
+    {
+        ptr->_errno = EBADF;
+        return -1;
+    }
+}
+
+/** Convert a file system error to errno. */
+static int
+file_system_errno (ucoo::FileSystem::Error error)
+{
+    switch (error)
+    {
+    case ucoo::FileSystem::Error::ACCESS_DENIED:
+        return EACCES;
+    case ucoo::FileSystem::Error::TOO_MANY_OPEN_FILES:
+        return ENFILE;
+    case ucoo::FileSystem::Error::NAME_TOO_LONG:
+        return ENAMETOOLONG;
+    case ucoo::FileSystem::Error::NO_SUCH_FILE:
+        return ENOENT;
+    case ucoo::FileSystem::Error::NO_SPACE_LEFT:
+        return ENOSPC;
+    case ucoo::FileSystem::Error::READ_ONLY:
+        return EROFS;
+    case ucoo::FileSystem::Error::NOT_SUPPORTED:
+        return ENOTSUP;
+    default:
+        ucoo::assert_unreachable ();
+    }
 }
 
 /** Open a file. */
@@ -154,20 +206,7 @@ _open_r (struct _reent *ptr, const char *file, int flags, int mode)
                 ucoo::syscalls_file_system->open (file, mode, error);
             if (!ucoo::syscalls_streams[i])
             {
-                if (error == ucoo::FileSystem::Error::ACCESS_DENIED)
-                    ptr->_errno = EACCES;
-                else if (error == ucoo::FileSystem::Error::TOO_MANY_OPEN_FILES)
-                    ptr->_errno = ENFILE;
-                else if (error == ucoo::FileSystem::Error::NAME_TOO_LONG)
-                    ptr->_errno = ENAMETOOLONG;
-                else if (error == ucoo::FileSystem::Error::NO_SUCH_FILE)
-                    ptr->_errno = ENOENT;
-                else if (error == ucoo::FileSystem::Error::NO_SPACE_LEFT)
-                    ptr->_errno = ENOSPC;
-                else if (error == ucoo::FileSystem::Error::READ_ONLY)
-                    ptr->_errno = EROFS;
-                else
-                    ucoo::assert_unreachable ();
+                ptr->_errno = file_system_errno (error);
                 return -1;
             }
             else
@@ -217,6 +256,31 @@ _fstat_r (struct _reent *ptr, int fd, struct stat *st)
     }
 }
 
+/** Status of a file, only regular files with a size. */
+extern "C" int
+_stat_r (struct _reent *ptr, const char *file, struct stat *st)
+{
+    if (ucoo::syscalls_file_system)
+    {
+        ucoo::FileSystem::Stat stat;
+        ucoo::FileSystem::Error error;
+        if (!ucoo::syscalls_file_system->stat (file, stat, error))
+        {
+            ptr->_errno = file_system_errno (error);
+            return -1;
+        }
+        memset (st, 0, sizeof (*st));
+        st->st_mode = S_IFREG;
+        st->st_size = stat.size;
+        return 0;
+    }
+    else
+    {
+        ptr->_errno = ENOSYS;
+        return -1;
+    }
+}
+
 /** Read from file. */
 extern "C" int
 _read_r (struct _reent *ptr, int fd, void *buf, size_t cnt)
@@ -0,0 +1,712 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/fs/logfs/logfs.hh"
+#include "ucoo/hal/self_programming/self_programming.hh"
+#include "ucoo/utils/crc.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ucoo {
+
+/// Sector header magic, 'LogF'.
+static const uint32_t sector_magic = 0x46676f4c;
+
+/// Size of sector header.
+static const int sector_header_size = 8;
+
+/// Size of record header.
+static const int record_header_size = 16;
+
+/// Number of free sectors kept when writing.  Compaction may use one of them
+/// and if it is interrupted, the other one is used to resume it.
+static const int reserved_sectors = 2;
+
+static_assert (CONFIG_UCOO_BASE_FS_LOGFS_SECTORS <= 32,
+               "too many sectors for erased sectors bit field");
+static_assert (CONFIG_UCOO_BASE_FS_LOGFS_PAGE_SIZE % 4 == 0,
+               "page size must be a multiple of 4");
+
+/// Return size of a record, with header and padding.
+static int
+record_size (int payload_size)
+{
+    return record_header_size + ((payload_size + 3) & ~3);
+}
+
+/// Update CRC with a buffer content.
+static uint32_t
+crc_update (uint32_t crc, const char *data, int size)
+{
+    for (int i = 0; i < size; i++)
+        crc = crc32_update (crc, data[i]);
+    return crc;
+}
+
+/// Compute record CRC, from header (excluding CRC) and payload.
+static uint32_t
+record_crc (const char *header, const char *payload, int size)
+{
+    uint32_t crc = crc_update (0xffffffff, header + 4,
+                               record_header_size - 4);
+    return crc_update (crc, payload, size) ^ 0xffffffff;
+}
+
+static int
+filename_compare (const char *a, int a_len, const char *b, int b_len)
+{
+    int bcmp = std::memcmp (a, b, std::min (a_len, b_len));
+    if (bcmp == 0)
+        return a_len - b_len;
+    else
+        return bcmp;
+}
+
+LogFS::LogFSStream::LogFSStream (LogFS &fs, uint32_t id, int size)
+    : fs_ (fs), entry_ (nullptr), id_ (id), pos_ (0), size_ (size),
+      cursor_ { -1, 0 }, cursor_compactions_ (0), next_ (nullptr),
+      buffered_ (0)
+{
+}
+
+LogFS::LogFSStream::LogFSStream (LogFS &fs, Entry &entry, uint32_t id)
+    : fs_ (fs), entry_ (&entry), id_ (id), pos_ (0), size_ (0),
+      cursor_ { -1, 0 }, cursor_compactions_ (0), next_ (nullptr),
+      buffered_ (0)
+{
+}
+
+int
+LogFS::LogFSStream::read (char *buf, int count)
+{
+    if (entry_)
+        return -1;
+    int l = std::min (count, size_ - pos_);
+    if (!l)
+        return -2;
+    if (cursor_compactions_ != fs_.compactions_)
+    {
+        // Records may have moved.
+        cursor_.sector = -1;
+        cursor_compactions_ = fs_.compactions_;
+    }
+    const Record *r = fs_.record_find_data (id_, pos_, cursor_);
+    if (!r)
+        return -1;
+    int offset = pos_ - r->arg;
+    l = std::min (l, r->size - offset);
+    std::memcpy (buf, reinterpret_cast<const char *> (r + 1) + offset, l);
+    pos_ += l;
+    return l;
+}
+
+int
+LogFS::LogFSStream::write (const char *buf, int count)
+{
+    if (!entry_)
+        return -1;
+    char *page = reinterpret_cast<char *> (page_);
+    int done = 0;
+    while (done < count)
+    {
+        if (buffered_ == sizeof (page_) && !write_page ())
+            return done ? done : -1;
+        int l = std::min<int> (count - done, sizeof (page_) - buffered_);
+        std::memcpy (page + buffered_, buf + done, l);
+        buffered_ += l;
+        done += l;
+        pos_ += l;
+    }
+    size_ = pos_;
+    return done;
+}
+
+int
+LogFS::LogFSStream::poll ()
+{
+    return entry_ ? 0 : size_ - pos_;
+}
+
+int
+LogFS::LogFSStream::seek (int offset, Whence whence/*SET*/)
+{
+    if (entry_)
+        return offset == 0 && whence == Whence::CUR ? pos_ : -1;
+    int origin;
+    switch (whence)
+    {
+    case Whence::SET:
+        origin = 0;
+        break;
+    case Whence::CUR:
+        origin = pos_;
+        break;
+    case Whence::END:
+        origin = size_;
+        break;
+    default:
+        assert_unreachable ();
+    }
+    if (offset < -origin || offset > size_ - origin)
+        return -1;
+    pos_ = origin + offset;
+    return pos_;
+}
+
+int
+LogFS::LogFSStream::size ()
+{
+    return size_;
+}
+
+bool
+LogFS::LogFSStream::flush ()
+{
+    if (!entry_)
+        return true;
+    if (!write_page ())
+        return false;
+    if (!fs_.append (COMMIT, id_, pos_, entry_->name, entry_->name_size))
+        return false;
+    entry_->id = id_;
+    entry_->size = pos_;
+    return true;
+}
+
+bool
+LogFS::LogFSStream::write_page ()
+{
+    if (!buffered_)
+        return true;
+    if (!fs_.append (DATA, id_, pos_ - buffered_,
+                     reinterpret_cast<const char *> (page_), buffered_))
+        return false;
+    buffered_ = 0;
+    return true;
+}
+
+LogFS::LogFS (uint32_t addr, int size)
+    : sectors_count_ (0), erased_ (0), tail_ (0), head_ (-1), used_ (0),
+      head_offset_ (0), seq_ (0), next_id_ (1), compactions_ (0),
+      readers_ (nullptr)
+{
+    static_assert (sizeof (Record) == record_header_size,
+                   "unexpected record header layout");
+    uint32_t end = addr + size;
+    while (addr < end)
+    {
+        assert (sectors_count_ < CONFIG_UCOO_BASE_FS_LOGFS_SECTORS);
+        sector_addr_[sectors_count_++] = addr;
+        addr += self_programming_erase_size (addr);
+    }
+    assert (addr == end);
+    sector_addr_[sectors_count_] = end;
+    // Needs a sector to compact, a sector to receive records in use, and
+    // reserved sectors.
+    assert (sectors_count_ >= reserved_sectors + 2);
+    for (int i = 0; i < sectors_count_; i++)
+        assert (sector_size (i) >= sector_header_size
+                + record_size (CONFIG_UCOO_BASE_FS_LOGFS_PAGE_SIZE));
+    for (Entry &e : files_)
+    {
+        e.id = 0;
+        e.writing_id = 0;
+    }
+    mount ();
+}
+
+void
+LogFS::mount ()
+{
+    // Find the oldest sector.
+    int tail = -1;
+    for (int s = 0; s < sectors_count_; s++)
+    {
+        const uint32_t *h = reinterpret_cast<const uint32_t *> (
+            self_programming_map (sector_addr_[s]));
+        if (h[0] == sector_magic && (tail == -1 || h[1] < seq_))
+        {
+            tail = s;
+            seq_ = h[1];
+        }
+    }
+    if (tail == -1)
+        // Empty log.
+        return;
+    tail_ = tail;
+    // Walk the log, sequence numbers must follow.
+    int s = tail;
+    do
+    {
+        const char *p = self_programming_map (sector_addr_[s]);
+        const uint32_t *h = reinterpret_cast<const uint32_t *> (p);
+        if (h[0] != sector_magic || h[1] != seq_)
+            break;
+        seq_++;
+        head_ = s;
+        used_++;
+        int size = sector_size (s);
+        int offset = sector_header_size;
+        bool torn = false;
+        while (offset + record_header_size <= size)
+        {
+            const Record *r = reinterpret_cast<const Record *> (p + offset);
+            const char *payload = reinterpret_cast<const char *> (r + 1);
+            if (r->crc == 0xffffffff && r->size == 0xffff && r->type == 0xff
+                && r->reserved == 0xff && r->id == 0xffffffff
+                && r->arg == 0xffffffff)
+                // Erased, end of sector.
+                break;
+            if (offset + record_size (r->size) > size
+                || r->crc != record_crc (reinterpret_cast<const char *> (r),
+                                         payload, r->size))
+            {
+                // Partially written record, end of sector.
+                torn = true;
+                break;
+            }
+            if (r->id >= next_id_)
+                next_id_ = r->id + 1;
+            if (r->type == COMMIT)
+            {
+                Entry *e = entry_get (payload, r->size);
+                if (e && r->id >= e->id)
+                {
+                    e->id = r->id;
+                    e->size = r->arg;
+                }
+            }
+            else if (r->type == UNLINK)
+            {
+                Entry *e = entry_find (payload, r->size);
+                if (e && e->id <= r->id)
+                    e->id = 0;
+            }
+            offset += record_size (r->size);
+        }
+        sector_end_[s] = offset;
+        // Never write after a partially written record.
+        head_offset_ = torn ? size : offset;
+        s = sector_next (s);
+    } while (s != tail);
+}
+
+const LogFS::Record *
+LogFS::record_get (Cursor &c) const
+{
+    if (head_ < 0)
+        return nullptr;
+    while (c.offset >= sector_end_[c.sector])
+    {
+        if (c.sector == head_)
+            return nullptr;
+        c.sector = sector_next (c.sector);
+        c.offset = sector_header_size;
+    }
+    return reinterpret_cast<const Record *> (
+        self_programming_map (sector_addr_[c.sector] + c.offset));
+}
+
+const LogFS::Record *
+LogFS::record_find_data (uint32_t id, int offset, Cursor &c) const
+{
+    bool from_tail = c.sector < 0;
+    if (from_tail)
+        c = Cursor { tail_, sector_header_size };
+    // Records are usually found in order, search from cursor, then from
+    // tail if not found.
+    for (int pass = from_tail ? 1 : 0; pass < 2; pass++)
+    {
+        const Record *r;
+        while ((r = record_get (c)))
+        {
+            if (r->type == DATA && r->id == id
+                && offset >= static_cast<int> (r->arg)
+                && offset < static_cast<int> (r->arg) + r->size)
+                return r;
+            c.offset += record_size (r->size);
+        }
+        c = Cursor { tail_, sector_header_size };
+    }
+    c.sector = -1;
+    return nullptr;
+}
+
+bool
+LogFS::record_live (const Record &r) const
+{
+    for (const Entry &e : files_)
+    {
+        if (r.type == DATA)
+        {
+            if ((r.id == e.id && static_cast<int> (r.arg) < e.size)
+                || r.id == e.writing_id)
+                return true;
+        }
+        else if (r.type == COMMIT)
+        {
+            if (r.id == e.id && static_cast<int> (r.arg) == e.size)
+                return true;
+        }
+    }
+    // Old versions may still be read.
+    if (r.type == DATA)
+    {
+        for (const LogFSStream *s = readers_; s; s = s->next_)
+        {
+            if (r.id == s->id_ && static_cast<int> (r.arg) < s->size_)
+                return true;
+        }
+    }
+    return false;
+}
+
+bool
+LogFS::append (uint8_t type, uint32_t id, uint32_t arg, const char *payload,
+               int size)
+{
+    int needed = record_size (size);
+    auto fits = [&] () {
+        return head_ >= 0 && head_offset_ + needed <= sector_size (head_);
+    };
+    if (!fits ())
+    {
+        // A new sector is needed, keep free sectors to be able to compact.
+        for (int i = 0; i < sectors_count_
+                 && free_sectors () <= reserved_sectors; i++)
+        {
+            if (!compact ())
+                break;
+        }
+        if (!fits () && free_sectors () <= reserved_sectors)
+            return false;
+    }
+    return append_head (type, id, arg, payload, size);
+}
+
+bool
+LogFS::append_head (uint8_t type, uint32_t id, uint32_t arg,
+                    const char *payload, int size)
+{
+    int needed = record_size (size);
+    if ((head_ < 0 || head_offset_ + needed > sector_size (head_))
+        && !allocate ())
+        return false;
+    Record r;
+    r.size = size;
+    r.type = type;
+    r.reserved = 0;
+    r.id = id;
+    r.arg = arg;
+    r.crc = record_crc (reinterpret_cast<const char *> (&r), payload, size);
+    uint32_t addr = sector_addr_[head_] + head_offset_;
+    self_programming_write (addr, reinterpret_cast<const char *> (&r),
+                            record_header_size);
+    addr += record_header_size;
+    int aligned = size & ~3;
+    if (aligned)
+        self_programming_write (addr, payload, aligned);
+    if (aligned != size)
+    {
+        uint32_t last = 0xffffffff;
+        std::memcpy (&last, payload + aligned, size - aligned);
+        self_programming_write (addr + aligned,
+                                reinterpret_cast<const char *> (&last), 4);
+    }
+    head_offset_ += needed;
+    sector_end_[head_] = head_offset_;
+    return true;
+}
+
+bool
+LogFS::allocate ()
+{
+    if (!free_sectors ())
+        return false;
+    int s = head_ < 0 ? tail_ : sector_next (head_);
+    if (!(erased_ & 1u << s))
+        self_programming_erase (sector_addr_[s], sector_size (s));
+    erased_ &= ~(1u << s);
+    // Write magic last, so that an interrupted header is not valid.
+    uint32_t seq = seq_++;
+    self_programming_write (sector_addr_[s] + 4,
+                            reinterpret_cast<const char *> (&seq), 4);
+    self_programming_write (sector_addr_[s],
+                            reinterpret_cast<const char *> (&sector_magic),
+                            4);
+    head_ = s;
+    used_++;
+    head_offset_ = sector_header_size;
+    sector_end_[s] = head_offset_;
+    return true;
+}
+
+bool
+LogFS::record_copied (const Record &r) const
+{
+    Cursor c { sector_next (tail_), sector_header_size };
+    if (tail_ == head_)
+        return false;
+    const Record *o;
+    while ((o = record_get (c)))
+    {
+        if (o->type == r.type && o->id == r.id && o->arg == r.arg
+            && o->size == r.size)
+            return true;
+        c.offset += record_size (o->size);
+    }
+    return false;
+}
+
+bool
+LogFS::compact_needed (const Record &r, bool skip_copied) const
+{
+    return record_live (r) && !(skip_copied && record_copied (r));
+}
+
+bool
+LogFS::compact_fits (bool skip_copied) const
+{
+    const char *p = self_programming_map (sector_addr_[tail_]);
+    int room = sector_size (head_) - head_offset_;
+    int next = sector_next (head_);
+    for (int offset = sector_header_size; offset < sector_end_[tail_];)
+    {
+        const Record *r = reinterpret_cast<const Record *> (p + offset);
+        int size = record_size (r->size);
+        offset += size;
+        if (!compact_needed (*r, skip_copied))
+            continue;
+        while (size > room)
+        {
+            if (next == tail_)
+                return false;
+            room = sector_size (next) - sector_header_size;
+            next = sector_next (next);
+        }
+        room -= size;
+    }
+    return true;
+}
+
+bool
+LogFS::compact ()
+{
+    if (used_ < 2)
+        return false;
+    // If records in use do not fit, this may be an interrupted compaction,
+    // in this case, some records are already copied.
+    bool skip_copied = !compact_fits (false);
+    if (skip_copied && !compact_fits (true))
+        return false;
+    // Copy records, verbatim.
+    int tail = tail_;
+    const char *p = self_programming_map (sector_addr_[tail]);
+    for (int offset = sector_header_size; offset < sector_end_[tail];)
+    {
+        const Record *r = reinterpret_cast<const Record *> (p + offset);
+        int size = record_size (r->size);
+        if (compact_needed (*r, skip_copied))
+        {
+            if (head_offset_ + size > sector_size (head_))
+            {
+                bool ok = allocate ();
+                assert (ok);
+            }
+            self_programming_write (sector_addr_[head_] + head_offset_,
+                                    reinterpret_cast<const char *> (r), size);
+            head_offset_ += size;
+            sector_end_[head_] = head_offset_;
+        }
+        offset += size;
+    }
+    // Invalidate the sector first, in case erase is interrupted.
+    static const uint32_t zero = 0;
+    self_programming_write (sector_addr_[tail],
+                            reinterpret_cast<const char *> (&zero), 4);
+    self_programming_erase (sector_addr_[tail], sector_size (tail));
+    erased_ |= 1u << tail;
+    tail_ = sector_next (tail);
+    used_--;
+    compactions_++;
+    return true;
+}
+
+LogFS::Entry *
+LogFS::entry_find (const char *name, int name_size)
+{
+    for (Entry &e : files_)
+    {
+        if ((e.id || e.writing_id) && e.name_size == name_size
+            && std::memcmp (e.name, name, name_size) == 0)
+            return &e;
+    }
+    return nullptr;
+}
+
+LogFS::Entry *
+LogFS::entry_get (const char *name, int name_size)
+{
+    Entry *e = entry_find (name, name_size);
+    if (e)
+        return e;
+    if (name_size > CONFIG_UCOO_BASE_FS_LOGFS_NAME_SIZE)
+        return nullptr;
+    for (Entry &e : files_)
+    {
+        if (!e.id && !e.writing_id)
+        {
+            e.size = 0;
+            e.name_size = name_size;
+            std::memcpy (e.name, name, name_size);
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+Stream *
+LogFS::open (const char *filename, Mode mode, Error &error)
+{
+    int name_size = std::strlen (filename);
+    if (name_size > CONFIG_UCOO_BASE_FS_LOGFS_NAME_SIZE)
+    {
+        error = Error::NAME_TOO_LONG;
+        return nullptr;
+    }
+    LogFSStream *s;
+    if (mode == Mode::READ)
+    {
+        Entry *e = entry_find (filename, name_size);
+        if (!e || !e->id)
+        {
+            error = Error::NO_SUCH_FILE;
+            return nullptr;
+        }
+        s = pool_.construct (*this, e->id, e->size);
+        if (s)
+        {
+            s->next_ = readers_;
+            readers_ = s;
+        }
+    }
+    else
+    {
+        Entry *e = entry_get (filename, name_size);
+        if (!e)
+        {
+            error = Error::NO_SPACE_LEFT;
+            return nullptr;
+        }
+        if (e->writing_id)
+        {
+            // Only one writer at a time.
+            error = Error::ACCESS_DENIED;
+            return nullptr;
+        }
+        s = pool_.construct (*this, *e, next_id_);
+        if (s)
+            e->writing_id = next_id_++;
+    }
+    if (!s)
+        error = Error::TOO_MANY_OPEN_FILES;
+    return s;
+}
+
+void
+LogFS::close (Stream *file)
+{
+    LogFSStream *s = static_cast<LogFSStream *> (file);
+    if (s->entry_)
+    {
+        s->flush ();
+        s->entry_->writing_id = 0;
+    }
+    else
+    {
+        LogFSStream **p = &readers_;
+        while (*p != s)
+            p = &(*p)->next_;
+        *p = s->next_;
+    }
+    pool_.destroy (s);
+}
+
+bool
+LogFS::stat (const char *filename, Stat &stat, Error &error)
+{
+    Entry *e = entry_find (filename, std::strlen (filename));
+    if (!e || !e->id)
+    {
+        error = Error::NO_SUCH_FILE;
+        return false;
+    }
+    stat.size = e->size;
+    return true;
+}
+
+int
+LogFS::list (const char *prefix, const ListCallback &callback)
+{
+    int prefix_size = std::strlen (prefix);
+    int listed = 0;
+    const Entry *last = nullptr;
+    while (true)
+    {
+        // Find the first name after the last listed one, files table is
+        // small, no need to sort it.
+        const Entry *first = nullptr;
+        for (const Entry &e : files_)
+        {
+            if (!e.id || e.name_size < prefix_size
+                || std::memcmp (e.name, prefix, prefix_size) != 0)
+                continue;
+            if (last && filename_compare (e.name, e.name_size, last->name,
+                                          last->name_size) <= 0)
+                continue;
+            if (!first || filename_compare (e.name, e.name_size, first->name,
+                                            first->name_size) < 0)
+                first = &e;
+        }
+        if (!first)
+            break;
+        listed++;
+        if (!callback (first->name, first->name_size))
+            break;
+        last = first;
+    }
+    return listed;
+}
+
+void
+LogFS::unlink (const char *filename)
+{
+    Entry *e = entry_find (filename, std::strlen (filename));
+    if (!e || !e->id)
+        return;
+    if (append (UNLINK, e->id, 0, e->name, e->name_size))
+        e->id = 0;
+}
+
+} // namespace ucoo
@@ -0,0 +1,258 @@
+#ifndef ucoo_base_fs_logfs_logfs_hh
+#define ucoo_base_fs_logfs_logfs_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/intf/file_system.hh"
+#include "ucoo/utils/pool.hh"
+#include "ucoo/common.hh"
+
+#include "config/ucoo/base/fs/logfs.hh"
+
+namespace ucoo {
+
+/// Writable file system, stored as a log in flash sectors, using
+/// self_programming.
+///
+/// Sectors are used in a circular way: records are appended to the head
+/// sector, and when it is full, the next sector is erased and becomes the
+/// head.  To reclaim space, records still in use are copied from the oldest
+/// sector (the tail) to the head, then the tail is erased.  This way, every
+/// sector is erased in turn, even when holding files which never change.
+///
+/// Sector structure, little endian:
+///  u32: 'LogF'
+///  u32: sequence number, incremented for each new head sector
+///  records, aligned on 32 bits
+///
+/// Record structure:
+///  u32: CRC-32 of the rest of header and payload
+///  u16: payload size
+///  u8: record type
+///  u8: reserved, zero
+///  u32: file identifier, unique for each written version of a file
+///  u32: DATA: offset of payload in file, COMMIT: file size, UNLINK: zero
+///  char[]: DATA: file content, COMMIT and UNLINK: file name
+///
+/// A new file version is only visible once a COMMIT record is written, when
+/// the file is flushed or closed.  Until then, the previous version is
+/// kept.  After a power loss, sectors and records are checked and a
+/// partially written record marks the end of the sector.  Two sectors are
+/// kept free so that an interrupted compaction can be resumed, the flash
+/// area should use sectors of the same size.
+///
+/// Data written to a file is gathered in a page buffer and written by
+/// records of at most page_size bytes (see configuration).
+///
+/// A file open for reading keeps reading the version it was opened with,
+/// even if it is replaced or unlinked, its records are kept by compaction
+/// until it is closed.
+class LogFS : public FileSystem
+{
+    /// Location of a record in the log.
+    struct Cursor
+    {
+        /// Sector index, or -1 if not set.
+        int sector;
+        /// Offset in sector.
+        int offset;
+    };
+    /// Record header, see class description.
+    struct Record
+    {
+        uint32_t crc;
+        uint16_t size;
+        uint8_t type;
+        uint8_t reserved;
+        uint32_t id;
+        uint32_t arg;
+    };
+    /// Record types.
+    enum RecordType
+    {
+        DATA = 1,
+        COMMIT = 2,
+        UNLINK = 3,
+    };
+    /// File in the files table.
+    struct Entry
+    {
+        /// Last committed version identifier, or 0 if not visible.
+        uint32_t id;
+        /// Version being written, or 0 if none.
+        uint32_t writing_id;
+        /// Committed size.
+        int size;
+        /// File name length.
+        int name_size;
+        /// File name, not zero terminated, aligned to be written directly.
+        char name[CONFIG_UCOO_BASE_FS_LOGFS_NAME_SIZE]
+            __attribute__ ((aligned (4)));
+    };
+    /// Stream from a LogFS.
+    class LogFSStream : public Stream
+    {
+      public:
+        /// Constructor for reading.
+        LogFSStream (LogFS &fs, uint32_t id, int size);
+        /// Constructor for writing.
+        LogFSStream (LogFS &fs, Entry &entry, uint32_t id);
+        /// See Stream::read.
+        int read (char *buf, int count) override;
+        /// See Stream::write.
+        int write (const char *buf, int count) override;
+        /// See Stream::poll.
+        int poll () override;
+        /// See Stream::seek.  Writing streams can only tell their position.
+        int seek (int offset, Whence whence = Whence::SET) override;
+        /// See Stream::size.
+        int size () override;
+        /// See Stream::flush.  Write buffered data and commit file.
+        bool flush () override;
+      private:
+        /// Write buffered data, return false on failure.
+        bool write_page ();
+      private:
+        friend class LogFS;
+        /// Parent file system.
+        LogFS &fs_;
+        /// File entry when writing, or nullptr when reading.
+        Entry *entry_;
+        /// File version identifier.
+        uint32_t id_;
+        /// Current position and size.
+        int pos_, size_;
+        /// Location of the last used record when reading.
+        Cursor cursor_;
+        /// Value of compactions counter when cursor was set.
+        uint32_t cursor_compactions_;
+        /// Next open reading stream.
+        LogFSStream *next_;
+        /// Number of bytes in page buffer.
+        int buffered_;
+        /// Page buffer, used when writing.
+        uint32_t page_[CONFIG_UCOO_BASE_FS_LOGFS_PAGE_SIZE / 4];
+    };
+  public:
+    /// Constructor, takes flash address and size, which must be aligned on
+    /// sectors.  Existing content is checked and used, anything else is
+    /// considered as free space.
+    LogFS (uint32_t addr, int size);
+    /// See FileSystem::open.
+    Stream *open (const char *filename, Mode mode, Error &error) override;
+    Stream *open (const char *filename, Mode mode = Mode::READ)
+    {
+        return FileSystem::open (filename, mode);
+    }
+    /// See FileSystem::close.  Written files are committed.
+    void close (Stream *file) override;
+    /// See FileSystem::stat.
+    bool stat (const char *filename, Stat &stat, Error &error) override;
+    /// See FileSystem::list.
+    int list (const char *prefix, const ListCallback &callback) override;
+    /// See FileSystem::unlink.
+    void unlink (const char *filename) override;
+    /// Reclaim space by copying records in use from the oldest sector, then
+    /// erasing it.  This is done when needed while writing, but can be
+    /// called when idle to prepare free sectors in advance.  Return false if
+    /// there is nothing to compact.
+    bool compact ();
+    /// Return the number of free sectors.
+    int free_sectors () const { return sectors_count_ - used_; }
+    /// Return the number of compactions done.
+    uint32_t compactions () const { return compactions_; }
+  private:
+    /// Check existing sectors and records, build files table.
+    void mount ();
+    /// Return size of a sector.
+    int sector_size (int sector) const
+    {
+        return sector_addr_[sector + 1] - sector_addr_[sector];
+    }
+    /// Return index of the sector following the given one.
+    int sector_next (int sector) const
+    {
+        return sector + 1 == sectors_count_ ? 0 : sector + 1;
+    }
+    /// Return record at cursor, or skip to the next sector when no more
+    /// record in this one.  Return nullptr at end of log.
+    const Record *record_get (Cursor &c) const;
+    /// Find a DATA record containing the given file offset, search starts
+    /// at cursor.  Return nullptr if not found.
+    const Record *record_find_data (uint32_t id, int offset,
+                                    Cursor &c) const;
+    /// Is this record still in use?
+    bool record_live (const Record &r) const;
+    /// Is there a copy of this record outside the tail sector?
+    bool record_copied (const Record &r) const;
+    /// Should this record from the tail sector be copied by compaction?
+    bool compact_needed (const Record &r, bool skip_copied) const;
+    /// Check whether records to be copied by compaction fit in free space.
+    bool compact_fits (bool skip_copied) const;
+    /// Append a record to the log, with its payload, reclaim space if
+    /// needed.  Return false if there is no space left.
+    bool append (uint8_t type, uint32_t id, uint32_t arg,
+                 const char *payload, int size);
+    /// Append a record to the head, use a new sector if needed.  Return
+    /// false if there is no free sector.
+    bool append_head (uint8_t type, uint32_t id, uint32_t arg,
+                      const char *payload, int size);
+    /// Erase and use next sector as head.  Return false if no free sector.
+    bool allocate ();
+    /// Find a file entry by name, or nullptr.
+    Entry *entry_find (const char *name, int name_size);
+    /// Find or allocate a file entry, or nullptr if table is full.
+    Entry *entry_get (const char *name, int name_size);
+  private:
+    /// Number of sectors.
+    int sectors_count_;
+    /// Address of each sector, plus end address.
+    uint32_t sector_addr_[CONFIG_UCOO_BASE_FS_LOGFS_SECTORS + 1];
+    /// End of valid records in each sector of the log.
+    int sector_end_[CONFIG_UCOO_BASE_FS_LOGFS_SECTORS];
+    /// Bit field of sectors known to be erased.
+    uint32_t erased_;
+    /// Oldest and newest sectors of the log, head is -1 if log is empty.
+    int tail_, head_;
+    /// Number of sectors in the log.
+    int used_;
+    /// Write offset in head sector, may be after sector end if the last
+    /// record was partially written.
+    int head_offset_;
+    /// Sequence number of next head sector.
+    uint32_t seq_;
+    /// Next file version identifier.
+    uint32_t next_id_;
+    /// Number of compactions, used to invalidate cursors.
+    uint32_t compactions_;
+    /// Files table.
+    Entry files_[CONFIG_UCOO_BASE_FS_LOGFS_FILES];
+    /// Pool of stream.
+    Pool<LogFSStream, CONFIG_UCOO_BASE_FS_LOGFS_STREAMS> pool_;
+    /// First open reading stream, their records are in use.
+    LogFSStream *readers_;
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_fs_logfs_logfs_hh
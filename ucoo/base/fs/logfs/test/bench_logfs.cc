@@ -0,0 +1,189 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/fs/logfs/logfs.hh"
+#include "ucoo/hal/self_programming/self_programming.host.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <algorithm>
+#include <cstdio>
+
+/// Flash area used for benchmarks, at flash start.
+static const uint32_t fs_addr = ucoo::self_programming_host_base;
+static int fs_size = 16 * 2048;
+
+/// Report flash usage, PROGRAMMED_BASE and BUSY_NS_BASE are the number of
+/// programmed bytes and modelled flash time before the benchmark.
+static void
+flash_info (ucoo::Bench &bench, ucoo::LogFS &fs, int written,
+            int programmed_base = 0, uint64_t busy_ns_base = 0)
+{
+    int min = -1, max = 0;
+    for (uint32_t addr = fs_addr; addr < fs_addr + fs_size;
+         addr += ucoo::self_programming_erase_size (addr))
+    {
+        int c = ucoo::self_programming_host_erase_count (addr);
+        min = min < 0 ? c : std::min (min, c);
+        max = std::max (max, c);
+    }
+    int programmed = ucoo::self_programming_host_programmed ()
+        - programmed_base;
+    int amp_milli = written ? static_cast<int64_t> (programmed) * 1000
+        / written : 0;
+    int flash_ms = (ucoo::self_programming_host_busy_ns () - busy_ns_base)
+        / 1000000;
+    bench.info ("programmed=%d amplification=%d.%03d compactions=%u "
+                "erases_min=%d erases_max=%d flash_ms=%d", programmed,
+                amp_milli / 1000, amp_milli % 1000,
+                static_cast<unsigned> (fs.compactions ()), min, max,
+                flash_ms);
+}
+
+/// Append to a log file by small writes, flushing from time to time.
+static void
+bench_log (ucoo::BenchSuite &bsuite, const char *name, int chunk,
+           int flush_every)
+{
+    ucoo::self_programming_host_reset ();
+    ucoo::LogFS fs (fs_addr, fs_size);
+    ucoo::Bench bench (bsuite, name);
+    char buf[256];
+    std::fill (buf, buf + sizeof (buf), 'x');
+    int written = 0;
+    bool ok = true;
+    // Write more than flash size, replacing the log when it is big.
+    for (int file = 0; ok && written < fs_size * 4; file++)
+    {
+        ucoo::Stream *s = fs.open (file % 2 ? "log.1" : "log.0",
+                                   ucoo::FileSystem::Mode::WRITE);
+        for (int i = 0; ok && i < fs_size / 6 / chunk; i++)
+        {
+            bench.start ();
+            int r = s->write (buf, chunk);
+            if (flush_every && i % flush_every == flush_every - 1)
+                s->flush ();
+            bench.stop (std::max (r, 0));
+            written += std::max (r, 0);
+            ok = r == chunk;
+        }
+        fs.close (s);
+    }
+    if (!ok)
+        bench.info ("no space left");
+    flash_info (bench, fs, written);
+}
+
+/// Rewrite a small calibration file, among static files.
+static void
+bench_rewrite (ucoo::BenchSuite &bsuite, const char *name, int size)
+{
+    ucoo::self_programming_host_reset ();
+    ucoo::LogFS fs (fs_addr, fs_size);
+    char buf[1024];
+    std::fill (buf, buf + sizeof (buf), 's');
+    for (int i = 0; i < 8; i++)
+    {
+        char static_name[16];
+        std::snprintf (static_name, sizeof (static_name), "static.%d", i);
+        ucoo::Stream *s = fs.open (static_name,
+                                   ucoo::FileSystem::Mode::WRITE);
+        s->write (buf, sizeof (buf));
+        fs.close (s);
+    }
+    int programmed_base = ucoo::self_programming_host_programmed ();
+    uint64_t busy_ns_base = ucoo::self_programming_host_busy_ns ();
+    ucoo::Bench bench (bsuite, name);
+    int written = 0;
+    for (int i = 0; i < 2000; i++)
+    {
+        bench.start ();
+        ucoo::Stream *s = fs.open ("cal", ucoo::FileSystem::Mode::WRITE);
+        s->write (buf, size);
+        fs.close (s);
+        bench.stop (size);
+        written += size;
+    }
+    flash_info (bench, fs, written, programmed_base, busy_ns_base);
+}
+
+/// Read a file sequentially.
+static void
+bench_read (ucoo::BenchSuite &bsuite, const char *name, int chunk)
+{
+    ucoo::self_programming_host_reset ();
+    ucoo::LogFS fs (fs_addr, fs_size);
+    char buf[256];
+    std::fill (buf, buf + sizeof (buf), 'r');
+    // Interleave two files.
+    ucoo::Stream *s0 = fs.open ("file.0", ucoo::FileSystem::Mode::WRITE);
+    ucoo::Stream *s1 = fs.open ("file.1", ucoo::FileSystem::Mode::WRITE);
+    for (int i = 0; i < fs_size / 4 / static_cast<int> (sizeof (buf)); i++)
+    {
+        s0->write (buf, sizeof (buf));
+        s1->write (buf, sizeof (buf));
+    }
+    fs.close (s0);
+    fs.close (s1);
+    ucoo::Bench bench (bsuite, name);
+    for (int i = 0; i < 20; i++)
+    {
+        ucoo::Stream *s = fs.open ("file.1");
+        int r;
+        do
+        {
+            bench.start ();
+            r = s->read (buf, chunk);
+            bench.stop (std::max (r, 0));
+        } while (r > 0);
+        fs.close (s);
+    }
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("logfs");
+    bsuite.group ("log");
+    bench_log (bsuite, "write16", 16, 0);
+    bench_log (bsuite, "write64", 64, 0);
+    bench_log (bsuite, "write16:flush64", 16, 64);
+    bench_log (bsuite, "write16:flush4", 16, 4);
+    bsuite.group ("rewrite");
+    bench_rewrite (bsuite, "cal32", 32);
+    bench_rewrite (bsuite, "cal256", 256);
+    bsuite.group ("read");
+    bench_read (bsuite, "read64", 64);
+    bench_read (bsuite, "read256", 256);
+    // Same on STM32F4 layout, using the four 16 KB sectors.
+    ucoo::self_programming_host_setup (
+        ucoo::SelfProgrammingHostLayout::STM32F4, 1024 * 1024);
+    fs_size = 4 * 16 * 1024;
+    bsuite.group ("stm32f4");
+    bench_log (bsuite, "write16:flush64", 16, 64);
+    bench_rewrite (bsuite, "cal32", 32);
+    return 0;
+}
@@ -0,0 +1,9 @@
+#ifndef obj_config_ucoo_base_fs_logfs_hh
+#define obj_config_ucoo_base_fs_logfs_hh
+// Generated from configuration.
+#define CONFIG_UCOO_BASE_FS_LOGFS_FILES (16)
+#define CONFIG_UCOO_BASE_FS_LOGFS_SECTORS (16)
+#define CONFIG_UCOO_BASE_FS_LOGFS_STREAMS (4)
+#define CONFIG_UCOO_BASE_FS_LOGFS_PAGE_SIZE (256)
+#define CONFIG_UCOO_BASE_FS_LOGFS_NAME_SIZE (32)
+#endif
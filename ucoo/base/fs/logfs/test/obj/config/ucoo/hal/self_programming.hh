@@ -0,0 +1,9 @@
+#ifndef obj_config_ucoo_hal_self_programming_hh
+#define obj_config_ucoo_hal_self_programming_hh
+// Generated from configuration.
+#define CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_ERASE_SIZE (2048)
+#define CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_FLASH_SIZE (65536)
+#define CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_FILE (nullptr)
+#define CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_LAYOUT (1)
+#define CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_SLEEP (false)
+#endif
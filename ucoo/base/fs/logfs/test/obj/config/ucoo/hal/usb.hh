@@ -0,0 +1,10 @@
+#ifndef obj_config_ucoo_hal_usb_hh
+#define obj_config_ucoo_hal_usb_hh
+// Generated from configuration.
+#define CONFIG_UCOO_HAL_USB_PRODUCT_ID (0x6052)
+#define CONFIG_UCOO_HAL_USB_TRACE (false)
+#define CONFIG_UCOO_HAL_USB_EP_SIZE (64)
+#define CONFIG_UCOO_HAL_USB_VENDOR_ID (0x1d50)
+#define CONFIG_UCOO_HAL_USB_MAX_POWER (100)
+#define CONFIG_UCOO_HAL_USB_SELF_POWERED (false)
+#endif
@@ -0,0 +1,290 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/fs/logfs/logfs.hh"
+#include "ucoo/hal/self_programming/self_programming.host.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/fs_test.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+/// Flash area used for tests, 8 sectors of 2 KB.
+static const uint32_t fs_addr = ucoo::self_programming_host_base;
+static const int fs_size = 8 * 2048;
+
+/// Fill buffer with a pattern depending on seed.
+static void
+pattern (char *buf, int size, int seed)
+{
+    for (int i = 0; i < size; i++)
+        buf[i] = (i * 7 + seed * 13 + i / 251) & 0xff;
+}
+
+/// Read a file and compare it to expected content.
+static bool
+check_file (ucoo::FileSystem &fs, const char *name, const char *data,
+            int size)
+{
+    ucoo::FileSystem::Stat st;
+    ucoo::FileSystem::Error error;
+    if (!fs.stat (name, st, error) || st.size != size)
+        return false;
+    return ucoo::test_fs_read (fs, name) == std::string (data, size);
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("logfs");
+    static char data[3][5000];
+    for (int i = 0; i < 3; i++)
+        pattern (data[i], sizeof (data[i]), i);
+    do {
+        ucoo::Test test (tsuite, "write and read");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        for (int chunk : { 1, 100, 256, 5000 })
+        {
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, "a", data[0], 1000, chunk));
+            test_fail_break_unless (test, check_file (fs, "a", data[0],
+                                                      1000));
+        }
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "empty", "", 0, 1));
+        test_fail_break_unless (test, check_file (fs, "empty", "", 0));
+        ucoo::Stream *s = fs.open ("a");
+        char buf[10];
+        test_fail_break_unless (test, s && s->seek (995) == 995
+                                && s->read (buf, sizeof (buf)) == 5
+                                && std::memcmp (buf, data[0] + 995, 5) == 0
+                                && s->read (buf, sizeof (buf)) == -2);
+        fs.close (s);
+        ucoo::FileSystem::Error error;
+        test_fail_break_unless (
+            test, !fs.open ("none", ucoo::FileSystem::Mode::READ, error)
+            && error == ucoo::FileSystem::Error::NO_SUCH_FILE);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "replace is atomic");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "cal", data[0], 300, 300));
+        ucoo::Stream *w = fs.open ("cal", ucoo::FileSystem::Mode::WRITE);
+        test_fail_break_unless (test, w && w->write (data[1], 700) == 700);
+        // Not committed yet, even after a remount.
+        test_fail_break_unless (test, check_file (fs, "cal", data[0], 300));
+        {
+            ucoo::LogFS fs2 (fs_addr, fs_size);
+            test_fail_break_unless (test, check_file (fs2, "cal", data[0],
+                                                      300));
+        }
+        fs.close (w);
+        test_fail_break_unless (test, check_file (fs, "cal", data[1], 700));
+        ucoo::LogFS fs2 (fs_addr, fs_size);
+        test_fail_break_unless (test, check_file (fs2, "cal", data[1], 700));
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "unlink and list");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        for (const char *name : { "log/2", "cal", "log/1", "log/3" })
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, name, name, std::strlen (name),
+                                           1));
+        fs.unlink ("log/2");
+        fs.unlink ("none");
+        test_fail_break_unless (test, !fs.open ("log/2"));
+        for (int remount = 0; remount < 2; remount++)
+        {
+            ucoo::LogFS fs2 (fs_addr, fs_size);
+            ucoo::LogFS &f = remount ? fs2 : fs;
+            ucoo::TestFsLister lister;
+            int n = f.list ("log/", ucoo::FileSystem::ListCallback (
+                    &lister, &ucoo::TestFsLister::add));
+            test_fail_break_unless (test, n == 2
+                                    && lister.names == "log/1 log/3 ");
+            lister.names.clear ();
+            n = f.list ("", ucoo::FileSystem::ListCallback (
+                    &lister, &ucoo::TestFsLister::add));
+            test_fail_break_unless (test, n == 3
+                                    && lister.names == "cal log/1 log/3 ");
+        }
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "compaction and wear leveling");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        // Static file, must survive compactions.
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "static", data[2], 2000, 64));
+        for (int i = 0; i < 200; i++)
+        {
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, "a", data[i % 2], 1500, 100));
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, "b", data[1], i * 7 % 1000,
+                                           33));
+        }
+        test_fail_break_unless (test, fs.compactions () > 0);
+        test_fail_break_unless (test, check_file (fs, "static", data[2],
+                                                  2000));
+        test_fail_break_unless (test, check_file (fs, "a", data[1], 1500));
+        ucoo::LogFS fs2 (fs_addr, fs_size);
+        test_fail_break_unless (test, check_file (fs2, "static", data[2],
+                                                  2000));
+        test_fail_break_unless (test, check_file (fs2, "a", data[1], 1500));
+        test_fail_break_unless (test, check_file (fs2, "b", data[1],
+                                                  199 * 7 % 1000));
+        int min = -1, max = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            int c = ucoo::self_programming_host_erase_count (fs_addr
+                                                             + i * 2048);
+            min = min < 0 ? c : std::min (min, c);
+            max = std::max (max, c);
+        }
+        test_fail_break_unless (test, min > 0 && max - min <= 2);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "readers survive compaction");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "a", data[0], 1000, 100));
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "b", data[1], 1000, 100));
+        ucoo::Stream *ra = fs.open ("a");
+        ucoo::Stream *rb = fs.open ("b");
+        test_fail_break_unless (test, ra && rb);
+        // Replace one, unlink the other, then force compactions.
+        fs.unlink ("b");
+        for (int i = 0; i < 20; i++)
+            test_fail_break_unless (
+                test, ucoo::test_fs_write (fs, "a", data[2], 1000, 100));
+        test_fail_break_unless (test, fs.compactions () > 8);
+        static char buf[1000];
+        int got = 0, r;
+        while ((r = ra->read (buf + got, sizeof (buf) - got)) > 0)
+            got += r;
+        test_fail_break_unless (test, got == 1000
+                                && std::memcmp (buf, data[0], 1000) == 0);
+        got = 0;
+        while ((r = rb->read (buf + got, sizeof (buf) - got)) > 0)
+            got += r;
+        test_fail_break_unless (test, got == 1000
+                                && std::memcmp (buf, data[1], 1000) == 0);
+        fs.close (ra);
+        fs.close (rb);
+        test_fail_break_unless (test, check_file (fs, "a", data[2], 1000));
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "no space left");
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS fs (fs_addr, fs_size);
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "keep", data[0], 5000, 256));
+        test_fail_break_unless (
+            test, !ucoo::test_fs_write (fs, "big", data[1], 5000, 256)
+            || !ucoo::test_fs_write (fs, "big2", data[1], 5000, 256));
+        test_fail_break_unless (test, check_file (fs, "keep", data[0],
+                                                  5000));
+        // Space is reclaimed after unlink.
+        fs.unlink ("big");
+        fs.unlink ("big2");
+        test_fail_break_unless (
+            test, ucoo::test_fs_write (fs, "big", data[1], 5000, 256));
+        test_fail_break_unless (test, check_file (fs, "big", data[1],
+                                                  5000));
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "power loss");
+        // Cut power at every point of an update which compacts, then
+        // check that the file system is usable with either old or new
+        // version of files.
+        auto setup = [&] (ucoo::LogFS &fs) {
+            bool ok = ucoo::test_fs_write (fs, "static", data[2], 3000, 256);
+            for (int i = 0; ok && i < 4; i++)
+                ok = ucoo::test_fs_write (fs, "a", data[i % 2], 2000, 256);
+            return ok && ucoo::test_fs_write (fs, "b", data[0], 100, 10);
+        };
+        auto update = [&] (ucoo::LogFS &fs) {
+            ucoo::test_fs_write (fs, "a", data[0], 3000, 256);
+            fs.unlink ("b");
+        };
+        // Reference run, without power loss.
+        ucoo::self_programming_host_reset ();
+        ucoo::LogFS ref (fs_addr, fs_size);
+        test_fail_break_unless (test, setup (ref));
+        int programmed = ucoo::self_programming_host_programmed ();
+        uint32_t compactions = ref.compactions ();
+        update (ref);
+        programmed = ucoo::self_programming_host_programmed () - programmed;
+        test_fail_break_unless (test, ref.compactions () > compactions);
+        auto check = [&] (ucoo::LogFS &fs, bool complete) {
+            ucoo::FileSystem::Stat st;
+            ucoo::FileSystem::Error error;
+            bool b_exists = fs.stat ("b", st, error);
+            bool a_new = check_file (fs, "a", data[0], 3000);
+            return check_file (fs, "static", data[2], 3000)
+                && (a_new || check_file (fs, "a", data[1], 2000))
+                && (!b_exists || check_file (fs, "b", data[0], 100))
+                && (!complete || (a_new && !b_exists));
+        };
+        bool ok = true;
+        for (int cut = 0; ok && cut <= programmed; cut++)
+        {
+            ucoo::self_programming_host_reset ();
+            {
+                ucoo::LogFS fs (fs_addr, fs_size);
+                ok = setup (fs);
+                ucoo::self_programming_host_power_cut (cut);
+                update (fs);
+                ucoo::self_programming_host_power_cut (-1);
+            }
+            {
+                // Cut power again, while recovering.
+                ucoo::LogFS fs (fs_addr, fs_size);
+                ok = ok && check (fs, cut == programmed);
+                ucoo::self_programming_host_power_cut (cut * 7 % 4000);
+                ucoo::test_fs_write (fs, "c", data[1], 3000, 256);
+                ucoo::self_programming_host_power_cut (-1);
+            }
+            ucoo::LogFS fs (fs_addr, fs_size);
+            ok = ok && check (fs, cut == programmed);
+            // Still writable.
+            ok = ok && ucoo::test_fs_write (fs, "c", data[1], 1000, 100)
+                && check_file (fs, "c", data[1], 1000);
+            ucoo::LogFS fs2 (fs_addr, fs_size);
+            ok = ok && check (fs2, cut == programmed)
+                && check_file (fs2, "c", data[1], 1000);
+        }
+        test_fail_break_unless (test, ok);
+    } while (0);
+    return tsuite.report () ? 0 : 1;
+}
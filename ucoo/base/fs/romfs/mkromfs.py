@@ -27,6 +27,10 @@ import struct
 import sys
 import os
 
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', '..',
+    'lzss'))
+import lzss
+
 p = argparse.ArgumentParser(description=__doc__)
 p.add_argument('-o', '--output', type=argparse.FileType('w'),
         default=sys.stdout,
@@ -36,6 +40,25 @@ p.add_argument('-i', '--header', metavar='VARNAME',
 p.add_argument('-p', '--search-path', action='append', metavar='PATH',
         default = [],
         help='search files in PATH, can be used several times')
+p.add_argument('-H', '--hash', action='store_true',
+        help='add a hash table for faster lookup')
+p.add_argument('-z', '--compress', action='store_true',
+        help='compress files, when this saves space')
+p.add_argument('--lzss-window-bits', type=int, default=lzss.WINDOW_BITS,
+        metavar='BITS', help='LZSS window size, must match decoder'
+        ' configuration')
+p.add_argument('--lzss-lookahead-bits', type=int,
+        default=lzss.LOOKAHEAD_BITS, metavar='BITS',
+        help='LZSS maximum match length, must match decoder configuration')
+p.add_argument('-a', '--align', type=int, default=1, metavar='BYTES',
+        help='align file contents, a power of two up to 32')
+p.add_argument('--align-ext', action='append', default=[],
+        metavar='EXT=BYTES', help='align file contents for files with the'
+        ' given extension, can be used several times')
+p.add_argument('-d', '--dedup', action='store_true',
+        help='store identical file contents only once')
+p.add_argument('-v', '--verbose', action='store_true',
+        help='report compression ratio and image size on standard error')
 p.add_argument('-S', '--not-static', dest='static',
         action='store_const', const='', default='static ',
         help='do not output static keyword')
@@ -45,15 +68,52 @@ options = p.parse_args()
 files = options.file
 files.sort()
 
+def fnv1a(s):
+    """Compute 32 bit FNV-1a hash."""
+    h = 0x811c9dc5
+    for c in s:
+        h = ((h ^ ord(c)) * 0x01000193) & 0xffffffff
+    return h
+
+def hash_table(files):
+    """Make an open addressing hash table, with a load factor of at most one
+    half, return its binary representation."""
+    assert len(files) < 0xffff
+    slots = 1
+    while slots < 2 * len(files):
+        slots *= 2
+    table = [0] * slots
+    for i, f in enumerate(files):
+        s = fnv1a(f) & (slots - 1)
+        while table[s]:
+            s = (s + 1) & (slots - 1)
+        table[s] = i + 1
+    if slots % 2:
+        table.append(0)
+    return (struct.pack('<II', hash_magic, slots)
+            + struct.pack('<%dH' % len(table), *table))
+
+def alignment(f):
+    """Return the alignment needed for a file."""
+    align = options.align
+    for a in options.align_ext:
+        ext, bytes = a.split('=', 1)
+        if f.endswith(ext):
+            align = int(bytes)
+    if align not in (1, 2, 4, 8, 16, 32):
+        p.error('bad alignment for %s: %d' % (f, align))
+    return align
+
 magic = 0x466d6f52
-h = struct.pack('<II', magic, len(files))
-indexes = [0]
-contents = []
+magic_v2 = 0x326d6f52
+hash_magic = 0x486d6f52
+compress_magic = 0x5a6d6f52
+sizes_magic = 0x536d6f52
 
-index = 0
-for f in files:
-    index += len(f)
-    indexes.append(index)
+# Read and compress files.
+contents = []
+sizes = []
+raw_size = 0
 for f in files:
     for p in options.search_path:
         fp = os.path.join(p, f)
@@ -63,14 +123,97 @@ for f in files:
         fp = f
     with open(fp) as fd:
         content = fd.read()
-        index += len(content)
-        indexes.append(index)
-        contents.append(content)
+    raw_size += len(content)
+    size = 0
+    if options.compress:
+        compressed = lzss.encode(content, options.lzss_window_bits,
+                options.lzss_lookahead_bits)
+        if len(compressed) < len(content):
+            size = len(content)
+            content = compressed
+    if options.verbose and options.compress:
+        print >> sys.stderr, '%s: %d -> %d%s' % (f, size or len(content),
+                len(content), ' (%.3f)' % (float(len(content)) / size)
+                if size else '')
+    contents.append(content)
+    sizes.append(size)
 
-indexes = struct.pack('<%dI' % len(indexes), *indexes)
+# Version 2 is needed when file contents are not contiguous: contents may be
+# shared and padding may be inserted.  Header has one more index, as file
+# contents start is not the end of file names, and a section gives file
+# sizes.
+v2 = bool(options.dedup or options.align != 1 or options.align_ext)
 names = ''.join(files)
-contents = ''.join(contents)
-fs = ''.join((h, indexes, names, contents))
+header_size = 4 * (3 + 2 * len(files) + (1 if v2 else 0))
+indexes = [0]
+index = 0
+for f in files:
+    index += len(f)
+    indexes.append(index)
+data = [names]
+offsets = []
+data_padding = 0
+dedup_saved = 0
+blobs = {}
+for f, content, size in zip(files, contents, sizes):
+    align = alignment(f)
+    key = (content, size)
+    if (options.dedup and key in blobs
+            and (header_size + blobs[key]) % align == 0):
+        offsets.append(blobs[key])
+        dedup_saved += len(content)
+        continue
+    # Alignment is relative to image start, which must be aligned too.
+    pad = -(header_size + index) % align
+    data.append('\0' * pad)
+    data_padding += pad
+    index += pad
+    offsets.append(index)
+    blobs.setdefault(key, index)
+    data.append(content)
+    index += len(content)
+if v2:
+    indexes += offsets + [index]
+else:
+    indexes += [o + len(c) for o, c in zip(offsets, contents)]
+h = struct.pack('<II', magic_v2 if v2 else magic, len(files))
+indexes = struct.pack('<%dI' % len(indexes), *indexes)
+fs = ''.join([h, indexes] + data)
+image_align = max([4] + [alignment(f) for f in files])
+
+sections = []
+if v2:
+    sections.append(struct.pack('<II%dI' % len(contents), sizes_magic,
+        len(contents), *[len(c) for c in contents]))
+if any(sizes):
+    sections.append(struct.pack('<II%dI' % len(sizes), compress_magic,
+            options.lzss_window_bits | options.lzss_lookahead_bits << 8,
+            *sizes))
+if options.hash:
+    sections.append(hash_table(files))
+sections_padding = 0
+if sections:
+    sections_padding = -len(fs) % 4
+    fs += '\0' * sections_padding
+    fs += ''.join(sections)
+
+if options.verbose:
+    if options.compress:
+        stored = sum(len(c) for c in contents)
+        print >> sys.stderr, 'compression: %d -> %d (%.3f)' % (raw_size,
+                stored, float(stored) / raw_size if raw_size else 1.0)
+    report = [
+            ('header', header_size),
+            ('names', len(names)),
+            ('contents', index - len(names) - data_padding),
+            ('padding', data_padding + sections_padding),
+            ('sections', sum(len(s) for s in sections)),
+            ('total', len(fs)),
+            ]
+    if options.dedup:
+        report.append(('dedup saved', dedup_saved))
+    for name, size in report:
+        print >> sys.stderr, '%s: %d' % (name, size)
 
 if options.header:
     pad = (len(fs) + 3) / 4 * 4 - len(fs)
@@ -79,8 +222,10 @@ if options.header:
     words = struct.unpack('<%dI' % (len(fs) / 4), fs)
     lines = [ '/* Auto-generated ROM FS from:' ]
     lines += [ ' *  - %s' % f for f in files ]
-    lines += [ ' */', '', '%sconst uint32_t %s[] = {'
-            % (options.static, options.header) ]
+    attribute = (' __attribute__ ((aligned (%d)))' % image_align
+            if image_align > 4 else '')
+    lines += [ ' */', '', '%sconst uint32_t %s[]%s = {'
+            % (options.static, options.header, attribute) ]
     for i in xrange(0, len(words), 4):
         w = [ '0x%08x,' % i for i in words[i:i+4] ]
         lines.append('    ' + ' '.join (w))
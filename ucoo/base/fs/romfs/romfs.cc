@@ -30,13 +30,92 @@ namespace ucoo {
 
 
 RomFS::RomFSStream::RomFSStream (const char *begin, const char *end)
-    : begin_ (begin), end_ (end)
+    : start_ (begin), begin_ (begin), end_ (end)
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+      , decoder_ (nullptr), size_ (0), pos_ (0)
+#endif
+{
+}
+
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+
+RomFS::RomFSStream::RomFSStream (const char *begin, const char *end,
+                                 int size, LzssDecoder *decoder)
+    : start_ (begin), begin_ (begin), end_ (end), decoder_ (decoder),
+      size_ (size), pos_ (0)
 {
 }
 
+int
+RomFS::RomFSStream::read_compressed (char *buf, int count)
+{
+    int l = std::min (count, size_ - pos_);
+    if (!l)
+        return -2;
+    int out = 0;
+    while (out < l)
+    {
+        int used;
+        int r = decoder_->decode (begin_, end_ - begin_, used, buf + out,
+                                  l - out);
+        begin_ += used;
+        out += r;
+        if (!r && !used)
+            // Truncated data.
+            break;
+    }
+    pos_ += out;
+    return out ? out : -1;
+}
+
+int
+RomFS::RomFSStream::seek_compressed (int offset, Whence whence)
+{
+    int origin;
+    switch (whence)
+    {
+    case Whence::SET:
+        origin = 0;
+        break;
+    case Whence::CUR:
+        origin = pos_;
+        break;
+    case Whence::END:
+        origin = size_;
+        break;
+    default:
+        assert_unreachable ();
+    }
+    if (offset < -origin || offset > size_ - origin)
+        return -1;
+    int pos = origin + offset;
+    if (pos < pos_)
+    {
+        // Can not go backward, decode again from start.
+        *decoder_ = LzssDecoder ();
+        begin_ = start_;
+        pos_ = 0;
+    }
+    while (pos_ < pos)
+    {
+        char buf[32];
+        int r = read_compressed (buf, std::min<int> (sizeof (buf),
+                                                     pos - pos_));
+        if (r < 0)
+            return -1;
+    }
+    return pos_;
+}
+
+#endif // CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+
 int
 RomFS::RomFSStream::read (char *buf, int count)
 {
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    if (decoder_)
+        return read_compressed (buf, count);
+#endif
     int l = std::min<int> (count, end_ - begin_);
     if (!l)
         return -2;
@@ -57,20 +136,102 @@ RomFS::RomFSStream::write (const char *buf, int count)
 int
 RomFS::RomFSStream::poll ()
 {
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    if (decoder_)
+        return size_ - pos_;
+#endif
     return end_ - begin_;
 }
 
+int
+RomFS::RomFSStream::seek (int offset, Whence whence/*SET*/)
+{
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    if (decoder_)
+        return seek_compressed (offset, whence);
+#endif
+    const char *origin;
+    switch (whence)
+    {
+    case Whence::SET:
+        origin = start_;
+        break;
+    case Whence::CUR:
+        origin = begin_;
+        break;
+    case Whence::END:
+        origin = end_;
+        break;
+    default:
+        assert_unreachable ();
+    }
+    if (offset < start_ - origin || offset > end_ - origin)
+        return -1;
+    begin_ = origin + offset;
+    return begin_ - start_;
+}
+
+int
+RomFS::RomFSStream::size ()
+{
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    if (decoder_)
+        return size_;
+#endif
+    return end_ - start_;
+}
+
 RomFS::RomFS (const uint32_t *addr, int size)
+    : filesizes_ (nullptr), hash_ (nullptr), hash_mask_ (0),
+      decompressed_sizes_ (nullptr)
 {
     ucoo::assert (size >= 12);
-    ucoo::assert (addr[0] == 0x466d6f52); // RomF
+    bool v2 = addr[0] == 0x326d6f52; // Rom2
+    ucoo::assert (v2 || addr[0] == 0x466d6f52); // RomF
     files_count_ = addr[1];
-    ucoo::assert (size >= 12 + 8 * files_count_);
+    int header_words = 3 + 2 * files_count_ + (v2 ? 1 : 0);
+    ucoo::assert (size >= 4 * header_words);
     filenames_ = &addr[2];
-    filecontents_ = &addr[2 + files_count_];
-    ucoo::assert (size >= 12 + 8 * files_count_
+    filecontents_ = &addr[2 + files_count_ + (v2 ? 1 : 0)];
+    ucoo::assert (size >= 4 * header_words
                   + static_cast<int> (filecontents_[files_count_]));
-    data_ = reinterpret_cast<const char *> (&addr[3 + 2 * files_count_]);
+    data_ = reinterpret_cast<const char *> (&addr[header_words]);
+    // Optional sections.
+    int index = header_words + (filecontents_[files_count_] + 3) / 4;
+    int words = size / 4;
+    while (index + 2 <= words)
+    {
+        if (addr[index] == 0x486d6f52) // RomH
+        {
+            uint32_t slots = addr[index + 1];
+            ucoo::assert (slots && (slots & (slots - 1)) == 0);
+            ucoo::assert (index + 2 + static_cast<int> (slots + 1) / 2
+                          <= words);
+            hash_ = reinterpret_cast<const uint16_t *> (&addr[index + 2]);
+            hash_mask_ = slots - 1;
+            index += 2 + (slots + 1) / 2;
+        }
+        else if (addr[index] == 0x536d6f52) // RomS
+        {
+            ucoo::assert (static_cast<int> (addr[index + 1]) == files_count_);
+            ucoo::assert (index + 2 + files_count_ <= words);
+            filesizes_ = &addr[index + 2];
+            index += 2 + files_count_;
+        }
+        else if (addr[index] == 0x5a6d6f52) // RomZ
+        {
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+            ucoo::assert (addr[index + 1] == static_cast<uint32_t> (
+                    Lzss::window_bits | Lzss::lookahead_bits << 8));
+#endif
+            ucoo::assert (index + 2 + files_count_ <= words);
+            decompressed_sizes_ = &addr[index + 2];
+            index += 2 + files_count_;
+        }
+        else
+            break;
+    }
+    ucoo::assert (!v2 || filesizes_);
 }
 
 static int
@@ -83,16 +244,48 @@ filename_compare (const char *a, int a_len, const char *b, int b_len)
         return bcmp;
 }
 
-Stream *
-RomFS::open (const char *filename, Mode mode, Error &error)
+/// Compute FNV-1a hash of a string.
+static uint32_t
+fnv1a (const char *s, int len)
 {
-    if (mode == Mode::WRITE)
+    uint32_t h = 0x811c9dc5;
+    for (int i = 0; i < len; i++)
+        h = (h ^ static_cast<uint8_t> (s[i])) * 0x01000193;
+    return h;
+}
+
+int
+RomFS::find (const char *filename, int filename_len) const
+{
+    if (hash_)
     {
-        error = Error::READ_ONLY;
-        return nullptr;
+        // Hash table search, table is never full.
+        uint32_t slot = fnv1a (filename, filename_len) & hash_mask_;
+        int e;
+        while ((e = hash_[slot]))
+        {
+            int i = e - 1;
+            const char *i_name = data_ + filenames_[i];
+            int i_len = filenames_[i + 1] - filenames_[i];
+            if (filename_len == i_len
+                && std::memcmp (filename, i_name, i_len) == 0)
+                return i;
+            slot = (slot + 1) & hash_mask_;
+        }
+        return -1;
     }
-    int filename_len = std::strlen (filename);
     // Dichotomy search.
+    int i = lower_bound (filename, filename_len);
+    if (i < files_count_
+        && filename_compare (filename, filename_len, data_ + filenames_[i],
+                             filenames_[i + 1] - filenames_[i]) == 0)
+        return i;
+    return -1;
+}
+
+int
+RomFS::lower_bound (const char *filename, int filename_len) const
+{
     int begin = 0;
     int end = files_count_;
     while (begin != end)
@@ -102,30 +295,118 @@ RomFS::open (const char *filename, Mode mode, Error &error)
         const char *i_name = data_ + filenames_[i];
         int i_len = filenames_[i + 1] - filenames_[i];
         int cmp = filename_compare (filename, filename_len, i_name, i_len);
-        if (cmp < 0)
+        if (cmp <= 0)
             end = i;
-        else if (cmp > 0)
-            begin = i + 1;
         else
+            begin = i + 1;
+    }
+    return begin;
+}
+
+Stream *
+RomFS::open (const char *filename, Mode mode, Error &error)
+{
+    if (mode == Mode::WRITE)
+    {
+        error = Error::READ_ONLY;
+        return nullptr;
+    }
+    int i = find (filename, std::strlen (filename));
+    if (i < 0)
+    {
+        error = Error::NO_SUCH_FILE;
+        return nullptr;
+    }
+    const char *begin = data_ + filecontents_[i];
+    const char *end = begin + file_size (i);
+    RomFSStream *s;
+    if (decompressed_sizes_ && decompressed_sizes_[i])
+    {
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+        LzssDecoder *decoder = decoders_.construct ();
+        if (!decoder)
         {
-            // Match.
-            const char *begin = data_ + filecontents_[i];
-            const char *end = data_ + filecontents_[i + 1];
-            RomFSStream *s = pool_.construct (begin, end);
-            if (!s)
-                error = Error::TOO_MANY_OPEN_FILES;
-            return s;
+            error = Error::TOO_MANY_OPEN_FILES;
+            return nullptr;
         }
+        s = pool_.construct (begin, end, decompressed_sizes_[i], decoder);
+        if (!s)
+            decoders_.destroy (decoder);
+#else
+        // Compression support is disabled.
+        error = Error::ACCESS_DENIED;
+        return nullptr;
+#endif
     }
-    // Not found.
-    error = Error::NO_SUCH_FILE;
-    return nullptr;
+    else
+        s = pool_.construct (begin, end);
+    if (!s)
+        error = Error::TOO_MANY_OPEN_FILES;
+    return s;
 }
 
 void
 RomFS::close (Stream *file)
 {
-    pool_.destroy (static_cast<RomFSStream *> (file));
+    RomFSStream *s = static_cast<RomFSStream *> (file);
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    if (s->decoder_)
+        decoders_.destroy (s->decoder_);
+#endif
+    pool_.destroy (s);
+}
+
+const char *
+RomFS::map (const char *filename, int &size, Error &error)
+{
+    int i = find (filename, std::strlen (filename));
+    if (i < 0)
+    {
+        error = Error::NO_SUCH_FILE;
+        return nullptr;
+    }
+    if (decompressed_sizes_ && decompressed_sizes_[i])
+    {
+        error = Error::NOT_SUPPORTED;
+        return nullptr;
+    }
+    size = file_size (i);
+    return data_ + filecontents_[i];
+}
+
+bool
+RomFS::stat (const char *filename, Stat &stat, Error &error)
+{
+    int i = find (filename, std::strlen (filename));
+    if (i < 0)
+    {
+        error = Error::NO_SUCH_FILE;
+        return false;
+    }
+    if (decompressed_sizes_ && decompressed_sizes_[i])
+        stat.size = decompressed_sizes_[i];
+    else
+        stat.size = file_size (i);
+    return true;
+}
+
+int
+RomFS::list (const char *prefix, const ListCallback &callback)
+{
+    int prefix_len = std::strlen (prefix);
+    int listed = 0;
+    for (int i = lower_bound (prefix, prefix_len); i < files_count_; i++)
+    {
+        const char *i_name = data_ + filenames_[i];
+        int i_len = filenames_[i + 1] - filenames_[i];
+        if (i_len < prefix_len
+            || std::memcmp (i_name, prefix, prefix_len) != 0)
+            break;
+        listed++;
+        if (!callback (i_name, i_len))
+            break;
+    }
+    return listed;
 }
 
 void
@@ -27,6 +27,12 @@
 #include "ucoo/utils/pool.hh"
 #include "ucoo/common.hh"
 
+#include "config/ucoo/base/fs/romfs.hh"
+
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+# include "ucoo/base/lzss/lzss.hh"
+#endif
+
 namespace ucoo {
 
 /// Read only file system, read data from a buffer.
@@ -39,6 +45,44 @@ namespace ucoo {
 ///  u32: index in data buffer to first unused byte
 ///  char[][n]: file names, not zero terminated
 ///  char[][n]: file contents
+///
+/// Version 2 is used when file contents are aligned or shared between
+/// identical files:
+///  u32: 'Rom2'
+///  u32: number of files
+///  u32[n + 1]: indexes in data buffer of file names, then end of names
+///  u32[n]: indexes in data buffer of file content, not necessarily
+///  increasing
+///  u32: index in data buffer to first unused byte
+///  char[][n]: file names, not zero terminated
+///  char[][]: file contents and padding
+///
+/// In version 2, file sizes are given in a mandatory sizes section.
+///
+/// Optionally followed by extra sections, aligned on 32 bits, in any order.
+///
+/// Sizes:
+///  u32: 'RomS'
+///  u32: number of files
+///  u32[n]: file size, as stored
+///
+/// Hash table:
+///  u32: 'RomH'
+///  u32: number of slots, a power of two
+///  u16[slots]: file index plus one, or zero for an empty slot
+///
+/// Files are placed in the slot given by the FNV-1a hash of their name, or
+/// in the following free slot (linear probing).  When there is no hash
+/// table, lookup uses a dichotomy search.
+///
+/// Compression:
+///  u32: 'RomZ'
+///  u32: LZSS window_bits, plus lookahead_bits << 8
+///  u32[n]: decompressed file size, or zero if file is stored
+///
+/// Compressed file contents are LZSS encoded, they are decompressed on the
+/// fly when read, which needs a decoder per open file (see
+/// compressed_streams in configuration).
 class RomFS : public FileSystem
 {
     /// Stream from a romfs.
@@ -47,14 +91,40 @@ class RomFS : public FileSystem
       public:
         /// Constructor from a memory chunk.
         RomFSStream (const char *begin, const char *end);
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+        /// Constructor from a compressed memory chunk, with the size of
+        /// decompressed data.
+        RomFSStream (const char *begin, const char *end, int size,
+                     LzssDecoder *decoder);
+#endif
         /// See Stream::read.
         int read (char *buf, int count) override;
         /// See Stream::write.
         int write (const char *buf, int count) override;
         /// See Stream::poll.
         int poll () override;
+        /// See Stream::seek.
+        int seek (int offset, Whence whence = Whence::SET) override;
+        /// See Stream::size.
+        int size () override;
+      private:
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+        /// Read compressed data.
+        int read_compressed (char *buf, int count);
+        /// Seek in compressed data, by decoding from start if needed.
+        int seek_compressed (int offset, Whence whence);
+#endif
       private:
-        const char *begin_, *end_;
+        friend class RomFS;
+        /// File start, current position and end.  For a compressed file,
+        /// this is the position in compressed data.
+        const char *start_, *begin_, *end_;
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+        /// Decoder for compressed file, or nullptr.
+        LzssDecoder *decoder_;
+        /// Decompressed size and position.
+        int size_, pos_;
+#endif
     };
   public:
     /// Constructor, takes romfs address and size.
@@ -67,8 +137,32 @@ class RomFS : public FileSystem
     }
     /// See FileSystem::close.
     void close (Stream *file) override;
+    /// See FileSystem::map.  Compressed files can not be mapped.
+    const char *map (const char *filename, int &size, Error &error)
+        override;
+    const char *map (const char *filename, int &size)
+    {
+        return FileSystem::map (filename, size);
+    }
+    /// See FileSystem::stat.
+    bool stat (const char *filename, Stat &stat, Error &error) override;
+    /// See FileSystem::list.  Use a dichotomy search to find the first file,
+    /// then walk the sorted names.
+    int list (const char *prefix, const ListCallback &callback) override;
     /// See FileSystem::unlink, this is a no-op.
     void unlink (const char *filename) override;
+  private:
+    /// Find a file, return its index or -1 if not found.
+    int find (const char *filename, int filename_len) const;
+    /// Return the index of the first file which name is not lower than
+    /// FILENAME, or the number of files if none.
+    int lower_bound (const char *filename, int filename_len) const;
+    /// Return stored size of a file.
+    int file_size (int i) const
+    {
+        return filesizes_ ? filesizes_[i]
+            : filecontents_[i + 1] - filecontents_[i];
+    }
   private:
     /// Number of files.
     int files_count_;
@@ -76,8 +170,20 @@ class RomFS : public FileSystem
     const uint32_t *filenames_;
     /// File contents indexes.
     const uint32_t *filecontents_;
+    /// File sizes for version 2, or nullptr if files are contiguous.
+    const uint32_t *filesizes_;
     /// Byte array with file names and contents.
     const char *data_;
+    /// Hash table, or nullptr if absent.
+    const uint16_t *hash_;
+    /// Hash table slots number minus one.
+    uint32_t hash_mask_;
+    /// Decompressed file sizes, or nullptr if no file is compressed.
+    const uint32_t *decompressed_sizes_;
+#if CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS
+    /// Pool of decoders.
+    Pool<LzssDecoder, CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS> decoders_;
+#endif
     /// Pool of stream.
     Pool<RomFSStream, 5> pool_;
 };
@@ -0,0 +1,318 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/fs/romfs/romfs.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/base/test/test.hh"
+
+#include "bench_fs_16.h"
+#include "bench_fs_128.h"
+#include "bench_fs_1024.h"
+#include "bench_fs_hash_16.h"
+#include "bench_fs_hash_128.h"
+#include "bench_fs_hash_1024.h"
+#include "bench_fs_text.h"
+#include "bench_fs_text_z.h"
+#include "bench_fs_text_a.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+/// Open and close every file of a file system, plus missing files.
+static void
+bench_open (ucoo::BenchSuite &bsuite, const char *name, const uint32_t *fs,
+            int fs_size, int files_nb)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::RomFS romfs (fs, fs_size);
+    int errors = 0;
+    for (int j = 0; j < 4; j++)
+    {
+        for (int i = 0; i < files_nb; i += 16)
+        {
+            char names[16][16];
+            int n = std::min (16, files_nb - i);
+            for (int k = 0; k < n; k++)
+                snprintf (names[k], sizeof (names[k]), "file%04d.txt",
+                          i + k + 1 + (j == 3 ? files_nb : 0));
+            uint64_t start = ucoo::bench_time_ns ();
+            for (int k = 0; k < n; k++)
+            {
+                ucoo::Stream *s = romfs.open (names[k]);
+                if (s)
+                    romfs.close (s);
+                // Last round is done with missing files.
+                if (!s != (j == 3))
+                    errors++;
+            }
+            bench.add (ucoo::bench_time_ns () - start, n);
+        }
+    }
+    if (errors)
+        bench.info ("%d errors", errors);
+}
+
+/// Files used for read benchmark.
+static const char *read_files[] = { "hello.txt", "mkromfs.py", "romfs.cc",
+    "romfs.hh" };
+
+/// Read every file of a file system, using reads of CHUNK bytes.
+static void
+bench_read (ucoo::BenchSuite &bsuite, const char *name, const uint32_t *fs,
+            int fs_size, int chunk, int raw_fs_size)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::RomFS romfs (fs, fs_size);
+    int errors = 0;
+    for (int j = 0; j < 8; j++)
+    {
+        for (const char *f : read_files)
+        {
+            char buf[256];
+            int r, size = 0;
+            bench.start ();
+            ucoo::Stream *s = romfs.open (f);
+            if (!s)
+                errors++;
+            else
+            {
+                while ((r = s->read (buf, chunk)) > 0)
+                    size += r;
+                if (r != -2)
+                    errors++;
+                romfs.close (s);
+            }
+            bench.stop (size);
+        }
+    }
+    bench.info ("image %d bytes, ratio %.3f", fs_size,
+                static_cast<double> (fs_size) / raw_fs_size);
+    if (errors)
+        bench.info ("%d errors", errors);
+}
+
+/// Compute a checksum of a file content, using content in place if MAP is
+/// true, else by reading it.
+static unsigned
+checksum (ucoo::RomFS &romfs, const char *f, bool map, int &size)
+{
+    unsigned sum = 0;
+    if (map)
+    {
+        const char *data = romfs.map (f, size);
+        if (!data)
+            return 0;
+        for (int i = 0; i < size; i++)
+            sum += static_cast<uint8_t> (data[i]);
+    }
+    else
+    {
+        ucoo::Stream *s = romfs.open (f);
+        if (!s)
+            return 0;
+        char buf[256];
+        int r;
+        size = 0;
+        while ((r = s->read (buf, sizeof (buf))) > 0)
+        {
+            for (int i = 0; i < r; i++)
+                sum += static_cast<uint8_t> (buf[i]);
+            size += r;
+        }
+        romfs.close (s);
+    }
+    return sum;
+}
+
+/// Use every file content, compare access in place to reading.
+static void
+bench_map (ucoo::BenchSuite &bsuite, const char *name, const uint32_t *fs,
+           int fs_size, bool map)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::RomFS romfs (fs, fs_size);
+    int errors = 0;
+    for (int j = 0; j < 8; j++)
+    {
+        for (const char *f : read_files)
+        {
+            int size = 0, check_size = 0;
+            bench.start ();
+            unsigned sum = checksum (romfs, f, map, size);
+            bench.stop (size);
+            // Check against the other method.
+            if (!size || checksum (romfs, f, !map, check_size) != sum
+                || check_size != size)
+                errors++;
+        }
+    }
+    if (errors)
+        bench.info ("%d errors", errors);
+}
+
+/// Sum file contents as 32 bit words, using content in place when aligned,
+/// else by copying it to an aligned buffer.
+static void
+bench_sum32 (ucoo::BenchSuite &bsuite, const char *name, const uint32_t *fs,
+             int fs_size)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::RomFS romfs (fs, fs_size);
+    int errors = 0;
+    for (int j = 0; j < 8; j++)
+    {
+        for (const char *f : read_files)
+        {
+            static uint32_t buf[16384 / 4];
+            int size;
+            uint32_t sum = 0;
+            bench.start ();
+            const char *data = romfs.map (f, size);
+            if (!data || size > static_cast<int> (sizeof (buf)))
+            {
+                errors++;
+                continue;
+            }
+            const uint32_t *words;
+            if (reinterpret_cast<uintptr_t> (data) % 4 == 0)
+                words = reinterpret_cast<const uint32_t *> (data);
+            else
+            {
+                std::memcpy (buf, data, size);
+                words = buf;
+            }
+            for (int i = 0; i < size / 4; i++)
+                sum += words[i];
+            bench.stop (size);
+            if (!sum)
+                errors++;
+        }
+    }
+    if (errors)
+        bench.info ("%d errors", errors);
+}
+
+/// Count listed files.
+struct Counter
+{
+    int count = 0;
+    bool add (const char *name, int name_size)
+    {
+        count++;
+        return true;
+    }
+};
+
+/// Find files with a prefix, using list or stat on every possible name.
+static void
+bench_list (ucoo::BenchSuite &bsuite, const char *name, const uint32_t *fs,
+            int fs_size, bool list)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::RomFS romfs (fs, fs_size);
+    int errors = 0;
+    for (int j = 0; j < 16; j++)
+    {
+        Counter counter;
+        bench.start ();
+        if (list)
+            romfs.list ("file00", { &counter, &Counter::add });
+        else
+        {
+            for (int i = 0; i < 100; i++)
+            {
+                char name[16];
+                ucoo::FileSystem::Stat stat;
+                ucoo::FileSystem::Error error;
+                snprintf (name, sizeof (name), "file00%02d.txt", i);
+                if (romfs.stat (name, stat, error))
+                    counter.add (name, 0);
+            }
+        }
+        bench.stop ();
+        if (counter.count != 99)
+            errors++;
+    }
+    if (errors)
+        bench.info ("%d errors", errors);
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("romfs");
+    bsuite.group ("open");
+    bench_open (bsuite, "dichotomy:16", bench_fs_16, sizeof (bench_fs_16),
+                16);
+    bench_open (bsuite, "hash:16", bench_fs_hash_16,
+                sizeof (bench_fs_hash_16), 16);
+    bench_open (bsuite, "dichotomy:128", bench_fs_128, sizeof (bench_fs_128),
+                128);
+    bench_open (bsuite, "hash:128", bench_fs_hash_128,
+                sizeof (bench_fs_hash_128), 128);
+    bench_open (bsuite, "dichotomy:1024", bench_fs_1024,
+                sizeof (bench_fs_1024), 1024);
+    bench_open (bsuite, "hash:1024", bench_fs_hash_1024,
+                sizeof (bench_fs_hash_1024), 1024);
+    bsuite.group ("list");
+    bench_list (bsuite, "list", bench_fs_1024, sizeof (bench_fs_1024), true);
+    bench_list (bsuite, "stat", bench_fs_1024, sizeof (bench_fs_1024),
+                false);
+    bench_list (bsuite, "stat:hash", bench_fs_hash_1024,
+                sizeof (bench_fs_hash_1024), false);
+    bsuite.group ("read");
+    bench_read (bsuite, "raw:16", bench_fs_text, sizeof (bench_fs_text), 16,
+                sizeof (bench_fs_text));
+    bench_read (bsuite, "lzss:16", bench_fs_text_z, sizeof (bench_fs_text_z),
+                16, sizeof (bench_fs_text));
+    bench_read (bsuite, "raw:256", bench_fs_text, sizeof (bench_fs_text),
+                256, sizeof (bench_fs_text));
+    bench_read (bsuite, "lzss:256", bench_fs_text_z,
+                sizeof (bench_fs_text_z), 256, sizeof (bench_fs_text));
+    bench_map (bsuite, "sum:read", bench_fs_text, sizeof (bench_fs_text),
+               false);
+    bench_map (bsuite, "sum:map", bench_fs_text, sizeof (bench_fs_text),
+               true);
+    bsuite.group ("layout");
+    {
+        // Check aligned and shared contents.
+        ucoo::RomFS romfs (bench_fs_text_a, sizeof (bench_fs_text_a));
+        int hello_size, copy_size, cc_size;
+        const char *hello = romfs.map ("hello.txt", hello_size);
+        const char *copy = romfs.map ("hello_copy.txt", copy_size);
+        const char *cc = romfs.map ("romfs.cc", cc_size);
+        if (!hello || hello != copy || hello_size != copy_size
+            || reinterpret_cast<uintptr_t> (hello) % 32 != 0
+            || !cc || reinterpret_cast<uintptr_t> (cc) % 4 != 0)
+            printf ("layout error\n");
+    }
+    bench_sum32 (bsuite, "sum32:packed", bench_fs_text,
+                 sizeof (bench_fs_text));
+    bench_sum32 (bsuite, "sum32:aligned", bench_fs_text_a,
+                 sizeof (bench_fs_text_a));
+    return 0;
+}
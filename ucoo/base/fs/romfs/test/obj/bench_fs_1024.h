@@ -0,0 +1,3144 @@
+/* Auto-generated ROM FS from:
+ *  - file0001.txt
+ *  - file0002.txt
+ *  - file0003.txt
+ *  - file0004.txt
+ *  - file0005.txt
+ *  - file0006.txt
+ *  - file0007.txt
+ *  - file0008.txt
+ *  - file0009.txt
+ *  - file0010.txt
+ *  - file0011.txt
+ *  - file0012.txt
+ *  - file0013.txt
+ *  - file0014.txt
+ *  - file0015.txt
+ *  - file0016.txt
+ *  - file0017.txt
+ *  - file0018.txt
+ *  - file0019.txt
+ *  - file0020.txt
+ *  - file0021.txt
+ *  - file0022.txt
+ *  - file0023.txt
+ *  - file0024.txt
+ *  - file0025.txt
+ *  - file0026.txt
+ *  - file0027.txt
+ *  - file0028.txt
+ *  - file0029.txt
+ *  - file0030.txt
+ *  - file0031.txt
+ *  - file0032.txt
+ *  - file0033.txt
+ *  - file0034.txt
+ *  - file0035.txt
+ *  - file0036.txt
+ *  - file0037.txt
+ *  - file0038.txt
+ *  - file0039.txt
+ *  - file0040.txt
+ *  - file0041.txt
+ *  - file0042.txt
+ *  - file0043.txt
+ *  - file0044.txt
+ *  - file0045.txt
+ *  - file0046.txt
+ *  - file0047.txt
+ *  - file0048.txt
+ *  - file0049.txt
+ *  - file0050.txt
+ *  - file0051.txt
+ *  - file0052.txt
+ *  - file0053.txt
+ *  - file0054.txt
+ *  - file0055.txt
+ *  - file0056.txt
+ *  - file0057.txt
+ *  - file0058.txt
+ *  - file0059.txt
+ *  - file0060.txt
+ *  - file0061.txt
+ *  - file0062.txt
+ *  - file0063.txt
+ *  - file0064.txt
+ *  - file0065.txt
+ *  - file0066.txt
+ *  - file0067.txt
+ *  - file0068.txt
+ *  - file0069.txt
+ *  - file0070.txt
+ *  - file0071.txt
+ *  - file0072.txt
+ *  - file0073.txt
+ *  - file0074.txt
+ *  - file0075.txt
+ *  - file0076.txt
+ *  - file0077.txt
+ *  - file0078.txt
+ *  - file0079.txt
+ *  - file0080.txt
+ *  - file0081.txt
+ *  - file0082.txt
+ *  - file0083.txt
+ *  - file0084.txt
+ *  - file0085.txt
+ *  - file0086.txt
+ *  - file0087.txt
+ *  - file0088.txt
+ *  - file0089.txt
+ *  - file0090.txt
+ *  - file0091.txt
+ *  - file0092.txt
+ *  - file0093.txt
+ *  - file0094.txt
+ *  - file0095.txt
+ *  - file0096.txt
+ *  - file0097.txt
+ *  - file0098.txt
+ *  - file0099.txt
+ *  - file0100.txt
+ *  - file0101.txt
+ *  - file0102.txt
+ *  - file0103.txt
+ *  - file0104.txt
+ *  - file0105.txt
+ *  - file0106.txt
+ *  - file0107.txt
+ *  - file0108.txt
+ *  - file0109.txt
+ *  - file0110.txt
+ *  - file0111.txt
+ *  - file0112.txt
+ *  - file0113.txt
+ *  - file0114.txt
+ *  - file0115.txt
+ *  - file0116.txt
+ *  - file0117.txt
+ *  - file0118.txt
+ *  - file0119.txt
+ *  - file0120.txt
+ *  - file0121.txt
+ *  - file0122.txt
+ *  - file0123.txt
+ *  - file0124.txt
+ *  - file0125.txt
+ *  - file0126.txt
+ *  - file0127.txt
+ *  - file0128.txt
+ *  - file0129.txt
+ *  - file0130.txt
+ *  - file0131.txt
+ *  - file0132.txt
+ *  - file0133.txt
+ *  - file0134.txt
+ *  - file0135.txt
+ *  - file0136.txt
+ *  - file0137.txt
+ *  - file0138.txt
+ *  - file0139.txt
+ *  - file0140.txt
+ *  - file0141.txt
+ *  - file0142.txt
+ *  - file0143.txt
+ *  - file0144.txt
+ *  - file0145.txt
+ *  - file0146.txt
+ *  - file0147.txt
+ *  - file0148.txt
+ *  - file0149.txt
+ *  - file0150.txt
+ *  - file0151.txt
+ *  - file0152.txt
+ *  - file0153.txt
+ *  - file0154.txt
+ *  - file0155.txt
+ *  - file0156.txt
+ *  - file0157.txt
+ *  - file0158.txt
+ *  - file0159.txt
+ *  - file0160.txt
+ *  - file0161.txt
+ *  - file0162.txt
+ *  - file0163.txt
+ *  - file0164.txt
+ *  - file0165.txt
+ *  - file0166.txt
+ *  - file0167.txt
+ *  - file0168.txt
+ *  - file0169.txt
+ *  - file0170.txt
+ *  - file0171.txt
+ *  - file0172.txt
+ *  - file0173.txt
+ *  - file0174.txt
+ *  - file0175.txt
+ *  - file0176.txt
+ *  - file0177.txt
+ *  - file0178.txt
+ *  - file0179.txt
+ *  - file0180.txt
+ *  - file0181.txt
+ *  - file0182.txt
+ *  - file0183.txt
+ *  - file0184.txt
+ *  - file0185.txt
+ *  - file0186.txt
+ *  - file0187.txt
+ *  - file0188.txt
+ *  - file0189.txt
+ *  - file0190.txt
+ *  - file0191.txt
+ *  - file0192.txt
+ *  - file0193.txt
+ *  - file0194.txt
+ *  - file0195.txt
+ *  - file0196.txt
+ *  - file0197.txt
+ *  - file0198.txt
+ *  - file0199.txt
+ *  - file0200.txt
+ *  - file0201.txt
+ *  - file0202.txt
+ *  - file0203.txt
+ *  - file0204.txt
+ *  - file0205.txt
+ *  - file0206.txt
+ *  - file0207.txt
+ *  - file0208.txt
+ *  - file0209.txt
+ *  - file0210.txt
+ *  - file0211.txt
+ *  - file0212.txt
+ *  - file0213.txt
+ *  - file0214.txt
+ *  - file0215.txt
+ *  - file0216.txt
+ *  - file0217.txt
+ *  - file0218.txt
+ *  - file0219.txt
+ *  - file0220.txt
+ *  - file0221.txt
+ *  - file0222.txt
+ *  - file0223.txt
+ *  - file0224.txt
+ *  - file0225.txt
+ *  - file0226.txt
+ *  - file0227.txt
+ *  - file0228.txt
+ *  - file0229.txt
+ *  - file0230.txt
+ *  - file0231.txt
+ *  - file0232.txt
+ *  - file0233.txt
+ *  - file0234.txt
+ *  - file0235.txt
+ *  - file0236.txt
+ *  - file0237.txt
+ *  - file0238.txt
+ *  - file0239.txt
+ *  - file0240.txt
+ *  - file0241.txt
+ *  - file0242.txt
+ *  - file0243.txt
+ *  - file0244.txt
+ *  - file0245.txt
+ *  - file0246.txt
+ *  - file0247.txt
+ *  - file0248.txt
+ *  - file0249.txt
+ *  - file0250.txt
+ *  - file0251.txt
+ *  - file0252.txt
+ *  - file0253.txt
+ *  - file0254.txt
+ *  - file0255.txt
+ *  - file0256.txt
+ *  - file0257.txt
+ *  - file0258.txt
+ *  - file0259.txt
+ *  - file0260.txt
+ *  - file0261.txt
+ *  - file0262.txt
+ *  - file0263.txt
+ *  - file0264.txt
+ *  - file0265.txt
+ *  - file0266.txt
+ *  - file0267.txt
+ *  - file0268.txt
+ *  - file0269.txt
+ *  - file0270.txt
+ *  - file0271.txt
+ *  - file0272.txt
+ *  - file0273.txt
+ *  - file0274.txt
+ *  - file0275.txt
+ *  - file0276.txt
+ *  - file0277.txt
+ *  - file0278.txt
+ *  - file0279.txt
+ *  - file0280.txt
+ *  - file0281.txt
+ *  - file0282.txt
+ *  - file0283.txt
+ *  - file0284.txt
+ *  - file0285.txt
+ *  - file0286.txt
+ *  - file0287.txt
+ *  - file0288.txt
+ *  - file0289.txt
+ *  - file0290.txt
+ *  - file0291.txt
+ *  - file0292.txt
+ *  - file0293.txt
+ *  - file0294.txt
+ *  - file0295.txt
+ *  - file0296.txt
+ *  - file0297.txt
+ *  - file0298.txt
+ *  - file0299.txt
+ *  - file0300.txt
+ *  - file0301.txt
+ *  - file0302.txt
+ *  - file0303.txt
+ *  - file0304.txt
+ *  - file0305.txt
+ *  - file0306.txt
+ *  - file0307.txt
+ *  - file0308.txt
+ *  - file0309.txt
+ *  - file0310.txt
+ *  - file0311.txt
+ *  - file0312.txt
+ *  - file0313.txt
+ *  - file0314.txt
+ *  - file0315.txt
+ *  - file0316.txt
+ *  - file0317.txt
+ *  - file0318.txt
+ *  - file0319.txt
+ *  - file0320.txt
+ *  - file0321.txt
+ *  - file0322.txt
+ *  - file0323.txt
+ *  - file0324.txt
+ *  - file0325.txt
+ *  - file0326.txt
+ *  - file0327.txt
+ *  - file0328.txt
+ *  - file0329.txt
+ *  - file0330.txt
+ *  - file0331.txt
+ *  - file0332.txt
+ *  - file0333.txt
+ *  - file0334.txt
+ *  - file0335.txt
+ *  - file0336.txt
+ *  - file0337.txt
+ *  - file0338.txt
+ *  - file0339.txt
+ *  - file0340.txt
+ *  - file0341.txt
+ *  - file0342.txt
+ *  - file0343.txt
+ *  - file0344.txt
+ *  - file0345.txt
+ *  - file0346.txt
+ *  - file0347.txt
+ *  - file0348.txt
+ *  - file0349.txt
+ *  - file0350.txt
+ *  - file0351.txt
+ *  - file0352.txt
+ *  - file0353.txt
+ *  - file0354.txt
+ *  - file0355.txt
+ *  - file0356.txt
+ *  - file0357.txt
+ *  - file0358.txt
+ *  - file0359.txt
+ *  - file0360.txt
+ *  - file0361.txt
+ *  - file0362.txt
+ *  - file0363.txt
+ *  - file0364.txt
+ *  - file0365.txt
+ *  - file0366.txt
+ *  - file0367.txt
+ *  - file0368.txt
+ *  - file0369.txt
+ *  - file0370.txt
+ *  - file0371.txt
+ *  - file0372.txt
+ *  - file0373.txt
+ *  - file0374.txt
+ *  - file0375.txt
+ *  - file0376.txt
+ *  - file0377.txt
+ *  - file0378.txt
+ *  - file0379.txt
+ *  - file0380.txt
+ *  - file0381.txt
+ *  - file0382.txt
+ *  - file0383.txt
+ *  - file0384.txt
+ *  - file0385.txt
+ *  - file0386.txt
+ *  - file0387.txt
+ *  - file0388.txt
+ *  - file0389.txt
+ *  - file0390.txt
+ *  - file0391.txt
+ *  - file0392.txt
+ *  - file0393.txt
+ *  - file0394.txt
+ *  - file0395.txt
+ *  - file0396.txt
+ *  - file0397.txt
+ *  - file0398.txt
+ *  - file0399.txt
+ *  - file0400.txt
+ *  - file0401.txt
+ *  - file0402.txt
+ *  - file0403.txt
+ *  - file0404.txt
+ *  - file0405.txt
+ *  - file0406.txt
+ *  - file0407.txt
+ *  - file0408.txt
+ *  - file0409.txt
+ *  - file0410.txt
+ *  - file0411.txt
+ *  - file0412.txt
+ *  - file0413.txt
+ *  - file0414.txt
+ *  - file0415.txt
+ *  - file0416.txt
+ *  - file0417.txt
+ *  - file0418.txt
+ *  - file0419.txt
+ *  - file0420.txt
+ *  - file0421.txt
+ *  - file0422.txt
+ *  - file0423.txt
+ *  - file0424.txt
+ *  - file0425.txt
+ *  - file0426.txt
+ *  - file0427.txt
+ *  - file0428.txt
+ *  - file0429.txt
+ *  - file0430.txt
+ *  - file0431.txt
+ *  - file0432.txt
+ *  - file0433.txt
+ *  - file0434.txt
+ *  - file0435.txt
+ *  - file0436.txt
+ *  - file0437.txt
+ *  - file0438.txt
+ *  - file0439.txt
+ *  - file0440.txt
+ *  - file0441.txt
+ *  - file0442.txt
+ *  - file0443.txt
+ *  - file0444.txt
+ *  - file0445.txt
+ *  - file0446.txt
+ *  - file0447.txt
+ *  - file0448.txt
+ *  - file0449.txt
+ *  - file0450.txt
+ *  - file0451.txt
+ *  - file0452.txt
+ *  - file0453.txt
+ *  - file0454.txt
+ *  - file0455.txt
+ *  - file0456.txt
+ *  - file0457.txt
+ *  - file0458.txt
+ *  - file0459.txt
+ *  - file0460.txt
+ *  - file0461.txt
+ *  - file0462.txt
+ *  - file0463.txt
+ *  - file0464.txt
+ *  - file0465.txt
+ *  - file0466.txt
+ *  - file0467.txt
+ *  - file0468.txt
+ *  - file0469.txt
+ *  - file0470.txt
+ *  - file0471.txt
+ *  - file0472.txt
+ *  - file0473.txt
+ *  - file0474.txt
+ *  - file0475.txt
+ *  - file0476.txt
+ *  - file0477.txt
+ *  - file0478.txt
+ *  - file0479.txt
+ *  - file0480.txt
+ *  - file0481.txt
+ *  - file0482.txt
+ *  - file0483.txt
+ *  - file0484.txt
+ *  - file0485.txt
+ *  - file0486.txt
+ *  - file0487.txt
+ *  - file0488.txt
+ *  - file0489.txt
+ *  - file0490.txt
+ *  - file0491.txt
+ *  - file0492.txt
+ *  - file0493.txt
+ *  - file0494.txt
+ *  - file0495.txt
+ *  - file0496.txt
+ *  - file0497.txt
+ *  - file0498.txt
+ *  - file0499.txt
+ *  - file0500.txt
+ *  - file0501.txt
+ *  - file0502.txt
+ *  - file0503.txt
+ *  - file0504.txt
+ *  - file0505.txt
+ *  - file0506.txt
+ *  - file0507.txt
+ *  - file0508.txt
+ *  - file0509.txt
+ *  - file0510.txt
+ *  - file0511.txt
+ *  - file0512.txt
+ *  - file0513.txt
+ *  - file0514.txt
+ *  - file0515.txt
+ *  - file0516.txt
+ *  - file0517.txt
+ *  - file0518.txt
+ *  - file0519.txt
+ *  - file0520.txt
+ *  - file0521.txt
+ *  - file0522.txt
+ *  - file0523.txt
+ *  - file0524.txt
+ *  - file0525.txt
+ *  - file0526.txt
+ *  - file0527.txt
+ *  - file0528.txt
+ *  - file0529.txt
+ *  - file0530.txt
+ *  - file0531.txt
+ *  - file0532.txt
+ *  - file0533.txt
+ *  - file0534.txt
+ *  - file0535.txt
+ *  - file0536.txt
+ *  - file0537.txt
+ *  - file0538.txt
+ *  - file0539.txt
+ *  - file0540.txt
+ *  - file0541.txt
+ *  - file0542.txt
+ *  - file0543.txt
+ *  - file0544.txt
+ *  - file0545.txt
+ *  - file0546.txt
+ *  - file0547.txt
+ *  - file0548.txt
+ *  - file0549.txt
+ *  - file0550.txt
+ *  - file0551.txt
+ *  - file0552.txt
+ *  - file0553.txt
+ *  - file0554.txt
+ *  - file0555.txt
+ *  - file0556.txt
+ *  - file0557.txt
+ *  - file0558.txt
+ *  - file0559.txt
+ *  - file0560.txt
+ *  - file0561.txt
+ *  - file0562.txt
+ *  - file0563.txt
+ *  - file0564.txt
+ *  - file0565.txt
+ *  - file0566.txt
+ *  - file0567.txt
+ *  - file0568.txt
+ *  - file0569.txt
+ *  - file0570.txt
+ *  - file0571.txt
+ *  - file0572.txt
+ *  - file0573.txt
+ *  - file0574.txt
+ *  - file0575.txt
+ *  - file0576.txt
+ *  - file0577.txt
+ *  - file0578.txt
+ *  - file0579.txt
+ *  - file0580.txt
+ *  - file0581.txt
+ *  - file0582.txt
+ *  - file0583.txt
+ *  - file0584.txt
+ *  - file0585.txt
+ *  - file0586.txt
+ *  - file0587.txt
+ *  - file0588.txt
+ *  - file0589.txt
+ *  - file0590.txt
+ *  - file0591.txt
+ *  - file0592.txt
+ *  - file0593.txt
+ *  - file0594.txt
+ *  - file0595.txt
+ *  - file0596.txt
+ *  - file0597.txt
+ *  - file0598.txt
+ *  - file0599.txt
+ *  - file0600.txt
+ *  - file0601.txt
+ *  - file0602.txt
+ *  - file0603.txt
+ *  - file0604.txt
+ *  - file0605.txt
+ *  - file0606.txt
+ *  - file0607.txt
+ *  - file0608.txt
+ *  - file0609.txt
+ *  - file0610.txt
+ *  - file0611.txt
+ *  - file0612.txt
+ *  - file0613.txt
+ *  - file0614.txt
+ *  - file0615.txt
+ *  - file0616.txt
+ *  - file0617.txt
+ *  - file0618.txt
+ *  - file0619.txt
+ *  - file0620.txt
+ *  - file0621.txt
+ *  - file0622.txt
+ *  - file0623.txt
+ *  - file0624.txt
+ *  - file0625.txt
+ *  - file0626.txt
+ *  - file0627.txt
+ *  - file0628.txt
+ *  - file0629.txt
+ *  - file0630.txt
+ *  - file0631.txt
+ *  - file0632.txt
+ *  - file0633.txt
+ *  - file0634.txt
+ *  - file0635.txt
+ *  - file0636.txt
+ *  - file0637.txt
+ *  - file0638.txt
+ *  - file0639.txt
+ *  - file0640.txt
+ *  - file0641.txt
+ *  - file0642.txt
+ *  - file0643.txt
+ *  - file0644.txt
+ *  - file0645.txt
+ *  - file0646.txt
+ *  - file0647.txt
+ *  - file0648.txt
+ *  - file0649.txt
+ *  - file0650.txt
+ *  - file0651.txt
+ *  - file0652.txt
+ *  - file0653.txt
+ *  - file0654.txt
+ *  - file0655.txt
+ *  - file0656.txt
+ *  - file0657.txt
+ *  - file0658.txt
+ *  - file0659.txt
+ *  - file0660.txt
+ *  - file0661.txt
+ *  - file0662.txt
+ *  - file0663.txt
+ *  - file0664.txt
+ *  - file0665.txt
+ *  - file0666.txt
+ *  - file0667.txt
+ *  - file0668.txt
+ *  - file0669.txt
+ *  - file0670.txt
+ *  - file0671.txt
+ *  - file0672.txt
+ *  - file0673.txt
+ *  - file0674.txt
+ *  - file0675.txt
+ *  - file0676.txt
+ *  - file0677.txt
+ *  - file0678.txt
+ *  - file0679.txt
+ *  - file0680.txt
+ *  - file0681.txt
+ *  - file0682.txt
+ *  - file0683.txt
+ *  - file0684.txt
+ *  - file0685.txt
+ *  - file0686.txt
+ *  - file0687.txt
+ *  - file0688.txt
+ *  - file0689.txt
+ *  - file0690.txt
+ *  - file0691.txt
+ *  - file0692.txt
+ *  - file0693.txt
+ *  - file0694.txt
+ *  - file0695.txt
+ *  - file0696.txt
+ *  - file0697.txt
+ *  - file0698.txt
+ *  - file0699.txt
+ *  - file0700.txt
+ *  - file0701.txt
+ *  - file0702.txt
+ *  - file0703.txt
+ *  - file0704.txt
+ *  - file0705.txt
+ *  - file0706.txt
+ *  - file0707.txt
+ *  - file0708.txt
+ *  - file0709.txt
+ *  - file0710.txt
+ *  - file0711.txt
+ *  - file0712.txt
+ *  - file0713.txt
+ *  - file0714.txt
+ *  - file0715.txt
+ *  - file0716.txt
+ *  - file0717.txt
+ *  - file0718.txt
+ *  - file0719.txt
+ *  - file0720.txt
+ *  - file0721.txt
+ *  - file0722.txt
+ *  - file0723.txt
+ *  - file0724.txt
+ *  - file0725.txt
+ *  - file0726.txt
+ *  - file0727.txt
+ *  - file0728.txt
+ *  - file0729.txt
+ *  - file0730.txt
+ *  - file0731.txt
+ *  - file0732.txt
+ *  - file0733.txt
+ *  - file0734.txt
+ *  - file0735.txt
+ *  - file0736.txt
+ *  - file0737.txt
+ *  - file0738.txt
+ *  - file0739.txt
+ *  - file0740.txt
+ *  - file0741.txt
+ *  - file0742.txt
+ *  - file0743.txt
+ *  - file0744.txt
+ *  - file0745.txt
+ *  - file0746.txt
+ *  - file0747.txt
+ *  - file0748.txt
+ *  - file0749.txt
+ *  - file0750.txt
+ *  - file0751.txt
+ *  - file0752.txt
+ *  - file0753.txt
+ *  - file0754.txt
+ *  - file0755.txt
+ *  - file0756.txt
+ *  - file0757.txt
+ *  - file0758.txt
+ *  - file0759.txt
+ *  - file0760.txt
+ *  - file0761.txt
+ *  - file0762.txt
+ *  - file0763.txt
+ *  - file0764.txt
+ *  - file0765.txt
+ *  - file0766.txt
+ *  - file0767.txt
+ *  - file0768.txt
+ *  - file0769.txt
+ *  - file0770.txt
+ *  - file0771.txt
+ *  - file0772.txt
+ *  - file0773.txt
+ *  - file0774.txt
+ *  - file0775.txt
+ *  - file0776.txt
+ *  - file0777.txt
+ *  - file0778.txt
+ *  - file0779.txt
+ *  - file0780.txt
+ *  - file0781.txt
+ *  - file0782.txt
+ *  - file0783.txt
+ *  - file0784.txt
+ *  - file0785.txt
+ *  - file0786.txt
+ *  - file0787.txt
+ *  - file0788.txt
+ *  - file0789.txt
+ *  - file0790.txt
+ *  - file0791.txt
+ *  - file0792.txt
+ *  - file0793.txt
+ *  - file0794.txt
+ *  - file0795.txt
+ *  - file0796.txt
+ *  - file0797.txt
+ *  - file0798.txt
+ *  - file0799.txt
+ *  - file0800.txt
+ *  - file0801.txt
+ *  - file0802.txt
+ *  - file0803.txt
+ *  - file0804.txt
+ *  - file0805.txt
+ *  - file0806.txt
+ *  - file0807.txt
+ *  - file0808.txt
+ *  - file0809.txt
+ *  - file0810.txt
+ *  - file0811.txt
+ *  - file0812.txt
+ *  - file0813.txt
+ *  - file0814.txt
+ *  - file0815.txt
+ *  - file0816.txt
+ *  - file0817.txt
+ *  - file0818.txt
+ *  - file0819.txt
+ *  - file0820.txt
+ *  - file0821.txt
+ *  - file0822.txt
+ *  - file0823.txt
+ *  - file0824.txt
+ *  - file0825.txt
+ *  - file0826.txt
+ *  - file0827.txt
+ *  - file0828.txt
+ *  - file0829.txt
+ *  - file0830.txt
+ *  - file0831.txt
+ *  - file0832.txt
+ *  - file0833.txt
+ *  - file0834.txt
+ *  - file0835.txt
+ *  - file0836.txt
+ *  - file0837.txt
+ *  - file0838.txt
+ *  - file0839.txt
+ *  - file0840.txt
+ *  - file0841.txt
+ *  - file0842.txt
+ *  - file0843.txt
+ *  - file0844.txt
+ *  - file0845.txt
+ *  - file0846.txt
+ *  - file0847.txt
+ *  - file0848.txt
+ *  - file0849.txt
+ *  - file0850.txt
+ *  - file0851.txt
+ *  - file0852.txt
+ *  - file0853.txt
+ *  - file0854.txt
+ *  - file0855.txt
+ *  - file0856.txt
+ *  - file0857.txt
+ *  - file0858.txt
+ *  - file0859.txt
+ *  - file0860.txt
+ *  - file0861.txt
+ *  - file0862.txt
+ *  - file0863.txt
+ *  - file0864.txt
+ *  - file0865.txt
+ *  - file0866.txt
+ *  - file0867.txt
+ *  - file0868.txt
+ *  - file0869.txt
+ *  - file0870.txt
+ *  - file0871.txt
+ *  - file0872.txt
+ *  - file0873.txt
+ *  - file0874.txt
+ *  - file0875.txt
+ *  - file0876.txt
+ *  - file0877.txt
+ *  - file0878.txt
+ *  - file0879.txt
+ *  - file0880.txt
+ *  - file0881.txt
+ *  - file0882.txt
+ *  - file0883.txt
+ *  - file0884.txt
+ *  - file0885.txt
+ *  - file0886.txt
+ *  - file0887.txt
+ *  - file0888.txt
+ *  - file0889.txt
+ *  - file0890.txt
+ *  - file0891.txt
+ *  - file0892.txt
+ *  - file0893.txt
+ *  - file0894.txt
+ *  - file0895.txt
+ *  - file0896.txt
+ *  - file0897.txt
+ *  - file0898.txt
+ *  - file0899.txt
+ *  - file0900.txt
+ *  - file0901.txt
+ *  - file0902.txt
+ *  - file0903.txt
+ *  - file0904.txt
+ *  - file0905.txt
+ *  - file0906.txt
+ *  - file0907.txt
+ *  - file0908.txt
+ *  - file0909.txt
+ *  - file0910.txt
+ *  - file0911.txt
+ *  - file0912.txt
+ *  - file0913.txt
+ *  - file0914.txt
+ *  - file0915.txt
+ *  - file0916.txt
+ *  - file0917.txt
+ *  - file0918.txt
+ *  - file0919.txt
+ *  - file0920.txt
+ *  - file0921.txt
+ *  - file0922.txt
+ *  - file0923.txt
+ *  - file0924.txt
+ *  - file0925.txt
+ *  - file0926.txt
+ *  - file0927.txt
+ *  - file0928.txt
+ *  - file0929.txt
+ *  - file0930.txt
+ *  - file0931.txt
+ *  - file0932.txt
+ *  - file0933.txt
+ *  - file0934.txt
+ *  - file0935.txt
+ *  - file0936.txt
+ *  - file0937.txt
+ *  - file0938.txt
+ *  - file0939.txt
+ *  - file0940.txt
+ *  - file0941.txt
+ *  - file0942.txt
+ *  - file0943.txt
+ *  - file0944.txt
+ *  - file0945.txt
+ *  - file0946.txt
+ *  - file0947.txt
+ *  - file0948.txt
+ *  - file0949.txt
+ *  - file0950.txt
+ *  - file0951.txt
+ *  - file0952.txt
+ *  - file0953.txt
+ *  - file0954.txt
+ *  - file0955.txt
+ *  - file0956.txt
+ *  - file0957.txt
+ *  - file0958.txt
+ *  - file0959.txt
+ *  - file0960.txt
+ *  - file0961.txt
+ *  - file0962.txt
+ *  - file0963.txt
+ *  - file0964.txt
+ *  - file0965.txt
+ *  - file0966.txt
+ *  - file0967.txt
+ *  - file0968.txt
+ *  - file0969.txt
+ *  - file0970.txt
+ *  - file0971.txt
+ *  - file0972.txt
+ *  - file0973.txt
+ *  - file0974.txt
+ *  - file0975.txt
+ *  - file0976.txt
+ *  - file0977.txt
+ *  - file0978.txt
+ *  - file0979.txt
+ *  - file0980.txt
+ *  - file0981.txt
+ *  - file0982.txt
+ *  - file0983.txt
+ *  - file0984.txt
+ *  - file0985.txt
+ *  - file0986.txt
+ *  - file0987.txt
+ *  - file0988.txt
+ *  - file0989.txt
+ *  - file0990.txt
+ *  - file0991.txt
+ *  - file0992.txt
+ *  - file0993.txt
+ *  - file0994.txt
+ *  - file0995.txt
+ *  - file0996.txt
+ *  - file0997.txt
+ *  - file0998.txt
+ *  - file0999.txt
+ *  - file1000.txt
+ *  - file1001.txt
+ *  - file1002.txt
+ *  - file1003.txt
+ *  - file1004.txt
+ *  - file1005.txt
+ *  - file1006.txt
+ *  - file1007.txt
+ *  - file1008.txt
+ *  - file1009.txt
+ *  - file1010.txt
+ *  - file1011.txt
+ *  - file1012.txt
+ *  - file1013.txt
+ *  - file1014.txt
+ *  - file1015.txt
+ *  - file1016.txt
+ *  - file1017.txt
+ *  - file1018.txt
+ *  - file1019.txt
+ *  - file1020.txt
+ *  - file1021.txt
+ *  - file1022.txt
+ *  - file1023.txt
+ *  - file1024.txt
+ */
+
+static const uint32_t bench_fs_1024[] = {
+    0x466d6f52, 0x00000400, 0x00000000, 0x0000000c,
+    0x00000018, 0x00000024, 0x00000030, 0x0000003c,
+    0x00000048, 0x00000054, 0x00000060, 0x0000006c,
+    0x00000078, 0x00000084, 0x00000090, 0x0000009c,
+    0x000000a8, 0x000000b4, 0x000000c0, 0x000000cc,
+    0x000000d8, 0x000000e4, 0x000000f0, 0x000000fc,
+    0x00000108, 0x00000114, 0x00000120, 0x0000012c,
+    0x00000138, 0x00000144, 0x00000150, 0x0000015c,
+    0x00000168, 0x00000174, 0x00000180, 0x0000018c,
+    0x00000198, 0x000001a4, 0x000001b0, 0x000001bc,
+    0x000001c8, 0x000001d4, 0x000001e0, 0x000001ec,
+    0x000001f8, 0x00000204, 0x00000210, 0x0000021c,
+    0x00000228, 0x00000234, 0x00000240, 0x0000024c,
+    0x00000258, 0x00000264, 0x00000270, 0x0000027c,
+    0x00000288, 0x00000294, 0x000002a0, 0x000002ac,
+    0x000002b8, 0x000002c4, 0x000002d0, 0x000002dc,
+    0x000002e8, 0x000002f4, 0x00000300, 0x0000030c,
+    0x00000318, 0x00000324, 0x00000330, 0x0000033c,
+    0x00000348, 0x00000354, 0x00000360, 0x0000036c,
+    0x00000378, 0x00000384, 0x00000390, 0x0000039c,
+    0x000003a8, 0x000003b4, 0x000003c0, 0x000003cc,
+    0x000003d8, 0x000003e4, 0x000003f0, 0x000003fc,
+    0x00000408, 0x00000414, 0x00000420, 0x0000042c,
+    0x00000438, 0x00000444, 0x00000450, 0x0000045c,
+    0x00000468, 0x00000474, 0x00000480, 0x0000048c,
+    0x00000498, 0x000004a4, 0x000004b0, 0x000004bc,
+    0x000004c8, 0x000004d4, 0x000004e0, 0x000004ec,
+    0x000004f8, 0x00000504, 0x00000510, 0x0000051c,
+    0x00000528, 0x00000534, 0x00000540, 0x0000054c,
+    0x00000558, 0x00000564, 0x00000570, 0x0000057c,
+    0x00000588, 0x00000594, 0x000005a0, 0x000005ac,
+    0x000005b8, 0x000005c4, 0x000005d0, 0x000005dc,
+    0x000005e8, 0x000005f4, 0x00000600, 0x0000060c,
+    0x00000618, 0x00000624, 0x00000630, 0x0000063c,
+    0x00000648, 0x00000654, 0x00000660, 0x0000066c,
+    0x00000678, 0x00000684, 0x00000690, 0x0000069c,
+    0x000006a8, 0x000006b4, 0x000006c0, 0x000006cc,
+    0x000006d8, 0x000006e4, 0x000006f0, 0x000006fc,
+    0x00000708, 0x00000714, 0x00000720, 0x0000072c,
+    0x00000738, 0x00000744, 0x00000750, 0x0000075c,
+    0x00000768, 0x00000774, 0x00000780, 0x0000078c,
+    0x00000798, 0x000007a4, 0x000007b0, 0x000007bc,
+    0x000007c8, 0x000007d4, 0x000007e0, 0x000007ec,
+    0x000007f8, 0x00000804, 0x00000810, 0x0000081c,
+    0x00000828, 0x00000834, 0x00000840, 0x0000084c,
+    0x00000858, 0x00000864, 0x00000870, 0x0000087c,
+    0x00000888, 0x00000894, 0x000008a0, 0x000008ac,
+    0x000008b8, 0x000008c4, 0x000008d0, 0x000008dc,
+    0x000008e8, 0x000008f4, 0x00000900, 0x0000090c,
+    0x00000918, 0x00000924, 0x00000930, 0x0000093c,
+    0x00000948, 0x00000954, 0x00000960, 0x0000096c,
+    0x00000978, 0x00000984, 0x00000990, 0x0000099c,
+    0x000009a8, 0x000009b4, 0x000009c0, 0x000009cc,
+    0x000009d8, 0x000009e4, 0x000009f0, 0x000009fc,
+    0x00000a08, 0x00000a14, 0x00000a20, 0x00000a2c,
+    0x00000a38, 0x00000a44, 0x00000a50, 0x00000a5c,
+    0x00000a68, 0x00000a74, 0x00000a80, 0x00000a8c,
+    0x00000a98, 0x00000aa4, 0x00000ab0, 0x00000abc,
+    0x00000ac8, 0x00000ad4, 0x00000ae0, 0x00000aec,
+    0x00000af8, 0x00000b04, 0x00000b10, 0x00000b1c,
+    0x00000b28, 0x00000b34, 0x00000b40, 0x00000b4c,
+    0x00000b58, 0x00000b64, 0x00000b70, 0x00000b7c,
+    0x00000b88, 0x00000b94, 0x00000ba0, 0x00000bac,
+    0x00000bb8, 0x00000bc4, 0x00000bd0, 0x00000bdc,
+    0x00000be8, 0x00000bf4, 0x00000c00, 0x00000c0c,
+    0x00000c18, 0x00000c24, 0x00000c30, 0x00000c3c,
+    0x00000c48, 0x00000c54, 0x00000c60, 0x00000c6c,
+    0x00000c78, 0x00000c84, 0x00000c90, 0x00000c9c,
+    0x00000ca8, 0x00000cb4, 0x00000cc0, 0x00000ccc,
+    0x00000cd8, 0x00000ce4, 0x00000cf0, 0x00000cfc,
+    0x00000d08, 0x00000d14, 0x00000d20, 0x00000d2c,
+    0x00000d38, 0x00000d44, 0x00000d50, 0x00000d5c,
+    0x00000d68, 0x00000d74, 0x00000d80, 0x00000d8c,
+    0x00000d98, 0x00000da4, 0x00000db0, 0x00000dbc,
+    0x00000dc8, 0x00000dd4, 0x00000de0, 0x00000dec,
+    0x00000df8, 0x00000e04, 0x00000e10, 0x00000e1c,
+    0x00000e28, 0x00000e34, 0x00000e40, 0x00000e4c,
+    0x00000e58, 0x00000e64, 0x00000e70, 0x00000e7c,
+    0x00000e88, 0x00000e94, 0x00000ea0, 0x00000eac,
+    0x00000eb8, 0x00000ec4, 0x00000ed0, 0x00000edc,
+    0x00000ee8, 0x00000ef4, 0x00000f00, 0x00000f0c,
+    0x00000f18, 0x00000f24, 0x00000f30, 0x00000f3c,
+    0x00000f48, 0x00000f54, 0x00000f60, 0x00000f6c,
+    0x00000f78, 0x00000f84, 0x00000f90, 0x00000f9c,
+    0x00000fa8, 0x00000fb4, 0x00000fc0, 0x00000fcc,
+    0x00000fd8, 0x00000fe4, 0x00000ff0, 0x00000ffc,
+    0x00001008, 0x00001014, 0x00001020, 0x0000102c,
+    0x00001038, 0x00001044, 0x00001050, 0x0000105c,
+    0x00001068, 0x00001074, 0x00001080, 0x0000108c,
+    0x00001098, 0x000010a4, 0x000010b0, 0x000010bc,
+    0x000010c8, 0x000010d4, 0x000010e0, 0x000010ec,
+    0x000010f8, 0x00001104, 0x00001110, 0x0000111c,
+    0x00001128, 0x00001134, 0x00001140, 0x0000114c,
+    0x00001158, 0x00001164, 0x00001170, 0x0000117c,
+    0x00001188, 0x00001194, 0x000011a0, 0x000011ac,
+    0x000011b8, 0x000011c4, 0x000011d0, 0x000011dc,
+    0x000011e8, 0x000011f4, 0x00001200, 0x0000120c,
+    0x00001218, 0x00001224, 0x00001230, 0x0000123c,
+    0x00001248, 0x00001254, 0x00001260, 0x0000126c,
+    0x00001278, 0x00001284, 0x00001290, 0x0000129c,
+    0x000012a8, 0x000012b4, 0x000012c0, 0x000012cc,
+    0x000012d8, 0x000012e4, 0x000012f0, 0x000012fc,
+    0x00001308, 0x00001314, 0x00001320, 0x0000132c,
+    0x00001338, 0x00001344, 0x00001350, 0x0000135c,
+    0x00001368, 0x00001374, 0x00001380, 0x0000138c,
+    0x00001398, 0x000013a4, 0x000013b0, 0x000013bc,
+    0x000013c8, 0x000013d4, 0x000013e0, 0x000013ec,
+    0x000013f8, 0x00001404, 0x00001410, 0x0000141c,
+    0x00001428, 0x00001434, 0x00001440, 0x0000144c,
+    0x00001458, 0x00001464, 0x00001470, 0x0000147c,
+    0x00001488, 0x00001494, 0x000014a0, 0x000014ac,
+    0x000014b8, 0x000014c4, 0x000014d0, 0x000014dc,
+    0x000014e8, 0x000014f4, 0x00001500, 0x0000150c,
+    0x00001518, 0x00001524, 0x00001530, 0x0000153c,
+    0x00001548, 0x00001554, 0x00001560, 0x0000156c,
+    0x00001578, 0x00001584, 0x00001590, 0x0000159c,
+    0x000015a8, 0x000015b4, 0x000015c0, 0x000015cc,
+    0x000015d8, 0x000015e4, 0x000015f0, 0x000015fc,
+    0x00001608, 0x00001614, 0x00001620, 0x0000162c,
+    0x00001638, 0x00001644, 0x00001650, 0x0000165c,
+    0x00001668, 0x00001674, 0x00001680, 0x0000168c,
+    0x00001698, 0x000016a4, 0x000016b0, 0x000016bc,
+    0x000016c8, 0x000016d4, 0x000016e0, 0x000016ec,
+    0x000016f8, 0x00001704, 0x00001710, 0x0000171c,
+    0x00001728, 0x00001734, 0x00001740, 0x0000174c,
+    0x00001758, 0x00001764, 0x00001770, 0x0000177c,
+    0x00001788, 0x00001794, 0x000017a0, 0x000017ac,
+    0x000017b8, 0x000017c4, 0x000017d0, 0x000017dc,
+    0x000017e8, 0x000017f4, 0x00001800, 0x0000180c,
+    0x00001818, 0x00001824, 0x00001830, 0x0000183c,
+    0x00001848, 0x00001854, 0x00001860, 0x0000186c,
+    0x00001878, 0x00001884, 0x00001890, 0x0000189c,
+    0x000018a8, 0x000018b4, 0x000018c0, 0x000018cc,
+    0x000018d8, 0x000018e4, 0x000018f0, 0x000018fc,
+    0x00001908, 0x00001914, 0x00001920, 0x0000192c,
+    0x00001938, 0x00001944, 0x00001950, 0x0000195c,
+    0x00001968, 0x00001974, 0x00001980, 0x0000198c,
+    0x00001998, 0x000019a4, 0x000019b0, 0x000019bc,
+    0x000019c8, 0x000019d4, 0x000019e0, 0x000019ec,
+    0x000019f8, 0x00001a04, 0x00001a10, 0x00001a1c,
+    0x00001a28, 0x00001a34, 0x00001a40, 0x00001a4c,
+    0x00001a58, 0x00001a64, 0x00001a70, 0x00001a7c,
+    0x00001a88, 0x00001a94, 0x00001aa0, 0x00001aac,
+    0x00001ab8, 0x00001ac4, 0x00001ad0, 0x00001adc,
+    0x00001ae8, 0x00001af4, 0x00001b00, 0x00001b0c,
+    0x00001b18, 0x00001b24, 0x00001b30, 0x00001b3c,
+    0x00001b48, 0x00001b54, 0x00001b60, 0x00001b6c,
+    0x00001b78, 0x00001b84, 0x00001b90, 0x00001b9c,
+    0x00001ba8, 0x00001bb4, 0x00001bc0, 0x00001bcc,
+    0x00001bd8, 0x00001be4, 0x00001bf0, 0x00001bfc,
+    0x00001c08, 0x00001c14, 0x00001c20, 0x00001c2c,
+    0x00001c38, 0x00001c44, 0x00001c50, 0x00001c5c,
+    0x00001c68, 0x00001c74, 0x00001c80, 0x00001c8c,
+    0x00001c98, 0x00001ca4, 0x00001cb0, 0x00001cbc,
+    0x00001cc8, 0x00001cd4, 0x00001ce0, 0x00001cec,
+    0x00001cf8, 0x00001d04, 0x00001d10, 0x00001d1c,
+    0x00001d28, 0x00001d34, 0x00001d40, 0x00001d4c,
+    0x00001d58, 0x00001d64, 0x00001d70, 0x00001d7c,
+    0x00001d88, 0x00001d94, 0x00001da0, 0x00001dac,
+    0x00001db8, 0x00001dc4, 0x00001dd0, 0x00001ddc,
+    0x00001de8, 0x00001df4, 0x00001e00, 0x00001e0c,
+    0x00001e18, 0x00001e24, 0x00001e30, 0x00001e3c,
+    0x00001e48, 0x00001e54, 0x00001e60, 0x00001e6c,
+    0x00001e78, 0x00001e84, 0x00001e90, 0x00001e9c,
+    0x00001ea8, 0x00001eb4, 0x00001ec0, 0x00001ecc,
+    0x00001ed8, 0x00001ee4, 0x00001ef0, 0x00001efc,
+    0x00001f08, 0x00001f14, 0x00001f20, 0x00001f2c,
+    0x00001f38, 0x00001f44, 0x00001f50, 0x00001f5c,
+    0x00001f68, 0x00001f74, 0x00001f80, 0x00001f8c,
+    0x00001f98, 0x00001fa4, 0x00001fb0, 0x00001fbc,
+    0x00001fc8, 0x00001fd4, 0x00001fe0, 0x00001fec,
+    0x00001ff8, 0x00002004, 0x00002010, 0x0000201c,
+    0x00002028, 0x00002034, 0x00002040, 0x0000204c,
+    0x00002058, 0x00002064, 0x00002070, 0x0000207c,
+    0x00002088, 0x00002094, 0x000020a0, 0x000020ac,
+    0x000020b8, 0x000020c4, 0x000020d0, 0x000020dc,
+    0x000020e8, 0x000020f4, 0x00002100, 0x0000210c,
+    0x00002118, 0x00002124, 0x00002130, 0x0000213c,
+    0x00002148, 0x00002154, 0x00002160, 0x0000216c,
+    0x00002178, 0x00002184, 0x00002190, 0x0000219c,
+    0x000021a8, 0x000021b4, 0x000021c0, 0x000021cc,
+    0x000021d8, 0x000021e4, 0x000021f0, 0x000021fc,
+    0x00002208, 0x00002214, 0x00002220, 0x0000222c,
+    0x00002238, 0x00002244, 0x00002250, 0x0000225c,
+    0x00002268, 0x00002274, 0x00002280, 0x0000228c,
+    0x00002298, 0x000022a4, 0x000022b0, 0x000022bc,
+    0x000022c8, 0x000022d4, 0x000022e0, 0x000022ec,
+    0x000022f8, 0x00002304, 0x00002310, 0x0000231c,
+    0x00002328, 0x00002334, 0x00002340, 0x0000234c,
+    0x00002358, 0x00002364, 0x00002370, 0x0000237c,
+    0x00002388, 0x00002394, 0x000023a0, 0x000023ac,
+    0x000023b8, 0x000023c4, 0x000023d0, 0x000023dc,
+    0x000023e8, 0x000023f4, 0x00002400, 0x0000240c,
+    0x00002418, 0x00002424, 0x00002430, 0x0000243c,
+    0x00002448, 0x00002454, 0x00002460, 0x0000246c,
+    0x00002478, 0x00002484, 0x00002490, 0x0000249c,
+    0x000024a8, 0x000024b4, 0x000024c0, 0x000024cc,
+    0x000024d8, 0x000024e4, 0x000024f0, 0x000024fc,
+    0x00002508, 0x00002514, 0x00002520, 0x0000252c,
+    0x00002538, 0x00002544, 0x00002550, 0x0000255c,
+    0x00002568, 0x00002574, 0x00002580, 0x0000258c,
+    0x00002598, 0x000025a4, 0x000025b0, 0x000025bc,
+    0x000025c8, 0x000025d4, 0x000025e0, 0x000025ec,
+    0x000025f8, 0x00002604, 0x00002610, 0x0000261c,
+    0x00002628, 0x00002634, 0x00002640, 0x0000264c,
+    0x00002658, 0x00002664, 0x00002670, 0x0000267c,
+    0x00002688, 0x00002694, 0x000026a0, 0x000026ac,
+    0x000026b8, 0x000026c4, 0x000026d0, 0x000026dc,
+    0x000026e8, 0x000026f4, 0x00002700, 0x0000270c,
+    0x00002718, 0x00002724, 0x00002730, 0x0000273c,
+    0x00002748, 0x00002754, 0x00002760, 0x0000276c,
+    0x00002778, 0x00002784, 0x00002790, 0x0000279c,
+    0x000027a8, 0x000027b4, 0x000027c0, 0x000027cc,
+    0x000027d8, 0x000027e4, 0x000027f0, 0x000027fc,
+    0x00002808, 0x00002814, 0x00002820, 0x0000282c,
+    0x00002838, 0x00002844, 0x00002850, 0x0000285c,
+    0x00002868, 0x00002874, 0x00002880, 0x0000288c,
+    0x00002898, 0x000028a4, 0x000028b0, 0x000028bc,
+    0x000028c8, 0x000028d4, 0x000028e0, 0x000028ec,
+    0x000028f8, 0x00002904, 0x00002910, 0x0000291c,
+    0x00002928, 0x00002934, 0x00002940, 0x0000294c,
+    0x00002958, 0x00002964, 0x00002970, 0x0000297c,
+    0x00002988, 0x00002994, 0x000029a0, 0x000029ac,
+    0x000029b8, 0x000029c4, 0x000029d0, 0x000029dc,
+    0x000029e8, 0x000029f4, 0x00002a00, 0x00002a0c,
+    0x00002a18, 0x00002a24, 0x00002a30, 0x00002a3c,
+    0x00002a48, 0x00002a54, 0x00002a60, 0x00002a6c,
+    0x00002a78, 0x00002a84, 0x00002a90, 0x00002a9c,
+    0x00002aa8, 0x00002ab4, 0x00002ac0, 0x00002acc,
+    0x00002ad8, 0x00002ae4, 0x00002af0, 0x00002afc,
+    0x00002b08, 0x00002b14, 0x00002b20, 0x00002b2c,
+    0x00002b38, 0x00002b44, 0x00002b50, 0x00002b5c,
+    0x00002b68, 0x00002b74, 0x00002b80, 0x00002b8c,
+    0x00002b98, 0x00002ba4, 0x00002bb0, 0x00002bbc,
+    0x00002bc8, 0x00002bd4, 0x00002be0, 0x00002bec,
+    0x00002bf8, 0x00002c04, 0x00002c10, 0x00002c1c,
+    0x00002c28, 0x00002c34, 0x00002c40, 0x00002c4c,
+    0x00002c58, 0x00002c64, 0x00002c70, 0x00002c7c,
+    0x00002c88, 0x00002c94, 0x00002ca0, 0x00002cac,
+    0x00002cb8, 0x00002cc4, 0x00002cd0, 0x00002cdc,
+    0x00002ce8, 0x00002cf4, 0x00002d00, 0x00002d0c,
+    0x00002d18, 0x00002d24, 0x00002d30, 0x00002d3c,
+    0x00002d48, 0x00002d54, 0x00002d60, 0x00002d6c,
+    0x00002d78, 0x00002d84, 0x00002d90, 0x00002d9c,
+    0x00002da8, 0x00002db4, 0x00002dc0, 0x00002dcc,
+    0x00002dd8, 0x00002de4, 0x00002df0, 0x00002dfc,
+    0x00002e08, 0x00002e14, 0x00002e20, 0x00002e2c,
+    0x00002e38, 0x00002e44, 0x00002e50, 0x00002e5c,
+    0x00002e68, 0x00002e74, 0x00002e80, 0x00002e8c,
+    0x00002e98, 0x00002ea4, 0x00002eb0, 0x00002ebc,
+    0x00002ec8, 0x00002ed4, 0x00002ee0, 0x00002eec,
+    0x00002ef8, 0x00002f04, 0x00002f10, 0x00002f1c,
+    0x00002f28, 0x00002f34, 0x00002f40, 0x00002f4c,
+    0x00002f58, 0x00002f64, 0x00002f70, 0x00002f7c,
+    0x00002f88, 0x00002f94, 0x00002fa0, 0x00002fac,
+    0x00002fb8, 0x00002fc4, 0x00002fd0, 0x00002fdc,
+    0x00002fe8, 0x00002ff4, 0x00003000, 0x0000300d,
+    0x0000301a, 0x00003027, 0x00003034, 0x00003041,
+    0x0000304e, 0x0000305b, 0x00003068, 0x00003075,
+    0x00003082, 0x0000308f, 0x0000309c, 0x000030a9,
+    0x000030b6, 0x000030c3, 0x000030d0, 0x000030dd,
+    0x000030ea, 0x000030f7, 0x00003104, 0x00003111,
+    0x0000311e, 0x0000312b, 0x00003138, 0x00003145,
+    0x00003152, 0x0000315f, 0x0000316c, 0x00003179,
+    0x00003186, 0x00003193, 0x000031a0, 0x000031ad,
+    0x000031ba, 0x000031c7, 0x000031d4, 0x000031e1,
+    0x000031ee, 0x000031fb, 0x00003208, 0x00003215,
+    0x00003222, 0x0000322f, 0x0000323c, 0x00003249,
+    0x00003256, 0x00003263, 0x00003270, 0x0000327d,
+    0x0000328a, 0x00003297, 0x000032a4, 0x000032b1,
+    0x000032be, 0x000032cb, 0x000032d8, 0x000032e5,
+    0x000032f2, 0x000032ff, 0x0000330c, 0x00003319,
+    0x00003326, 0x00003333, 0x00003340, 0x0000334d,
+    0x0000335a, 0x00003367, 0x00003374, 0x00003381,
+    0x0000338e, 0x0000339b, 0x000033a8, 0x000033b5,
+    0x000033c2, 0x000033cf, 0x000033dc, 0x000033e9,
+    0x000033f6, 0x00003403, 0x00003410, 0x0000341d,
+    0x0000342a, 0x00003437, 0x00003444, 0x00003451,
+    0x0000345e, 0x0000346b, 0x00003478, 0x00003485,
+    0x00003492, 0x0000349f, 0x000034ac, 0x000034b9,
+    0x000034c6, 0x000034d3, 0x000034e0, 0x000034ed,
+    0x000034fa, 0x00003507, 0x00003514, 0x00003521,
+    0x0000352e, 0x0000353b, 0x00003548, 0x00003555,
+    0x00003562, 0x0000356f, 0x0000357c, 0x00003589,
+    0x00003596, 0x000035a3, 0x000035b0, 0x000035bd,
+    0x000035ca, 0x000035d7, 0x000035e4, 0x000035f1,
+    0x000035fe, 0x0000360b, 0x00003618, 0x00003625,
+    0x00003632, 0x0000363f, 0x0000364c, 0x00003659,
+    0x00003666, 0x00003673, 0x00003680, 0x0000368d,
+    0x0000369a, 0x000036a7, 0x000036b4, 0x000036c1,
+    0x000036ce, 0x000036db, 0x000036e8, 0x000036f5,
+    0x00003702, 0x0000370f, 0x0000371c, 0x00003729,
+    0x00003736, 0x00003743, 0x00003750, 0x0000375d,
+    0x0000376a, 0x00003777, 0x00003784, 0x00003791,
+    0x0000379e, 0x000037ab, 0x000037b8, 0x000037c5,
+    0x000037d2, 0x000037df, 0x000037ec, 0x000037f9,
+    0x00003806, 0x00003813, 0x00003820, 0x0000382d,
+    0x0000383a, 0x00003847, 0x00003854, 0x00003861,
+    0x0000386e, 0x0000387b, 0x00003888, 0x00003895,
+    0x000038a2, 0x000038af, 0x000038bc, 0x000038c9,
+    0x000038d6, 0x000038e3, 0x000038f0, 0x000038fd,
+    0x0000390a, 0x00003917, 0x00003924, 0x00003931,
+    0x0000393e, 0x0000394b, 0x00003958, 0x00003965,
+    0x00003972, 0x0000397f, 0x0000398c, 0x00003999,
+    0x000039a6, 0x000039b3, 0x000039c0, 0x000039cd,
+    0x000039da, 0x000039e7, 0x000039f4, 0x00003a01,
+    0x00003a0e, 0x00003a1b, 0x00003a28, 0x00003a35,
+    0x00003a42, 0x00003a4f, 0x00003a5c, 0x00003a69,
+    0x00003a76, 0x00003a83, 0x00003a90, 0x00003a9d,
+    0x00003aaa, 0x00003ab7, 0x00003ac4, 0x00003ad1,
+    0x00003ade, 0x00003aeb, 0x00003af8, 0x00003b05,
+    0x00003b12, 0x00003b1f, 0x00003b2c, 0x00003b39,
+    0x00003b46, 0x00003b53, 0x00003b60, 0x00003b6d,
+    0x00003b7a, 0x00003b87, 0x00003b94, 0x00003ba1,
+    0x00003bae, 0x00003bbb, 0x00003bc8, 0x00003bd5,
+    0x00003be2, 0x00003bef, 0x00003bfc, 0x00003c09,
+    0x00003c16, 0x00003c23, 0x00003c30, 0x00003c3d,
+    0x00003c4a, 0x00003c57, 0x00003c64, 0x00003c71,
+    0x00003c7e, 0x00003c8b, 0x00003c98, 0x00003ca5,
+    0x00003cb2, 0x00003cbf, 0x00003ccc, 0x00003cd9,
+    0x00003ce6, 0x00003cf3, 0x00003d00, 0x00003d0d,
+    0x00003d1a, 0x00003d27, 0x00003d34, 0x00003d41,
+    0x00003d4e, 0x00003d5b, 0x00003d68, 0x00003d75,
+    0x00003d82, 0x00003d8f, 0x00003d9c, 0x00003da9,
+    0x00003db6, 0x00003dc3, 0x00003dd0, 0x00003ddd,
+    0x00003dea, 0x00003df7, 0x00003e04, 0x00003e11,
+    0x00003e1e, 0x00003e2b, 0x00003e38, 0x00003e45,
+    0x00003e52, 0x00003e5f, 0x00003e6c, 0x00003e79,
+    0x00003e86, 0x00003e93, 0x00003ea0, 0x00003ead,
+    0x00003eba, 0x00003ec7, 0x00003ed4, 0x00003ee1,
+    0x00003eee, 0x00003efb, 0x00003f08, 0x00003f15,
+    0x00003f22, 0x00003f2f, 0x00003f3c, 0x00003f49,
+    0x00003f56, 0x00003f63, 0x00003f70, 0x00003f7d,
+    0x00003f8a, 0x00003f97, 0x00003fa4, 0x00003fb1,
+    0x00003fbe, 0x00003fcb, 0x00003fd8, 0x00003fe5,
+    0x00003ff2, 0x00003fff, 0x0000400c, 0x00004019,
+    0x00004026, 0x00004033, 0x00004040, 0x0000404d,
+    0x0000405a, 0x00004067, 0x00004074, 0x00004081,
+    0x0000408e, 0x0000409b, 0x000040a8, 0x000040b5,
+    0x000040c2, 0x000040cf, 0x000040dc, 0x000040e9,
+    0x000040f6, 0x00004103, 0x00004110, 0x0000411d,
+    0x0000412a, 0x00004137, 0x00004144, 0x00004151,
+    0x0000415e, 0x0000416b, 0x00004178, 0x00004185,
+    0x00004192, 0x0000419f, 0x000041ac, 0x000041b9,
+    0x000041c6, 0x000041d3, 0x000041e0, 0x000041ed,
+    0x000041fa, 0x00004207, 0x00004214, 0x00004221,
+    0x0000422e, 0x0000423b, 0x00004248, 0x00004255,
+    0x00004262, 0x0000426f, 0x0000427c, 0x00004289,
+    0x00004296, 0x000042a3, 0x000042b0, 0x000042bd,
+    0x000042ca, 0x000042d7, 0x000042e4, 0x000042f1,
+    0x000042fe, 0x0000430b, 0x00004318, 0x00004325,
+    0x00004332, 0x0000433f, 0x0000434c, 0x00004359,
+    0x00004366, 0x00004373, 0x00004380, 0x0000438d,
+    0x0000439a, 0x000043a7, 0x000043b4, 0x000043c1,
+    0x000043ce, 0x000043db, 0x000043e8, 0x000043f5,
+    0x00004402, 0x0000440f, 0x0000441c, 0x00004429,
+    0x00004436, 0x00004443, 0x00004450, 0x0000445d,
+    0x0000446a, 0x00004477, 0x00004484, 0x00004491,
+    0x0000449e, 0x000044ab, 0x000044b8, 0x000044c5,
+    0x000044d2, 0x000044df, 0x000044ec, 0x000044f9,
+    0x00004506, 0x00004513, 0x00004520, 0x0000452d,
+    0x0000453a, 0x00004547, 0x00004554, 0x00004561,
+    0x0000456e, 0x0000457b, 0x00004588, 0x00004595,
+    0x000045a2, 0x000045af, 0x000045bc, 0x000045c9,
+    0x000045d6, 0x000045e3, 0x000045f0, 0x000045fd,
+    0x0000460a, 0x00004617, 0x00004624, 0x00004631,
+    0x0000463e, 0x0000464b, 0x00004658, 0x00004665,
+    0x00004672, 0x0000467f, 0x0000468c, 0x00004699,
+    0x000046a6, 0x000046b3, 0x000046c0, 0x000046cd,
+    0x000046da, 0x000046e7, 0x000046f4, 0x00004701,
+    0x0000470e, 0x0000471b, 0x00004728, 0x00004735,
+    0x00004742, 0x0000474f, 0x0000475c, 0x00004769,
+    0x00004776, 0x00004783, 0x00004790, 0x0000479d,
+    0x000047aa, 0x000047b7, 0x000047c4, 0x000047d1,
+    0x000047de, 0x000047eb, 0x000047f8, 0x00004805,
+    0x00004812, 0x0000481f, 0x0000482c, 0x00004839,
+    0x00004846, 0x00004853, 0x00004860, 0x0000486d,
+    0x0000487a, 0x00004887, 0x00004894, 0x000048a1,
+    0x000048ae, 0x000048bb, 0x000048c8, 0x000048d5,
+    0x000048e2, 0x000048ef, 0x000048fc, 0x00004909,
+    0x00004916, 0x00004923, 0x00004930, 0x0000493d,
+    0x0000494a, 0x00004957, 0x00004964, 0x00004971,
+    0x0000497e, 0x0000498b, 0x00004998, 0x000049a5,
+    0x000049b2, 0x000049bf, 0x000049cc, 0x000049d9,
+    0x000049e6, 0x000049f3, 0x00004a00, 0x00004a0d,
+    0x00004a1a, 0x00004a27, 0x00004a34, 0x00004a41,
+    0x00004a4e, 0x00004a5b, 0x00004a68, 0x00004a75,
+    0x00004a82, 0x00004a8f, 0x00004a9c, 0x00004aa9,
+    0x00004ab6, 0x00004ac3, 0x00004ad0, 0x00004add,
+    0x00004aea, 0x00004af7, 0x00004b04, 0x00004b11,
+    0x00004b1e, 0x00004b2b, 0x00004b38, 0x00004b45,
+    0x00004b52, 0x00004b5f, 0x00004b6c, 0x00004b79,
+    0x00004b86, 0x00004b93, 0x00004ba0, 0x00004bad,
+    0x00004bba, 0x00004bc7, 0x00004bd4, 0x00004be1,
+    0x00004bee, 0x00004bfb, 0x00004c08, 0x00004c15,
+    0x00004c22, 0x00004c2f, 0x00004c3c, 0x00004c49,
+    0x00004c56, 0x00004c63, 0x00004c70, 0x00004c7d,
+    0x00004c8a, 0x00004c97, 0x00004ca4, 0x00004cb1,
+    0x00004cbe, 0x00004ccb, 0x00004cd8, 0x00004ce5,
+    0x00004cf2, 0x00004cff, 0x00004d0c, 0x00004d19,
+    0x00004d26, 0x00004d33, 0x00004d40, 0x00004d4d,
+    0x00004d5a, 0x00004d67, 0x00004d74, 0x00004d81,
+    0x00004d8e, 0x00004d9b, 0x00004da8, 0x00004db5,
+    0x00004dc2, 0x00004dcf, 0x00004ddc, 0x00004de9,
+    0x00004df6, 0x00004e03, 0x00004e10, 0x00004e1d,
+    0x00004e2a, 0x00004e37, 0x00004e44, 0x00004e51,
+    0x00004e5e, 0x00004e6b, 0x00004e78, 0x00004e85,
+    0x00004e92, 0x00004e9f, 0x00004eac, 0x00004eb9,
+    0x00004ec6, 0x00004ed3, 0x00004ee0, 0x00004eed,
+    0x00004efa, 0x00004f07, 0x00004f14, 0x00004f21,
+    0x00004f2e, 0x00004f3b, 0x00004f48, 0x00004f55,
+    0x00004f62, 0x00004f6f, 0x00004f7c, 0x00004f89,
+    0x00004f96, 0x00004fa3, 0x00004fb0, 0x00004fbd,
+    0x00004fca, 0x00004fd7, 0x00004fe4, 0x00004ff1,
+    0x00004ffe, 0x0000500b, 0x00005018, 0x00005025,
+    0x00005032, 0x0000503f, 0x0000504c, 0x00005059,
+    0x00005066, 0x00005073, 0x00005080, 0x0000508d,
+    0x0000509a, 0x000050a7, 0x000050b4, 0x000050c1,
+    0x000050ce, 0x000050db, 0x000050e8, 0x000050f5,
+    0x00005102, 0x0000510f, 0x0000511c, 0x00005129,
+    0x00005136, 0x00005143, 0x00005150, 0x0000515d,
+    0x0000516a, 0x00005177, 0x00005184, 0x00005191,
+    0x0000519e, 0x000051ab, 0x000051b8, 0x000051c5,
+    0x000051d2, 0x000051df, 0x000051ec, 0x000051f9,
+    0x00005206, 0x00005213, 0x00005220, 0x0000522d,
+    0x0000523a, 0x00005247, 0x00005254, 0x00005261,
+    0x0000526e, 0x0000527b, 0x00005288, 0x00005295,
+    0x000052a2, 0x000052af, 0x000052bc, 0x000052c9,
+    0x000052d6, 0x000052e3, 0x000052f0, 0x000052fd,
+    0x0000530a, 0x00005317, 0x00005324, 0x00005331,
+    0x0000533e, 0x0000534b, 0x00005358, 0x00005365,
+    0x00005372, 0x0000537f, 0x0000538c, 0x00005399,
+    0x000053a6, 0x000053b3, 0x000053c0, 0x000053cd,
+    0x000053da, 0x000053e7, 0x000053f4, 0x00005401,
+    0x0000540e, 0x0000541b, 0x00005428, 0x00005435,
+    0x00005442, 0x0000544f, 0x0000545c, 0x00005469,
+    0x00005476, 0x00005483, 0x00005490, 0x0000549d,
+    0x000054aa, 0x000054b7, 0x000054c4, 0x000054d1,
+    0x000054de, 0x000054eb, 0x000054f8, 0x00005505,
+    0x00005512, 0x0000551f, 0x0000552c, 0x00005539,
+    0x00005546, 0x00005553, 0x00005560, 0x0000556d,
+    0x0000557a, 0x00005587, 0x00005594, 0x000055a1,
+    0x000055ae, 0x000055bb, 0x000055c8, 0x000055d5,
+    0x000055e2, 0x000055ef, 0x000055fc, 0x00005609,
+    0x00005616, 0x00005623, 0x00005630, 0x0000563d,
+    0x0000564a, 0x00005657, 0x00005664, 0x00005671,
+    0x0000567e, 0x0000568b, 0x00005698, 0x000056a5,
+    0x000056b2, 0x000056bf, 0x000056cc, 0x000056d9,
+    0x000056e6, 0x000056f3, 0x00005700, 0x0000570d,
+    0x0000571a, 0x00005727, 0x00005734, 0x00005741,
+    0x0000574e, 0x0000575b, 0x00005768, 0x00005775,
+    0x00005782, 0x0000578f, 0x0000579c, 0x000057a9,
+    0x000057b6, 0x000057c3, 0x000057d0, 0x000057dd,
+    0x000057ea, 0x000057f7, 0x00005804, 0x00005811,
+    0x0000581e, 0x0000582b, 0x00005838, 0x00005845,
+    0x00005852, 0x0000585f, 0x0000586c, 0x00005879,
+    0x00005886, 0x00005893, 0x000058a0, 0x000058ad,
+    0x000058ba, 0x000058c7, 0x000058d4, 0x000058e1,
+    0x000058ee, 0x000058fb, 0x00005908, 0x00005915,
+    0x00005922, 0x0000592f, 0x0000593c, 0x00005949,
+    0x00005956, 0x00005963, 0x00005970, 0x0000597d,
+    0x0000598a, 0x00005997, 0x000059a4, 0x000059b1,
+    0x000059be, 0x000059cb, 0x000059d8, 0x000059e5,
+    0x000059f2, 0x000059ff, 0x00005a0c, 0x00005a19,
+    0x00005a26, 0x00005a33, 0x00005a40, 0x00005a4d,
+    0x00005a5a, 0x00005a67, 0x00005a74, 0x00005a81,
+    0x00005a8e, 0x00005a9b, 0x00005aa8, 0x00005ab5,
+    0x00005ac2, 0x00005acf, 0x00005adc, 0x00005ae9,
+    0x00005af6, 0x00005b03, 0x00005b10, 0x00005b1d,
+    0x00005b2a, 0x00005b37, 0x00005b44, 0x00005b51,
+    0x00005b5e, 0x00005b6b, 0x00005b78, 0x00005b85,
+    0x00005b92, 0x00005b9f, 0x00005bac, 0x00005bb9,
+    0x00005bc6, 0x00005bd3, 0x00005be0, 0x00005bed,
+    0x00005bfa, 0x00005c07, 0x00005c14, 0x00005c21,
+    0x00005c2e, 0x00005c3b, 0x00005c48, 0x00005c55,
+    0x00005c62, 0x00005c6f, 0x00005c7c, 0x00005c89,
+    0x00005c96, 0x00005ca3, 0x00005cb0, 0x00005cbd,
+    0x00005cca, 0x00005cd7, 0x00005ce4, 0x00005cf1,
+    0x00005cfe, 0x00005d0b, 0x00005d18, 0x00005d25,
+    0x00005d32, 0x00005d3f, 0x00005d4c, 0x00005d59,
+    0x00005d66, 0x00005d73, 0x00005d80, 0x00005d8d,
+    0x00005d9a, 0x00005da7, 0x00005db4, 0x00005dc1,
+    0x00005dce, 0x00005ddb, 0x00005de8, 0x00005df5,
+    0x00005e02, 0x00005e0f, 0x00005e1c, 0x00005e29,
+    0x00005e36, 0x00005e43, 0x00005e50, 0x00005e5d,
+    0x00005e6a, 0x00005e77, 0x00005e84, 0x00005e91,
+    0x00005e9e, 0x00005eab, 0x00005eb8, 0x00005ec5,
+    0x00005ed2, 0x00005edf, 0x00005eec, 0x00005ef9,
+    0x00005f06, 0x00005f13, 0x00005f20, 0x00005f2d,
+    0x00005f3a, 0x00005f47, 0x00005f54, 0x00005f61,
+    0x00005f6e, 0x00005f7b, 0x00005f88, 0x00005f95,
+    0x00005fa2, 0x00005faf, 0x00005fbc, 0x00005fc9,
+    0x00005fd6, 0x00005fe3, 0x00005ff0, 0x00005ffd,
+    0x0000600a, 0x00006017, 0x00006024, 0x00006031,
+    0x0000603e, 0x0000604b, 0x00006058, 0x00006065,
+    0x00006072, 0x0000607f, 0x0000608c, 0x00006099,
+    0x000060a6, 0x000060b3, 0x000060c0, 0x000060cd,
+    0x000060da, 0x000060e7, 0x000060f4, 0x00006101,
+    0x0000610e, 0x0000611b, 0x00006128, 0x00006135,
+    0x00006142, 0x0000614f, 0x0000615c, 0x00006169,
+    0x00006176, 0x00006183, 0x00006190, 0x0000619d,
+    0x000061aa, 0x000061b7, 0x000061c4, 0x000061d1,
+    0x000061de, 0x000061eb, 0x000061f8, 0x00006205,
+    0x00006212, 0x0000621f, 0x0000622c, 0x00006239,
+    0x00006246, 0x00006253, 0x00006260, 0x0000626d,
+    0x0000627a, 0x00006287, 0x00006294, 0x000062a1,
+    0x000062ae, 0x000062bb, 0x000062c8, 0x000062d5,
+    0x000062e2, 0x000062ef, 0x000062fc, 0x00006309,
+    0x00006316, 0x00006323, 0x00006330, 0x0000633d,
+    0x0000634a, 0x00006357, 0x00006364, 0x00006371,
+    0x0000637e, 0x0000638b, 0x00006398, 0x000063a5,
+    0x000063b2, 0x000063bf, 0x000063cc, 0x000063d9,
+    0x000063e6, 0x000063f3, 0x00006400, 0x656c6966,
+    0x31303030, 0x7478742e, 0x656c6966, 0x32303030,
+    0x7478742e, 0x656c6966, 0x33303030, 0x7478742e,
+    0x656c6966, 0x34303030, 0x7478742e, 0x656c6966,
+    0x35303030, 0x7478742e, 0x656c6966, 0x36303030,
+    0x7478742e, 0x656c6966, 0x37303030, 0x7478742e,
+    0x656c6966, 0x38303030, 0x7478742e, 0x656c6966,
+    0x39303030, 0x7478742e, 0x656c6966, 0x30313030,
+    0x7478742e, 0x656c6966, 0x31313030, 0x7478742e,
+    0x656c6966, 0x32313030, 0x7478742e, 0x656c6966,
+    0x33313030, 0x7478742e, 0x656c6966, 0x34313030,
+    0x7478742e, 0x656c6966, 0x35313030, 0x7478742e,
+    0x656c6966, 0x36313030, 0x7478742e, 0x656c6966,
+    0x37313030, 0x7478742e, 0x656c6966, 0x38313030,
+    0x7478742e, 0x656c6966, 0x39313030, 0x7478742e,
+    0x656c6966, 0x30323030, 0x7478742e, 0x656c6966,
+    0x31323030, 0x7478742e, 0x656c6966, 0x32323030,
+    0x7478742e, 0x656c6966, 0x33323030, 0x7478742e,
+    0x656c6966, 0x34323030, 0x7478742e, 0x656c6966,
+    0x35323030, 0x7478742e, 0x656c6966, 0x36323030,
+    0x7478742e, 0x656c6966, 0x37323030, 0x7478742e,
+    0x656c6966, 0x38323030, 0x7478742e, 0x656c6966,
+    0x39323030, 0x7478742e, 0x656c6966, 0x30333030,
+    0x7478742e, 0x656c6966, 0x31333030, 0x7478742e,
+    0x656c6966, 0x32333030, 0x7478742e, 0x656c6966,
+    0x33333030, 0x7478742e, 0x656c6966, 0x34333030,
+    0x7478742e, 0x656c6966, 0x35333030, 0x7478742e,
+    0x656c6966, 0x36333030, 0x7478742e, 0x656c6966,
+    0x37333030, 0x7478742e, 0x656c6966, 0x38333030,
+    0x7478742e, 0x656c6966, 0x39333030, 0x7478742e,
+    0x656c6966, 0x30343030, 0x7478742e, 0x656c6966,
+    0x31343030, 0x7478742e, 0x656c6966, 0x32343030,
+    0x7478742e, 0x656c6966, 0x33343030, 0x7478742e,
+    0x656c6966, 0x34343030, 0x7478742e, 0x656c6966,
+    0x35343030, 0x7478742e, 0x656c6966, 0x36343030,
+    0x7478742e, 0x656c6966, 0x37343030, 0x7478742e,
+    0x656c6966, 0x38343030, 0x7478742e, 0x656c6966,
+    0x39343030, 0x7478742e, 0x656c6966, 0x30353030,
+    0x7478742e, 0x656c6966, 0x31353030, 0x7478742e,
+    0x656c6966, 0x32353030, 0x7478742e, 0x656c6966,
+    0x33353030, 0x7478742e, 0x656c6966, 0x34353030,
+    0x7478742e, 0x656c6966, 0x35353030, 0x7478742e,
+    0x656c6966, 0x36353030, 0x7478742e, 0x656c6966,
+    0x37353030, 0x7478742e, 0x656c6966, 0x38353030,
+    0x7478742e, 0x656c6966, 0x39353030, 0x7478742e,
+    0x656c6966, 0x30363030, 0x7478742e, 0x656c6966,
+    0x31363030, 0x7478742e, 0x656c6966, 0x32363030,
+    0x7478742e, 0x656c6966, 0x33363030, 0x7478742e,
+    0x656c6966, 0x34363030, 0x7478742e, 0x656c6966,
+    0x35363030, 0x7478742e, 0x656c6966, 0x36363030,
+    0x7478742e, 0x656c6966, 0x37363030, 0x7478742e,
+    0x656c6966, 0x38363030, 0x7478742e, 0x656c6966,
+    0x39363030, 0x7478742e, 0x656c6966, 0x30373030,
+    0x7478742e, 0x656c6966, 0x31373030, 0x7478742e,
+    0x656c6966, 0x32373030, 0x7478742e, 0x656c6966,
+    0x33373030, 0x7478742e, 0x656c6966, 0x34373030,
+    0x7478742e, 0x656c6966, 0x35373030, 0x7478742e,
+    0x656c6966, 0x36373030, 0x7478742e, 0x656c6966,
+    0x37373030, 0x7478742e, 0x656c6966, 0x38373030,
+    0x7478742e, 0x656c6966, 0x39373030, 0x7478742e,
+    0x656c6966, 0x30383030, 0x7478742e, 0x656c6966,
+    0x31383030, 0x7478742e, 0x656c6966, 0x32383030,
+    0x7478742e, 0x656c6966, 0x33383030, 0x7478742e,
+    0x656c6966, 0x34383030, 0x7478742e, 0x656c6966,
+    0x35383030, 0x7478742e, 0x656c6966, 0x36383030,
+    0x7478742e, 0x656c6966, 0x37383030, 0x7478742e,
+    0x656c6966, 0x38383030, 0x7478742e, 0x656c6966,
+    0x39383030, 0x7478742e, 0x656c6966, 0x30393030,
+    0x7478742e, 0x656c6966, 0x31393030, 0x7478742e,
+    0x656c6966, 0x32393030, 0x7478742e, 0x656c6966,
+    0x33393030, 0x7478742e, 0x656c6966, 0x34393030,
+    0x7478742e, 0x656c6966, 0x35393030, 0x7478742e,
+    0x656c6966, 0x36393030, 0x7478742e, 0x656c6966,
+    0x37393030, 0x7478742e, 0x656c6966, 0x38393030,
+    0x7478742e, 0x656c6966, 0x39393030, 0x7478742e,
+    0x656c6966, 0x30303130, 0x7478742e, 0x656c6966,
+    0x31303130, 0x7478742e, 0x656c6966, 0x32303130,
+    0x7478742e, 0x656c6966, 0x33303130, 0x7478742e,
+    0x656c6966, 0x34303130, 0x7478742e, 0x656c6966,
+    0x35303130, 0x7478742e, 0x656c6966, 0x36303130,
+    0x7478742e, 0x656c6966, 0x37303130, 0x7478742e,
+    0x656c6966, 0x38303130, 0x7478742e, 0x656c6966,
+    0x39303130, 0x7478742e, 0x656c6966, 0x30313130,
+    0x7478742e, 0x656c6966, 0x31313130, 0x7478742e,
+    0x656c6966, 0x32313130, 0x7478742e, 0x656c6966,
+    0x33313130, 0x7478742e, 0x656c6966, 0x34313130,
+    0x7478742e, 0x656c6966, 0x35313130, 0x7478742e,
+    0x656c6966, 0x36313130, 0x7478742e, 0x656c6966,
+    0x37313130, 0x7478742e, 0x656c6966, 0x38313130,
+    0x7478742e, 0x656c6966, 0x39313130, 0x7478742e,
+    0x656c6966, 0x30323130, 0x7478742e, 0x656c6966,
+    0x31323130, 0x7478742e, 0x656c6966, 0x32323130,
+    0x7478742e, 0x656c6966, 0x33323130, 0x7478742e,
+    0x656c6966, 0x34323130, 0x7478742e, 0x656c6966,
+    0x35323130, 0x7478742e, 0x656c6966, 0x36323130,
+    0x7478742e, 0x656c6966, 0x37323130, 0x7478742e,
+    0x656c6966, 0x38323130, 0x7478742e, 0x656c6966,
+    0x39323130, 0x7478742e, 0x656c6966, 0x30333130,
+    0x7478742e, 0x656c6966, 0x31333130, 0x7478742e,
+    0x656c6966, 0x32333130, 0x7478742e, 0x656c6966,
+    0x33333130, 0x7478742e, 0x656c6966, 0x34333130,
+    0x7478742e, 0x656c6966, 0x35333130, 0x7478742e,
+    0x656c6966, 0x36333130, 0x7478742e, 0x656c6966,
+    0x37333130, 0x7478742e, 0x656c6966, 0x38333130,
+    0x7478742e, 0x656c6966, 0x39333130, 0x7478742e,
+    0x656c6966, 0x30343130, 0x7478742e, 0x656c6966,
+    0x31343130, 0x7478742e, 0x656c6966, 0x32343130,
+    0x7478742e, 0x656c6966, 0x33343130, 0x7478742e,
+    0x656c6966, 0x34343130, 0x7478742e, 0x656c6966,
+    0x35343130, 0x7478742e, 0x656c6966, 0x36343130,
+    0x7478742e, 0x656c6966, 0x37343130, 0x7478742e,
+    0x656c6966, 0x38343130, 0x7478742e, 0x656c6966,
+    0x39343130, 0x7478742e, 0x656c6966, 0x30353130,
+    0x7478742e, 0x656c6966, 0x31353130, 0x7478742e,
+    0x656c6966, 0x32353130, 0x7478742e, 0x656c6966,
+    0x33353130, 0x7478742e, 0x656c6966, 0x34353130,
+    0x7478742e, 0x656c6966, 0x35353130, 0x7478742e,
+    0x656c6966, 0x36353130, 0x7478742e, 0x656c6966,
+    0x37353130, 0x7478742e, 0x656c6966, 0x38353130,
+    0x7478742e, 0x656c6966, 0x39353130, 0x7478742e,
+    0x656c6966, 0x30363130, 0x7478742e, 0x656c6966,
+    0x31363130, 0x7478742e, 0x656c6966, 0x32363130,
+    0x7478742e, 0x656c6966, 0x33363130, 0x7478742e,
+    0x656c6966, 0x34363130, 0x7478742e, 0x656c6966,
+    0x35363130, 0x7478742e, 0x656c6966, 0x36363130,
+    0x7478742e, 0x656c6966, 0x37363130, 0x7478742e,
+    0x656c6966, 0x38363130, 0x7478742e, 0x656c6966,
+    0x39363130, 0x7478742e, 0x656c6966, 0x30373130,
+    0x7478742e, 0x656c6966, 0x31373130, 0x7478742e,
+    0x656c6966, 0x32373130, 0x7478742e, 0x656c6966,
+    0x33373130, 0x7478742e, 0x656c6966, 0x34373130,
+    0x7478742e, 0x656c6966, 0x35373130, 0x7478742e,
+    0x656c6966, 0x36373130, 0x7478742e, 0x656c6966,
+    0x37373130, 0x7478742e, 0x656c6966, 0x38373130,
+    0x7478742e, 0x656c6966, 0x39373130, 0x7478742e,
+    0x656c6966, 0x30383130, 0x7478742e, 0x656c6966,
+    0x31383130, 0x7478742e, 0x656c6966, 0x32383130,
+    0x7478742e, 0x656c6966, 0x33383130, 0x7478742e,
+    0x656c6966, 0x34383130, 0x7478742e, 0x656c6966,
+    0x35383130, 0x7478742e, 0x656c6966, 0x36383130,
+    0x7478742e, 0x656c6966, 0x37383130, 0x7478742e,
+    0x656c6966, 0x38383130, 0x7478742e, 0x656c6966,
+    0x39383130, 0x7478742e, 0x656c6966, 0x30393130,
+    0x7478742e, 0x656c6966, 0x31393130, 0x7478742e,
+    0x656c6966, 0x32393130, 0x7478742e, 0x656c6966,
+    0x33393130, 0x7478742e, 0x656c6966, 0x34393130,
+    0x7478742e, 0x656c6966, 0x35393130, 0x7478742e,
+    0x656c6966, 0x36393130, 0x7478742e, 0x656c6966,
+    0x37393130, 0x7478742e, 0x656c6966, 0x38393130,
+    0x7478742e, 0x656c6966, 0x39393130, 0x7478742e,
+    0x656c6966, 0x30303230, 0x7478742e, 0x656c6966,
+    0x31303230, 0x7478742e, 0x656c6966, 0x32303230,
+    0x7478742e, 0x656c6966, 0x33303230, 0x7478742e,
+    0x656c6966, 0x34303230, 0x7478742e, 0x656c6966,
+    0x35303230, 0x7478742e, 0x656c6966, 0x36303230,
+    0x7478742e, 0x656c6966, 0x37303230, 0x7478742e,
+    0x656c6966, 0x38303230, 0x7478742e, 0x656c6966,
+    0x39303230, 0x7478742e, 0x656c6966, 0x30313230,
+    0x7478742e, 0x656c6966, 0x31313230, 0x7478742e,
+    0x656c6966, 0x32313230, 0x7478742e, 0x656c6966,
+    0x33313230, 0x7478742e, 0x656c6966, 0x34313230,
+    0x7478742e, 0x656c6966, 0x35313230, 0x7478742e,
+    0x656c6966, 0x36313230, 0x7478742e, 0x656c6966,
+    0x37313230, 0x7478742e, 0x656c6966, 0x38313230,
+    0x7478742e, 0x656c6966, 0x39313230, 0x7478742e,
+    0x656c6966, 0x30323230, 0x7478742e, 0x656c6966,
+    0x31323230, 0x7478742e, 0x656c6966, 0x32323230,
+    0x7478742e, 0x656c6966, 0x33323230, 0x7478742e,
+    0x656c6966, 0x34323230, 0x7478742e, 0x656c6966,
+    0x35323230, 0x7478742e, 0x656c6966, 0x36323230,
+    0x7478742e, 0x656c6966, 0x37323230, 0x7478742e,
+    0x656c6966, 0x38323230, 0x7478742e, 0x656c6966,
+    0x39323230, 0x7478742e, 0x656c6966, 0x30333230,
+    0x7478742e, 0x656c6966, 0x31333230, 0x7478742e,
+    0x656c6966, 0x32333230, 0x7478742e, 0x656c6966,
+    0x33333230, 0x7478742e, 0x656c6966, 0x34333230,
+    0x7478742e, 0x656c6966, 0x35333230, 0x7478742e,
+    0x656c6966, 0x36333230, 0x7478742e, 0x656c6966,
+    0x37333230, 0x7478742e, 0x656c6966, 0x38333230,
+    0x7478742e, 0x656c6966, 0x39333230, 0x7478742e,
+    0x656c6966, 0x30343230, 0x7478742e, 0x656c6966,
+    0x31343230, 0x7478742e, 0x656c6966, 0x32343230,
+    0x7478742e, 0x656c6966, 0x33343230, 0x7478742e,
+    0x656c6966, 0x34343230, 0x7478742e, 0x656c6966,
+    0x35343230, 0x7478742e, 0x656c6966, 0x36343230,
+    0x7478742e, 0x656c6966, 0x37343230, 0x7478742e,
+    0x656c6966, 0x38343230, 0x7478742e, 0x656c6966,
+    0x39343230, 0x7478742e, 0x656c6966, 0x30353230,
+    0x7478742e, 0x656c6966, 0x31353230, 0x7478742e,
+    0x656c6966, 0x32353230, 0x7478742e, 0x656c6966,
+    0x33353230, 0x7478742e, 0x656c6966, 0x34353230,
+    0x7478742e, 0x656c6966, 0x35353230, 0x7478742e,
+    0x656c6966, 0x36353230, 0x7478742e, 0x656c6966,
+    0x37353230, 0x7478742e, 0x656c6966, 0x38353230,
+    0x7478742e, 0x656c6966, 0x39353230, 0x7478742e,
+    0x656c6966, 0x30363230, 0x7478742e, 0x656c6966,
+    0x31363230, 0x7478742e, 0x656c6966, 0x32363230,
+    0x7478742e, 0x656c6966, 0x33363230, 0x7478742e,
+    0x656c6966, 0x34363230, 0x7478742e, 0x656c6966,
+    0x35363230, 0x7478742e, 0x656c6966, 0x36363230,
+    0x7478742e, 0x656c6966, 0x37363230, 0x7478742e,
+    0x656c6966, 0x38363230, 0x7478742e, 0x656c6966,
+    0x39363230, 0x7478742e, 0x656c6966, 0x30373230,
+    0x7478742e, 0x656c6966, 0x31373230, 0x7478742e,
+    0x656c6966, 0x32373230, 0x7478742e, 0x656c6966,
+    0x33373230, 0x7478742e, 0x656c6966, 0x34373230,
+    0x7478742e, 0x656c6966, 0x35373230, 0x7478742e,
+    0x656c6966, 0x36373230, 0x7478742e, 0x656c6966,
+    0x37373230, 0x7478742e, 0x656c6966, 0x38373230,
+    0x7478742e, 0x656c6966, 0x39373230, 0x7478742e,
+    0x656c6966, 0x30383230, 0x7478742e, 0x656c6966,
+    0x31383230, 0x7478742e, 0x656c6966, 0x32383230,
+    0x7478742e, 0x656c6966, 0x33383230, 0x7478742e,
+    0x656c6966, 0x34383230, 0x7478742e, 0x656c6966,
+    0x35383230, 0x7478742e, 0x656c6966, 0x36383230,
+    0x7478742e, 0x656c6966, 0x37383230, 0x7478742e,
+    0x656c6966, 0x38383230, 0x7478742e, 0x656c6966,
+    0x39383230, 0x7478742e, 0x656c6966, 0x30393230,
+    0x7478742e, 0x656c6966, 0x31393230, 0x7478742e,
+    0x656c6966, 0x32393230, 0x7478742e, 0x656c6966,
+    0x33393230, 0x7478742e, 0x656c6966, 0x34393230,
+    0x7478742e, 0x656c6966, 0x35393230, 0x7478742e,
+    0x656c6966, 0x36393230, 0x7478742e, 0x656c6966,
+    0x37393230, 0x7478742e, 0x656c6966, 0x38393230,
+    0x7478742e, 0x656c6966, 0x39393230, 0x7478742e,
+    0x656c6966, 0x30303330, 0x7478742e, 0x656c6966,
+    0x31303330, 0x7478742e, 0x656c6966, 0x32303330,
+    0x7478742e, 0x656c6966, 0x33303330, 0x7478742e,
+    0x656c6966, 0x34303330, 0x7478742e, 0x656c6966,
+    0x35303330, 0x7478742e, 0x656c6966, 0x36303330,
+    0x7478742e, 0x656c6966, 0x37303330, 0x7478742e,
+    0x656c6966, 0x38303330, 0x7478742e, 0x656c6966,
+    0x39303330, 0x7478742e, 0x656c6966, 0x30313330,
+    0x7478742e, 0x656c6966, 0x31313330, 0x7478742e,
+    0x656c6966, 0x32313330, 0x7478742e, 0x656c6966,
+    0x33313330, 0x7478742e, 0x656c6966, 0x34313330,
+    0x7478742e, 0x656c6966, 0x35313330, 0x7478742e,
+    0x656c6966, 0x36313330, 0x7478742e, 0x656c6966,
+    0x37313330, 0x7478742e, 0x656c6966, 0x38313330,
+    0x7478742e, 0x656c6966, 0x39313330, 0x7478742e,
+    0x656c6966, 0x30323330, 0x7478742e, 0x656c6966,
+    0x31323330, 0x7478742e, 0x656c6966, 0x32323330,
+    0x7478742e, 0x656c6966, 0x33323330, 0x7478742e,
+    0x656c6966, 0x34323330, 0x7478742e, 0x656c6966,
+    0x35323330, 0x7478742e, 0x656c6966, 0x36323330,
+    0x7478742e, 0x656c6966, 0x37323330, 0x7478742e,
+    0x656c6966, 0x38323330, 0x7478742e, 0x656c6966,
+    0x39323330, 0x7478742e, 0x656c6966, 0x30333330,
+    0x7478742e, 0x656c6966, 0x31333330, 0x7478742e,
+    0x656c6966, 0x32333330, 0x7478742e, 0x656c6966,
+    0x33333330, 0x7478742e, 0x656c6966, 0x34333330,
+    0x7478742e, 0x656c6966, 0x35333330, 0x7478742e,
+    0x656c6966, 0x36333330, 0x7478742e, 0x656c6966,
+    0x37333330, 0x7478742e, 0x656c6966, 0x38333330,
+    0x7478742e, 0x656c6966, 0x39333330, 0x7478742e,
+    0x656c6966, 0x30343330, 0x7478742e, 0x656c6966,
+    0x31343330, 0x7478742e, 0x656c6966, 0x32343330,
+    0x7478742e, 0x656c6966, 0x33343330, 0x7478742e,
+    0x656c6966, 0x34343330, 0x7478742e, 0x656c6966,
+    0x35343330, 0x7478742e, 0x656c6966, 0x36343330,
+    0x7478742e, 0x656c6966, 0x37343330, 0x7478742e,
+    0x656c6966, 0x38343330, 0x7478742e, 0x656c6966,
+    0x39343330, 0x7478742e, 0x656c6966, 0x30353330,
+    0x7478742e, 0x656c6966, 0x31353330, 0x7478742e,
+    0x656c6966, 0x32353330, 0x7478742e, 0x656c6966,
+    0x33353330, 0x7478742e, 0x656c6966, 0x34353330,
+    0x7478742e, 0x656c6966, 0x35353330, 0x7478742e,
+    0x656c6966, 0x36353330, 0x7478742e, 0x656c6966,
+    0x37353330, 0x7478742e, 0x656c6966, 0x38353330,
+    0x7478742e, 0x656c6966, 0x39353330, 0x7478742e,
+    0x656c6966, 0x30363330, 0x7478742e, 0x656c6966,
+    0x31363330, 0x7478742e, 0x656c6966, 0x32363330,
+    0x7478742e, 0x656c6966, 0x33363330, 0x7478742e,
+    0x656c6966, 0x34363330, 0x7478742e, 0x656c6966,
+    0x35363330, 0x7478742e, 0x656c6966, 0x36363330,
+    0x7478742e, 0x656c6966, 0x37363330, 0x7478742e,
+    0x656c6966, 0x38363330, 0x7478742e, 0x656c6966,
+    0x39363330, 0x7478742e, 0x656c6966, 0x30373330,
+    0x7478742e, 0x656c6966, 0x31373330, 0x7478742e,
+    0x656c6966, 0x32373330, 0x7478742e, 0x656c6966,
+    0x33373330, 0x7478742e, 0x656c6966, 0x34373330,
+    0x7478742e, 0x656c6966, 0x35373330, 0x7478742e,
+    0x656c6966, 0x36373330, 0x7478742e, 0x656c6966,
+    0x37373330, 0x7478742e, 0x656c6966, 0x38373330,
+    0x7478742e, 0x656c6966, 0x39373330, 0x7478742e,
+    0x656c6966, 0x30383330, 0x7478742e, 0x656c6966,
+    0x31383330, 0x7478742e, 0x656c6966, 0x32383330,
+    0x7478742e, 0x656c6966, 0x33383330, 0x7478742e,
+    0x656c6966, 0x34383330, 0x7478742e, 0x656c6966,
+    0x35383330, 0x7478742e, 0x656c6966, 0x36383330,
+    0x7478742e, 0x656c6966, 0x37383330, 0x7478742e,
+    0x656c6966, 0x38383330, 0x7478742e, 0x656c6966,
+    0x39383330, 0x7478742e, 0x656c6966, 0x30393330,
+    0x7478742e, 0x656c6966, 0x31393330, 0x7478742e,
+    0x656c6966, 0x32393330, 0x7478742e, 0x656c6966,
+    0x33393330, 0x7478742e, 0x656c6966, 0x34393330,
+    0x7478742e, 0x656c6966, 0x35393330, 0x7478742e,
+    0x656c6966, 0x36393330, 0x7478742e, 0x656c6966,
+    0x37393330, 0x7478742e, 0x656c6966, 0x38393330,
+    0x7478742e, 0x656c6966, 0x39393330, 0x7478742e,
+    0x656c6966, 0x30303430, 0x7478742e, 0x656c6966,
+    0x31303430, 0x7478742e, 0x656c6966, 0x32303430,
+    0x7478742e, 0x656c6966, 0x33303430, 0x7478742e,
+    0x656c6966, 0x34303430, 0x7478742e, 0x656c6966,
+    0x35303430, 0x7478742e, 0x656c6966, 0x36303430,
+    0x7478742e, 0x656c6966, 0x37303430, 0x7478742e,
+    0x656c6966, 0x38303430, 0x7478742e, 0x656c6966,
+    0x39303430, 0x7478742e, 0x656c6966, 0x30313430,
+    0x7478742e, 0x656c6966, 0x31313430, 0x7478742e,
+    0x656c6966, 0x32313430, 0x7478742e, 0x656c6966,
+    0x33313430, 0x7478742e, 0x656c6966, 0x34313430,
+    0x7478742e, 0x656c6966, 0x35313430, 0x7478742e,
+    0x656c6966, 0x36313430, 0x7478742e, 0x656c6966,
+    0x37313430, 0x7478742e, 0x656c6966, 0x38313430,
+    0x7478742e, 0x656c6966, 0x39313430, 0x7478742e,
+    0x656c6966, 0x30323430, 0x7478742e, 0x656c6966,
+    0x31323430, 0x7478742e, 0x656c6966, 0x32323430,
+    0x7478742e, 0x656c6966, 0x33323430, 0x7478742e,
+    0x656c6966, 0x34323430, 0x7478742e, 0x656c6966,
+    0x35323430, 0x7478742e, 0x656c6966, 0x36323430,
+    0x7478742e, 0x656c6966, 0x37323430, 0x7478742e,
+    0x656c6966, 0x38323430, 0x7478742e, 0x656c6966,
+    0x39323430, 0x7478742e, 0x656c6966, 0x30333430,
+    0x7478742e, 0x656c6966, 0x31333430, 0x7478742e,
+    0x656c6966, 0x32333430, 0x7478742e, 0x656c6966,
+    0x33333430, 0x7478742e, 0x656c6966, 0x34333430,
+    0x7478742e, 0x656c6966, 0x35333430, 0x7478742e,
+    0x656c6966, 0x36333430, 0x7478742e, 0x656c6966,
+    0x37333430, 0x7478742e, 0x656c6966, 0x38333430,
+    0x7478742e, 0x656c6966, 0x39333430, 0x7478742e,
+    0x656c6966, 0x30343430, 0x7478742e, 0x656c6966,
+    0x31343430, 0x7478742e, 0x656c6966, 0x32343430,
+    0x7478742e, 0x656c6966, 0x33343430, 0x7478742e,
+    0x656c6966, 0x34343430, 0x7478742e, 0x656c6966,
+    0x35343430, 0x7478742e, 0x656c6966, 0x36343430,
+    0x7478742e, 0x656c6966, 0x37343430, 0x7478742e,
+    0x656c6966, 0x38343430, 0x7478742e, 0x656c6966,
+    0x39343430, 0x7478742e, 0x656c6966, 0x30353430,
+    0x7478742e, 0x656c6966, 0x31353430, 0x7478742e,
+    0x656c6966, 0x32353430, 0x7478742e, 0x656c6966,
+    0x33353430, 0x7478742e, 0x656c6966, 0x34353430,
+    0x7478742e, 0x656c6966, 0x35353430, 0x7478742e,
+    0x656c6966, 0x36353430, 0x7478742e, 0x656c6966,
+    0x37353430, 0x7478742e, 0x656c6966, 0x38353430,
+    0x7478742e, 0x656c6966, 0x39353430, 0x7478742e,
+    0x656c6966, 0x30363430, 0x7478742e, 0x656c6966,
+    0x31363430, 0x7478742e, 0x656c6966, 0x32363430,
+    0x7478742e, 0x656c6966, 0x33363430, 0x7478742e,
+    0x656c6966, 0x34363430, 0x7478742e, 0x656c6966,
+    0x35363430, 0x7478742e, 0x656c6966, 0x36363430,
+    0x7478742e, 0x656c6966, 0x37363430, 0x7478742e,
+    0x656c6966, 0x38363430, 0x7478742e, 0x656c6966,
+    0x39363430, 0x7478742e, 0x656c6966, 0x30373430,
+    0x7478742e, 0x656c6966, 0x31373430, 0x7478742e,
+    0x656c6966, 0x32373430, 0x7478742e, 0x656c6966,
+    0x33373430, 0x7478742e, 0x656c6966, 0x34373430,
+    0x7478742e, 0x656c6966, 0x35373430, 0x7478742e,
+    0x656c6966, 0x36373430, 0x7478742e, 0x656c6966,
+    0x37373430, 0x7478742e, 0x656c6966, 0x38373430,
+    0x7478742e, 0x656c6966, 0x39373430, 0x7478742e,
+    0x656c6966, 0x30383430, 0x7478742e, 0x656c6966,
+    0x31383430, 0x7478742e, 0x656c6966, 0x32383430,
+    0x7478742e, 0x656c6966, 0x33383430, 0x7478742e,
+    0x656c6966, 0x34383430, 0x7478742e, 0x656c6966,
+    0x35383430, 0x7478742e, 0x656c6966, 0x36383430,
+    0x7478742e, 0x656c6966, 0x37383430, 0x7478742e,
+    0x656c6966, 0x38383430, 0x7478742e, 0x656c6966,
+    0x39383430, 0x7478742e, 0x656c6966, 0x30393430,
+    0x7478742e, 0x656c6966, 0x31393430, 0x7478742e,
+    0x656c6966, 0x32393430, 0x7478742e, 0x656c6966,
+    0x33393430, 0x7478742e, 0x656c6966, 0x34393430,
+    0x7478742e, 0x656c6966, 0x35393430, 0x7478742e,
+    0x656c6966, 0x36393430, 0x7478742e, 0x656c6966,
+    0x37393430, 0x7478742e, 0x656c6966, 0x38393430,
+    0x7478742e, 0x656c6966, 0x39393430, 0x7478742e,
+    0x656c6966, 0x30303530, 0x7478742e, 0x656c6966,
+    0x31303530, 0x7478742e, 0x656c6966, 0x32303530,
+    0x7478742e, 0x656c6966, 0x33303530, 0x7478742e,
+    0x656c6966, 0x34303530, 0x7478742e, 0x656c6966,
+    0x35303530, 0x7478742e, 0x656c6966, 0x36303530,
+    0x7478742e, 0x656c6966, 0x37303530, 0x7478742e,
+    0x656c6966, 0x38303530, 0x7478742e, 0x656c6966,
+    0x39303530, 0x7478742e, 0x656c6966, 0x30313530,
+    0x7478742e, 0x656c6966, 0x31313530, 0x7478742e,
+    0x656c6966, 0x32313530, 0x7478742e, 0x656c6966,
+    0x33313530, 0x7478742e, 0x656c6966, 0x34313530,
+    0x7478742e, 0x656c6966, 0x35313530, 0x7478742e,
+    0x656c6966, 0x36313530, 0x7478742e, 0x656c6966,
+    0x37313530, 0x7478742e, 0x656c6966, 0x38313530,
+    0x7478742e, 0x656c6966, 0x39313530, 0x7478742e,
+    0x656c6966, 0x30323530, 0x7478742e, 0x656c6966,
+    0x31323530, 0x7478742e, 0x656c6966, 0x32323530,
+    0x7478742e, 0x656c6966, 0x33323530, 0x7478742e,
+    0x656c6966, 0x34323530, 0x7478742e, 0x656c6966,
+    0x35323530, 0x7478742e, 0x656c6966, 0x36323530,
+    0x7478742e, 0x656c6966, 0x37323530, 0x7478742e,
+    0x656c6966, 0x38323530, 0x7478742e, 0x656c6966,
+    0x39323530, 0x7478742e, 0x656c6966, 0x30333530,
+    0x7478742e, 0x656c6966, 0x31333530, 0x7478742e,
+    0x656c6966, 0x32333530, 0x7478742e, 0x656c6966,
+    0x33333530, 0x7478742e, 0x656c6966, 0x34333530,
+    0x7478742e, 0x656c6966, 0x35333530, 0x7478742e,
+    0x656c6966, 0x36333530, 0x7478742e, 0x656c6966,
+    0x37333530, 0x7478742e, 0x656c6966, 0x38333530,
+    0x7478742e, 0x656c6966, 0x39333530, 0x7478742e,
+    0x656c6966, 0x30343530, 0x7478742e, 0x656c6966,
+    0x31343530, 0x7478742e, 0x656c6966, 0x32343530,
+    0x7478742e, 0x656c6966, 0x33343530, 0x7478742e,
+    0x656c6966, 0x34343530, 0x7478742e, 0x656c6966,
+    0x35343530, 0x7478742e, 0x656c6966, 0x36343530,
+    0x7478742e, 0x656c6966, 0x37343530, 0x7478742e,
+    0x656c6966, 0x38343530, 0x7478742e, 0x656c6966,
+    0x39343530, 0x7478742e, 0x656c6966, 0x30353530,
+    0x7478742e, 0x656c6966, 0x31353530, 0x7478742e,
+    0x656c6966, 0x32353530, 0x7478742e, 0x656c6966,
+    0x33353530, 0x7478742e, 0x656c6966, 0x34353530,
+    0x7478742e, 0x656c6966, 0x35353530, 0x7478742e,
+    0x656c6966, 0x36353530, 0x7478742e, 0x656c6966,
+    0x37353530, 0x7478742e, 0x656c6966, 0x38353530,
+    0x7478742e, 0x656c6966, 0x39353530, 0x7478742e,
+    0x656c6966, 0x30363530, 0x7478742e, 0x656c6966,
+    0x31363530, 0x7478742e, 0x656c6966, 0x32363530,
+    0x7478742e, 0x656c6966, 0x33363530, 0x7478742e,
+    0x656c6966, 0x34363530, 0x7478742e, 0x656c6966,
+    0x35363530, 0x7478742e, 0x656c6966, 0x36363530,
+    0x7478742e, 0x656c6966, 0x37363530, 0x7478742e,
+    0x656c6966, 0x38363530, 0x7478742e, 0x656c6966,
+    0x39363530, 0x7478742e, 0x656c6966, 0x30373530,
+    0x7478742e, 0x656c6966, 0x31373530, 0x7478742e,
+    0x656c6966, 0x32373530, 0x7478742e, 0x656c6966,
+    0x33373530, 0x7478742e, 0x656c6966, 0x34373530,
+    0x7478742e, 0x656c6966, 0x35373530, 0x7478742e,
+    0x656c6966, 0x36373530, 0x7478742e, 0x656c6966,
+    0x37373530, 0x7478742e, 0x656c6966, 0x38373530,
+    0x7478742e, 0x656c6966, 0x39373530, 0x7478742e,
+    0x656c6966, 0x30383530, 0x7478742e, 0x656c6966,
+    0x31383530, 0x7478742e, 0x656c6966, 0x32383530,
+    0x7478742e, 0x656c6966, 0x33383530, 0x7478742e,
+    0x656c6966, 0x34383530, 0x7478742e, 0x656c6966,
+    0x35383530, 0x7478742e, 0x656c6966, 0x36383530,
+    0x7478742e, 0x656c6966, 0x37383530, 0x7478742e,
+    0x656c6966, 0x38383530, 0x7478742e, 0x656c6966,
+    0x39383530, 0x7478742e, 0x656c6966, 0x30393530,
+    0x7478742e, 0x656c6966, 0x31393530, 0x7478742e,
+    0x656c6966, 0x32393530, 0x7478742e, 0x656c6966,
+    0x33393530, 0x7478742e, 0x656c6966, 0x34393530,
+    0x7478742e, 0x656c6966, 0x35393530, 0x7478742e,
+    0x656c6966, 0x36393530, 0x7478742e, 0x656c6966,
+    0x37393530, 0x7478742e, 0x656c6966, 0x38393530,
+    0x7478742e, 0x656c6966, 0x39393530, 0x7478742e,
+    0x656c6966, 0x30303630, 0x7478742e, 0x656c6966,
+    0x31303630, 0x7478742e, 0x656c6966, 0x32303630,
+    0x7478742e, 0x656c6966, 0x33303630, 0x7478742e,
+    0x656c6966, 0x34303630, 0x7478742e, 0x656c6966,
+    0x35303630, 0x7478742e, 0x656c6966, 0x36303630,
+    0x7478742e, 0x656c6966, 0x37303630, 0x7478742e,
+    0x656c6966, 0x38303630, 0x7478742e, 0x656c6966,
+    0x39303630, 0x7478742e, 0x656c6966, 0x30313630,
+    0x7478742e, 0x656c6966, 0x31313630, 0x7478742e,
+    0x656c6966, 0x32313630, 0x7478742e, 0x656c6966,
+    0x33313630, 0x7478742e, 0x656c6966, 0x34313630,
+    0x7478742e, 0x656c6966, 0x35313630, 0x7478742e,
+    0x656c6966, 0x36313630, 0x7478742e, 0x656c6966,
+    0x37313630, 0x7478742e, 0x656c6966, 0x38313630,
+    0x7478742e, 0x656c6966, 0x39313630, 0x7478742e,
+    0x656c6966, 0x30323630, 0x7478742e, 0x656c6966,
+    0x31323630, 0x7478742e, 0x656c6966, 0x32323630,
+    0x7478742e, 0x656c6966, 0x33323630, 0x7478742e,
+    0x656c6966, 0x34323630, 0x7478742e, 0x656c6966,
+    0x35323630, 0x7478742e, 0x656c6966, 0x36323630,
+    0x7478742e, 0x656c6966, 0x37323630, 0x7478742e,
+    0x656c6966, 0x38323630, 0x7478742e, 0x656c6966,
+    0x39323630, 0x7478742e, 0x656c6966, 0x30333630,
+    0x7478742e, 0x656c6966, 0x31333630, 0x7478742e,
+    0x656c6966, 0x32333630, 0x7478742e, 0x656c6966,
+    0x33333630, 0x7478742e, 0x656c6966, 0x34333630,
+    0x7478742e, 0x656c6966, 0x35333630, 0x7478742e,
+    0x656c6966, 0x36333630, 0x7478742e, 0x656c6966,
+    0x37333630, 0x7478742e, 0x656c6966, 0x38333630,
+    0x7478742e, 0x656c6966, 0x39333630, 0x7478742e,
+    0x656c6966, 0x30343630, 0x7478742e, 0x656c6966,
+    0x31343630, 0x7478742e, 0x656c6966, 0x32343630,
+    0x7478742e, 0x656c6966, 0x33343630, 0x7478742e,
+    0x656c6966, 0x34343630, 0x7478742e, 0x656c6966,
+    0x35343630, 0x7478742e, 0x656c6966, 0x36343630,
+    0x7478742e, 0x656c6966, 0x37343630, 0x7478742e,
+    0x656c6966, 0x38343630, 0x7478742e, 0x656c6966,
+    0x39343630, 0x7478742e, 0x656c6966, 0x30353630,
+    0x7478742e, 0x656c6966, 0x31353630, 0x7478742e,
+    0x656c6966, 0x32353630, 0x7478742e, 0x656c6966,
+    0x33353630, 0x7478742e, 0x656c6966, 0x34353630,
+    0x7478742e, 0x656c6966, 0x35353630, 0x7478742e,
+    0x656c6966, 0x36353630, 0x7478742e, 0x656c6966,
+    0x37353630, 0x7478742e, 0x656c6966, 0x38353630,
+    0x7478742e, 0x656c6966, 0x39353630, 0x7478742e,
+    0x656c6966, 0x30363630, 0x7478742e, 0x656c6966,
+    0x31363630, 0x7478742e, 0x656c6966, 0x32363630,
+    0x7478742e, 0x656c6966, 0x33363630, 0x7478742e,
+    0x656c6966, 0x34363630, 0x7478742e, 0x656c6966,
+    0x35363630, 0x7478742e, 0x656c6966, 0x36363630,
+    0x7478742e, 0x656c6966, 0x37363630, 0x7478742e,
+    0x656c6966, 0x38363630, 0x7478742e, 0x656c6966,
+    0x39363630, 0x7478742e, 0x656c6966, 0x30373630,
+    0x7478742e, 0x656c6966, 0x31373630, 0x7478742e,
+    0x656c6966, 0x32373630, 0x7478742e, 0x656c6966,
+    0x33373630, 0x7478742e, 0x656c6966, 0x34373630,
+    0x7478742e, 0x656c6966, 0x35373630, 0x7478742e,
+    0x656c6966, 0x36373630, 0x7478742e, 0x656c6966,
+    0x37373630, 0x7478742e, 0x656c6966, 0x38373630,
+    0x7478742e, 0x656c6966, 0x39373630, 0x7478742e,
+    0x656c6966, 0x30383630, 0x7478742e, 0x656c6966,
+    0x31383630, 0x7478742e, 0x656c6966, 0x32383630,
+    0x7478742e, 0x656c6966, 0x33383630, 0x7478742e,
+    0x656c6966, 0x34383630, 0x7478742e, 0x656c6966,
+    0x35383630, 0x7478742e, 0x656c6966, 0x36383630,
+    0x7478742e, 0x656c6966, 0x37383630, 0x7478742e,
+    0x656c6966, 0x38383630, 0x7478742e, 0x656c6966,
+    0x39383630, 0x7478742e, 0x656c6966, 0x30393630,
+    0x7478742e, 0x656c6966, 0x31393630, 0x7478742e,
+    0x656c6966, 0x32393630, 0x7478742e, 0x656c6966,
+    0x33393630, 0x7478742e, 0x656c6966, 0x34393630,
+    0x7478742e, 0x656c6966, 0x35393630, 0x7478742e,
+    0x656c6966, 0x36393630, 0x7478742e, 0x656c6966,
+    0x37393630, 0x7478742e, 0x656c6966, 0x38393630,
+    0x7478742e, 0x656c6966, 0x39393630, 0x7478742e,
+    0x656c6966, 0x30303730, 0x7478742e, 0x656c6966,
+    0x31303730, 0x7478742e, 0x656c6966, 0x32303730,
+    0x7478742e, 0x656c6966, 0x33303730, 0x7478742e,
+    0x656c6966, 0x34303730, 0x7478742e, 0x656c6966,
+    0x35303730, 0x7478742e, 0x656c6966, 0x36303730,
+    0x7478742e, 0x656c6966, 0x37303730, 0x7478742e,
+    0x656c6966, 0x38303730, 0x7478742e, 0x656c6966,
+    0x39303730, 0x7478742e, 0x656c6966, 0x30313730,
+    0x7478742e, 0x656c6966, 0x31313730, 0x7478742e,
+    0x656c6966, 0x32313730, 0x7478742e, 0x656c6966,
+    0x33313730, 0x7478742e, 0x656c6966, 0x34313730,
+    0x7478742e, 0x656c6966, 0x35313730, 0x7478742e,
+    0x656c6966, 0x36313730, 0x7478742e, 0x656c6966,
+    0x37313730, 0x7478742e, 0x656c6966, 0x38313730,
+    0x7478742e, 0x656c6966, 0x39313730, 0x7478742e,
+    0x656c6966, 0x30323730, 0x7478742e, 0x656c6966,
+    0x31323730, 0x7478742e, 0x656c6966, 0x32323730,
+    0x7478742e, 0x656c6966, 0x33323730, 0x7478742e,
+    0x656c6966, 0x34323730, 0x7478742e, 0x656c6966,
+    0x35323730, 0x7478742e, 0x656c6966, 0x36323730,
+    0x7478742e, 0x656c6966, 0x37323730, 0x7478742e,
+    0x656c6966, 0x38323730, 0x7478742e, 0x656c6966,
+    0x39323730, 0x7478742e, 0x656c6966, 0x30333730,
+    0x7478742e, 0x656c6966, 0x31333730, 0x7478742e,
+    0x656c6966, 0x32333730, 0x7478742e, 0x656c6966,
+    0x33333730, 0x7478742e, 0x656c6966, 0x34333730,
+    0x7478742e, 0x656c6966, 0x35333730, 0x7478742e,
+    0x656c6966, 0x36333730, 0x7478742e, 0x656c6966,
+    0x37333730, 0x7478742e, 0x656c6966, 0x38333730,
+    0x7478742e, 0x656c6966, 0x39333730, 0x7478742e,
+    0x656c6966, 0x30343730, 0x7478742e, 0x656c6966,
+    0x31343730, 0x7478742e, 0x656c6966, 0x32343730,
+    0x7478742e, 0x656c6966, 0x33343730, 0x7478742e,
+    0x656c6966, 0x34343730, 0x7478742e, 0x656c6966,
+    0x35343730, 0x7478742e, 0x656c6966, 0x36343730,
+    0x7478742e, 0x656c6966, 0x37343730, 0x7478742e,
+    0x656c6966, 0x38343730, 0x7478742e, 0x656c6966,
+    0x39343730, 0x7478742e, 0x656c6966, 0x30353730,
+    0x7478742e, 0x656c6966, 0x31353730, 0x7478742e,
+    0x656c6966, 0x32353730, 0x7478742e, 0x656c6966,
+    0x33353730, 0x7478742e, 0x656c6966, 0x34353730,
+    0x7478742e, 0x656c6966, 0x35353730, 0x7478742e,
+    0x656c6966, 0x36353730, 0x7478742e, 0x656c6966,
+    0x37353730, 0x7478742e, 0x656c6966, 0x38353730,
+    0x7478742e, 0x656c6966, 0x39353730, 0x7478742e,
+    0x656c6966, 0x30363730, 0x7478742e, 0x656c6966,
+    0x31363730, 0x7478742e, 0x656c6966, 0x32363730,
+    0x7478742e, 0x656c6966, 0x33363730, 0x7478742e,
+    0x656c6966, 0x34363730, 0x7478742e, 0x656c6966,
+    0x35363730, 0x7478742e, 0x656c6966, 0x36363730,
+    0x7478742e, 0x656c6966, 0x37363730, 0x7478742e,
+    0x656c6966, 0x38363730, 0x7478742e, 0x656c6966,
+    0x39363730, 0x7478742e, 0x656c6966, 0x30373730,
+    0x7478742e, 0x656c6966, 0x31373730, 0x7478742e,
+    0x656c6966, 0x32373730, 0x7478742e, 0x656c6966,
+    0x33373730, 0x7478742e, 0x656c6966, 0x34373730,
+    0x7478742e, 0x656c6966, 0x35373730, 0x7478742e,
+    0x656c6966, 0x36373730, 0x7478742e, 0x656c6966,
+    0x37373730, 0x7478742e, 0x656c6966, 0x38373730,
+    0x7478742e, 0x656c6966, 0x39373730, 0x7478742e,
+    0x656c6966, 0x30383730, 0x7478742e, 0x656c6966,
+    0x31383730, 0x7478742e, 0x656c6966, 0x32383730,
+    0x7478742e, 0x656c6966, 0x33383730, 0x7478742e,
+    0x656c6966, 0x34383730, 0x7478742e, 0x656c6966,
+    0x35383730, 0x7478742e, 0x656c6966, 0x36383730,
+    0x7478742e, 0x656c6966, 0x37383730, 0x7478742e,
+    0x656c6966, 0x38383730, 0x7478742e, 0x656c6966,
+    0x39383730, 0x7478742e, 0x656c6966, 0x30393730,
+    0x7478742e, 0x656c6966, 0x31393730, 0x7478742e,
+    0x656c6966, 0x32393730, 0x7478742e, 0x656c6966,
+    0x33393730, 0x7478742e, 0x656c6966, 0x34393730,
+    0x7478742e, 0x656c6966, 0x35393730, 0x7478742e,
+    0x656c6966, 0x36393730, 0x7478742e, 0x656c6966,
+    0x37393730, 0x7478742e, 0x656c6966, 0x38393730,
+    0x7478742e, 0x656c6966, 0x39393730, 0x7478742e,
+    0x656c6966, 0x30303830, 0x7478742e, 0x656c6966,
+    0x31303830, 0x7478742e, 0x656c6966, 0x32303830,
+    0x7478742e, 0x656c6966, 0x33303830, 0x7478742e,
+    0x656c6966, 0x34303830, 0x7478742e, 0x656c6966,
+    0x35303830, 0x7478742e, 0x656c6966, 0x36303830,
+    0x7478742e, 0x656c6966, 0x37303830, 0x7478742e,
+    0x656c6966, 0x38303830, 0x7478742e, 0x656c6966,
+    0x39303830, 0x7478742e, 0x656c6966, 0x30313830,
+    0x7478742e, 0x656c6966, 0x31313830, 0x7478742e,
+    0x656c6966, 0x32313830, 0x7478742e, 0x656c6966,
+    0x33313830, 0x7478742e, 0x656c6966, 0x34313830,
+    0x7478742e, 0x656c6966, 0x35313830, 0x7478742e,
+    0x656c6966, 0x36313830, 0x7478742e, 0x656c6966,
+    0x37313830, 0x7478742e, 0x656c6966, 0x38313830,
+    0x7478742e, 0x656c6966, 0x39313830, 0x7478742e,
+    0x656c6966, 0x30323830, 0x7478742e, 0x656c6966,
+    0x31323830, 0x7478742e, 0x656c6966, 0x32323830,
+    0x7478742e, 0x656c6966, 0x33323830, 0x7478742e,
+    0x656c6966, 0x34323830, 0x7478742e, 0x656c6966,
+    0x35323830, 0x7478742e, 0x656c6966, 0x36323830,
+    0x7478742e, 0x656c6966, 0x37323830, 0x7478742e,
+    0x656c6966, 0x38323830, 0x7478742e, 0x656c6966,
+    0x39323830, 0x7478742e, 0x656c6966, 0x30333830,
+    0x7478742e, 0x656c6966, 0x31333830, 0x7478742e,
+    0x656c6966, 0x32333830, 0x7478742e, 0x656c6966,
+    0x33333830, 0x7478742e, 0x656c6966, 0x34333830,
+    0x7478742e, 0x656c6966, 0x35333830, 0x7478742e,
+    0x656c6966, 0x36333830, 0x7478742e, 0x656c6966,
+    0x37333830, 0x7478742e, 0x656c6966, 0x38333830,
+    0x7478742e, 0x656c6966, 0x39333830, 0x7478742e,
+    0x656c6966, 0x30343830, 0x7478742e, 0x656c6966,
+    0x31343830, 0x7478742e, 0x656c6966, 0x32343830,
+    0x7478742e, 0x656c6966, 0x33343830, 0x7478742e,
+    0x656c6966, 0x34343830, 0x7478742e, 0x656c6966,
+    0x35343830, 0x7478742e, 0x656c6966, 0x36343830,
+    0x7478742e, 0x656c6966, 0x37343830, 0x7478742e,
+    0x656c6966, 0x38343830, 0x7478742e, 0x656c6966,
+    0x39343830, 0x7478742e, 0x656c6966, 0x30353830,
+    0x7478742e, 0x656c6966, 0x31353830, 0x7478742e,
+    0x656c6966, 0x32353830, 0x7478742e, 0x656c6966,
+    0x33353830, 0x7478742e, 0x656c6966, 0x34353830,
+    0x7478742e, 0x656c6966, 0x35353830, 0x7478742e,
+    0x656c6966, 0x36353830, 0x7478742e, 0x656c6966,
+    0x37353830, 0x7478742e, 0x656c6966, 0x38353830,
+    0x7478742e, 0x656c6966, 0x39353830, 0x7478742e,
+    0x656c6966, 0x30363830, 0x7478742e, 0x656c6966,
+    0x31363830, 0x7478742e, 0x656c6966, 0x32363830,
+    0x7478742e, 0x656c6966, 0x33363830, 0x7478742e,
+    0x656c6966, 0x34363830, 0x7478742e, 0x656c6966,
+    0x35363830, 0x7478742e, 0x656c6966, 0x36363830,
+    0x7478742e, 0x656c6966, 0x37363830, 0x7478742e,
+    0x656c6966, 0x38363830, 0x7478742e, 0x656c6966,
+    0x39363830, 0x7478742e, 0x656c6966, 0x30373830,
+    0x7478742e, 0x656c6966, 0x31373830, 0x7478742e,
+    0x656c6966, 0x32373830, 0x7478742e, 0x656c6966,
+    0x33373830, 0x7478742e, 0x656c6966, 0x34373830,
+    0x7478742e, 0x656c6966, 0x35373830, 0x7478742e,
+    0x656c6966, 0x36373830, 0x7478742e, 0x656c6966,
+    0x37373830, 0x7478742e, 0x656c6966, 0x38373830,
+    0x7478742e, 0x656c6966, 0x39373830, 0x7478742e,
+    0x656c6966, 0x30383830, 0x7478742e, 0x656c6966,
+    0x31383830, 0x7478742e, 0x656c6966, 0x32383830,
+    0x7478742e, 0x656c6966, 0x33383830, 0x7478742e,
+    0x656c6966, 0x34383830, 0x7478742e, 0x656c6966,
+    0x35383830, 0x7478742e, 0x656c6966, 0x36383830,
+    0x7478742e, 0x656c6966, 0x37383830, 0x7478742e,
+    0x656c6966, 0x38383830, 0x7478742e, 0x656c6966,
+    0x39383830, 0x7478742e, 0x656c6966, 0x30393830,
+    0x7478742e, 0x656c6966, 0x31393830, 0x7478742e,
+    0x656c6966, 0x32393830, 0x7478742e, 0x656c6966,
+    0x33393830, 0x7478742e, 0x656c6966, 0x34393830,
+    0x7478742e, 0x656c6966, 0x35393830, 0x7478742e,
+    0x656c6966, 0x36393830, 0x7478742e, 0x656c6966,
+    0x37393830, 0x7478742e, 0x656c6966, 0x38393830,
+    0x7478742e, 0x656c6966, 0x39393830, 0x7478742e,
+    0x656c6966, 0x30303930, 0x7478742e, 0x656c6966,
+    0x31303930, 0x7478742e, 0x656c6966, 0x32303930,
+    0x7478742e, 0x656c6966, 0x33303930, 0x7478742e,
+    0x656c6966, 0x34303930, 0x7478742e, 0x656c6966,
+    0x35303930, 0x7478742e, 0x656c6966, 0x36303930,
+    0x7478742e, 0x656c6966, 0x37303930, 0x7478742e,
+    0x656c6966, 0x38303930, 0x7478742e, 0x656c6966,
+    0x39303930, 0x7478742e, 0x656c6966, 0x30313930,
+    0x7478742e, 0x656c6966, 0x31313930, 0x7478742e,
+    0x656c6966, 0x32313930, 0x7478742e, 0x656c6966,
+    0x33313930, 0x7478742e, 0x656c6966, 0x34313930,
+    0x7478742e, 0x656c6966, 0x35313930, 0x7478742e,
+    0x656c6966, 0x36313930, 0x7478742e, 0x656c6966,
+    0x37313930, 0x7478742e, 0x656c6966, 0x38313930,
+    0x7478742e, 0x656c6966, 0x39313930, 0x7478742e,
+    0x656c6966, 0x30323930, 0x7478742e, 0x656c6966,
+    0x31323930, 0x7478742e, 0x656c6966, 0x32323930,
+    0x7478742e, 0x656c6966, 0x33323930, 0x7478742e,
+    0x656c6966, 0x34323930, 0x7478742e, 0x656c6966,
+    0x35323930, 0x7478742e, 0x656c6966, 0x36323930,
+    0x7478742e, 0x656c6966, 0x37323930, 0x7478742e,
+    0x656c6966, 0x38323930, 0x7478742e, 0x656c6966,
+    0x39323930, 0x7478742e, 0x656c6966, 0x30333930,
+    0x7478742e, 0x656c6966, 0x31333930, 0x7478742e,
+    0x656c6966, 0x32333930, 0x7478742e, 0x656c6966,
+    0x33333930, 0x7478742e, 0x656c6966, 0x34333930,
+    0x7478742e, 0x656c6966, 0x35333930, 0x7478742e,
+    0x656c6966, 0x36333930, 0x7478742e, 0x656c6966,
+    0x37333930, 0x7478742e, 0x656c6966, 0x38333930,
+    0x7478742e, 0x656c6966, 0x39333930, 0x7478742e,
+    0x656c6966, 0x30343930, 0x7478742e, 0x656c6966,
+    0x31343930, 0x7478742e, 0x656c6966, 0x32343930,
+    0x7478742e, 0x656c6966, 0x33343930, 0x7478742e,
+    0x656c6966, 0x34343930, 0x7478742e, 0x656c6966,
+    0x35343930, 0x7478742e, 0x656c6966, 0x36343930,
+    0x7478742e, 0x656c6966, 0x37343930, 0x7478742e,
+    0x656c6966, 0x38343930, 0x7478742e, 0x656c6966,
+    0x39343930, 0x7478742e, 0x656c6966, 0x30353930,
+    0x7478742e, 0x656c6966, 0x31353930, 0x7478742e,
+    0x656c6966, 0x32353930, 0x7478742e, 0x656c6966,
+    0x33353930, 0x7478742e, 0x656c6966, 0x34353930,
+    0x7478742e, 0x656c6966, 0x35353930, 0x7478742e,
+    0x656c6966, 0x36353930, 0x7478742e, 0x656c6966,
+    0x37353930, 0x7478742e, 0x656c6966, 0x38353930,
+    0x7478742e, 0x656c6966, 0x39353930, 0x7478742e,
+    0x656c6966, 0x30363930, 0x7478742e, 0x656c6966,
+    0x31363930, 0x7478742e, 0x656c6966, 0x32363930,
+    0x7478742e, 0x656c6966, 0x33363930, 0x7478742e,
+    0x656c6966, 0x34363930, 0x7478742e, 0x656c6966,
+    0x35363930, 0x7478742e, 0x656c6966, 0x36363930,
+    0x7478742e, 0x656c6966, 0x37363930, 0x7478742e,
+    0x656c6966, 0x38363930, 0x7478742e, 0x656c6966,
+    0x39363930, 0x7478742e, 0x656c6966, 0x30373930,
+    0x7478742e, 0x656c6966, 0x31373930, 0x7478742e,
+    0x656c6966, 0x32373930, 0x7478742e, 0x656c6966,
+    0x33373930, 0x7478742e, 0x656c6966, 0x34373930,
+    0x7478742e, 0x656c6966, 0x35373930, 0x7478742e,
+    0x656c6966, 0x36373930, 0x7478742e, 0x656c6966,
+    0x37373930, 0x7478742e, 0x656c6966, 0x38373930,
+    0x7478742e, 0x656c6966, 0x39373930, 0x7478742e,
+    0x656c6966, 0x30383930, 0x7478742e, 0x656c6966,
+    0x31383930, 0x7478742e, 0x656c6966, 0x32383930,
+    0x7478742e, 0x656c6966, 0x33383930, 0x7478742e,
+    0x656c6966, 0x34383930, 0x7478742e, 0x656c6966,
+    0x35383930, 0x7478742e, 0x656c6966, 0x36383930,
+    0x7478742e, 0x656c6966, 0x37383930, 0x7478742e,
+    0x656c6966, 0x38383930, 0x7478742e, 0x656c6966,
+    0x39383930, 0x7478742e, 0x656c6966, 0x30393930,
+    0x7478742e, 0x656c6966, 0x31393930, 0x7478742e,
+    0x656c6966, 0x32393930, 0x7478742e, 0x656c6966,
+    0x33393930, 0x7478742e, 0x656c6966, 0x34393930,
+    0x7478742e, 0x656c6966, 0x35393930, 0x7478742e,
+    0x656c6966, 0x36393930, 0x7478742e, 0x656c6966,
+    0x37393930, 0x7478742e, 0x656c6966, 0x38393930,
+    0x7478742e, 0x656c6966, 0x39393930, 0x7478742e,
+    0x656c6966, 0x30303031, 0x7478742e, 0x656c6966,
+    0x31303031, 0x7478742e, 0x656c6966, 0x32303031,
+    0x7478742e, 0x656c6966, 0x33303031, 0x7478742e,
+    0x656c6966, 0x34303031, 0x7478742e, 0x656c6966,
+    0x35303031, 0x7478742e, 0x656c6966, 0x36303031,
+    0x7478742e, 0x656c6966, 0x37303031, 0x7478742e,
+    0x656c6966, 0x38303031, 0x7478742e, 0x656c6966,
+    0x39303031, 0x7478742e, 0x656c6966, 0x30313031,
+    0x7478742e, 0x656c6966, 0x31313031, 0x7478742e,
+    0x656c6966, 0x32313031, 0x7478742e, 0x656c6966,
+    0x33313031, 0x7478742e, 0x656c6966, 0x34313031,
+    0x7478742e, 0x656c6966, 0x35313031, 0x7478742e,
+    0x656c6966, 0x36313031, 0x7478742e, 0x656c6966,
+    0x37313031, 0x7478742e, 0x656c6966, 0x38313031,
+    0x7478742e, 0x656c6966, 0x39313031, 0x7478742e,
+    0x656c6966, 0x30323031, 0x7478742e, 0x656c6966,
+    0x31323031, 0x7478742e, 0x656c6966, 0x32323031,
+    0x7478742e, 0x656c6966, 0x33323031, 0x7478742e,
+    0x656c6966, 0x34323031, 0x7478742e, 0x656c6966,
+    0x31303030, 0x7478742e, 0x6c69660a, 0x30303065,
+    0x78742e32, 0x69660a74, 0x3030656c, 0x742e3330,
+    0x660a7478, 0x30656c69, 0x2e343030, 0x0a747874,
+    0x656c6966, 0x35303030, 0x7478742e, 0x6c69660a,
+    0x30303065, 0x78742e36, 0x69660a74, 0x3030656c,
+    0x742e3730, 0x660a7478, 0x30656c69, 0x2e383030,
+    0x0a747874, 0x656c6966, 0x39303030, 0x7478742e,
+    0x6c69660a, 0x31303065, 0x78742e30, 0x69660a74,
+    0x3030656c, 0x742e3131, 0x660a7478, 0x30656c69,
+    0x2e323130, 0x0a747874, 0x656c6966, 0x33313030,
+    0x7478742e, 0x6c69660a, 0x31303065, 0x78742e34,
+    0x69660a74, 0x3030656c, 0x742e3531, 0x660a7478,
+    0x30656c69, 0x2e363130, 0x0a747874, 0x656c6966,
+    0x37313030, 0x7478742e, 0x6c69660a, 0x31303065,
+    0x78742e38, 0x69660a74, 0x3030656c, 0x742e3931,
+    0x660a7478, 0x30656c69, 0x2e303230, 0x0a747874,
+    0x656c6966, 0x31323030, 0x7478742e, 0x6c69660a,
+    0x32303065, 0x78742e32, 0x69660a74, 0x3030656c,
+    0x742e3332, 0x660a7478, 0x30656c69, 0x2e343230,
+    0x0a747874, 0x656c6966, 0x35323030, 0x7478742e,
+    0x6c69660a, 0x32303065, 0x78742e36, 0x69660a74,
+    0x3030656c, 0x742e3732, 0x660a7478, 0x30656c69,
+    0x2e383230, 0x0a747874, 0x656c6966, 0x39323030,
+    0x7478742e, 0x6c69660a, 0x33303065, 0x78742e30,
+    0x69660a74, 0x3030656c, 0x742e3133, 0x660a7478,
+    0x30656c69, 0x2e323330, 0x0a747874, 0x656c6966,
+    0x33333030, 0x7478742e, 0x6c69660a, 0x33303065,
+    0x78742e34, 0x69660a74, 0x3030656c, 0x742e3533,
+    0x660a7478, 0x30656c69, 0x2e363330, 0x0a747874,
+    0x656c6966, 0x37333030, 0x7478742e, 0x6c69660a,
+    0x33303065, 0x78742e38, 0x69660a74, 0x3030656c,
+    0x742e3933, 0x660a7478, 0x30656c69, 0x2e303430,
+    0x0a747874, 0x656c6966, 0x31343030, 0x7478742e,
+    0x6c69660a, 0x34303065, 0x78742e32, 0x69660a74,
+    0x3030656c, 0x742e3334, 0x660a7478, 0x30656c69,
+    0x2e343430, 0x0a747874, 0x656c6966, 0x35343030,
+    0x7478742e, 0x6c69660a, 0x34303065, 0x78742e36,
+    0x69660a74, 0x3030656c, 0x742e3734, 0x660a7478,
+    0x30656c69, 0x2e383430, 0x0a747874, 0x656c6966,
+    0x39343030, 0x7478742e, 0x6c69660a, 0x35303065,
+    0x78742e30, 0x69660a74, 0x3030656c, 0x742e3135,
+    0x660a7478, 0x30656c69, 0x2e323530, 0x0a747874,
+    0x656c6966, 0x33353030, 0x7478742e, 0x6c69660a,
+    0x35303065, 0x78742e34, 0x69660a74, 0x3030656c,
+    0x742e3535, 0x660a7478, 0x30656c69, 0x2e363530,
+    0x0a747874, 0x656c6966, 0x37353030, 0x7478742e,
+    0x6c69660a, 0x35303065, 0x78742e38, 0x69660a74,
+    0x3030656c, 0x742e3935, 0x660a7478, 0x30656c69,
+    0x2e303630, 0x0a747874, 0x656c6966, 0x31363030,
+    0x7478742e, 0x6c69660a, 0x36303065, 0x78742e32,
+    0x69660a74, 0x3030656c, 0x742e3336, 0x660a7478,
+    0x30656c69, 0x2e343630, 0x0a747874, 0x656c6966,
+    0x35363030, 0x7478742e, 0x6c69660a, 0x36303065,
+    0x78742e36, 0x69660a74, 0x3030656c, 0x742e3736,
+    0x660a7478, 0x30656c69, 0x2e383630, 0x0a747874,
+    0x656c6966, 0x39363030, 0x7478742e, 0x6c69660a,
+    0x37303065, 0x78742e30, 0x69660a74, 0x3030656c,
+    0x742e3137, 0x660a7478, 0x30656c69, 0x2e323730,
+    0x0a747874, 0x656c6966, 0x33373030, 0x7478742e,
+    0x6c69660a, 0x37303065, 0x78742e34, 0x69660a74,
+    0x3030656c, 0x742e3537, 0x660a7478, 0x30656c69,
+    0x2e363730, 0x0a747874, 0x656c6966, 0x37373030,
+    0x7478742e, 0x6c69660a, 0x37303065, 0x78742e38,
+    0x69660a74, 0x3030656c, 0x742e3937, 0x660a7478,
+    0x30656c69, 0x2e303830, 0x0a747874, 0x656c6966,
+    0x31383030, 0x7478742e, 0x6c69660a, 0x38303065,
+    0x78742e32, 0x69660a74, 0x3030656c, 0x742e3338,
+    0x660a7478, 0x30656c69, 0x2e343830, 0x0a747874,
+    0x656c6966, 0x35383030, 0x7478742e, 0x6c69660a,
+    0x38303065, 0x78742e36, 0x69660a74, 0x3030656c,
+    0x742e3738, 0x660a7478, 0x30656c69, 0x2e383830,
+    0x0a747874, 0x656c6966, 0x39383030, 0x7478742e,
+    0x6c69660a, 0x39303065, 0x78742e30, 0x69660a74,
+    0x3030656c, 0x742e3139, 0x660a7478, 0x30656c69,
+    0x2e323930, 0x0a747874, 0x656c6966, 0x33393030,
+    0x7478742e, 0x6c69660a, 0x39303065, 0x78742e34,
+    0x69660a74, 0x3030656c, 0x742e3539, 0x660a7478,
+    0x30656c69, 0x2e363930, 0x0a747874, 0x656c6966,
+    0x37393030, 0x7478742e, 0x6c69660a, 0x39303065,
+    0x78742e38, 0x69660a74, 0x3030656c, 0x742e3939,
+    0x660a7478, 0x30656c69, 0x2e303031, 0x0a747874,
+    0x656c6966, 0x31303130, 0x7478742e, 0x6c69660a,
+    0x30313065, 0x78742e32, 0x69660a74, 0x3130656c,
+    0x742e3330, 0x660a7478, 0x30656c69, 0x2e343031,
+    0x0a747874, 0x656c6966, 0x35303130, 0x7478742e,
+    0x6c69660a, 0x30313065, 0x78742e36, 0x69660a74,
+    0x3130656c, 0x742e3730, 0x660a7478, 0x30656c69,
+    0x2e383031, 0x0a747874, 0x656c6966, 0x39303130,
+    0x7478742e, 0x6c69660a, 0x31313065, 0x78742e30,
+    0x69660a74, 0x3130656c, 0x742e3131, 0x660a7478,
+    0x30656c69, 0x2e323131, 0x0a747874, 0x656c6966,
+    0x33313130, 0x7478742e, 0x6c69660a, 0x31313065,
+    0x78742e34, 0x69660a74, 0x3130656c, 0x742e3531,
+    0x660a7478, 0x30656c69, 0x2e363131, 0x0a747874,
+    0x656c6966, 0x37313130, 0x7478742e, 0x6c69660a,
+    0x31313065, 0x78742e38, 0x69660a74, 0x3130656c,
+    0x742e3931, 0x660a7478, 0x30656c69, 0x2e303231,
+    0x0a747874, 0x656c6966, 0x31323130, 0x7478742e,
+    0x6c69660a, 0x32313065, 0x78742e32, 0x69660a74,
+    0x3130656c, 0x742e3332, 0x660a7478, 0x30656c69,
+    0x2e343231, 0x0a747874, 0x656c6966, 0x35323130,
+    0x7478742e, 0x6c69660a, 0x32313065, 0x78742e36,
+    0x69660a74, 0x3130656c, 0x742e3732, 0x660a7478,
+    0x30656c69, 0x2e383231, 0x0a747874, 0x656c6966,
+    0x39323130, 0x7478742e, 0x6c69660a, 0x33313065,
+    0x78742e30, 0x69660a74, 0x3130656c, 0x742e3133,
+    0x660a7478, 0x30656c69, 0x2e323331, 0x0a747874,
+    0x656c6966, 0x33333130, 0x7478742e, 0x6c69660a,
+    0x33313065, 0x78742e34, 0x69660a74, 0x3130656c,
+    0x742e3533, 0x660a7478, 0x30656c69, 0x2e363331,
+    0x0a747874, 0x656c6966, 0x37333130, 0x7478742e,
+    0x6c69660a, 0x33313065, 0x78742e38, 0x69660a74,
+    0x3130656c, 0x742e3933, 0x660a7478, 0x30656c69,
+    0x2e303431, 0x0a747874, 0x656c6966, 0x31343130,
+    0x7478742e, 0x6c69660a, 0x34313065, 0x78742e32,
+    0x69660a74, 0x3130656c, 0x742e3334, 0x660a7478,
+    0x30656c69, 0x2e343431, 0x0a747874, 0x656c6966,
+    0x35343130, 0x7478742e, 0x6c69660a, 0x34313065,
+    0x78742e36, 0x69660a74, 0x3130656c, 0x742e3734,
+    0x660a7478, 0x30656c69, 0x2e383431, 0x0a747874,
+    0x656c6966, 0x39343130, 0x7478742e, 0x6c69660a,
+    0x35313065, 0x78742e30, 0x69660a74, 0x3130656c,
+    0x742e3135, 0x660a7478, 0x30656c69, 0x2e323531,
+    0x0a747874, 0x656c6966, 0x33353130, 0x7478742e,
+    0x6c69660a, 0x35313065, 0x78742e34, 0x69660a74,
+    0x3130656c, 0x742e3535, 0x660a7478, 0x30656c69,
+    0x2e363531, 0x0a747874, 0x656c6966, 0x37353130,
+    0x7478742e, 0x6c69660a, 0x35313065, 0x78742e38,
+    0x69660a74, 0x3130656c, 0x742e3935, 0x660a7478,
+    0x30656c69, 0x2e303631, 0x0a747874, 0x656c6966,
+    0x31363130, 0x7478742e, 0x6c69660a, 0x36313065,
+    0x78742e32, 0x69660a74, 0x3130656c, 0x742e3336,
+    0x660a7478, 0x30656c69, 0x2e343631, 0x0a747874,
+    0x656c6966, 0x35363130, 0x7478742e, 0x6c69660a,
+    0x36313065, 0x78742e36, 0x69660a74, 0x3130656c,
+    0x742e3736, 0x660a7478, 0x30656c69, 0x2e383631,
+    0x0a747874, 0x656c6966, 0x39363130, 0x7478742e,
+    0x6c69660a, 0x37313065, 0x78742e30, 0x69660a74,
+    0x3130656c, 0x742e3137, 0x660a7478, 0x30656c69,
+    0x2e323731, 0x0a747874, 0x656c6966, 0x33373130,
+    0x7478742e, 0x6c69660a, 0x37313065, 0x78742e34,
+    0x69660a74, 0x3130656c, 0x742e3537, 0x660a7478,
+    0x30656c69, 0x2e363731, 0x0a747874, 0x656c6966,
+    0x37373130, 0x7478742e, 0x6c69660a, 0x37313065,
+    0x78742e38, 0x69660a74, 0x3130656c, 0x742e3937,
+    0x660a7478, 0x30656c69, 0x2e303831, 0x0a747874,
+    0x656c6966, 0x31383130, 0x7478742e, 0x6c69660a,
+    0x38313065, 0x78742e32, 0x69660a74, 0x3130656c,
+    0x742e3338, 0x660a7478, 0x30656c69, 0x2e343831,
+    0x0a747874, 0x656c6966, 0x35383130, 0x7478742e,
+    0x6c69660a, 0x38313065, 0x78742e36, 0x69660a74,
+    0x3130656c, 0x742e3738, 0x660a7478, 0x30656c69,
+    0x2e383831, 0x0a747874, 0x656c6966, 0x39383130,
+    0x7478742e, 0x6c69660a, 0x39313065, 0x78742e30,
+    0x69660a74, 0x3130656c, 0x742e3139, 0x660a7478,
+    0x30656c69, 0x2e323931, 0x0a747874, 0x656c6966,
+    0x33393130, 0x7478742e, 0x6c69660a, 0x39313065,
+    0x78742e34, 0x69660a74, 0x3130656c, 0x742e3539,
+    0x660a7478, 0x30656c69, 0x2e363931, 0x0a747874,
+    0x656c6966, 0x37393130, 0x7478742e, 0x6c69660a,
+    0x39313065, 0x78742e38, 0x69660a74, 0x3130656c,
+    0x742e3939, 0x660a7478, 0x30656c69, 0x2e303032,
+    0x0a747874, 0x656c6966, 0x31303230, 0x7478742e,
+    0x6c69660a, 0x30323065, 0x78742e32, 0x69660a74,
+    0x3230656c, 0x742e3330, 0x660a7478, 0x30656c69,
+    0x2e343032, 0x0a747874, 0x656c6966, 0x35303230,
+    0x7478742e, 0x6c69660a, 0x30323065, 0x78742e36,
+    0x69660a74, 0x3230656c, 0x742e3730, 0x660a7478,
+    0x30656c69, 0x2e383032, 0x0a747874, 0x656c6966,
+    0x39303230, 0x7478742e, 0x6c69660a, 0x31323065,
+    0x78742e30, 0x69660a74, 0x3230656c, 0x742e3131,
+    0x660a7478, 0x30656c69, 0x2e323132, 0x0a747874,
+    0x656c6966, 0x33313230, 0x7478742e, 0x6c69660a,
+    0x31323065, 0x78742e34, 0x69660a74, 0x3230656c,
+    0x742e3531, 0x660a7478, 0x30656c69, 0x2e363132,
+    0x0a747874, 0x656c6966, 0x37313230, 0x7478742e,
+    0x6c69660a, 0x31323065, 0x78742e38, 0x69660a74,
+    0x3230656c, 0x742e3931, 0x660a7478, 0x30656c69,
+    0x2e303232, 0x0a747874, 0x656c6966, 0x31323230,
+    0x7478742e, 0x6c69660a, 0x32323065, 0x78742e32,
+    0x69660a74, 0x3230656c, 0x742e3332, 0x660a7478,
+    0x30656c69, 0x2e343232, 0x0a747874, 0x656c6966,
+    0x35323230, 0x7478742e, 0x6c69660a, 0x32323065,
+    0x78742e36, 0x69660a74, 0x3230656c, 0x742e3732,
+    0x660a7478, 0x30656c69, 0x2e383232, 0x0a747874,
+    0x656c6966, 0x39323230, 0x7478742e, 0x6c69660a,
+    0x33323065, 0x78742e30, 0x69660a74, 0x3230656c,
+    0x742e3133, 0x660a7478, 0x30656c69, 0x2e323332,
+    0x0a747874, 0x656c6966, 0x33333230, 0x7478742e,
+    0x6c69660a, 0x33323065, 0x78742e34, 0x69660a74,
+    0x3230656c, 0x742e3533, 0x660a7478, 0x30656c69,
+    0x2e363332, 0x0a747874, 0x656c6966, 0x37333230,
+    0x7478742e, 0x6c69660a, 0x33323065, 0x78742e38,
+    0x69660a74, 0x3230656c, 0x742e3933, 0x660a7478,
+    0x30656c69, 0x2e303432, 0x0a747874, 0x656c6966,
+    0x31343230, 0x7478742e, 0x6c69660a, 0x34323065,
+    0x78742e32, 0x69660a74, 0x3230656c, 0x742e3334,
+    0x660a7478, 0x30656c69, 0x2e343432, 0x0a747874,
+    0x656c6966, 0x35343230, 0x7478742e, 0x6c69660a,
+    0x34323065, 0x78742e36, 0x69660a74, 0x3230656c,
+    0x742e3734, 0x660a7478, 0x30656c69, 0x2e383432,
+    0x0a747874, 0x656c6966, 0x39343230, 0x7478742e,
+    0x6c69660a, 0x35323065, 0x78742e30, 0x69660a74,
+    0x3230656c, 0x742e3135, 0x660a7478, 0x30656c69,
+    0x2e323532, 0x0a747874, 0x656c6966, 0x33353230,
+    0x7478742e, 0x6c69660a, 0x35323065, 0x78742e34,
+    0x69660a74, 0x3230656c, 0x742e3535, 0x660a7478,
+    0x30656c69, 0x2e363532, 0x0a747874, 0x656c6966,
+    0x37353230, 0x7478742e, 0x6c69660a, 0x35323065,
+    0x78742e38, 0x69660a74, 0x3230656c, 0x742e3935,
+    0x660a7478, 0x30656c69, 0x2e303632, 0x0a747874,
+    0x656c6966, 0x31363230, 0x7478742e, 0x6c69660a,
+    0x36323065, 0x78742e32, 0x69660a74, 0x3230656c,
+    0x742e3336, 0x660a7478, 0x30656c69, 0x2e343632,
+    0x0a747874, 0x656c6966, 0x35363230, 0x7478742e,
+    0x6c69660a, 0x36323065, 0x78742e36, 0x69660a74,
+    0x3230656c, 0x742e3736, 0x660a7478, 0x30656c69,
+    0x2e383632, 0x0a747874, 0x656c6966, 0x39363230,
+    0x7478742e, 0x6c69660a, 0x37323065, 0x78742e30,
+    0x69660a74, 0x3230656c, 0x742e3137, 0x660a7478,
+    0x30656c69, 0x2e323732, 0x0a747874, 0x656c6966,
+    0x33373230, 0x7478742e, 0x6c69660a, 0x37323065,
+    0x78742e34, 0x69660a74, 0x3230656c, 0x742e3537,
+    0x660a7478, 0x30656c69, 0x2e363732, 0x0a747874,
+    0x656c6966, 0x37373230, 0x7478742e, 0x6c69660a,
+    0x37323065, 0x78742e38, 0x69660a74, 0x3230656c,
+    0x742e3937, 0x660a7478, 0x30656c69, 0x2e303832,
+    0x0a747874, 0x656c6966, 0x31383230, 0x7478742e,
+    0x6c69660a, 0x38323065, 0x78742e32, 0x69660a74,
+    0x3230656c, 0x742e3338, 0x660a7478, 0x30656c69,
+    0x2e343832, 0x0a747874, 0x656c6966, 0x35383230,
+    0x7478742e, 0x6c69660a, 0x38323065, 0x78742e36,
+    0x69660a74, 0x3230656c, 0x742e3738, 0x660a7478,
+    0x30656c69, 0x2e383832, 0x0a747874, 0x656c6966,
+    0x39383230, 0x7478742e, 0x6c69660a, 0x39323065,
+    0x78742e30, 0x69660a74, 0x3230656c, 0x742e3139,
+    0x660a7478, 0x30656c69, 0x2e323932, 0x0a747874,
+    0x656c6966, 0x33393230, 0x7478742e, 0x6c69660a,
+    0x39323065, 0x78742e34, 0x69660a74, 0x3230656c,
+    0x742e3539, 0x660a7478, 0x30656c69, 0x2e363932,
+    0x0a747874, 0x656c6966, 0x37393230, 0x7478742e,
+    0x6c69660a, 0x39323065, 0x78742e38, 0x69660a74,
+    0x3230656c, 0x742e3939, 0x660a7478, 0x30656c69,
+    0x2e303033, 0x0a747874, 0x656c6966, 0x31303330,
+    0x7478742e, 0x6c69660a, 0x30333065, 0x78742e32,
+    0x69660a74, 0x3330656c, 0x742e3330, 0x660a7478,
+    0x30656c69, 0x2e343033, 0x0a747874, 0x656c6966,
+    0x35303330, 0x7478742e, 0x6c69660a, 0x30333065,
+    0x78742e36, 0x69660a74, 0x3330656c, 0x742e3730,
+    0x660a7478, 0x30656c69, 0x2e383033, 0x0a747874,
+    0x656c6966, 0x39303330, 0x7478742e, 0x6c69660a,
+    0x31333065, 0x78742e30, 0x69660a74, 0x3330656c,
+    0x742e3131, 0x660a7478, 0x30656c69, 0x2e323133,
+    0x0a747874, 0x656c6966, 0x33313330, 0x7478742e,
+    0x6c69660a, 0x31333065, 0x78742e34, 0x69660a74,
+    0x3330656c, 0x742e3531, 0x660a7478, 0x30656c69,
+    0x2e363133, 0x0a747874, 0x656c6966, 0x37313330,
+    0x7478742e, 0x6c69660a, 0x31333065, 0x78742e38,
+    0x69660a74, 0x3330656c, 0x742e3931, 0x660a7478,
+    0x30656c69, 0x2e303233, 0x0a747874, 0x656c6966,
+    0x31323330, 0x7478742e, 0x6c69660a, 0x32333065,
+    0x78742e32, 0x69660a74, 0x3330656c, 0x742e3332,
+    0x660a7478, 0x30656c69, 0x2e343233, 0x0a747874,
+    0x656c6966, 0x35323330, 0x7478742e, 0x6c69660a,
+    0x32333065, 0x78742e36, 0x69660a74, 0x3330656c,
+    0x742e3732, 0x660a7478, 0x30656c69, 0x2e383233,
+    0x0a747874, 0x656c6966, 0x39323330, 0x7478742e,
+    0x6c69660a, 0x33333065, 0x78742e30, 0x69660a74,
+    0x3330656c, 0x742e3133, 0x660a7478, 0x30656c69,
+    0x2e323333, 0x0a747874, 0x656c6966, 0x33333330,
+    0x7478742e, 0x6c69660a, 0x33333065, 0x78742e34,
+    0x69660a74, 0x3330656c, 0x742e3533, 0x660a7478,
+    0x30656c69, 0x2e363333, 0x0a747874, 0x656c6966,
+    0x37333330, 0x7478742e, 0x6c69660a, 0x33333065,
+    0x78742e38, 0x69660a74, 0x3330656c, 0x742e3933,
+    0x660a7478, 0x30656c69, 0x2e303433, 0x0a747874,
+    0x656c6966, 0x31343330, 0x7478742e, 0x6c69660a,
+    0x34333065, 0x78742e32, 0x69660a74, 0x3330656c,
+    0x742e3334, 0x660a7478, 0x30656c69, 0x2e343433,
+    0x0a747874, 0x656c6966, 0x35343330, 0x7478742e,
+    0x6c69660a, 0x34333065, 0x78742e36, 0x69660a74,
+    0x3330656c, 0x742e3734, 0x660a7478, 0x30656c69,
+    0x2e383433, 0x0a747874, 0x656c6966, 0x39343330,
+    0x7478742e, 0x6c69660a, 0x35333065, 0x78742e30,
+    0x69660a74, 0x3330656c, 0x742e3135, 0x660a7478,
+    0x30656c69, 0x2e323533, 0x0a747874, 0x656c6966,
+    0x33353330, 0x7478742e, 0x6c69660a, 0x35333065,
+    0x78742e34, 0x69660a74, 0x3330656c, 0x742e3535,
+    0x660a7478, 0x30656c69, 0x2e363533, 0x0a747874,
+    0x656c6966, 0x37353330, 0x7478742e, 0x6c69660a,
+    0x35333065, 0x78742e38, 0x69660a74, 0x3330656c,
+    0x742e3935, 0x660a7478, 0x30656c69, 0x2e303633,
+    0x0a747874, 0x656c6966, 0x31363330, 0x7478742e,
+    0x6c69660a, 0x36333065, 0x78742e32, 0x69660a74,
+    0x3330656c, 0x742e3336, 0x660a7478, 0x30656c69,
+    0x2e343633, 0x0a747874, 0x656c6966, 0x35363330,
+    0x7478742e, 0x6c69660a, 0x36333065, 0x78742e36,
+    0x69660a74, 0x3330656c, 0x742e3736, 0x660a7478,
+    0x30656c69, 0x2e383633, 0x0a747874, 0x656c6966,
+    0x39363330, 0x7478742e, 0x6c69660a, 0x37333065,
+    0x78742e30, 0x69660a74, 0x3330656c, 0x742e3137,
+    0x660a7478, 0x30656c69, 0x2e323733, 0x0a747874,
+    0x656c6966, 0x33373330, 0x7478742e, 0x6c69660a,
+    0x37333065, 0x78742e34, 0x69660a74, 0x3330656c,
+    0x742e3537, 0x660a7478, 0x30656c69, 0x2e363733,
+    0x0a747874, 0x656c6966, 0x37373330, 0x7478742e,
+    0x6c69660a, 0x37333065, 0x78742e38, 0x69660a74,
+    0x3330656c, 0x742e3937, 0x660a7478, 0x30656c69,
+    0x2e303833, 0x0a747874, 0x656c6966, 0x31383330,
+    0x7478742e, 0x6c69660a, 0x38333065, 0x78742e32,
+    0x69660a74, 0x3330656c, 0x742e3338, 0x660a7478,
+    0x30656c69, 0x2e343833, 0x0a747874, 0x656c6966,
+    0x35383330, 0x7478742e, 0x6c69660a, 0x38333065,
+    0x78742e36, 0x69660a74, 0x3330656c, 0x742e3738,
+    0x660a7478, 0x30656c69, 0x2e383833, 0x0a747874,
+    0x656c6966, 0x39383330, 0x7478742e, 0x6c69660a,
+    0x39333065, 0x78742e30, 0x69660a74, 0x3330656c,
+    0x742e3139, 0x660a7478, 0x30656c69, 0x2e323933,
+    0x0a747874, 0x656c6966, 0x33393330, 0x7478742e,
+    0x6c69660a, 0x39333065, 0x78742e34, 0x69660a74,
+    0x3330656c, 0x742e3539, 0x660a7478, 0x30656c69,
+    0x2e363933, 0x0a747874, 0x656c6966, 0x37393330,
+    0x7478742e, 0x6c69660a, 0x39333065, 0x78742e38,
+    0x69660a74, 0x3330656c, 0x742e3939, 0x660a7478,
+    0x30656c69, 0x2e303034, 0x0a747874, 0x656c6966,
+    0x31303430, 0x7478742e, 0x6c69660a, 0x30343065,
+    0x78742e32, 0x69660a74, 0x3430656c, 0x742e3330,
+    0x660a7478, 0x30656c69, 0x2e343034, 0x0a747874,
+    0x656c6966, 0x35303430, 0x7478742e, 0x6c69660a,
+    0x30343065, 0x78742e36, 0x69660a74, 0x3430656c,
+    0x742e3730, 0x660a7478, 0x30656c69, 0x2e383034,
+    0x0a747874, 0x656c6966, 0x39303430, 0x7478742e,
+    0x6c69660a, 0x31343065, 0x78742e30, 0x69660a74,
+    0x3430656c, 0x742e3131, 0x660a7478, 0x30656c69,
+    0x2e323134, 0x0a747874, 0x656c6966, 0x33313430,
+    0x7478742e, 0x6c69660a, 0x31343065, 0x78742e34,
+    0x69660a74, 0x3430656c, 0x742e3531, 0x660a7478,
+    0x30656c69, 0x2e363134, 0x0a747874, 0x656c6966,
+    0x37313430, 0x7478742e, 0x6c69660a, 0x31343065,
+    0x78742e38, 0x69660a74, 0x3430656c, 0x742e3931,
+    0x660a7478, 0x30656c69, 0x2e303234, 0x0a747874,
+    0x656c6966, 0x31323430, 0x7478742e, 0x6c69660a,
+    0x32343065, 0x78742e32, 0x69660a74, 0x3430656c,
+    0x742e3332, 0x660a7478, 0x30656c69, 0x2e343234,
+    0x0a747874, 0x656c6966, 0x35323430, 0x7478742e,
+    0x6c69660a, 0x32343065, 0x78742e36, 0x69660a74,
+    0x3430656c, 0x742e3732, 0x660a7478, 0x30656c69,
+    0x2e383234, 0x0a747874, 0x656c6966, 0x39323430,
+    0x7478742e, 0x6c69660a, 0x33343065, 0x78742e30,
+    0x69660a74, 0x3430656c, 0x742e3133, 0x660a7478,
+    0x30656c69, 0x2e323334, 0x0a747874, 0x656c6966,
+    0x33333430, 0x7478742e, 0x6c69660a, 0x33343065,
+    0x78742e34, 0x69660a74, 0x3430656c, 0x742e3533,
+    0x660a7478, 0x30656c69, 0x2e363334, 0x0a747874,
+    0x656c6966, 0x37333430, 0x7478742e, 0x6c69660a,
+    0x33343065, 0x78742e38, 0x69660a74, 0x3430656c,
+    0x742e3933, 0x660a7478, 0x30656c69, 0x2e303434,
+    0x0a747874, 0x656c6966, 0x31343430, 0x7478742e,
+    0x6c69660a, 0x34343065, 0x78742e32, 0x69660a74,
+    0x3430656c, 0x742e3334, 0x660a7478, 0x30656c69,
+    0x2e343434, 0x0a747874, 0x656c6966, 0x35343430,
+    0x7478742e, 0x6c69660a, 0x34343065, 0x78742e36,
+    0x69660a74, 0x3430656c, 0x742e3734, 0x660a7478,
+    0x30656c69, 0x2e383434, 0x0a747874, 0x656c6966,
+    0x39343430, 0x7478742e, 0x6c69660a, 0x35343065,
+    0x78742e30, 0x69660a74, 0x3430656c, 0x742e3135,
+    0x660a7478, 0x30656c69, 0x2e323534, 0x0a747874,
+    0x656c6966, 0x33353430, 0x7478742e, 0x6c69660a,
+    0x35343065, 0x78742e34, 0x69660a74, 0x3430656c,
+    0x742e3535, 0x660a7478, 0x30656c69, 0x2e363534,
+    0x0a747874, 0x656c6966, 0x37353430, 0x7478742e,
+    0x6c69660a, 0x35343065, 0x78742e38, 0x69660a74,
+    0x3430656c, 0x742e3935, 0x660a7478, 0x30656c69,
+    0x2e303634, 0x0a747874, 0x656c6966, 0x31363430,
+    0x7478742e, 0x6c69660a, 0x36343065, 0x78742e32,
+    0x69660a74, 0x3430656c, 0x742e3336, 0x660a7478,
+    0x30656c69, 0x2e343634, 0x0a747874, 0x656c6966,
+    0x35363430, 0x7478742e, 0x6c69660a, 0x36343065,
+    0x78742e36, 0x69660a74, 0x3430656c, 0x742e3736,
+    0x660a7478, 0x30656c69, 0x2e383634, 0x0a747874,
+    0x656c6966, 0x39363430, 0x7478742e, 0x6c69660a,
+    0x37343065, 0x78742e30, 0x69660a74, 0x3430656c,
+    0x742e3137, 0x660a7478, 0x30656c69, 0x2e323734,
+    0x0a747874, 0x656c6966, 0x33373430, 0x7478742e,
+    0x6c69660a, 0x37343065, 0x78742e34, 0x69660a74,
+    0x3430656c, 0x742e3537, 0x660a7478, 0x30656c69,
+    0x2e363734, 0x0a747874, 0x656c6966, 0x37373430,
+    0x7478742e, 0x6c69660a, 0x37343065, 0x78742e38,
+    0x69660a74, 0x3430656c, 0x742e3937, 0x660a7478,
+    0x30656c69, 0x2e303834, 0x0a747874, 0x656c6966,
+    0x31383430, 0x7478742e, 0x6c69660a, 0x38343065,
+    0x78742e32, 0x69660a74, 0x3430656c, 0x742e3338,
+    0x660a7478, 0x30656c69, 0x2e343834, 0x0a747874,
+    0x656c6966, 0x35383430, 0x7478742e, 0x6c69660a,
+    0x38343065, 0x78742e36, 0x69660a74, 0x3430656c,
+    0x742e3738, 0x660a7478, 0x30656c69, 0x2e383834,
+    0x0a747874, 0x656c6966, 0x39383430, 0x7478742e,
+    0x6c69660a, 0x39343065, 0x78742e30, 0x69660a74,
+    0x3430656c, 0x742e3139, 0x660a7478, 0x30656c69,
+    0x2e323934, 0x0a747874, 0x656c6966, 0x33393430,
+    0x7478742e, 0x6c69660a, 0x39343065, 0x78742e34,
+    0x69660a74, 0x3430656c, 0x742e3539, 0x660a7478,
+    0x30656c69, 0x2e363934, 0x0a747874, 0x656c6966,
+    0x37393430, 0x7478742e, 0x6c69660a, 0x39343065,
+    0x78742e38, 0x69660a74, 0x3430656c, 0x742e3939,
+    0x660a7478, 0x30656c69, 0x2e303035, 0x0a747874,
+    0x656c6966, 0x31303530, 0x7478742e, 0x6c69660a,
+    0x30353065, 0x78742e32, 0x69660a74, 0x3530656c,
+    0x742e3330, 0x660a7478, 0x30656c69, 0x2e343035,
+    0x0a747874, 0x656c6966, 0x35303530, 0x7478742e,
+    0x6c69660a, 0x30353065, 0x78742e36, 0x69660a74,
+    0x3530656c, 0x742e3730, 0x660a7478, 0x30656c69,
+    0x2e383035, 0x0a747874, 0x656c6966, 0x39303530,
+    0x7478742e, 0x6c69660a, 0x31353065, 0x78742e30,
+    0x69660a74, 0x3530656c, 0x742e3131, 0x660a7478,
+    0x30656c69, 0x2e323135, 0x0a747874, 0x656c6966,
+    0x33313530, 0x7478742e, 0x6c69660a, 0x31353065,
+    0x78742e34, 0x69660a74, 0x3530656c, 0x742e3531,
+    0x660a7478, 0x30656c69, 0x2e363135, 0x0a747874,
+    0x656c6966, 0x37313530, 0x7478742e, 0x6c69660a,
+    0x31353065, 0x78742e38, 0x69660a74, 0x3530656c,
+    0x742e3931, 0x660a7478, 0x30656c69, 0x2e303235,
+    0x0a747874, 0x656c6966, 0x31323530, 0x7478742e,
+    0x6c69660a, 0x32353065, 0x78742e32, 0x69660a74,
+    0x3530656c, 0x742e3332, 0x660a7478, 0x30656c69,
+    0x2e343235, 0x0a747874, 0x656c6966, 0x35323530,
+    0x7478742e, 0x6c69660a, 0x32353065, 0x78742e36,
+    0x69660a74, 0x3530656c, 0x742e3732, 0x660a7478,
+    0x30656c69, 0x2e383235, 0x0a747874, 0x656c6966,
+    0x39323530, 0x7478742e, 0x6c69660a, 0x33353065,
+    0x78742e30, 0x69660a74, 0x3530656c, 0x742e3133,
+    0x660a7478, 0x30656c69, 0x2e323335, 0x0a747874,
+    0x656c6966, 0x33333530, 0x7478742e, 0x6c69660a,
+    0x33353065, 0x78742e34, 0x69660a74, 0x3530656c,
+    0x742e3533, 0x660a7478, 0x30656c69, 0x2e363335,
+    0x0a747874, 0x656c6966, 0x37333530, 0x7478742e,
+    0x6c69660a, 0x33353065, 0x78742e38, 0x69660a74,
+    0x3530656c, 0x742e3933, 0x660a7478, 0x30656c69,
+    0x2e303435, 0x0a747874, 0x656c6966, 0x31343530,
+    0x7478742e, 0x6c69660a, 0x34353065, 0x78742e32,
+    0x69660a74, 0x3530656c, 0x742e3334, 0x660a7478,
+    0x30656c69, 0x2e343435, 0x0a747874, 0x656c6966,
+    0x35343530, 0x7478742e, 0x6c69660a, 0x34353065,
+    0x78742e36, 0x69660a74, 0x3530656c, 0x742e3734,
+    0x660a7478, 0x30656c69, 0x2e383435, 0x0a747874,
+    0x656c6966, 0x39343530, 0x7478742e, 0x6c69660a,
+    0x35353065, 0x78742e30, 0x69660a74, 0x3530656c,
+    0x742e3135, 0x660a7478, 0x30656c69, 0x2e323535,
+    0x0a747874, 0x656c6966, 0x33353530, 0x7478742e,
+    0x6c69660a, 0x35353065, 0x78742e34, 0x69660a74,
+    0x3530656c, 0x742e3535, 0x660a7478, 0x30656c69,
+    0x2e363535, 0x0a747874, 0x656c6966, 0x37353530,
+    0x7478742e, 0x6c69660a, 0x35353065, 0x78742e38,
+    0x69660a74, 0x3530656c, 0x742e3935, 0x660a7478,
+    0x30656c69, 0x2e303635, 0x0a747874, 0x656c6966,
+    0x31363530, 0x7478742e, 0x6c69660a, 0x36353065,
+    0x78742e32, 0x69660a74, 0x3530656c, 0x742e3336,
+    0x660a7478, 0x30656c69, 0x2e343635, 0x0a747874,
+    0x656c6966, 0x35363530, 0x7478742e, 0x6c69660a,
+    0x36353065, 0x78742e36, 0x69660a74, 0x3530656c,
+    0x742e3736, 0x660a7478, 0x30656c69, 0x2e383635,
+    0x0a747874, 0x656c6966, 0x39363530, 0x7478742e,
+    0x6c69660a, 0x37353065, 0x78742e30, 0x69660a74,
+    0x3530656c, 0x742e3137, 0x660a7478, 0x30656c69,
+    0x2e323735, 0x0a747874, 0x656c6966, 0x33373530,
+    0x7478742e, 0x6c69660a, 0x37353065, 0x78742e34,
+    0x69660a74, 0x3530656c, 0x742e3537, 0x660a7478,
+    0x30656c69, 0x2e363735, 0x0a747874, 0x656c6966,
+    0x37373530, 0x7478742e, 0x6c69660a, 0x37353065,
+    0x78742e38, 0x69660a74, 0x3530656c, 0x742e3937,
+    0x660a7478, 0x30656c69, 0x2e303835, 0x0a747874,
+    0x656c6966, 0x31383530, 0x7478742e, 0x6c69660a,
+    0x38353065, 0x78742e32, 0x69660a74, 0x3530656c,
+    0x742e3338, 0x660a7478, 0x30656c69, 0x2e343835,
+    0x0a747874, 0x656c6966, 0x35383530, 0x7478742e,
+    0x6c69660a, 0x38353065, 0x78742e36, 0x69660a74,
+    0x3530656c, 0x742e3738, 0x660a7478, 0x30656c69,
+    0x2e383835, 0x0a747874, 0x656c6966, 0x39383530,
+    0x7478742e, 0x6c69660a, 0x39353065, 0x78742e30,
+    0x69660a74, 0x3530656c, 0x742e3139, 0x660a7478,
+    0x30656c69, 0x2e323935, 0x0a747874, 0x656c6966,
+    0x33393530, 0x7478742e, 0x6c69660a, 0x39353065,
+    0x78742e34, 0x69660a74, 0x3530656c, 0x742e3539,
+    0x660a7478, 0x30656c69, 0x2e363935, 0x0a747874,
+    0x656c6966, 0x37393530, 0x7478742e, 0x6c69660a,
+    0x39353065, 0x78742e38, 0x69660a74, 0x3530656c,
+    0x742e3939, 0x660a7478, 0x30656c69, 0x2e303036,
+    0x0a747874, 0x656c6966, 0x31303630, 0x7478742e,
+    0x6c69660a, 0x30363065, 0x78742e32, 0x69660a74,
+    0x3630656c, 0x742e3330, 0x660a7478, 0x30656c69,
+    0x2e343036, 0x0a747874, 0x656c6966, 0x35303630,
+    0x7478742e, 0x6c69660a, 0x30363065, 0x78742e36,
+    0x69660a74, 0x3630656c, 0x742e3730, 0x660a7478,
+    0x30656c69, 0x2e383036, 0x0a747874, 0x656c6966,
+    0x39303630, 0x7478742e, 0x6c69660a, 0x31363065,
+    0x78742e30, 0x69660a74, 0x3630656c, 0x742e3131,
+    0x660a7478, 0x30656c69, 0x2e323136, 0x0a747874,
+    0x656c6966, 0x33313630, 0x7478742e, 0x6c69660a,
+    0x31363065, 0x78742e34, 0x69660a74, 0x3630656c,
+    0x742e3531, 0x660a7478, 0x30656c69, 0x2e363136,
+    0x0a747874, 0x656c6966, 0x37313630, 0x7478742e,
+    0x6c69660a, 0x31363065, 0x78742e38, 0x69660a74,
+    0x3630656c, 0x742e3931, 0x660a7478, 0x30656c69,
+    0x2e303236, 0x0a747874, 0x656c6966, 0x31323630,
+    0x7478742e, 0x6c69660a, 0x32363065, 0x78742e32,
+    0x69660a74, 0x3630656c, 0x742e3332, 0x660a7478,
+    0x30656c69, 0x2e343236, 0x0a747874, 0x656c6966,
+    0x35323630, 0x7478742e, 0x6c69660a, 0x32363065,
+    0x78742e36, 0x69660a74, 0x3630656c, 0x742e3732,
+    0x660a7478, 0x30656c69, 0x2e383236, 0x0a747874,
+    0x656c6966, 0x39323630, 0x7478742e, 0x6c69660a,
+    0x33363065, 0x78742e30, 0x69660a74, 0x3630656c,
+    0x742e3133, 0x660a7478, 0x30656c69, 0x2e323336,
+    0x0a747874, 0x656c6966, 0x33333630, 0x7478742e,
+    0x6c69660a, 0x33363065, 0x78742e34, 0x69660a74,
+    0x3630656c, 0x742e3533, 0x660a7478, 0x30656c69,
+    0x2e363336, 0x0a747874, 0x656c6966, 0x37333630,
+    0x7478742e, 0x6c69660a, 0x33363065, 0x78742e38,
+    0x69660a74, 0x3630656c, 0x742e3933, 0x660a7478,
+    0x30656c69, 0x2e303436, 0x0a747874, 0x656c6966,
+    0x31343630, 0x7478742e, 0x6c69660a, 0x34363065,
+    0x78742e32, 0x69660a74, 0x3630656c, 0x742e3334,
+    0x660a7478, 0x30656c69, 0x2e343436, 0x0a747874,
+    0x656c6966, 0x35343630, 0x7478742e, 0x6c69660a,
+    0x34363065, 0x78742e36, 0x69660a74, 0x3630656c,
+    0x742e3734, 0x660a7478, 0x30656c69, 0x2e383436,
+    0x0a747874, 0x656c6966, 0x39343630, 0x7478742e,
+    0x6c69660a, 0x35363065, 0x78742e30, 0x69660a74,
+    0x3630656c, 0x742e3135, 0x660a7478, 0x30656c69,
+    0x2e323536, 0x0a747874, 0x656c6966, 0x33353630,
+    0x7478742e, 0x6c69660a, 0x35363065, 0x78742e34,
+    0x69660a74, 0x3630656c, 0x742e3535, 0x660a7478,
+    0x30656c69, 0x2e363536, 0x0a747874, 0x656c6966,
+    0x37353630, 0x7478742e, 0x6c69660a, 0x35363065,
+    0x78742e38, 0x69660a74, 0x3630656c, 0x742e3935,
+    0x660a7478, 0x30656c69, 0x2e303636, 0x0a747874,
+    0x656c6966, 0x31363630, 0x7478742e, 0x6c69660a,
+    0x36363065, 0x78742e32, 0x69660a74, 0x3630656c,
+    0x742e3336, 0x660a7478, 0x30656c69, 0x2e343636,
+    0x0a747874, 0x656c6966, 0x35363630, 0x7478742e,
+    0x6c69660a, 0x36363065, 0x78742e36, 0x69660a74,
+    0x3630656c, 0x742e3736, 0x660a7478, 0x30656c69,
+    0x2e383636, 0x0a747874, 0x656c6966, 0x39363630,
+    0x7478742e, 0x6c69660a, 0x37363065, 0x78742e30,
+    0x69660a74, 0x3630656c, 0x742e3137, 0x660a7478,
+    0x30656c69, 0x2e323736, 0x0a747874, 0x656c6966,
+    0x33373630, 0x7478742e, 0x6c69660a, 0x37363065,
+    0x78742e34, 0x69660a74, 0x3630656c, 0x742e3537,
+    0x660a7478, 0x30656c69, 0x2e363736, 0x0a747874,
+    0x656c6966, 0x37373630, 0x7478742e, 0x6c69660a,
+    0x37363065, 0x78742e38, 0x69660a74, 0x3630656c,
+    0x742e3937, 0x660a7478, 0x30656c69, 0x2e303836,
+    0x0a747874, 0x656c6966, 0x31383630, 0x7478742e,
+    0x6c69660a, 0x38363065, 0x78742e32, 0x69660a74,
+    0x3630656c, 0x742e3338, 0x660a7478, 0x30656c69,
+    0x2e343836, 0x0a747874, 0x656c6966, 0x35383630,
+    0x7478742e, 0x6c69660a, 0x38363065, 0x78742e36,
+    0x69660a74, 0x3630656c, 0x742e3738, 0x660a7478,
+    0x30656c69, 0x2e383836, 0x0a747874, 0x656c6966,
+    0x39383630, 0x7478742e, 0x6c69660a, 0x39363065,
+    0x78742e30, 0x69660a74, 0x3630656c, 0x742e3139,
+    0x660a7478, 0x30656c69, 0x2e323936, 0x0a747874,
+    0x656c6966, 0x33393630, 0x7478742e, 0x6c69660a,
+    0x39363065, 0x78742e34, 0x69660a74, 0x3630656c,
+    0x742e3539, 0x660a7478, 0x30656c69, 0x2e363936,
+    0x0a747874, 0x656c6966, 0x37393630, 0x7478742e,
+    0x6c69660a, 0x39363065, 0x78742e38, 0x69660a74,
+    0x3630656c, 0x742e3939, 0x660a7478, 0x30656c69,
+    0x2e303037, 0x0a747874, 0x656c6966, 0x31303730,
+    0x7478742e, 0x6c69660a, 0x30373065, 0x78742e32,
+    0x69660a74, 0x3730656c, 0x742e3330, 0x660a7478,
+    0x30656c69, 0x2e343037, 0x0a747874, 0x656c6966,
+    0x35303730, 0x7478742e, 0x6c69660a, 0x30373065,
+    0x78742e36, 0x69660a74, 0x3730656c, 0x742e3730,
+    0x660a7478, 0x30656c69, 0x2e383037, 0x0a747874,
+    0x656c6966, 0x39303730, 0x7478742e, 0x6c69660a,
+    0x31373065, 0x78742e30, 0x69660a74, 0x3730656c,
+    0x742e3131, 0x660a7478, 0x30656c69, 0x2e323137,
+    0x0a747874, 0x656c6966, 0x33313730, 0x7478742e,
+    0x6c69660a, 0x31373065, 0x78742e34, 0x69660a74,
+    0x3730656c, 0x742e3531, 0x660a7478, 0x30656c69,
+    0x2e363137, 0x0a747874, 0x656c6966, 0x37313730,
+    0x7478742e, 0x6c69660a, 0x31373065, 0x78742e38,
+    0x69660a74, 0x3730656c, 0x742e3931, 0x660a7478,
+    0x30656c69, 0x2e303237, 0x0a747874, 0x656c6966,
+    0x31323730, 0x7478742e, 0x6c69660a, 0x32373065,
+    0x78742e32, 0x69660a74, 0x3730656c, 0x742e3332,
+    0x660a7478, 0x30656c69, 0x2e343237, 0x0a747874,
+    0x656c6966, 0x35323730, 0x7478742e, 0x6c69660a,
+    0x32373065, 0x78742e36, 0x69660a74, 0x3730656c,
+    0x742e3732, 0x660a7478, 0x30656c69, 0x2e383237,
+    0x0a747874, 0x656c6966, 0x39323730, 0x7478742e,
+    0x6c69660a, 0x33373065, 0x78742e30, 0x69660a74,
+    0x3730656c, 0x742e3133, 0x660a7478, 0x30656c69,
+    0x2e323337, 0x0a747874, 0x656c6966, 0x33333730,
+    0x7478742e, 0x6c69660a, 0x33373065, 0x78742e34,
+    0x69660a74, 0x3730656c, 0x742e3533, 0x660a7478,
+    0x30656c69, 0x2e363337, 0x0a747874, 0x656c6966,
+    0x37333730, 0x7478742e, 0x6c69660a, 0x33373065,
+    0x78742e38, 0x69660a74, 0x3730656c, 0x742e3933,
+    0x660a7478, 0x30656c69, 0x2e303437, 0x0a747874,
+    0x656c6966, 0x31343730, 0x7478742e, 0x6c69660a,
+    0x34373065, 0x78742e32, 0x69660a74, 0x3730656c,
+    0x742e3334, 0x660a7478, 0x30656c69, 0x2e343437,
+    0x0a747874, 0x656c6966, 0x35343730, 0x7478742e,
+    0x6c69660a, 0x34373065, 0x78742e36, 0x69660a74,
+    0x3730656c, 0x742e3734, 0x660a7478, 0x30656c69,
+    0x2e383437, 0x0a747874, 0x656c6966, 0x39343730,
+    0x7478742e, 0x6c69660a, 0x35373065, 0x78742e30,
+    0x69660a74, 0x3730656c, 0x742e3135, 0x660a7478,
+    0x30656c69, 0x2e323537, 0x0a747874, 0x656c6966,
+    0x33353730, 0x7478742e, 0x6c69660a, 0x35373065,
+    0x78742e34, 0x69660a74, 0x3730656c, 0x742e3535,
+    0x660a7478, 0x30656c69, 0x2e363537, 0x0a747874,
+    0x656c6966, 0x37353730, 0x7478742e, 0x6c69660a,
+    0x35373065, 0x78742e38, 0x69660a74, 0x3730656c,
+    0x742e3935, 0x660a7478, 0x30656c69, 0x2e303637,
+    0x0a747874, 0x656c6966, 0x31363730, 0x7478742e,
+    0x6c69660a, 0x36373065, 0x78742e32, 0x69660a74,
+    0x3730656c, 0x742e3336, 0x660a7478, 0x30656c69,
+    0x2e343637, 0x0a747874, 0x656c6966, 0x35363730,
+    0x7478742e, 0x6c69660a, 0x36373065, 0x78742e36,
+    0x69660a74, 0x3730656c, 0x742e3736, 0x660a7478,
+    0x30656c69, 0x2e383637, 0x0a747874, 0x656c6966,
+    0x39363730, 0x7478742e, 0x6c69660a, 0x37373065,
+    0x78742e30, 0x69660a74, 0x3730656c, 0x742e3137,
+    0x660a7478, 0x30656c69, 0x2e323737, 0x0a747874,
+    0x656c6966, 0x33373730, 0x7478742e, 0x6c69660a,
+    0x37373065, 0x78742e34, 0x69660a74, 0x3730656c,
+    0x742e3537, 0x660a7478, 0x30656c69, 0x2e363737,
+    0x0a747874, 0x656c6966, 0x37373730, 0x7478742e,
+    0x6c69660a, 0x37373065, 0x78742e38, 0x69660a74,
+    0x3730656c, 0x742e3937, 0x660a7478, 0x30656c69,
+    0x2e303837, 0x0a747874, 0x656c6966, 0x31383730,
+    0x7478742e, 0x6c69660a, 0x38373065, 0x78742e32,
+    0x69660a74, 0x3730656c, 0x742e3338, 0x660a7478,
+    0x30656c69, 0x2e343837, 0x0a747874, 0x656c6966,
+    0x35383730, 0x7478742e, 0x6c69660a, 0x38373065,
+    0x78742e36, 0x69660a74, 0x3730656c, 0x742e3738,
+    0x660a7478, 0x30656c69, 0x2e383837, 0x0a747874,
+    0x656c6966, 0x39383730, 0x7478742e, 0x6c69660a,
+    0x39373065, 0x78742e30, 0x69660a74, 0x3730656c,
+    0x742e3139, 0x660a7478, 0x30656c69, 0x2e323937,
+    0x0a747874, 0x656c6966, 0x33393730, 0x7478742e,
+    0x6c69660a, 0x39373065, 0x78742e34, 0x69660a74,
+    0x3730656c, 0x742e3539, 0x660a7478, 0x30656c69,
+    0x2e363937, 0x0a747874, 0x656c6966, 0x37393730,
+    0x7478742e, 0x6c69660a, 0x39373065, 0x78742e38,
+    0x69660a74, 0x3730656c, 0x742e3939, 0x660a7478,
+    0x30656c69, 0x2e303038, 0x0a747874, 0x656c6966,
+    0x31303830, 0x7478742e, 0x6c69660a, 0x30383065,
+    0x78742e32, 0x69660a74, 0x3830656c, 0x742e3330,
+    0x660a7478, 0x30656c69, 0x2e343038, 0x0a747874,
+    0x656c6966, 0x35303830, 0x7478742e, 0x6c69660a,
+    0x30383065, 0x78742e36, 0x69660a74, 0x3830656c,
+    0x742e3730, 0x660a7478, 0x30656c69, 0x2e383038,
+    0x0a747874, 0x656c6966, 0x39303830, 0x7478742e,
+    0x6c69660a, 0x31383065, 0x78742e30, 0x69660a74,
+    0x3830656c, 0x742e3131, 0x660a7478, 0x30656c69,
+    0x2e323138, 0x0a747874, 0x656c6966, 0x33313830,
+    0x7478742e, 0x6c69660a, 0x31383065, 0x78742e34,
+    0x69660a74, 0x3830656c, 0x742e3531, 0x660a7478,
+    0x30656c69, 0x2e363138, 0x0a747874, 0x656c6966,
+    0x37313830, 0x7478742e, 0x6c69660a, 0x31383065,
+    0x78742e38, 0x69660a74, 0x3830656c, 0x742e3931,
+    0x660a7478, 0x30656c69, 0x2e303238, 0x0a747874,
+    0x656c6966, 0x31323830, 0x7478742e, 0x6c69660a,
+    0x32383065, 0x78742e32, 0x69660a74, 0x3830656c,
+    0x742e3332, 0x660a7478, 0x30656c69, 0x2e343238,
+    0x0a747874, 0x656c6966, 0x35323830, 0x7478742e,
+    0x6c69660a, 0x32383065, 0x78742e36, 0x69660a74,
+    0x3830656c, 0x742e3732, 0x660a7478, 0x30656c69,
+    0x2e383238, 0x0a747874, 0x656c6966, 0x39323830,
+    0x7478742e, 0x6c69660a, 0x33383065, 0x78742e30,
+    0x69660a74, 0x3830656c, 0x742e3133, 0x660a7478,
+    0x30656c69, 0x2e323338, 0x0a747874, 0x656c6966,
+    0x33333830, 0x7478742e, 0x6c69660a, 0x33383065,
+    0x78742e34, 0x69660a74, 0x3830656c, 0x742e3533,
+    0x660a7478, 0x30656c69, 0x2e363338, 0x0a747874,
+    0x656c6966, 0x37333830, 0x7478742e, 0x6c69660a,
+    0x33383065, 0x78742e38, 0x69660a74, 0x3830656c,
+    0x742e3933, 0x660a7478, 0x30656c69, 0x2e303438,
+    0x0a747874, 0x656c6966, 0x31343830, 0x7478742e,
+    0x6c69660a, 0x34383065, 0x78742e32, 0x69660a74,
+    0x3830656c, 0x742e3334, 0x660a7478, 0x30656c69,
+    0x2e343438, 0x0a747874, 0x656c6966, 0x35343830,
+    0x7478742e, 0x6c69660a, 0x34383065, 0x78742e36,
+    0x69660a74, 0x3830656c, 0x742e3734, 0x660a7478,
+    0x30656c69, 0x2e383438, 0x0a747874, 0x656c6966,
+    0x39343830, 0x7478742e, 0x6c69660a, 0x35383065,
+    0x78742e30, 0x69660a74, 0x3830656c, 0x742e3135,
+    0x660a7478, 0x30656c69, 0x2e323538, 0x0a747874,
+    0x656c6966, 0x33353830, 0x7478742e, 0x6c69660a,
+    0x35383065, 0x78742e34, 0x69660a74, 0x3830656c,
+    0x742e3535, 0x660a7478, 0x30656c69, 0x2e363538,
+    0x0a747874, 0x656c6966, 0x37353830, 0x7478742e,
+    0x6c69660a, 0x35383065, 0x78742e38, 0x69660a74,
+    0x3830656c, 0x742e3935, 0x660a7478, 0x30656c69,
+    0x2e303638, 0x0a747874, 0x656c6966, 0x31363830,
+    0x7478742e, 0x6c69660a, 0x36383065, 0x78742e32,
+    0x69660a74, 0x3830656c, 0x742e3336, 0x660a7478,
+    0x30656c69, 0x2e343638, 0x0a747874, 0x656c6966,
+    0x35363830, 0x7478742e, 0x6c69660a, 0x36383065,
+    0x78742e36, 0x69660a74, 0x3830656c, 0x742e3736,
+    0x660a7478, 0x30656c69, 0x2e383638, 0x0a747874,
+    0x656c6966, 0x39363830, 0x7478742e, 0x6c69660a,
+    0x37383065, 0x78742e30, 0x69660a74, 0x3830656c,
+    0x742e3137, 0x660a7478, 0x30656c69, 0x2e323738,
+    0x0a747874, 0x656c6966, 0x33373830, 0x7478742e,
+    0x6c69660a, 0x37383065, 0x78742e34, 0x69660a74,
+    0x3830656c, 0x742e3537, 0x660a7478, 0x30656c69,
+    0x2e363738, 0x0a747874, 0x656c6966, 0x37373830,
+    0x7478742e, 0x6c69660a, 0x37383065, 0x78742e38,
+    0x69660a74, 0x3830656c, 0x742e3937, 0x660a7478,
+    0x30656c69, 0x2e303838, 0x0a747874, 0x656c6966,
+    0x31383830, 0x7478742e, 0x6c69660a, 0x38383065,
+    0x78742e32, 0x69660a74, 0x3830656c, 0x742e3338,
+    0x660a7478, 0x30656c69, 0x2e343838, 0x0a747874,
+    0x656c6966, 0x35383830, 0x7478742e, 0x6c69660a,
+    0x38383065, 0x78742e36, 0x69660a74, 0x3830656c,
+    0x742e3738, 0x660a7478, 0x30656c69, 0x2e383838,
+    0x0a747874, 0x656c6966, 0x39383830, 0x7478742e,
+    0x6c69660a, 0x39383065, 0x78742e30, 0x69660a74,
+    0x3830656c, 0x742e3139, 0x660a7478, 0x30656c69,
+    0x2e323938, 0x0a747874, 0x656c6966, 0x33393830,
+    0x7478742e, 0x6c69660a, 0x39383065, 0x78742e34,
+    0x69660a74, 0x3830656c, 0x742e3539, 0x660a7478,
+    0x30656c69, 0x2e363938, 0x0a747874, 0x656c6966,
+    0x37393830, 0x7478742e, 0x6c69660a, 0x39383065,
+    0x78742e38, 0x69660a74, 0x3830656c, 0x742e3939,
+    0x660a7478, 0x30656c69, 0x2e303039, 0x0a747874,
+    0x656c6966, 0x31303930, 0x7478742e, 0x6c69660a,
+    0x30393065, 0x78742e32, 0x69660a74, 0x3930656c,
+    0x742e3330, 0x660a7478, 0x30656c69, 0x2e343039,
+    0x0a747874, 0x656c6966, 0x35303930, 0x7478742e,
+    0x6c69660a, 0x30393065, 0x78742e36, 0x69660a74,
+    0x3930656c, 0x742e3730, 0x660a7478, 0x30656c69,
+    0x2e383039, 0x0a747874, 0x656c6966, 0x39303930,
+    0x7478742e, 0x6c69660a, 0x31393065, 0x78742e30,
+    0x69660a74, 0x3930656c, 0x742e3131, 0x660a7478,
+    0x30656c69, 0x2e323139, 0x0a747874, 0x656c6966,
+    0x33313930, 0x7478742e, 0x6c69660a, 0x31393065,
+    0x78742e34, 0x69660a74, 0x3930656c, 0x742e3531,
+    0x660a7478, 0x30656c69, 0x2e363139, 0x0a747874,
+    0x656c6966, 0x37313930, 0x7478742e, 0x6c69660a,
+    0x31393065, 0x78742e38, 0x69660a74, 0x3930656c,
+    0x742e3931, 0x660a7478, 0x30656c69, 0x2e303239,
+    0x0a747874, 0x656c6966, 0x31323930, 0x7478742e,
+    0x6c69660a, 0x32393065, 0x78742e32, 0x69660a74,
+    0x3930656c, 0x742e3332, 0x660a7478, 0x30656c69,
+    0x2e343239, 0x0a747874, 0x656c6966, 0x35323930,
+    0x7478742e, 0x6c69660a, 0x32393065, 0x78742e36,
+    0x69660a74, 0x3930656c, 0x742e3732, 0x660a7478,
+    0x30656c69, 0x2e383239, 0x0a747874, 0x656c6966,
+    0x39323930, 0x7478742e, 0x6c69660a, 0x33393065,
+    0x78742e30, 0x69660a74, 0x3930656c, 0x742e3133,
+    0x660a7478, 0x30656c69, 0x2e323339, 0x0a747874,
+    0x656c6966, 0x33333930, 0x7478742e, 0x6c69660a,
+    0x33393065, 0x78742e34, 0x69660a74, 0x3930656c,
+    0x742e3533, 0x660a7478, 0x30656c69, 0x2e363339,
+    0x0a747874, 0x656c6966, 0x37333930, 0x7478742e,
+    0x6c69660a, 0x33393065, 0x78742e38, 0x69660a74,
+    0x3930656c, 0x742e3933, 0x660a7478, 0x30656c69,
+    0x2e303439, 0x0a747874, 0x656c6966, 0x31343930,
+    0x7478742e, 0x6c69660a, 0x34393065, 0x78742e32,
+    0x69660a74, 0x3930656c, 0x742e3334, 0x660a7478,
+    0x30656c69, 0x2e343439, 0x0a747874, 0x656c6966,
+    0x35343930, 0x7478742e, 0x6c69660a, 0x34393065,
+    0x78742e36, 0x69660a74, 0x3930656c, 0x742e3734,
+    0x660a7478, 0x30656c69, 0x2e383439, 0x0a747874,
+    0x656c6966, 0x39343930, 0x7478742e, 0x6c69660a,
+    0x35393065, 0x78742e30, 0x69660a74, 0x3930656c,
+    0x742e3135, 0x660a7478, 0x30656c69, 0x2e323539,
+    0x0a747874, 0x656c6966, 0x33353930, 0x7478742e,
+    0x6c69660a, 0x35393065, 0x78742e34, 0x69660a74,
+    0x3930656c, 0x742e3535, 0x660a7478, 0x30656c69,
+    0x2e363539, 0x0a747874, 0x656c6966, 0x37353930,
+    0x7478742e, 0x6c69660a, 0x35393065, 0x78742e38,
+    0x69660a74, 0x3930656c, 0x742e3935, 0x660a7478,
+    0x30656c69, 0x2e303639, 0x0a747874, 0x656c6966,
+    0x31363930, 0x7478742e, 0x6c69660a, 0x36393065,
+    0x78742e32, 0x69660a74, 0x3930656c, 0x742e3336,
+    0x660a7478, 0x30656c69, 0x2e343639, 0x0a747874,
+    0x656c6966, 0x35363930, 0x7478742e, 0x6c69660a,
+    0x36393065, 0x78742e36, 0x69660a74, 0x3930656c,
+    0x742e3736, 0x660a7478, 0x30656c69, 0x2e383639,
+    0x0a747874, 0x656c6966, 0x39363930, 0x7478742e,
+    0x6c69660a, 0x37393065, 0x78742e30, 0x69660a74,
+    0x3930656c, 0x742e3137, 0x660a7478, 0x30656c69,
+    0x2e323739, 0x0a747874, 0x656c6966, 0x33373930,
+    0x7478742e, 0x6c69660a, 0x37393065, 0x78742e34,
+    0x69660a74, 0x3930656c, 0x742e3537, 0x660a7478,
+    0x30656c69, 0x2e363739, 0x0a747874, 0x656c6966,
+    0x37373930, 0x7478742e, 0x6c69660a, 0x37393065,
+    0x78742e38, 0x69660a74, 0x3930656c, 0x742e3937,
+    0x660a7478, 0x30656c69, 0x2e303839, 0x0a747874,
+    0x656c6966, 0x31383930, 0x7478742e, 0x6c69660a,
+    0x38393065, 0x78742e32, 0x69660a74, 0x3930656c,
+    0x742e3338, 0x660a7478, 0x30656c69, 0x2e343839,
+    0x0a747874, 0x656c6966, 0x35383930, 0x7478742e,
+    0x6c69660a, 0x38393065, 0x78742e36, 0x69660a74,
+    0x3930656c, 0x742e3738, 0x660a7478, 0x30656c69,
+    0x2e383839, 0x0a747874, 0x656c6966, 0x39383930,
+    0x7478742e, 0x6c69660a, 0x39393065, 0x78742e30,
+    0x69660a74, 0x3930656c, 0x742e3139, 0x660a7478,
+    0x30656c69, 0x2e323939, 0x0a747874, 0x656c6966,
+    0x33393930, 0x7478742e, 0x6c69660a, 0x39393065,
+    0x78742e34, 0x69660a74, 0x3930656c, 0x742e3539,
+    0x660a7478, 0x30656c69, 0x2e363939, 0x0a747874,
+    0x656c6966, 0x37393930, 0x7478742e, 0x6c69660a,
+    0x39393065, 0x78742e38, 0x69660a74, 0x3930656c,
+    0x742e3939, 0x660a7478, 0x31656c69, 0x2e303030,
+    0x0a747874, 0x656c6966, 0x31303031, 0x7478742e,
+    0x6c69660a, 0x30303165, 0x78742e32, 0x69660a74,
+    0x3031656c, 0x742e3330, 0x660a7478, 0x31656c69,
+    0x2e343030, 0x0a747874, 0x656c6966, 0x35303031,
+    0x7478742e, 0x6c69660a, 0x30303165, 0x78742e36,
+    0x69660a74, 0x3031656c, 0x742e3730, 0x660a7478,
+    0x31656c69, 0x2e383030, 0x0a747874, 0x656c6966,
+    0x39303031, 0x7478742e, 0x6c69660a, 0x31303165,
+    0x78742e30, 0x69660a74, 0x3031656c, 0x742e3131,
+    0x660a7478, 0x31656c69, 0x2e323130, 0x0a747874,
+    0x656c6966, 0x33313031, 0x7478742e, 0x6c69660a,
+    0x31303165, 0x78742e34, 0x69660a74, 0x3031656c,
+    0x742e3531, 0x660a7478, 0x31656c69, 0x2e363130,
+    0x0a747874, 0x656c6966, 0x37313031, 0x7478742e,
+    0x6c69660a, 0x31303165, 0x78742e38, 0x69660a74,
+    0x3031656c, 0x742e3931, 0x660a7478, 0x31656c69,
+    0x2e303230, 0x0a747874, 0x656c6966, 0x31323031,
+    0x7478742e, 0x6c69660a, 0x32303165, 0x78742e32,
+    0x69660a74, 0x3031656c, 0x742e3332, 0x660a7478,
+    0x31656c69, 0x2e343230, 0x0a747874,
+};
+
+static const int bench_fs_1024_size = sizeof (bench_fs_1024);
\ No newline at end of file
@@ -0,0 +1,400 @@
+/* Auto-generated ROM FS from:
+ *  - file0001.txt
+ *  - file0002.txt
+ *  - file0003.txt
+ *  - file0004.txt
+ *  - file0005.txt
+ *  - file0006.txt
+ *  - file0007.txt
+ *  - file0008.txt
+ *  - file0009.txt
+ *  - file0010.txt
+ *  - file0011.txt
+ *  - file0012.txt
+ *  - file0013.txt
+ *  - file0014.txt
+ *  - file0015.txt
+ *  - file0016.txt
+ *  - file0017.txt
+ *  - file0018.txt
+ *  - file0019.txt
+ *  - file0020.txt
+ *  - file0021.txt
+ *  - file0022.txt
+ *  - file0023.txt
+ *  - file0024.txt
+ *  - file0025.txt
+ *  - file0026.txt
+ *  - file0027.txt
+ *  - file0028.txt
+ *  - file0029.txt
+ *  - file0030.txt
+ *  - file0031.txt
+ *  - file0032.txt
+ *  - file0033.txt
+ *  - file0034.txt
+ *  - file0035.txt
+ *  - file0036.txt
+ *  - file0037.txt
+ *  - file0038.txt
+ *  - file0039.txt
+ *  - file0040.txt
+ *  - file0041.txt
+ *  - file0042.txt
+ *  - file0043.txt
+ *  - file0044.txt
+ *  - file0045.txt
+ *  - file0046.txt
+ *  - file0047.txt
+ *  - file0048.txt
+ *  - file0049.txt
+ *  - file0050.txt
+ *  - file0051.txt
+ *  - file0052.txt
+ *  - file0053.txt
+ *  - file0054.txt
+ *  - file0055.txt
+ *  - file0056.txt
+ *  - file0057.txt
+ *  - file0058.txt
+ *  - file0059.txt
+ *  - file0060.txt
+ *  - file0061.txt
+ *  - file0062.txt
+ *  - file0063.txt
+ *  - file0064.txt
+ *  - file0065.txt
+ *  - file0066.txt
+ *  - file0067.txt
+ *  - file0068.txt
+ *  - file0069.txt
+ *  - file0070.txt
+ *  - file0071.txt
+ *  - file0072.txt
+ *  - file0073.txt
+ *  - file0074.txt
+ *  - file0075.txt
+ *  - file0076.txt
+ *  - file0077.txt
+ *  - file0078.txt
+ *  - file0079.txt
+ *  - file0080.txt
+ *  - file0081.txt
+ *  - file0082.txt
+ *  - file0083.txt
+ *  - file0084.txt
+ *  - file0085.txt
+ *  - file0086.txt
+ *  - file0087.txt
+ *  - file0088.txt
+ *  - file0089.txt
+ *  - file0090.txt
+ *  - file0091.txt
+ *  - file0092.txt
+ *  - file0093.txt
+ *  - file0094.txt
+ *  - file0095.txt
+ *  - file0096.txt
+ *  - file0097.txt
+ *  - file0098.txt
+ *  - file0099.txt
+ *  - file0100.txt
+ *  - file0101.txt
+ *  - file0102.txt
+ *  - file0103.txt
+ *  - file0104.txt
+ *  - file0105.txt
+ *  - file0106.txt
+ *  - file0107.txt
+ *  - file0108.txt
+ *  - file0109.txt
+ *  - file0110.txt
+ *  - file0111.txt
+ *  - file0112.txt
+ *  - file0113.txt
+ *  - file0114.txt
+ *  - file0115.txt
+ *  - file0116.txt
+ *  - file0117.txt
+ *  - file0118.txt
+ *  - file0119.txt
+ *  - file0120.txt
+ *  - file0121.txt
+ *  - file0122.txt
+ *  - file0123.txt
+ *  - file0124.txt
+ *  - file0125.txt
+ *  - file0126.txt
+ *  - file0127.txt
+ *  - file0128.txt
+ */
+
+static const uint32_t bench_fs_128[] = {
+    0x466d6f52, 0x00000080, 0x00000000, 0x0000000c,
+    0x00000018, 0x00000024, 0x00000030, 0x0000003c,
+    0x00000048, 0x00000054, 0x00000060, 0x0000006c,
+    0x00000078, 0x00000084, 0x00000090, 0x0000009c,
+    0x000000a8, 0x000000b4, 0x000000c0, 0x000000cc,
+    0x000000d8, 0x000000e4, 0x000000f0, 0x000000fc,
+    0x00000108, 0x00000114, 0x00000120, 0x0000012c,
+    0x00000138, 0x00000144, 0x00000150, 0x0000015c,
+    0x00000168, 0x00000174, 0x00000180, 0x0000018c,
+    0x00000198, 0x000001a4, 0x000001b0, 0x000001bc,
+    0x000001c8, 0x000001d4, 0x000001e0, 0x000001ec,
+    0x000001f8, 0x00000204, 0x00000210, 0x0000021c,
+    0x00000228, 0x00000234, 0x00000240, 0x0000024c,
+    0x00000258, 0x00000264, 0x00000270, 0x0000027c,
+    0x00000288, 0x00000294, 0x000002a0, 0x000002ac,
+    0x000002b8, 0x000002c4, 0x000002d0, 0x000002dc,
+    0x000002e8, 0x000002f4, 0x00000300, 0x0000030c,
+    0x00000318, 0x00000324, 0x00000330, 0x0000033c,
+    0x00000348, 0x00000354, 0x00000360, 0x0000036c,
+    0x00000378, 0x00000384, 0x00000390, 0x0000039c,
+    0x000003a8, 0x000003b4, 0x000003c0, 0x000003cc,
+    0x000003d8, 0x000003e4, 0x000003f0, 0x000003fc,
+    0x00000408, 0x00000414, 0x00000420, 0x0000042c,
+    0x00000438, 0x00000444, 0x00000450, 0x0000045c,
+    0x00000468, 0x00000474, 0x00000480, 0x0000048c,
+    0x00000498, 0x000004a4, 0x000004b0, 0x000004bc,
+    0x000004c8, 0x000004d4, 0x000004e0, 0x000004ec,
+    0x000004f8, 0x00000504, 0x00000510, 0x0000051c,
+    0x00000528, 0x00000534, 0x00000540, 0x0000054c,
+    0x00000558, 0x00000564, 0x00000570, 0x0000057c,
+    0x00000588, 0x00000594, 0x000005a0, 0x000005ac,
+    0x000005b8, 0x000005c4, 0x000005d0, 0x000005dc,
+    0x000005e8, 0x000005f4, 0x00000600, 0x0000060d,
+    0x0000061a, 0x00000627, 0x00000634, 0x00000641,
+    0x0000064e, 0x0000065b, 0x00000668, 0x00000675,
+    0x00000682, 0x0000068f, 0x0000069c, 0x000006a9,
+    0x000006b6, 0x000006c3, 0x000006d0, 0x000006dd,
+    0x000006ea, 0x000006f7, 0x00000704, 0x00000711,
+    0x0000071e, 0x0000072b, 0x00000738, 0x00000745,
+    0x00000752, 0x0000075f, 0x0000076c, 0x00000779,
+    0x00000786, 0x00000793, 0x000007a0, 0x000007ad,
+    0x000007ba, 0x000007c7, 0x000007d4, 0x000007e1,
+    0x000007ee, 0x000007fb, 0x00000808, 0x00000815,
+    0x00000822, 0x0000082f, 0x0000083c, 0x00000849,
+    0x00000856, 0x00000863, 0x00000870, 0x0000087d,
+    0x0000088a, 0x00000897, 0x000008a4, 0x000008b1,
+    0x000008be, 0x000008cb, 0x000008d8, 0x000008e5,
+    0x000008f2, 0x000008ff, 0x0000090c, 0x00000919,
+    0x00000926, 0x00000933, 0x00000940, 0x0000094d,
+    0x0000095a, 0x00000967, 0x00000974, 0x00000981,
+    0x0000098e, 0x0000099b, 0x000009a8, 0x000009b5,
+    0x000009c2, 0x000009cf, 0x000009dc, 0x000009e9,
+    0x000009f6, 0x00000a03, 0x00000a10, 0x00000a1d,
+    0x00000a2a, 0x00000a37, 0x00000a44, 0x00000a51,
+    0x00000a5e, 0x00000a6b, 0x00000a78, 0x00000a85,
+    0x00000a92, 0x00000a9f, 0x00000aac, 0x00000ab9,
+    0x00000ac6, 0x00000ad3, 0x00000ae0, 0x00000aed,
+    0x00000afa, 0x00000b07, 0x00000b14, 0x00000b21,
+    0x00000b2e, 0x00000b3b, 0x00000b48, 0x00000b55,
+    0x00000b62, 0x00000b6f, 0x00000b7c, 0x00000b89,
+    0x00000b96, 0x00000ba3, 0x00000bb0, 0x00000bbd,
+    0x00000bca, 0x00000bd7, 0x00000be4, 0x00000bf1,
+    0x00000bfe, 0x00000c0b, 0x00000c18, 0x00000c25,
+    0x00000c32, 0x00000c3f, 0x00000c4c, 0x00000c59,
+    0x00000c66, 0x00000c73, 0x00000c80, 0x656c6966,
+    0x31303030, 0x7478742e, 0x656c6966, 0x32303030,
+    0x7478742e, 0x656c6966, 0x33303030, 0x7478742e,
+    0x656c6966, 0x34303030, 0x7478742e, 0x656c6966,
+    0x35303030, 0x7478742e, 0x656c6966, 0x36303030,
+    0x7478742e, 0x656c6966, 0x37303030, 0x7478742e,
+    0x656c6966, 0x38303030, 0x7478742e, 0x656c6966,
+    0x39303030, 0x7478742e, 0x656c6966, 0x30313030,
+    0x7478742e, 0x656c6966, 0x31313030, 0x7478742e,
+    0x656c6966, 0x32313030, 0x7478742e, 0x656c6966,
+    0x33313030, 0x7478742e, 0x656c6966, 0x34313030,
+    0x7478742e, 0x656c6966, 0x35313030, 0x7478742e,
+    0x656c6966, 0x36313030, 0x7478742e, 0x656c6966,
+    0x37313030, 0x7478742e, 0x656c6966, 0x38313030,
+    0x7478742e, 0x656c6966, 0x39313030, 0x7478742e,
+    0x656c6966, 0x30323030, 0x7478742e, 0x656c6966,
+    0x31323030, 0x7478742e, 0x656c6966, 0x32323030,
+    0x7478742e, 0x656c6966, 0x33323030, 0x7478742e,
+    0x656c6966, 0x34323030, 0x7478742e, 0x656c6966,
+    0x35323030, 0x7478742e, 0x656c6966, 0x36323030,
+    0x7478742e, 0x656c6966, 0x37323030, 0x7478742e,
+    0x656c6966, 0x38323030, 0x7478742e, 0x656c6966,
+    0x39323030, 0x7478742e, 0x656c6966, 0x30333030,
+    0x7478742e, 0x656c6966, 0x31333030, 0x7478742e,
+    0x656c6966, 0x32333030, 0x7478742e, 0x656c6966,
+    0x33333030, 0x7478742e, 0x656c6966, 0x34333030,
+    0x7478742e, 0x656c6966, 0x35333030, 0x7478742e,
+    0x656c6966, 0x36333030, 0x7478742e, 0x656c6966,
+    0x37333030, 0x7478742e, 0x656c6966, 0x38333030,
+    0x7478742e, 0x656c6966, 0x39333030, 0x7478742e,
+    0x656c6966, 0x30343030, 0x7478742e, 0x656c6966,
+    0x31343030, 0x7478742e, 0x656c6966, 0x32343030,
+    0x7478742e, 0x656c6966, 0x33343030, 0x7478742e,
+    0x656c6966, 0x34343030, 0x7478742e, 0x656c6966,
+    0x35343030, 0x7478742e, 0x656c6966, 0x36343030,
+    0x7478742e, 0x656c6966, 0x37343030, 0x7478742e,
+    0x656c6966, 0x38343030, 0x7478742e, 0x656c6966,
+    0x39343030, 0x7478742e, 0x656c6966, 0x30353030,
+    0x7478742e, 0x656c6966, 0x31353030, 0x7478742e,
+    0x656c6966, 0x32353030, 0x7478742e, 0x656c6966,
+    0x33353030, 0x7478742e, 0x656c6966, 0x34353030,
+    0x7478742e, 0x656c6966, 0x35353030, 0x7478742e,
+    0x656c6966, 0x36353030, 0x7478742e, 0x656c6966,
+    0x37353030, 0x7478742e, 0x656c6966, 0x38353030,
+    0x7478742e, 0x656c6966, 0x39353030, 0x7478742e,
+    0x656c6966, 0x30363030, 0x7478742e, 0x656c6966,
+    0x31363030, 0x7478742e, 0x656c6966, 0x32363030,
+    0x7478742e, 0x656c6966, 0x33363030, 0x7478742e,
+    0x656c6966, 0x34363030, 0x7478742e, 0x656c6966,
+    0x35363030, 0x7478742e, 0x656c6966, 0x36363030,
+    0x7478742e, 0x656c6966, 0x37363030, 0x7478742e,
+    0x656c6966, 0x38363030, 0x7478742e, 0x656c6966,
+    0x39363030, 0x7478742e, 0x656c6966, 0x30373030,
+    0x7478742e, 0x656c6966, 0x31373030, 0x7478742e,
+    0x656c6966, 0x32373030, 0x7478742e, 0x656c6966,
+    0x33373030, 0x7478742e, 0x656c6966, 0x34373030,
+    0x7478742e, 0x656c6966, 0x35373030, 0x7478742e,
+    0x656c6966, 0x36373030, 0x7478742e, 0x656c6966,
+    0x37373030, 0x7478742e, 0x656c6966, 0x38373030,
+    0x7478742e, 0x656c6966, 0x39373030, 0x7478742e,
+    0x656c6966, 0x30383030, 0x7478742e, 0x656c6966,
+    0x31383030, 0x7478742e, 0x656c6966, 0x32383030,
+    0x7478742e, 0x656c6966, 0x33383030, 0x7478742e,
+    0x656c6966, 0x34383030, 0x7478742e, 0x656c6966,
+    0x35383030, 0x7478742e, 0x656c6966, 0x36383030,
+    0x7478742e, 0x656c6966, 0x37383030, 0x7478742e,
+    0x656c6966, 0x38383030, 0x7478742e, 0x656c6966,
+    0x39383030, 0x7478742e, 0x656c6966, 0x30393030,
+    0x7478742e, 0x656c6966, 0x31393030, 0x7478742e,
+    0x656c6966, 0x32393030, 0x7478742e, 0x656c6966,
+    0x33393030, 0x7478742e, 0x656c6966, 0x34393030,
+    0x7478742e, 0x656c6966, 0x35393030, 0x7478742e,
+    0x656c6966, 0x36393030, 0x7478742e, 0x656c6966,
+    0x37393030, 0x7478742e, 0x656c6966, 0x38393030,
+    0x7478742e, 0x656c6966, 0x39393030, 0x7478742e,
+    0x656c6966, 0x30303130, 0x7478742e, 0x656c6966,
+    0x31303130, 0x7478742e, 0x656c6966, 0x32303130,
+    0x7478742e, 0x656c6966, 0x33303130, 0x7478742e,
+    0x656c6966, 0x34303130, 0x7478742e, 0x656c6966,
+    0x35303130, 0x7478742e, 0x656c6966, 0x36303130,
+    0x7478742e, 0x656c6966, 0x37303130, 0x7478742e,
+    0x656c6966, 0x38303130, 0x7478742e, 0x656c6966,
+    0x39303130, 0x7478742e, 0x656c6966, 0x30313130,
+    0x7478742e, 0x656c6966, 0x31313130, 0x7478742e,
+    0x656c6966, 0x32313130, 0x7478742e, 0x656c6966,
+    0x33313130, 0x7478742e, 0x656c6966, 0x34313130,
+    0x7478742e, 0x656c6966, 0x35313130, 0x7478742e,
+    0x656c6966, 0x36313130, 0x7478742e, 0x656c6966,
+    0x37313130, 0x7478742e, 0x656c6966, 0x38313130,
+    0x7478742e, 0x656c6966, 0x39313130, 0x7478742e,
+    0x656c6966, 0x30323130, 0x7478742e, 0x656c6966,
+    0x31323130, 0x7478742e, 0x656c6966, 0x32323130,
+    0x7478742e, 0x656c6966, 0x33323130, 0x7478742e,
+    0x656c6966, 0x34323130, 0x7478742e, 0x656c6966,
+    0x35323130, 0x7478742e, 0x656c6966, 0x36323130,
+    0x7478742e, 0x656c6966, 0x37323130, 0x7478742e,
+    0x656c6966, 0x38323130, 0x7478742e, 0x656c6966,
+    0x31303030, 0x7478742e, 0x6c69660a, 0x30303065,
+    0x78742e32, 0x69660a74, 0x3030656c, 0x742e3330,
+    0x660a7478, 0x30656c69, 0x2e343030, 0x0a747874,
+    0x656c6966, 0x35303030, 0x7478742e, 0x6c69660a,
+    0x30303065, 0x78742e36, 0x69660a74, 0x3030656c,
+    0x742e3730, 0x660a7478, 0x30656c69, 0x2e383030,
+    0x0a747874, 0x656c6966, 0x39303030, 0x7478742e,
+    0x6c69660a, 0x31303065, 0x78742e30, 0x69660a74,
+    0x3030656c, 0x742e3131, 0x660a7478, 0x30656c69,
+    0x2e323130, 0x0a747874, 0x656c6966, 0x33313030,
+    0x7478742e, 0x6c69660a, 0x31303065, 0x78742e34,
+    0x69660a74, 0x3030656c, 0x742e3531, 0x660a7478,
+    0x30656c69, 0x2e363130, 0x0a747874, 0x656c6966,
+    0x37313030, 0x7478742e, 0x6c69660a, 0x31303065,
+    0x78742e38, 0x69660a74, 0x3030656c, 0x742e3931,
+    0x660a7478, 0x30656c69, 0x2e303230, 0x0a747874,
+    0x656c6966, 0x31323030, 0x7478742e, 0x6c69660a,
+    0x32303065, 0x78742e32, 0x69660a74, 0x3030656c,
+    0x742e3332, 0x660a7478, 0x30656c69, 0x2e343230,
+    0x0a747874, 0x656c6966, 0x35323030, 0x7478742e,
+    0x6c69660a, 0x32303065, 0x78742e36, 0x69660a74,
+    0x3030656c, 0x742e3732, 0x660a7478, 0x30656c69,
+    0x2e383230, 0x0a747874, 0x656c6966, 0x39323030,
+    0x7478742e, 0x6c69660a, 0x33303065, 0x78742e30,
+    0x69660a74, 0x3030656c, 0x742e3133, 0x660a7478,
+    0x30656c69, 0x2e323330, 0x0a747874, 0x656c6966,
+    0x33333030, 0x7478742e, 0x6c69660a, 0x33303065,
+    0x78742e34, 0x69660a74, 0x3030656c, 0x742e3533,
+    0x660a7478, 0x30656c69, 0x2e363330, 0x0a747874,
+    0x656c6966, 0x37333030, 0x7478742e, 0x6c69660a,
+    0x33303065, 0x78742e38, 0x69660a74, 0x3030656c,
+    0x742e3933, 0x660a7478, 0x30656c69, 0x2e303430,
+    0x0a747874, 0x656c6966, 0x31343030, 0x7478742e,
+    0x6c69660a, 0x34303065, 0x78742e32, 0x69660a74,
+    0x3030656c, 0x742e3334, 0x660a7478, 0x30656c69,
+    0x2e343430, 0x0a747874, 0x656c6966, 0x35343030,
+    0x7478742e, 0x6c69660a, 0x34303065, 0x78742e36,
+    0x69660a74, 0x3030656c, 0x742e3734, 0x660a7478,
+    0x30656c69, 0x2e383430, 0x0a747874, 0x656c6966,
+    0x39343030, 0x7478742e, 0x6c69660a, 0x35303065,
+    0x78742e30, 0x69660a74, 0x3030656c, 0x742e3135,
+    0x660a7478, 0x30656c69, 0x2e323530, 0x0a747874,
+    0x656c6966, 0x33353030, 0x7478742e, 0x6c69660a,
+    0x35303065, 0x78742e34, 0x69660a74, 0x3030656c,
+    0x742e3535, 0x660a7478, 0x30656c69, 0x2e363530,
+    0x0a747874, 0x656c6966, 0x37353030, 0x7478742e,
+    0x6c69660a, 0x35303065, 0x78742e38, 0x69660a74,
+    0x3030656c, 0x742e3935, 0x660a7478, 0x30656c69,
+    0x2e303630, 0x0a747874, 0x656c6966, 0x31363030,
+    0x7478742e, 0x6c69660a, 0x36303065, 0x78742e32,
+    0x69660a74, 0x3030656c, 0x742e3336, 0x660a7478,
+    0x30656c69, 0x2e343630, 0x0a747874, 0x656c6966,
+    0x35363030, 0x7478742e, 0x6c69660a, 0x36303065,
+    0x78742e36, 0x69660a74, 0x3030656c, 0x742e3736,
+    0x660a7478, 0x30656c69, 0x2e383630, 0x0a747874,
+    0x656c6966, 0x39363030, 0x7478742e, 0x6c69660a,
+    0x37303065, 0x78742e30, 0x69660a74, 0x3030656c,
+    0x742e3137, 0x660a7478, 0x30656c69, 0x2e323730,
+    0x0a747874, 0x656c6966, 0x33373030, 0x7478742e,
+    0x6c69660a, 0x37303065, 0x78742e34, 0x69660a74,
+    0x3030656c, 0x742e3537, 0x660a7478, 0x30656c69,
+    0x2e363730, 0x0a747874, 0x656c6966, 0x37373030,
+    0x7478742e, 0x6c69660a, 0x37303065, 0x78742e38,
+    0x69660a74, 0x3030656c, 0x742e3937, 0x660a7478,
+    0x30656c69, 0x2e303830, 0x0a747874, 0x656c6966,
+    0x31383030, 0x7478742e, 0x6c69660a, 0x38303065,
+    0x78742e32, 0x69660a74, 0x3030656c, 0x742e3338,
+    0x660a7478, 0x30656c69, 0x2e343830, 0x0a747874,
+    0x656c6966, 0x35383030, 0x7478742e, 0x6c69660a,
+    0x38303065, 0x78742e36, 0x69660a74, 0x3030656c,
+    0x742e3738, 0x660a7478, 0x30656c69, 0x2e383830,
+    0x0a747874, 0x656c6966, 0x39383030, 0x7478742e,
+    0x6c69660a, 0x39303065, 0x78742e30, 0x69660a74,
+    0x3030656c, 0x742e3139, 0x660a7478, 0x30656c69,
+    0x2e323930, 0x0a747874, 0x656c6966, 0x33393030,
+    0x7478742e, 0x6c69660a, 0x39303065, 0x78742e34,
+    0x69660a74, 0x3030656c, 0x742e3539, 0x660a7478,
+    0x30656c69, 0x2e363930, 0x0a747874, 0x656c6966,
+    0x37393030, 0x7478742e, 0x6c69660a, 0x39303065,
+    0x78742e38, 0x69660a74, 0x3030656c, 0x742e3939,
+    0x660a7478, 0x30656c69, 0x2e303031, 0x0a747874,
+    0x656c6966, 0x31303130, 0x7478742e, 0x6c69660a,
+    0x30313065, 0x78742e32, 0x69660a74, 0x3130656c,
+    0x742e3330, 0x660a7478, 0x30656c69, 0x2e343031,
+    0x0a747874, 0x656c6966, 0x35303130, 0x7478742e,
+    0x6c69660a, 0x30313065, 0x78742e36, 0x69660a74,
+    0x3130656c, 0x742e3730, 0x660a7478, 0x30656c69,
+    0x2e383031, 0x0a747874, 0x656c6966, 0x39303130,
+    0x7478742e, 0x6c69660a, 0x31313065, 0x78742e30,
+    0x69660a74, 0x3130656c, 0x742e3131, 0x660a7478,
+    0x30656c69, 0x2e323131, 0x0a747874, 0x656c6966,
+    0x33313130, 0x7478742e, 0x6c69660a, 0x31313065,
+    0x78742e34, 0x69660a74, 0x3130656c, 0x742e3531,
+    0x660a7478, 0x30656c69, 0x2e363131, 0x0a747874,
+    0x656c6966, 0x37313130, 0x7478742e, 0x6c69660a,
+    0x31313065, 0x78742e38, 0x69660a74, 0x3130656c,
+    0x742e3931, 0x660a7478, 0x30656c69, 0x2e303231,
+    0x0a747874, 0x656c6966, 0x31323130, 0x7478742e,
+    0x6c69660a, 0x32313065, 0x78742e32, 0x69660a74,
+    0x3130656c, 0x742e3332, 0x660a7478, 0x30656c69,
+    0x2e343231, 0x0a747874, 0x656c6966, 0x35323130,
+    0x7478742e, 0x6c69660a, 0x32313065, 0x78742e36,
+    0x69660a74, 0x3130656c, 0x742e3732, 0x660a7478,
+    0x30656c69, 0x2e383231, 0x0a747874,
+};
+
+static const int bench_fs_128_size = sizeof (bench_fs_128);
\ No newline at end of file
@@ -0,0 +1,57 @@
+/* Auto-generated ROM FS from:
+ *  - file0001.txt
+ *  - file0002.txt
+ *  - file0003.txt
+ *  - file0004.txt
+ *  - file0005.txt
+ *  - file0006.txt
+ *  - file0007.txt
+ *  - file0008.txt
+ *  - file0009.txt
+ *  - file0010.txt
+ *  - file0011.txt
+ *  - file0012.txt
+ *  - file0013.txt
+ *  - file0014.txt
+ *  - file0015.txt
+ *  - file0016.txt
+ */
+
+static const uint32_t bench_fs_16[] = {
+    0x466d6f52, 0x00000010, 0x00000000, 0x0000000c,
+    0x00000018, 0x00000024, 0x00000030, 0x0000003c,
+    0x00000048, 0x00000054, 0x00000060, 0x0000006c,
+    0x00000078, 0x00000084, 0x00000090, 0x0000009c,
+    0x000000a8, 0x000000b4, 0x000000c0, 0x000000cd,
+    0x000000da, 0x000000e7, 0x000000f4, 0x00000101,
+    0x0000010e, 0x0000011b, 0x00000128, 0x00000135,
+    0x00000142, 0x0000014f, 0x0000015c, 0x00000169,
+    0x00000176, 0x00000183, 0x00000190, 0x656c6966,
+    0x31303030, 0x7478742e, 0x656c6966, 0x32303030,
+    0x7478742e, 0x656c6966, 0x33303030, 0x7478742e,
+    0x656c6966, 0x34303030, 0x7478742e, 0x656c6966,
+    0x35303030, 0x7478742e, 0x656c6966, 0x36303030,
+    0x7478742e, 0x656c6966, 0x37303030, 0x7478742e,
+    0x656c6966, 0x38303030, 0x7478742e, 0x656c6966,
+    0x39303030, 0x7478742e, 0x656c6966, 0x30313030,
+    0x7478742e, 0x656c6966, 0x31313030, 0x7478742e,
+    0x656c6966, 0x32313030, 0x7478742e, 0x656c6966,
+    0x33313030, 0x7478742e, 0x656c6966, 0x34313030,
+    0x7478742e, 0x656c6966, 0x35313030, 0x7478742e,
+    0x656c6966, 0x36313030, 0x7478742e, 0x656c6966,
+    0x31303030, 0x7478742e, 0x6c69660a, 0x30303065,
+    0x78742e32, 0x69660a74, 0x3030656c, 0x742e3330,
+    0x660a7478, 0x30656c69, 0x2e343030, 0x0a747874,
+    0x656c6966, 0x35303030, 0x7478742e, 0x6c69660a,
+    0x30303065, 0x78742e36, 0x69660a74, 0x3030656c,
+    0x742e3730, 0x660a7478, 0x30656c69, 0x2e383030,
+    0x0a747874, 0x656c6966, 0x39303030, 0x7478742e,
+    0x6c69660a, 0x31303065, 0x78742e30, 0x69660a74,
+    0x3030656c, 0x742e3131, 0x660a7478, 0x30656c69,
+    0x2e323130, 0x0a747874, 0x656c6966, 0x33313030,
+    0x7478742e, 0x6c69660a, 0x31303065, 0x78742e34,
+    0x69660a74, 0x3030656c, 0x742e3531, 0x660a7478,
+    0x30656c69, 0x2e363130, 0x0a747874,
+};
+
+static const int bench_fs_16_size = sizeof (bench_fs_16);
\ No newline at end of file
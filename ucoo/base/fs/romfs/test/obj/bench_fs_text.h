@@ -0,0 +1,1723 @@
+/* Auto-generated ROM FS from:
+ *  - hello.txt
+ *  - mkromfs.py
+ *  - romfs.cc
+ *  - romfs.hh
+ */
+
+static const uint32_t bench_fs_text[] = {
+    0x466d6f52, 0x00000004, 0x00000000, 0x00000009,
+    0x00000013, 0x0000001b, 0x00000023, 0x0000008f,
+    0x0000224a, 0x00004e4e, 0x00006acb, 0x6c6c6568,
+    0x78742e6f, 0x726b6d74, 0x73666d6f, 0x7279702e,
+    0x73666d6f, 0x7263632e, 0x73666d6f, 0x4868682e,
+    0x6f6c6c65, 0x726f7720, 0x0a21646c, 0x65482020,
+    0x206f6c6c, 0x6c726f77, 0x200a2164, 0x48202020,
+    0x6f6c6c65, 0x726f7720, 0x0a21646c, 0x20202020,
+    0x65482020, 0x206f6c6c, 0x6c726f77, 0x200a2164,
+    0x20202020, 0x48202020, 0x6f6c6c65, 0x726f7720,
+    0x0a21646c, 0x20202020, 0x20202020, 0x65482020,
+    0x206f6c6c, 0x6c726f77, 0x230a2164, 0x73752f21,
+    0x69622f72, 0x79702f6e, 0x6e6f6874, 0x220a230a,
+    0x65472222, 0x6172656e, 0x61206574, 0x4d4f5220,
+    0x6c696620, 0x79732065, 0x6d657473, 0x2222222e,
+    0x230a230a, 0x706f4320, 0x67697279, 0x28207468,
+    0x32202943, 0x20353130, 0x6f63694e, 0x2073616c,
+    0x6f686353, 0x0a746564, 0x20230a23, 0x6d726550,
+    0x69737369, 0x69206e6f, 0x65682073, 0x79626572,
+    0x61726720, 0x6465746e, 0x7266202c, 0x6f206565,
+    0x68632066, 0x65677261, 0x6f74202c, 0x796e6120,
+    0x72657020, 0x206e6f73, 0x6174626f, 0x6e696e69,
+    0x20612067, 0x79706f63, 0x6f20230a, 0x68742066,
+    0x73207369, 0x7774666f, 0x20657261, 0x20646e61,
+    0x6f737361, 0x74616963, 0x64206465, 0x6d75636f,
+    0x61746e65, 0x6e6f6974, 0x6c696620, 0x28207365,
+    0x20656874, 0x666f5322, 0x72617774, 0x2c292265,
+    0x0a6f7420, 0x65642023, 0x69206c61, 0x6874206e,
+    0x6f532065, 0x61777466, 0x77206572, 0x6f687469,
+    0x72207475, 0x72747365, 0x69746369, 0x202c6e6f,
+    0x6c636e69, 0x6e696475, 0x69772067, 0x756f6874,
+    0x696c2074, 0x6174696d, 0x6e6f6974, 0x65687420,
+    0x7220230a, 0x74686769, 0x6f742073, 0x65737520,
+    0x6f63202c, 0x202c7970, 0x69646f6d, 0x202c7966,
+    0x6772656d, 0x70202c65, 0x696c6275, 0x202c6873,
+    0x74736964, 0x75626972, 0x202c6574, 0x6c627573,
+    0x6e656369, 0x202c6573, 0x2f646e61, 0x230a726f,
+    0x6c657320, 0x6f63206c, 0x73656970, 0x20666f20,
+    0x20656874, 0x74666f53, 0x65726177, 0x6e61202c,
+    0x6f742064, 0x72657020, 0x2074696d, 0x73726570,
+    0x20736e6f, 0x77206f74, 0x206d6f68, 0x20656874,
+    0x74666f53, 0x65726177, 0x0a736920, 0x75662023,
+    0x73696e72, 0x20646568, 0x64206f74, 0x6f73206f,
+    0x7573202c, 0x63656a62, 0x6f742074, 0x65687420,
+    0x6c6f6620, 0x69776f6c, 0x6320676e, 0x69646e6f,
+    0x6e6f6974, 0x230a3a73, 0x5420230a, 0x61206568,
+    0x65766f62, 0x706f6320, 0x67697279, 0x6e207468,
+    0x6369746f, 0x6e612065, 0x68742064, 0x70207369,
+    0x696d7265, 0x6f697373, 0x6f6e206e, 0x65636974,
+    0x61687320, 0x62206c6c, 0x6e692065, 0x64756c63,
+    0x69206465, 0x20230a6e, 0x206c6c61, 0x69706f63,
+    0x6f207365, 0x75732072, 0x61747362, 0x6169746e,
+    0x6f70206c, 0x6f697472, 0x6f20736e, 0x68742066,
+    0x6f532065, 0x61777466, 0x0a2e6572, 0x20230a23,
+    0x20454854, 0x54464f53, 0x45524157, 0x20534920,
+    0x564f5250, 0x44454449, 0x53412220, 0x22534920,
+    0x4957202c, 0x554f4854, 0x41572054, 0x4e415252,
+    0x4f205954, 0x4e412046, 0x494b2059, 0x202c444e,
+    0x52505845, 0x20535345, 0x230a524f, 0x504d4920,
+    0x4445494c, 0x4e49202c, 0x44554c43, 0x20474e49,
+    0x20545542, 0x20544f4e, 0x494d494c, 0x20444554,
+    0x54204f54, 0x57204548, 0x41525241, 0x4549544e,
+    0x464f2053, 0x52454d20, 0x4e414843, 0x49424154,
+    0x5954494c, 0x20230a2c, 0x4e544946, 0x20535345,
+    0x20524f46, 0x41502041, 0x43495452, 0x52414c55,
+    0x52555020, 0x45534f50, 0x444e4120, 0x4e4f4e20,
+    0x52464e49, 0x45474e49, 0x544e454d, 0x4e49202e,
+    0x204f4e20, 0x4e455645, 0x48532054, 0x204c4c41,
+    0x0a454854, 0x55412023, 0x524f4854, 0x524f2053,
+    0x504f4320, 0x47495259, 0x48205448, 0x45444c4f,
+    0x42205352, 0x494c2045, 0x454c4241, 0x524f4620,
+    0x594e4120, 0x414c4320, 0x202c4d49, 0x414d4144,
+    0x20534547, 0x4f20524f, 0x52454854, 0x4c20230a,
+    0x49424149, 0x5954494c, 0x4857202c, 0x45485445,
+    0x4e492052, 0x204e4120, 0x49544341, 0x4f204e4f,
+    0x4f432046, 0x4152544e, 0x202c5443, 0x54524f54,
+    0x20524f20, 0x4548544f, 0x53495752, 0x41202c45,
+    0x49534952, 0x230a474e, 0x4f524620, 0x4f202c4d,
+    0x4f205455, 0x524f2046, 0x204e4920, 0x4e4e4f43,
+    0x49544345, 0x57204e4f, 0x20485449, 0x20454854,
+    0x54464f53, 0x45524157, 0x20524f20, 0x20454854,
+    0x20455355, 0x4f20524f, 0x52454854, 0x41454420,
+    0x474e494c, 0x20230a53, 0x54204e49, 0x53204548,
+    0x5754464f, 0x2e455241, 0x690a230a, 0x726f706d,
+    0x72612074, 0x72617067, 0x690a6573, 0x726f706d,
+    0x74732074, 0x74637572, 0x706d690a, 0x2074726f,
+    0x0a737973, 0x6f706d69, 0x6f207472, 0x730a0a73,
+    0x702e7379, 0x2e687461, 0x65736e69, 0x30287472,
+    0x736f202c, 0x7461702e, 0x6f6a2e68, 0x6f286e69,
+    0x61702e73, 0x642e6874, 0x616e7269, 0x5f28656d,
+    0x6c69665f, 0x295f5f65, 0x2e27202c, 0x202c272e,
+    0x272e2e27, 0x20200a2c, 0x6c272020, 0x2773737a,
+    0x690a2929, 0x726f706d, 0x7a6c2074, 0x0a0a7373,
+    0x203d2070, 0x70677261, 0x65737261, 0x6772412e,
+    0x6e656d75, 0x72615074, 0x28726573, 0x63736564,
+    0x74706972, 0x3d6e6f69, 0x6f645f5f, 0x295f5f63,
+    0x612e700a, 0x615f6464, 0x6d756772, 0x28746e65,
+    0x276f2d27, 0x2d27202c, 0x74756f2d, 0x27747570,
+    0x7974202c, 0x613d6570, 0x61706772, 0x2e657372,
+    0x656c6946, 0x65707954, 0x27772728, 0x200a2c29,
+    0x20202020, 0x64202020, 0x75616665, 0x733d746c,
+    0x732e7379, 0x756f6474, 0x200a2c74, 0x20202020,
+    0x6d202020, 0x76617465, 0x273d7261, 0x454c4946,
+    0x68202c27, 0x3d706c65, 0x74756f27, 0x20747570,
+    0x656c6966, 0x700a2927, 0x6464612e, 0x6772615f,
+    0x6e656d75, 0x2d272874, 0x202c2769, 0x682d2d27,
+    0x65646165, 0x202c2772, 0x6174656d, 0x3d726176,
+    0x52415627, 0x454d414e, 0x200a2c27, 0x20202020,
+    0x68202020, 0x3d706c65, 0x6e656727, 0x74617265,
+    0x20432065, 0x64616568, 0x66207265, 0x27656c69,
+    0x2e700a29, 0x5f646461, 0x75677261, 0x746e656d,
+    0x702d2728, 0x27202c27, 0x65732d2d, 0x68637261,
+    0x7461702d, 0x202c2768, 0x69746361, 0x273d6e6f,
+    0x65707061, 0x2c27646e, 0x74656d20, 0x72617661,
+    0x4150273d, 0x2c274854, 0x2020200a, 0x20202020,
+    0x66656420, 0x746c7561, 0x5b203d20, 0x200a2c5d,
+    0x20202020, 0x68202020, 0x3d706c65, 0x61657327,
+    0x20686372, 0x656c6966, 0x6e692073, 0x54415020,
+    0x63202c48, 0x62206e61, 0x73752065, 0x73206465,
+    0x72657665, 0x74206c61, 0x73656d69, 0x700a2927,
+    0x6464612e, 0x6772615f, 0x6e656d75, 0x2d272874,
+    0x202c2748, 0x682d2d27, 0x27687361, 0x6361202c,
+    0x6e6f6974, 0x7473273d, 0x5f65726f, 0x65757274,
+    0x200a2c27, 0x20202020, 0x68202020, 0x3d706c65,
+    0x64646127, 0x68206120, 0x20687361, 0x6c626174,
+    0x6f662065, 0x61662072, 0x72657473, 0x6f6f6c20,
+    0x2770756b, 0x2e700a29, 0x5f646461, 0x75677261,
+    0x746e656d, 0x7a2d2728, 0x27202c27, 0x6f632d2d,
+    0x6572706d, 0x2c277373, 0x74636120, 0x3d6e6f69,
+    0x6f747327, 0x745f6572, 0x27657572, 0x20200a2c,
+    0x20202020, 0x65682020, 0x273d706c, 0x706d6f63,
+    0x73736572, 0x6c696620, 0x202c7365, 0x6e656877,
+    0x69687420, 0x61732073, 0x20736576, 0x63617073,
+    0x0a292765, 0x64612e70, 0x72615f64, 0x656d7567,
+    0x2728746e, 0x7a6c2d2d, 0x772d7373, 0x6f646e69,
+    0x69622d77, 0x2c277374, 0x70797420, 0x6e693d65,
+    0x64202c74, 0x75616665, 0x6c3d746c, 0x2e73737a,
+    0x444e4957, 0x425f574f, 0x2c535449, 0x2020200a,
+    0x20202020, 0x74656d20, 0x72617661, 0x4942273d,
+    0x2c275354, 0x6c656820, 0x4c273d70, 0x2053535a,
+    0x646e6977, 0x7320776f, 0x2c657a69, 0x73756d20,
+    0x616d2074, 0x20686374, 0x6f636564, 0x27726564,
+    0x2020200a, 0x20202020, 0x63202720, 0x69666e6f,
+    0x61727567, 0x6e6f6974, 0x700a2927, 0x6464612e,
+    0x6772615f, 0x6e656d75, 0x2d272874, 0x737a6c2d,
+    0x6f6c2d73, 0x68616b6f, 0x2d646165, 0x73746962,
+    0x74202c27, 0x3d657079, 0x2c746e69, 0x2020200a,
+    0x20202020, 0x66656420, 0x746c7561, 0x737a6c3d,
+    0x4f4c2e73, 0x48414b4f, 0x5f444145, 0x53544942,
+    0x656d202c, 0x61766174, 0x42273d72, 0x27535449,
+    0x20200a2c, 0x20202020, 0x65682020, 0x273d706c,
+    0x53535a4c, 0x78616d20, 0x6d756d69, 0x74616d20,
+    0x6c206863, 0x74676e65, 0x6d202c68, 0x20747375,
+    0x6374616d, 0x65642068, 0x65646f63, 0x6f632072,
+    0x6769666e, 0x74617275, 0x276e6f69, 0x2e700a29,
+    0x5f646461, 0x75677261, 0x746e656d, 0x612d2728,
+    0x27202c27, 0x6c612d2d, 0x276e6769, 0x7974202c,
+    0x693d6570, 0x202c746e, 0x61666564, 0x3d746c75,
+    0x6d202c31, 0x76617465, 0x273d7261, 0x45545942,
+    0x0a2c2753, 0x20202020, 0x20202020, 0x706c6568,
+    0x6c61273d, 0x206e6769, 0x656c6966, 0x6e6f6320,
+    0x746e6574, 0x61202c73, 0x776f7020, 0x6f207265,
+    0x77742066, 0x7075206f, 0x206f7420, 0x29273233,
+    0x612e700a, 0x615f6464, 0x6d756772, 0x28746e65,
+    0x612d2d27, 0x6e67696c, 0x7478652d, 0x61202c27,
+    0x6f697463, 0x61273d6e, 0x6e657070, 0x202c2764,
+    0x61666564, 0x3d746c75, 0x0a2c5d5b, 0x20202020,
+    0x20202020, 0x6174656d, 0x3d726176, 0x54584527,
+    0x5459423d, 0x2c275345, 0x6c656820, 0x61273d70,
+    0x6e67696c, 0x6c696620, 0x6f632065, 0x6e65746e,
+    0x66207374, 0x6620726f, 0x73656c69, 0x74697720,
+    0x68742068, 0x200a2765, 0x20202020, 0x27202020,
+    0x76696720, 0x65206e65, 0x6e657478, 0x6e6f6973,
+    0x6163202c, 0x6562206e, 0x65737520, 0x65732064,
+    0x61726576, 0x6974206c, 0x2773656d, 0x2e700a29,
+    0x5f646461, 0x75677261, 0x746e656d, 0x642d2728,
+    0x27202c27, 0x65642d2d, 0x27707564, 0x6361202c,
+    0x6e6f6974, 0x7473273d, 0x5f65726f, 0x65757274,
+    0x200a2c27, 0x20202020, 0x68202020, 0x3d706c65,
+    0x6f747327, 0x69206572, 0x746e6564, 0x6c616369,
+    0x6c696620, 0x6f632065, 0x6e65746e, 0x6f207374,
+    0x20796c6e, 0x65636e6f, 0x700a2927, 0x6464612e,
+    0x6772615f, 0x6e656d75, 0x2d272874, 0x202c2776,
+    0x762d2d27, 0x6f627265, 0x2c276573, 0x74636120,
+    0x3d6e6f69, 0x6f747327, 0x745f6572, 0x27657572,
+    0x20200a2c, 0x20202020, 0x65682020, 0x273d706c,
+    0x6f706572, 0x63207472, 0x72706d6f, 0x69737365,
+    0x72206e6f, 0x6f697461, 0x646e6120, 0x616d6920,
+    0x73206567, 0x20657a69, 0x73206e6f, 0x646e6174,
+    0x20647261, 0x6f727265, 0x0a292772, 0x64612e70,
+    0x72615f64, 0x656d7567, 0x2728746e, 0x2c27532d,
+    0x2d2d2720, 0x2d746f6e, 0x74617473, 0x2c276369,
+    0x73656420, 0x73273d74, 0x69746174, 0x0a2c2763,
+    0x20202020, 0x20202020, 0x69746361, 0x273d6e6f,
+    0x726f7473, 0x6f635f65, 0x2774736e, 0x6f63202c,
+    0x3d74736e, 0x202c2727, 0x61666564, 0x3d746c75,
+    0x61747327, 0x20636974, 0x200a2c27, 0x20202020,
+    0x68202020, 0x3d706c65, 0x206f6427, 0x20746f6e,
+    0x7074756f, 0x73207475, 0x69746174, 0x656b2063,
+    0x726f7779, 0x0a292764, 0x64612e70, 0x72615f64,
+    0x656d7567, 0x2728746e, 0x656c6966, 0x6e202c27,
+    0x73677261, 0x272a273d, 0x6568202c, 0x273d706c,
+    0x656c6966, 0x206f7420, 0x20747570, 0x66206e69,
+    0x20656c69, 0x74737973, 0x29276d65, 0x74706f0a,
+    0x736e6f69, 0x70203d20, 0x7261702e, 0x615f6573,
+    0x28736772, 0x660a0a29, 0x73656c69, 0x6f203d20,
+    0x6f697470, 0x662e736e, 0x0a656c69, 0x656c6966,
+    0x6f732e73, 0x29287472, 0x65640a0a, 0x6e662066,
+    0x28613176, 0x0a3a2973, 0x20202020, 0x43222222,
+    0x75706d6f, 0x33206574, 0x69622032, 0x4e462074,
+    0x61312d56, 0x73616820, 0x22222e68, 0x20200a22,
+    0x20682020, 0x7830203d, 0x63313138, 0x35636439,
+    0x2020200a, 0x726f6620, 0x69206320, 0x3a73206e,
+    0x2020200a, 0x20202020, 0x3d206820, 0x68282820,
+    0x6f205e20, 0x63286472, 0x2a202929, 0x30783020,
+    0x30303031, 0x29333931, 0x30202620, 0x66666678,
+    0x66666666, 0x20200a66, 0x65722020, 0x6e727574,
+    0x0a0a6820, 0x20666564, 0x68736168, 0x6261745f,
+    0x6628656c, 0x73656c69, 0x200a3a29, 0x22202020,
+    0x614d2222, 0x6120656b, 0x706f206e, 0x61206e65,
+    0x65726464, 0x6e697373, 0x61682067, 0x74206873,
+    0x656c6261, 0x6977202c, 0x61206874, 0x616f6c20,
+    0x61662064, 0x726f7463, 0x20666f20, 0x6d207461,
+    0x2074736f, 0x0a656e6f, 0x20202020, 0x666c6168,
+    0x6572202c, 0x6e727574, 0x73746920, 0x6e696220,
+    0x20797261, 0x72706572, 0x6e657365, 0x69746174,
+    0x222e6e6f, 0x200a2222, 0x61202020, 0x72657373,
+    0x656c2074, 0x6966286e, 0x2973656c, 0x30203c20,
+    0x66666678, 0x20200a66, 0x6c732020, 0x2073746f,
+    0x0a31203d, 0x20202020, 0x6c696877, 0x6c732065,
+    0x2073746f, 0x2032203c, 0x656c202a, 0x6966286e,
+    0x2973656c, 0x20200a3a, 0x20202020, 0x6c732020,
+    0x2073746f, 0x32203d2a, 0x2020200a, 0x62617420,
+    0x3d20656c, 0x5d305b20, 0x73202a20, 0x73746f6c,
+    0x2020200a, 0x726f6620, 0x202c6920, 0x6e692066,
+    0x756e6520, 0x6172656d, 0x66286574, 0x73656c69,
+    0x200a3a29, 0x20202020, 0x73202020, 0x66203d20,
+    0x6131766e, 0x20296628, 0x73282026, 0x73746f6c,
+    0x31202d20, 0x20200a29, 0x20202020, 0x68772020,
+    0x20656c69, 0x6c626174, 0x5d735b65, 0x20200a3a,
+    0x20202020, 0x20202020, 0x20732020, 0x7328203d,
+    0x31202b20, 0x20262029, 0x6f6c7328, 0x2d207374,
+    0x0a293120, 0x20202020, 0x20202020, 0x6c626174,
+    0x5d735b65, 0x69203d20, 0x31202b20, 0x2020200a,
+    0x20666920, 0x746f6c73, 0x20252073, 0x200a3a32,
+    0x20202020, 0x74202020, 0x656c6261, 0x7070612e,
+    0x28646e65, 0x200a2930, 0x72202020, 0x72757465,
+    0x7328206e, 0x63757274, 0x61702e74, 0x27286b63,
+    0x2749493c, 0x6168202c, 0x6d5f6873, 0x63696761,
+    0x6c73202c, 0x2973746f, 0x2020200a, 0x20202020,
+    0x20202020, 0x73202b20, 0x63757274, 0x61702e74,
+    0x27286b63, 0x4864253c, 0x20252027, 0x286e656c,
+    0x6c626174, 0x202c2965, 0x6261742a, 0x2929656c,
+    0x65640a0a, 0x6c612066, 0x6d6e6769, 0x28746e65,
+    0x0a3a2966, 0x20202020, 0x52222222, 0x72757465,
+    0x6874206e, 0x6c612065, 0x6d6e6769, 0x20746e65,
+    0x6465656e, 0x66206465, 0x6120726f, 0x6c696620,
+    0x22222e65, 0x20200a22, 0x6c612020, 0x206e6769,
+    0x706f203d, 0x6e6f6974, 0x6c612e73, 0x0a6e6769,
+    0x20202020, 0x20726f66, 0x6e692061, 0x74706f20,
+    0x736e6f69, 0x696c612e, 0x655f6e67, 0x0a3a7478,
+    0x20202020, 0x20202020, 0x2c747865, 0x74796220,
+    0x3d207365, 0x732e6120, 0x74696c70, 0x273d2728,
+    0x2931202c, 0x2020200a, 0x20202020, 0x20666920,
+    0x6e652e66, 0x69777364, 0x65286874, 0x3a297478,
+    0x2020200a, 0x20202020, 0x20202020, 0x696c6120,
+    0x3d206e67, 0x746e6920, 0x74796228, 0x0a297365,
+    0x20202020, 0x61206669, 0x6e67696c, 0x746f6e20,
+    0x206e6920, 0x202c3128, 0x34202c32, 0x2c38202c,
+    0x2c363120, 0x29323320, 0x20200a3a, 0x20202020,
+    0x2e702020, 0x6f727265, 0x62272872, 0x61206461,
+    0x6e67696c, 0x746e656d, 0x726f6620, 0x3a732520,
+    0x27642520, 0x28202520, 0x61202c66, 0x6e67696c,
+    0x200a2929, 0x72202020, 0x72757465, 0x6c61206e,
+    0x0a6e6769, 0x67616d0a, 0x3d206369, 0x34783020,
+    0x36643636, 0x0a323566, 0x6967616d, 0x32765f63,
+    0x30203d20, 0x36323378, 0x35663664, 0x61680a32,
+    0x6d5f6873, 0x63696761, 0x30203d20, 0x36383478,
+    0x35663664, 0x6f630a32, 0x6572706d, 0x6d5f7373,
+    0x63696761, 0x30203d20, 0x36613578, 0x35663664,
+    0x69730a32, 0x5f73657a, 0x6967616d, 0x203d2063,
+    0x33357830, 0x66366436, 0x0a0a3235, 0x65522023,
+    0x61206461, 0x6320646e, 0x72706d6f, 0x20737365,
+    0x656c6966, 0x630a2e73, 0x65746e6f, 0x2073746e,
+    0x5d5b203d, 0x7a69730a, 0x3d207365, 0x0a5d5b20,
+    0x5f776172, 0x657a6973, 0x30203d20, 0x726f660a,
+    0x69206620, 0x6966206e, 0x3a73656c, 0x2020200a,
+    0x726f6620, 0x69207020, 0x706f206e, 0x6e6f6974,
+    0x65732e73, 0x68637261, 0x7461705f, 0x200a3a68,
+    0x20202020, 0x66202020, 0x203d2070, 0x702e736f,
+    0x2e687461, 0x6e696f6a, 0x202c7028, 0x200a2966,
+    0x20202020, 0x69202020, 0x736f2066, 0x7461702e,
+    0x78652e68, 0x73747369, 0x29706628, 0x20200a3a,
+    0x20202020, 0x20202020, 0x72622020, 0x0a6b6165,
+    0x20202020, 0x65736c65, 0x20200a3a, 0x20202020,
+    0x70662020, 0x66203d20, 0x2020200a, 0x74697720,
+    0x706f2068, 0x66286e65, 0x61202970, 0x64662073,
+    0x20200a3a, 0x20202020, 0x6f632020, 0x6e65746e,
+    0x203d2074, 0x722e6466, 0x28646165, 0x20200a29,
+    0x61722020, 0x69735f77, 0x2b20657a, 0x656c203d,
+    0x6f63286e, 0x6e65746e, 0x200a2974, 0x73202020,
+    0x20657a69, 0x0a30203d, 0x20202020, 0x6f206669,
+    0x6f697470, 0x632e736e, 0x72706d6f, 0x3a737365,
+    0x2020200a, 0x20202020, 0x6d6f6320, 0x73657270,
+    0x20646573, 0x7a6c203d, 0x652e7373, 0x646f636e,
+    0x6f632865, 0x6e65746e, 0x6f202c74, 0x6f697470,
+    0x6c2e736e, 0x5f73737a, 0x646e6977, 0x625f776f,
+    0x2c737469, 0x2020200a, 0x20202020, 0x20202020,
+    0x20202020, 0x74706f20, 0x736e6f69, 0x737a6c2e,
+    0x6f6c5f73, 0x68616b6f, 0x5f646165, 0x73746962,
+    0x20200a29, 0x20202020, 0x66692020, 0x6e656c20,
+    0x6d6f6328, 0x73657270, 0x29646573, 0x6c203c20,
+    0x63286e65, 0x65746e6f, 0x3a29746e, 0x2020200a,
+    0x20202020, 0x20202020, 0x7a697320, 0x203d2065,
+    0x286e656c, 0x746e6f63, 0x29746e65, 0x2020200a,
+    0x20202020, 0x20202020, 0x6e6f6320, 0x746e6574,
+    0x63203d20, 0x72706d6f, 0x65737365, 0x20200a64,
+    0x66692020, 0x74706f20, 0x736e6f69, 0x7265762e,
+    0x65736f62, 0x646e6120, 0x74706f20, 0x736e6f69,
+    0x6d6f632e, 0x73657270, 0x200a3a73, 0x20202020,
+    0x70202020, 0x746e6972, 0x203e3e20, 0x2e737973,
+    0x65647473, 0x202c7272, 0x3a732527, 0x20642520,
+    0x25203e2d, 0x27732564, 0x28202520, 0x73202c66,
+    0x20657a69, 0x6c20726f, 0x63286e65, 0x65746e6f,
+    0x2c29746e, 0x2020200a, 0x20202020, 0x20202020,
+    0x20202020, 0x6e656c20, 0x6e6f6328, 0x746e6574,
+    0x27202c29, 0x2e252820, 0x27296633, 0x28202520,
+    0x616f6c66, 0x656c2874, 0x6f63286e, 0x6e65746e,
+    0x20292974, 0x6973202f, 0x0a29657a, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x73206669,
+    0x20657a69, 0x65736c65, 0x29272720, 0x2020200a,
+    0x6e6f6320, 0x746e6574, 0x70612e73, 0x646e6570,
+    0x6e6f6328, 0x746e6574, 0x20200a29, 0x69732020,
+    0x2e73657a, 0x65707061, 0x7328646e, 0x29657a69,
+    0x20230a0a, 0x73726556, 0x206e6f69, 0x73692032,
+    0x65656e20, 0x20646564, 0x6e656877, 0x6c696620,
+    0x6f632065, 0x6e65746e, 0x61207374, 0x6e206572,
+    0x6320746f, 0x69746e6f, 0x756f7567, 0x63203a73,
+    0x65746e6f, 0x2073746e, 0x2079616d, 0x230a6562,
+    0x61687320, 0x20646572, 0x20646e61, 0x64646170,
+    0x20676e69, 0x2079616d, 0x69206562, 0x7265736e,
+    0x2e646574, 0x65482020, 0x72656461, 0x73616820,
+    0x656e6f20, 0x726f6d20, 0x6e692065, 0x2c786564,
+    0x20736120, 0x656c6966, 0x6320230a, 0x65746e6f,
+    0x2073746e, 0x72617473, 0x73692074, 0x746f6e20,
+    0x65687420, 0x646e6520, 0x20666f20, 0x656c6966,
+    0x6d616e20, 0x202c7365, 0x20646e61, 0x65732061,
+    0x6f697463, 0x6967206e, 0x20736576, 0x656c6966,
+    0x7320230a, 0x73657a69, 0x32760a2e, 0x62203d20,
+    0x286c6f6f, 0x6974706f, 0x2e736e6f, 0x75646564,
+    0x726f2070, 0x74706f20, 0x736e6f69, 0x696c612e,
+    0x21206e67, 0x2031203d, 0x6f20726f, 0x6f697470,
+    0x612e736e, 0x6e67696c, 0x7478655f, 0x616e0a29,
+    0x2073656d, 0x2727203d, 0x696f6a2e, 0x6966286e,
+    0x2973656c, 0x6165680a, 0x5f726564, 0x657a6973,
+    0x34203d20, 0x28202a20, 0x202b2033, 0x202a2032,
+    0x286e656c, 0x656c6966, 0x2b202973, 0x20312820,
+    0x76206669, 0x6c652032, 0x30206573, 0x690a2929,
+    0x7865646e, 0x3d207365, 0x5d305b20, 0x646e690a,
+    0x3d207865, 0x660a3020, 0x6620726f, 0x206e6920,
+    0x656c6966, 0x200a3a73, 0x69202020, 0x7865646e,
+    0x203d2b20, 0x286e656c, 0x200a2966, 0x69202020,
+    0x7865646e, 0x612e7365, 0x6e657070, 0x6e692864,
+    0x29786564, 0x7461640a, 0x203d2061, 0x6d616e5b,
+    0x0a5d7365, 0x7366666f, 0x20737465, 0x5d5b203d,
+    0x7461640a, 0x61705f61, 0x6e696464, 0x203d2067,
+    0x65640a30, 0x5f707564, 0x65766173, 0x203d2064,
+    0x6c620a30, 0x2073626f, 0x7d7b203d, 0x726f660a,
+    0x202c6620, 0x746e6f63, 0x2c746e65, 0x7a697320,
+    0x6e692065, 0x70697a20, 0x6c696628, 0x202c7365,
+    0x746e6f63, 0x73746e65, 0x6973202c, 0x2973657a,
+    0x20200a3a, 0x6c612020, 0x206e6769, 0x6c61203d,
+    0x6d6e6769, 0x28746e65, 0x200a2966, 0x6b202020,
+    0x3d207965, 0x6f632820, 0x6e65746e, 0x73202c74,
+    0x29657a69, 0x2020200a, 0x20666920, 0x74706f28,
+    0x736e6f69, 0x6465642e, 0x61207075, 0x6b20646e,
+    0x69207965, 0x6c62206e, 0x0a73626f, 0x20202020,
+    0x20202020, 0x20202020, 0x20646e61, 0x61656828,
+    0x5f726564, 0x657a6973, 0x62202b20, 0x73626f6c,
+    0x79656b5b, 0x2520295d, 0x696c6120, 0x3d206e67,
+    0x2930203d, 0x20200a3a, 0x20202020, 0x666f2020,
+    0x74657366, 0x70612e73, 0x646e6570, 0x6f6c6228,
+    0x6b5b7362, 0x295d7965, 0x2020200a, 0x20202020,
+    0x64656420, 0x735f7075, 0x64657661, 0x203d2b20,
+    0x286e656c, 0x746e6f63, 0x29746e65, 0x2020200a,
+    0x20202020, 0x6e6f6320, 0x756e6974, 0x20200a65,
+    0x20232020, 0x67696c41, 0x6e656d6e, 0x73692074,
+    0x6c657220, 0x76697461, 0x6f742065, 0x616d6920,
+    0x73206567, 0x74726174, 0x6877202c, 0x20686369,
+    0x7473756d, 0x20656220, 0x67696c61, 0x2064656e,
+    0x2e6f6f74, 0x2020200a, 0x64617020, 0x2d203d20,
+    0x61656828, 0x5f726564, 0x657a6973, 0x69202b20,
+    0x7865646e, 0x20252029, 0x67696c61, 0x20200a6e,
+    0x61642020, 0x612e6174, 0x6e657070, 0x5c272864,
+    0x2a202730, 0x64617020, 0x20200a29, 0x61642020,
+    0x705f6174, 0x69646461, 0x2b20676e, 0x6170203d,
+    0x20200a64, 0x6e692020, 0x20786564, 0x70203d2b,
+    0x200a6461, 0x6f202020, 0x65736666, 0x612e7374,
+    0x6e657070, 0x6e692864, 0x29786564, 0x2020200a,
+    0x6f6c6220, 0x732e7362, 0x65647465, 0x6c756166,
+    0x656b2874, 0x69202c79, 0x7865646e, 0x20200a29,
+    0x61642020, 0x612e6174, 0x6e657070, 0x6f632864,
+    0x6e65746e, 0x200a2974, 0x69202020, 0x7865646e,
+    0x203d2b20, 0x286e656c, 0x746e6f63, 0x29746e65,
+    0x2066690a, 0x0a3a3276, 0x20202020, 0x65646e69,
+    0x20736578, 0x6f203d2b, 0x65736666, 0x2b207374,
+    0x6e695b20, 0x5d786564, 0x736c650a, 0x200a3a65,
+    0x69202020, 0x7865646e, 0x2b207365, 0x6f5b203d,
+    0x6c202b20, 0x63286e65, 0x6f662029, 0x2c6f2072,
+    0x69206320, 0x697a206e, 0x666f2870, 0x74657366,
+    0x63202c73, 0x65746e6f, 0x2973746e, 0x20680a5d,
+    0x7473203d, 0x74637572, 0x6361702e, 0x3c27286b,
+    0x2c274949, 0x67616d20, 0x765f6369, 0x66692032,
+    0x20327620, 0x65736c65, 0x67616d20, 0x202c6369,
+    0x286e656c, 0x656c6966, 0x0a292973, 0x65646e69,
+    0x20736578, 0x7473203d, 0x74637572, 0x6361702e,
+    0x3c27286b, 0x27496425, 0x6c202520, 0x69286e65,
+    0x7865646e, 0x2c297365, 0x6e692a20, 0x65786564,
+    0x660a2973, 0x203d2073, 0x6a2e2727, 0x286e696f,
+    0x202c685b, 0x65646e69, 0x5d736578, 0x64202b20,
+    0x29617461, 0x616d690a, 0x615f6567, 0x6e67696c,
+    0x6d203d20, 0x5b287861, 0x2b205d34, 0x6c615b20,
+    0x6d6e6769, 0x28746e65, 0x66202966, 0x6620726f,
+    0x206e6920, 0x656c6966, 0x0a295d73, 0x6365730a,
+    0x6e6f6974, 0x203d2073, 0x690a5d5b, 0x32762066,
+    0x20200a3a, 0x65732020, 0x6f697463, 0x612e736e,
+    0x6e657070, 0x74732864, 0x74637572, 0x6361702e,
+    0x3c27286b, 0x64254949, 0x25202749, 0x6e656c20,
+    0x6e6f6328, 0x746e6574, 0x202c2973, 0x657a6973,
+    0x616d5f73, 0x2c636967, 0x2020200a, 0x20202020,
+    0x6e656c20, 0x6e6f6328, 0x746e6574, 0x202c2973,
+    0x656c5b2a, 0x2963286e, 0x726f6620, 0x69206320,
+    0x6f63206e, 0x6e65746e, 0x295d7374, 0x66690a29,
+    0x796e6120, 0x7a697328, 0x3a297365, 0x2020200a,
+    0x63657320, 0x6e6f6974, 0x70612e73, 0x646e6570,
+    0x72747328, 0x2e746375, 0x6b636170, 0x493c2728,
+    0x49642549, 0x20252027, 0x286e656c, 0x657a6973,
+    0x202c2973, 0x706d6f63, 0x73736572, 0x67616d5f,
+    0x0a2c6369, 0x20202020, 0x20202020, 0x20202020,
+    0x6974706f, 0x2e736e6f, 0x73737a6c, 0x6e69775f,
+    0x5f776f64, 0x73746962, 0x6f207c20, 0x6f697470,
+    0x6c2e736e, 0x5f73737a, 0x6b6f6f6c, 0x61656861,
+    0x69625f64, 0x3c207374, 0x2c38203c, 0x2020200a,
+    0x20202020, 0x20202020, 0x69732a20, 0x2973657a,
+    0x66690a29, 0x74706f20, 0x736e6f69, 0x7361682e,
+    0x200a3a68, 0x73202020, 0x69746365, 0x2e736e6f,
+    0x65707061, 0x6828646e, 0x5f687361, 0x6c626174,
+    0x69662865, 0x2973656c, 0x65730a29, 0x6f697463,
+    0x705f736e, 0x69646461, 0x3d20676e, 0x690a3020,
+    0x65732066, 0x6f697463, 0x0a3a736e, 0x20202020,
+    0x74636573, 0x736e6f69, 0x6461705f, 0x676e6964,
+    0x2d203d20, 0x286e656c, 0x20297366, 0x0a342025,
+    0x20202020, 0x2b207366, 0x5c27203d, 0x2a202730,
+    0x63657320, 0x6e6f6974, 0x61705f73, 0x6e696464,
+    0x20200a67, 0x73662020, 0x203d2b20, 0x6a2e2727,
+    0x286e696f, 0x74636573, 0x736e6f69, 0x690a0a29,
+    0x706f2066, 0x6e6f6974, 0x65762e73, 0x736f6272,
+    0x200a3a65, 0x69202020, 0x706f2066, 0x6e6f6974,
+    0x6f632e73, 0x6572706d, 0x0a3a7373, 0x20202020,
+    0x20202020, 0x726f7473, 0x3d206465, 0x6d757320,
+    0x6e656c28, 0x20296328, 0x20726f66, 0x6e692063,
+    0x6e6f6320, 0x746e6574, 0x200a2973, 0x20202020,
+    0x70202020, 0x746e6972, 0x203e3e20, 0x2e737973,
+    0x65647473, 0x202c7272, 0x6d6f6327, 0x73657270,
+    0x6e6f6973, 0x6425203a, 0x203e2d20, 0x28206425,
+    0x66332e25, 0x25202729, 0x61722820, 0x69735f77,
+    0x0a2c657a, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x726f7473, 0x202c6465, 0x616f6c66,
+    0x74732874, 0x6465726f, 0x202f2029, 0x5f776172,
+    0x657a6973, 0x20666920, 0x5f776172, 0x657a6973,
+    0x736c6520, 0x2e312065, 0x200a2930, 0x72202020,
+    0x726f7065, 0x203d2074, 0x20200a5b, 0x20202020,
+    0x20202020, 0x27282020, 0x64616568, 0x2c277265,
+    0x61656820, 0x5f726564, 0x657a6973, 0x200a2c29,
+    0x20202020, 0x20202020, 0x28202020, 0x6d616e27,
+    0x2c277365, 0x6e656c20, 0x6d616e28, 0x29297365,
+    0x20200a2c, 0x20202020, 0x20202020, 0x27282020,
+    0x746e6f63, 0x73746e65, 0x69202c27, 0x7865646e,
+    0x6c202d20, 0x6e286e65, 0x73656d61, 0x202d2029,
+    0x61746164, 0x6461705f, 0x676e6964, 0x200a2c29,
+    0x20202020, 0x20202020, 0x28202020, 0x64617027,
+    0x676e6964, 0x64202c27, 0x5f617461, 0x64646170,
+    0x20676e69, 0x6573202b, 0x6f697463, 0x705f736e,
+    0x69646461, 0x2c29676e, 0x2020200a, 0x20202020,
+    0x20202020, 0x73272820, 0x69746365, 0x27736e6f,
+    0x7573202c, 0x656c286d, 0x2973286e, 0x726f6620,
+    0x69207320, 0x6573206e, 0x6f697463, 0x2929736e,
+    0x20200a2c, 0x20202020, 0x20202020, 0x27282020,
+    0x61746f74, 0x202c276c, 0x286e656c, 0x29297366,
+    0x20200a2c, 0x20202020, 0x20202020, 0x0a5d2020,
+    0x20202020, 0x6f206669, 0x6f697470, 0x642e736e,
+    0x70756465, 0x20200a3a, 0x20202020, 0x65722020,
+    0x74726f70, 0x7070612e, 0x28646e65, 0x65642728,
+    0x20707564, 0x65766173, 0x202c2764, 0x75646564,
+    0x61735f70, 0x29646576, 0x20200a29, 0x6f662020,
+    0x616e2072, 0x202c656d, 0x657a6973, 0x206e6920,
+    0x6f706572, 0x0a3a7472, 0x20202020, 0x20202020,
+    0x6e697270, 0x3e3e2074, 0x73797320, 0x6474732e,
+    0x2c727265, 0x73252720, 0x6425203a, 0x20252027,
+    0x6d616e28, 0x73202c65, 0x29657a69, 0x66690a0a,
+    0x74706f20, 0x736e6f69, 0x6165682e, 0x3a726564,
+    0x2020200a, 0x64617020, 0x28203d20, 0x286e656c,
+    0x20297366, 0x2933202b, 0x34202f20, 0x34202a20,
+    0x6c202d20, 0x66286e65, 0x200a2973, 0x69202020,
+    0x61702066, 0x200a3a64, 0x20202020, 0x66202020,
+    0x3d2b2073, 0x72747320, 0x2e746375, 0x6b636170,
+    0x27422728, 0x2930202c, 0x70202a20, 0x200a6461,
+    0x77202020, 0x7364726f, 0x73203d20, 0x63757274,
+    0x6e752e74, 0x6b636170, 0x253c2728, 0x20274964,
+    0x6c282025, 0x66286e65, 0x2f202973, 0x2c293420,
+    0x29736620, 0x2020200a, 0x6e696c20, 0x3d207365,
+    0x27205b20, 0x41202a2f, 0x2d6f7475, 0x656e6567,
+    0x65746172, 0x4f522064, 0x5346204d, 0x6f726620,
+    0x20273a6d, 0x20200a5d, 0x696c2020, 0x2073656e,
+    0x5b203d2b, 0x2a202720, 0x202d2020, 0x20277325,
+    0x20662025, 0x20726f66, 0x6e692066, 0x6c696620,
+    0x5d207365, 0x2020200a, 0x74746120, 0x75626972,
+    0x3d206574, 0x20272820, 0x74615f5f, 0x62697274,
+    0x5f657475, 0x2828205f, 0x67696c61, 0x2064656e,
+    0x29642528, 0x20272929, 0x6d692025, 0x5f656761,
+    0x67696c61, 0x20200a6e, 0x20202020, 0x20202020,
+    0x66692020, 0x616d6920, 0x615f6567, 0x6e67696c,
+    0x34203e20, 0x736c6520, 0x27272065, 0x20200a29,
+    0x696c2020, 0x2073656e, 0x5b203d2b, 0x2a202720,
+    0x202c272f, 0x202c2727, 0x63732527, 0x74736e6f,
+    0x6e697520, 0x5f323374, 0x73252074, 0x73255d5b,
+    0x7b203d20, 0x20200a27, 0x20202020, 0x20202020,
+    0x20252020, 0x74706f28, 0x736e6f69, 0x6174732e,
+    0x2c636974, 0x74706f20, 0x736e6f69, 0x6165682e,
+    0x2c726564, 0x74746120, 0x75626972, 0x20296574,
+    0x20200a5d, 0x6f662020, 0x20692072, 0x78206e69,
+    0x676e6172, 0x2c302865, 0x6e656c20, 0x726f7728,
+    0x2c297364, 0x3a293420, 0x2020200a, 0x20202020,
+    0x3d207720, 0x27205b20, 0x30257830, 0x272c7838,
+    0x69202520, 0x726f6620, 0x69206920, 0x6f77206e,
+    0x5b736472, 0x2b693a69, 0x5d205d34, 0x2020200a,
+    0x20202020, 0x6e696c20, 0x612e7365, 0x6e657070,
+    0x20272864, 0x27202020, 0x27202b20, 0x6a2e2720,
+    0x206e696f, 0x29297728, 0x2020200a, 0x6e696c20,
+    0x2b207365, 0x205b203d, 0x273b7d27, 0x2727202c,
+    0x2527202c, 0x6e6f6373, 0x69207473, 0x2520746e,
+    0x69735f73, 0x3d20657a, 0x7a697320, 0x20666f65,
+    0x29732528, 0x200a273b, 0x20202020, 0x20202020,
+    0x25202020, 0x706f2820, 0x6e6f6974, 0x74732e73,
+    0x63697461, 0x706f202c, 0x6e6f6974, 0x65682e73,
+    0x72656461, 0x706f202c, 0x6e6f6974, 0x65682e73,
+    0x72656461, 0x0a5d2029, 0x20202020, 0x6974706f,
+    0x2e736e6f, 0x7074756f, 0x772e7475, 0x65746972,
+    0x6e5c2728, 0x6f6a2e27, 0x6c286e69, 0x73656e69,
+    0x650a2929, 0x3a65736c, 0x2020200a, 0x74706f20,
+    0x736e6f69, 0x74756f2e, 0x2e747570, 0x74697277,
+    0x73662865, 0x2f2f0a29, 0x6f637520, 0x62696c6f,
+    0x4d202d20, 0x6f726369, 0x746e6f63, 0x6c6c6f72,
+    0x6f207265, 0x63656a62, 0x726f2074, 0x746e6569,
+    0x6c206465, 0x61726269, 0x202e7972, 0x0a7b7b7b,
+    0x2f0a2f2f, 0x6f43202f, 0x69727970, 0x20746867,
+    0x20294328, 0x35313032, 0x63694e20, 0x73616c6f,
+    0x68635320, 0x7465646f, 0x0a2f2f0a, 0x50202f2f,
+    0x696d7265, 0x6f697373, 0x7369206e, 0x72656820,
+    0x20796265, 0x6e617267, 0x2c646574, 0x65726620,
+    0x666f2065, 0x61686320, 0x2c656772, 0x206f7420,
+    0x20796e61, 0x73726570, 0x6f206e6f, 0x69617462,
+    0x676e696e, 0x2f0a6120, 0x6f63202f, 0x6f207970,
+    0x68742066, 0x73207369, 0x7774666f, 0x20657261,
+    0x20646e61, 0x6f737361, 0x74616963, 0x64206465,
+    0x6d75636f, 0x61746e65, 0x6e6f6974, 0x6c696620,
+    0x28207365, 0x20656874, 0x666f5322, 0x72617774,
+    0x2c292265, 0x202f2f0a, 0x64206f74, 0x206c6165,
+    0x74206e69, 0x53206568, 0x7774666f, 0x20657261,
+    0x68746977, 0x2074756f, 0x74736572, 0x74636972,
+    0x2c6e6f69, 0x636e6920, 0x6964756c, 0x7720676e,
+    0x6f687469, 0x6c207475, 0x74696d69, 0x6f697461,
+    0x2f2f0a6e, 0x65687420, 0x67697220, 0x20737468,
+    0x75206f74, 0x202c6573, 0x79706f63, 0x6f6d202c,
+    0x79666964, 0x656d202c, 0x2c656772, 0x62757020,
+    0x6873696c, 0x6964202c, 0x69727473, 0x65747562,
+    0x7573202c, 0x63696c62, 0x65736e65, 0x2f2f0a2c,
+    0x646e6120, 0x20726f2f, 0x6c6c6573, 0x706f6320,
+    0x20736569, 0x7420666f, 0x53206568, 0x7774666f,
+    0x2c657261, 0x646e6120, 0x206f7420, 0x6d726570,
+    0x70207469, 0x6f737265, 0x7420736e, 0x6877206f,
+    0x74206d6f, 0x2f0a6568, 0x6f53202f, 0x61777466,
+    0x69206572, 0x75662073, 0x73696e72, 0x20646568,
+    0x64206f74, 0x6f73206f, 0x7573202c, 0x63656a62,
+    0x6f742074, 0x65687420, 0x6c6f6620, 0x69776f6c,
+    0x6320676e, 0x69646e6f, 0x6e6f6974, 0x2f0a3a73,
+    0x2f2f0a2f, 0x65685420, 0x6f626120, 0x63206576,
+    0x7279706f, 0x74686769, 0x746f6e20, 0x20656369,
+    0x20646e61, 0x73696874, 0x72657020, 0x7373696d,
+    0x206e6f69, 0x69746f6e, 0x73206563, 0x6c6c6168,
+    0x20656220, 0x6c636e69, 0x64656475, 0x0a6e6920,
+    0x61202f2f, 0x63206c6c, 0x6569706f, 0x726f2073,
+    0x62757320, 0x6e617473, 0x6c616974, 0x726f7020,
+    0x6e6f6974, 0x666f2073, 0x65687420, 0x666f5320,
+    0x72617774, 0x2f0a2e65, 0x2f2f0a2f, 0x45485420,
+    0x464f5320, 0x52415754, 0x53492045, 0x4f525020,
+    0x45444956, 0x41222044, 0x53492053, 0x57202c22,
+    0x4f485449, 0x57205455, 0x41525241, 0x2059544e,
+    0x4120464f, 0x4b20594e, 0x2c444e49, 0x50584520,
+    0x53534552, 0x0a524f20, 0x49202f2f, 0x494c504d,
+    0x202c4445, 0x4c434e49, 0x4e494455, 0x55422047,
+    0x4f4e2054, 0x494c2054, 0x4554494d, 0x4f542044,
+    0x45485420, 0x52415720, 0x544e4152, 0x20534549,
+    0x4d20464f, 0x48435245, 0x41544e41, 0x494c4942,
+    0x0a2c5954, 0x46202f2f, 0x454e5449, 0x46205353,
+    0x4120524f, 0x52415020, 0x55434954, 0x2052414c,
+    0x50525550, 0x2045534f, 0x20444e41, 0x494e4f4e,
+    0x4952464e, 0x4d45474e, 0x2e544e45, 0x204e4920,
+    0x45204f4e, 0x544e4556, 0x41485320, 0x54204c4c,
+    0x2f0a4548, 0x5541202f, 0x524f4854, 0x524f2053,
+    0x504f4320, 0x47495259, 0x48205448, 0x45444c4f,
+    0x42205352, 0x494c2045, 0x454c4241, 0x524f4620,
+    0x594e4120, 0x414c4320, 0x202c4d49, 0x414d4144,
+    0x20534547, 0x4f20524f, 0x52454854, 0x202f2f0a,
+    0x4241494c, 0x54494c49, 0x57202c59, 0x48544548,
+    0x49205245, 0x4e41204e, 0x54434120, 0x204e4f49,
+    0x4320464f, 0x52544e4f, 0x2c544341, 0x524f5420,
+    0x524f2054, 0x48544f20, 0x49575245, 0x202c4553,
+    0x53495241, 0x0a474e49, 0x46202f2f, 0x2c4d4f52,
+    0x54554f20, 0x20464f20, 0x4920524f, 0x4f43204e,
+    0x43454e4e, 0x4e4f4954, 0x54495720, 0x48542048,
+    0x4f532045, 0x41575446, 0x4f204552, 0x48542052,
+    0x53552045, 0x524f2045, 0x48544f20, 0x2f0a5245,
+    0x4544202f, 0x4e494c41, 0x49205347, 0x4854204e,
+    0x4f532045, 0x41575446, 0x0a2e4552, 0x2f0a2f2f,
+    0x7d7d202f, 0x69230a7d, 0x756c636e, 0x22206564,
+    0x6f6f6375, 0x7361622f, 0x73662f65, 0x6d6f722f,
+    0x722f7366, 0x73666d6f, 0x2268682e, 0x69230a0a,
+    0x756c636e, 0x3c206564, 0x6f676c61, 0x68746972,
+    0x230a3e6d, 0x6c636e69, 0x20656475, 0x7473633c,
+    0x676e6972, 0x6e0a0a3e, 0x73656d61, 0x65636170,
+    0x6f637520, 0x0a7b206f, 0x6f520a0a, 0x3a53466d,
+    0x6d6f523a, 0x74535346, 0x6d616572, 0x6f523a3a,
+    0x5353466d, 0x61657274, 0x6328206d, 0x74736e6f,
+    0x61686320, 0x622a2072, 0x6e696765, 0x6f63202c,
+    0x2074736e, 0x72616863, 0x6e652a20, 0x200a2964,
+    0x3a202020, 0x61747320, 0x205f7472, 0x67656228,
+    0x2c296e69, 0x67656220, 0x205f6e69, 0x67656228,
+    0x2c296e69, 0x646e6520, 0x6528205f, 0x0a29646e,
+    0x20666923, 0x464e4f43, 0x555f4749, 0x5f4f4f43,
+    0x45534142, 0x5f53465f, 0x464d4f52, 0x4f435f53,
+    0x4552504d, 0x44455353, 0x5254535f, 0x534d4145,
+    0x2020200a, 0x2c202020, 0x63656420, 0x7265646f,
+    0x6e28205f, 0x706c6c75, 0x2c297274, 0x7a697320,
+    0x28205f65, 0x202c2930, 0x5f736f70, 0x29302820,
+    0x6e65230a, 0x0a666964, 0x0a7d0a7b, 0x6669230a,
+    0x4e4f4320, 0x5f474946, 0x4f4f4355, 0x5341425f,
+    0x53465f45, 0x4d4f525f, 0x435f5346, 0x52504d4f,
+    0x45535345, 0x54535f44, 0x4d414552, 0x520a0a53,
+    0x53466d6f, 0x6f523a3a, 0x5353466d, 0x61657274,
+    0x523a3a6d, 0x53466d6f, 0x65727453, 0x28206d61,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x69676562,
+    0x63202c6e, 0x74736e6f, 0x61686320, 0x652a2072,
+    0x0a2c646e, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x746e6920, 0x7a697320, 0x4c202c65,
+    0x4473737a, 0x646f6365, 0x2a207265, 0x6f636564,
+    0x29726564, 0x2020200a, 0x73203a20, 0x74726174,
+    0x6228205f, 0x6e696765, 0x62202c29, 0x6e696765,
+    0x6228205f, 0x6e696765, 0x65202c29, 0x205f646e,
+    0x646e6528, 0x64202c29, 0x646f6365, 0x205f7265,
+    0x63656428, 0x7265646f, 0x200a2c29, 0x20202020,
+    0x7a697320, 0x28205f65, 0x657a6973, 0x70202c29,
+    0x205f736f, 0x0a293028, 0x0a7d0a7b, 0x746e690a,
+    0x6d6f520a, 0x3a3a5346, 0x466d6f52, 0x72745353,
+    0x3a6d6165, 0x6165723a, 0x6f635f64, 0x6572706d,
+    0x64657373, 0x68632820, 0x2a207261, 0x2c667562,
+    0x746e6920, 0x756f6320, 0x0a29746e, 0x20200a7b,
+    0x6e692020, 0x206c2074, 0x7473203d, 0x6d3a3a64,
+    0x28206e69, 0x6e756f63, 0x73202c74, 0x5f657a69,
+    0x70202d20, 0x295f736f, 0x20200a3b, 0x66692020,
+    0x6c212820, 0x20200a29, 0x20202020, 0x65722020,
+    0x6e727574, 0x3b322d20, 0x2020200a, 0x746e6920,
+    0x74756f20, 0x30203d20, 0x20200a3b, 0x68772020,
+    0x20656c69, 0x74756f28, 0x6c203c20, 0x20200a29,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x20746e69,
+    0x64657375, 0x20200a3b, 0x20202020, 0x6e692020,
+    0x20722074, 0x6564203d, 0x65646f63, 0x3e2d5f72,
+    0x6f636564, 0x28206564, 0x69676562, 0x202c5f6e,
+    0x5f646e65, 0x62202d20, 0x6e696765, 0x75202c5f,
+    0x2c646573, 0x66756220, 0x6f202b20, 0x0a2c7475,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x206c2020, 0x756f202d, 0x0a3b2974, 0x20202020,
+    0x20202020, 0x69676562, 0x2b205f6e, 0x7375203d,
+    0x0a3b6465, 0x20202020, 0x20202020, 0x2074756f,
+    0x72203d2b, 0x20200a3b, 0x20202020, 0x66692020,
+    0x72212820, 0x20262620, 0x65737521, 0x200a2964,
+    0x20202020, 0x20202020, 0x2f202020, 0x7254202f,
+    0x61636e75, 0x20646574, 0x61746164, 0x20200a2e,
+    0x20202020, 0x20202020, 0x72622020, 0x3b6b6165,
+    0x2020200a, 0x200a7d20, 0x70202020, 0x205f736f,
+    0x6f203d2b, 0x0a3b7475, 0x20202020, 0x75746572,
+    0x6f206e72, 0x3f207475, 0x74756f20, 0x2d203a20,
+    0x7d0a3b31, 0x6e690a0a, 0x6f520a74, 0x3a53466d,
+    0x6d6f523a, 0x74535346, 0x6d616572, 0x65733a3a,
+    0x635f6b65, 0x72706d6f, 0x65737365, 0x69282064,
+    0x6f20746e, 0x65736666, 0x57202c74, 0x636e6568,
+    0x68772065, 0x65636e65, 0x0a7b0a29, 0x20202020,
+    0x20746e69, 0x6769726f, 0x0a3b6e69, 0x20202020,
+    0x74697773, 0x28206863, 0x6e656877, 0x0a296563,
+    0x20202020, 0x20200a7b, 0x61632020, 0x57206573,
+    0x636e6568, 0x533a3a65, 0x0a3a5445, 0x20202020,
+    0x20202020, 0x6769726f, 0x3d206e69, 0x0a3b3020,
+    0x20202020, 0x20202020, 0x61657262, 0x200a3b6b,
+    0x63202020, 0x20657361, 0x6e656857, 0x3a3a6563,
+    0x3a525543, 0x2020200a, 0x20202020, 0x69726f20,
+    0x206e6967, 0x6f70203d, 0x0a3b5f73, 0x20202020,
+    0x20202020, 0x61657262, 0x200a3b6b, 0x63202020,
+    0x20657361, 0x6e656857, 0x3a3a6563, 0x3a444e45,
+    0x2020200a, 0x20202020, 0x69726f20, 0x206e6967,
+    0x6973203d, 0x3b5f657a, 0x2020200a, 0x20202020,
+    0x65726220, 0x0a3b6b61, 0x20202020, 0x61666564,
+    0x3a746c75, 0x2020200a, 0x20202020, 0x73736120,
+    0x5f747265, 0x65726e75, 0x61686361, 0x20656c62,
+    0x0a3b2928, 0x20202020, 0x20200a7d, 0x66692020,
+    0x666f2820, 0x74657366, 0x2d203c20, 0x6769726f,
+    0x7c206e69, 0x666f207c, 0x74657366, 0x73203e20,
+    0x5f657a69, 0x6f202d20, 0x69676972, 0x200a296e,
+    0x20202020, 0x72202020, 0x72757465, 0x312d206e,
+    0x20200a3b, 0x6e692020, 0x6f702074, 0x203d2073,
+    0x6769726f, 0x2b206e69, 0x66666f20, 0x3b746573,
+    0x2020200a, 0x20666920, 0x736f7028, 0x70203c20,
+    0x295f736f, 0x2020200a, 0x200a7b20, 0x20202020,
+    0x2f202020, 0x6143202f, 0x6f6e206e, 0x6f672074,
+    0x63616220, 0x7261776b, 0x64202c64, 0x646f6365,
+    0x67612065, 0x206e6961, 0x6d6f7266, 0x61747320,
+    0x0a2e7472, 0x20202020, 0x20202020, 0x6365642a,
+    0x7265646f, 0x203d205f, 0x73737a4c, 0x6f636544,
+    0x20726564, 0x0a3b2928, 0x20202020, 0x20202020,
+    0x69676562, 0x3d205f6e, 0x61747320, 0x3b5f7472,
+    0x2020200a, 0x20202020, 0x736f7020, 0x203d205f,
+    0x200a3b30, 0x7d202020, 0x2020200a, 0x69687720,
+    0x2820656c, 0x5f736f70, 0x70203c20, 0x0a29736f,
+    0x20202020, 0x20200a7b, 0x20202020, 0x68632020,
+    0x62207261, 0x335b6675, 0x0a3b5d32, 0x20202020,
+    0x20202020, 0x20746e69, 0x203d2072, 0x64616572,
+    0x6d6f635f, 0x73657270, 0x20646573, 0x66756228,
+    0x7473202c, 0x6d3a3a64, 0x693c6e69, 0x203e746e,
+    0x7a697328, 0x20666f65, 0x66756228, 0x200a2c29,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20736f70, 0x6f70202d, 0x29295f73,
+    0x20200a3b, 0x20202020, 0x66692020, 0x20722820,
+    0x2930203c, 0x2020200a, 0x20202020, 0x20202020,
+    0x74657220, 0x206e7275, 0x0a3b312d, 0x20202020,
+    0x20200a7d, 0x65722020, 0x6e727574, 0x736f7020,
+    0x7d0a3b5f, 0x65230a0a, 0x6669646e, 0x202f2f20,
+    0x464e4f43, 0x555f4749, 0x5f4f4f43, 0x45534142,
+    0x5f53465f, 0x464d4f52, 0x4f435f53, 0x4552504d,
+    0x44455353, 0x5254535f, 0x534d4145, 0x6e690a0a,
+    0x6f520a74, 0x3a53466d, 0x6d6f523a, 0x74535346,
+    0x6d616572, 0x65723a3a, 0x28206461, 0x72616863,
+    0x75622a20, 0x69202c66, 0x6320746e, 0x746e756f,
+    0x0a7b0a29, 0x20666923, 0x464e4f43, 0x555f4749,
+    0x5f4f4f43, 0x45534142, 0x5f53465f, 0x464d4f52,
+    0x4f435f53, 0x4552504d, 0x44455353, 0x5254535f,
+    0x534d4145, 0x2020200a, 0x20666920, 0x63656428,
+    0x7265646f, 0x200a295f, 0x20202020, 0x72202020,
+    0x72757465, 0x6572206e, 0x635f6461, 0x72706d6f,
+    0x65737365, 0x62282064, 0x202c6675, 0x6e756f63,
+    0x0a3b2974, 0x646e6523, 0x200a6669, 0x69202020,
+    0x6c20746e, 0x73203d20, 0x3a3a6474, 0x3c6e696d,
+    0x3e746e69, 0x6f632820, 0x2c746e75, 0x646e6520,
+    0x202d205f, 0x69676562, 0x3b295f6e, 0x2020200a,
+    0x20666920, 0x296c2128, 0x2020200a, 0x20202020,
+    0x74657220, 0x206e7275, 0x0a3b322d, 0x20202020,
+    0x65736c65, 0x2020200a, 0x200a7b20, 0x20202020,
+    0x73202020, 0x3a3a6474, 0x79706f63, 0x65622820,
+    0x5f6e6967, 0x6562202c, 0x5f6e6967, 0x6c202b20,
+    0x7562202c, 0x0a3b2966, 0x20202020, 0x20202020,
+    0x69676562, 0x2b205f6e, 0x3b6c203d, 0x2020200a,
+    0x20202020, 0x74657220, 0x206e7275, 0x200a3b6c,
+    0x7d202020, 0x0a0a7d0a, 0x0a746e69, 0x466d6f52,
+    0x523a3a53, 0x53466d6f, 0x65727453, 0x3a3a6d61,
+    0x74697277, 0x63282065, 0x74736e6f, 0x61686320,
+    0x622a2072, 0x202c6675, 0x20746e69, 0x6e756f63,
+    0x7b0a2974, 0x2020200a, 0x74657220, 0x206e7275,
+    0x0a3b312d, 0x690a0a7d, 0x520a746e, 0x53466d6f,
+    0x6f523a3a, 0x5353466d, 0x61657274, 0x703a3a6d,
+    0x206c6c6f, 0x7b0a2928, 0x6669230a, 0x4e4f4320,
+    0x5f474946, 0x4f4f4355, 0x5341425f, 0x53465f45,
+    0x4d4f525f, 0x435f5346, 0x52504d4f, 0x45535345,
+    0x54535f44, 0x4d414552, 0x20200a53, 0x66692020,
+    0x65642820, 0x65646f63, 0x0a295f72, 0x20202020,
+    0x20202020, 0x75746572, 0x73206e72, 0x5f657a69,
+    0x70202d20, 0x3b5f736f, 0x6e65230a, 0x0a666964,
+    0x20202020, 0x75746572, 0x65206e72, 0x205f646e,
+    0x6562202d, 0x5f6e6967, 0x0a7d0a3b, 0x746e690a,
+    0x6d6f520a, 0x3a3a5346, 0x466d6f52, 0x72745353,
+    0x3a6d6165, 0x6565733a, 0x6928206b, 0x6f20746e,
+    0x65736666, 0x57202c74, 0x636e6568, 0x68772065,
+    0x65636e65, 0x45532a2f, 0x292f2a54, 0x230a7b0a,
+    0x43206669, 0x49464e4f, 0x43555f47, 0x425f4f4f,
+    0x5f455341, 0x525f5346, 0x53464d4f, 0x4d4f435f,
+    0x53455250, 0x5f444553, 0x45525453, 0x0a534d41,
+    0x20202020, 0x28206669, 0x6f636564, 0x5f726564,
+    0x20200a29, 0x20202020, 0x65722020, 0x6e727574,
+    0x65657320, 0x6f635f6b, 0x6572706d, 0x64657373,
+    0x666f2820, 0x74657366, 0x6877202c, 0x65636e65,
+    0x230a3b29, 0x69646e65, 0x20200a66, 0x6f632020,
+    0x2074736e, 0x72616863, 0x726f2a20, 0x6e696769,
+    0x20200a3b, 0x77732020, 0x68637469, 0x68772820,
+    0x65636e65, 0x20200a29, 0x0a7b2020, 0x20202020,
+    0x65736163, 0x65685720, 0x3a65636e, 0x5445533a,
+    0x20200a3a, 0x20202020, 0x726f2020, 0x6e696769,
+    0x73203d20, 0x74726174, 0x200a3b5f, 0x20202020,
+    0x62202020, 0x6b616572, 0x20200a3b, 0x61632020,
+    0x57206573, 0x636e6568, 0x433a3a65, 0x0a3a5255,
+    0x20202020, 0x20202020, 0x6769726f, 0x3d206e69,
+    0x67656220, 0x3b5f6e69, 0x2020200a, 0x20202020,
+    0x65726220, 0x0a3b6b61, 0x20202020, 0x65736163,
+    0x65685720, 0x3a65636e, 0x444e453a, 0x20200a3a,
+    0x20202020, 0x726f2020, 0x6e696769, 0x65203d20,
+    0x3b5f646e, 0x2020200a, 0x20202020, 0x65726220,
+    0x0a3b6b61, 0x20202020, 0x61666564, 0x3a746c75,
+    0x2020200a, 0x20202020, 0x73736120, 0x5f747265,
+    0x65726e75, 0x61686361, 0x20656c62, 0x0a3b2928,
+    0x20202020, 0x20200a7d, 0x66692020, 0x666f2820,
+    0x74657366, 0x73203c20, 0x74726174, 0x202d205f,
+    0x6769726f, 0x7c206e69, 0x666f207c, 0x74657366,
+    0x65203e20, 0x205f646e, 0x726f202d, 0x6e696769,
+    0x20200a29, 0x20202020, 0x65722020, 0x6e727574,
+    0x3b312d20, 0x2020200a, 0x67656220, 0x205f6e69,
+    0x726f203d, 0x6e696769, 0x6f202b20, 0x65736666,
+    0x200a3b74, 0x72202020, 0x72757465, 0x6562206e,
+    0x5f6e6967, 0x73202d20, 0x74726174, 0x7d0a3b5f,
+    0x6e690a0a, 0x6f520a74, 0x3a53466d, 0x6d6f523a,
+    0x74535346, 0x6d616572, 0x69733a3a, 0x2820657a,
+    0x0a7b0a29, 0x20666923, 0x464e4f43, 0x555f4749,
+    0x5f4f4f43, 0x45534142, 0x5f53465f, 0x464d4f52,
+    0x4f435f53, 0x4552504d, 0x44455353, 0x5254535f,
+    0x534d4145, 0x2020200a, 0x20666920, 0x63656428,
+    0x7265646f, 0x200a295f, 0x20202020, 0x72202020,
+    0x72757465, 0x6973206e, 0x3b5f657a, 0x6e65230a,
+    0x0a666964, 0x20202020, 0x75746572, 0x65206e72,
+    0x205f646e, 0x7473202d, 0x5f747261, 0x0a7d0a3b,
+    0x6d6f520a, 0x3a3a5346, 0x466d6f52, 0x63282053,
+    0x74736e6f, 0x6e697520, 0x5f323374, 0x612a2074,
+    0x2c726464, 0x746e6920, 0x7a697320, 0x200a2965,
+    0x3a202020, 0x6c696620, 0x7a697365, 0x205f7365,
+    0x6c756e28, 0x7274706c, 0x68202c29, 0x5f687361,
+    0x756e2820, 0x74706c6c, 0x202c2972, 0x68736168,
+    0x73616d5f, 0x28205f6b, 0x0a2c2930, 0x20202020,
+    0x65642020, 0x706d6f63, 0x73736572, 0x735f6465,
+    0x73657a69, 0x6e28205f, 0x706c6c75, 0x0a297274,
+    0x20200a7b, 0x63752020, 0x3a3a6f6f, 0x65737361,
+    0x28207472, 0x657a6973, 0x203d3e20, 0x3b293231,
+    0x2020200a, 0x6f6f6220, 0x3276206c, 0x61203d20,
+    0x5b726464, 0x3d205d30, 0x7830203d, 0x64363233,
+    0x32356636, 0x2f2f203b, 0x6d6f5220, 0x20200a32,
+    0x63752020, 0x3a3a6f6f, 0x65737361, 0x28207472,
+    0x7c203276, 0x6461207c, 0x305b7264, 0x3d3d205d,
+    0x34783020, 0x36643636, 0x29323566, 0x2f2f203b,
+    0x6d6f5220, 0x20200a46, 0x69662020, 0x5f73656c,
+    0x6e756f63, 0x3d205f74, 0x64646120, 0x5d315b72,
+    0x20200a3b, 0x6e692020, 0x65682074, 0x72656461,
+    0x726f775f, 0x3d207364, 0x2b203320, 0x2a203220,
+    0x6c696620, 0x635f7365, 0x746e756f, 0x202b205f,
+    0x20327628, 0x2031203f, 0x2930203a, 0x20200a3b,
+    0x63752020, 0x3a3a6f6f, 0x65737361, 0x28207472,
+    0x657a6973, 0x203d3e20, 0x202a2034, 0x64616568,
+    0x775f7265, 0x7364726f, 0x200a3b29, 0x66202020,
+    0x6e656c69, 0x73656d61, 0x203d205f, 0x64646126,
+    0x5d325b72, 0x20200a3b, 0x69662020, 0x6f63656c,
+    0x6e65746e, 0x205f7374, 0x6126203d, 0x5b726464,
+    0x202b2032, 0x656c6966, 0x6f635f73, 0x5f746e75,
+    0x28202b20, 0x3f203276, 0x3a203120, 0x5d293020,
+    0x20200a3b, 0x63752020, 0x3a3a6f6f, 0x65737361,
+    0x28207472, 0x657a6973, 0x203d3e20, 0x202a2034,
+    0x64616568, 0x775f7265, 0x7364726f, 0x2020200a,
+    0x20202020, 0x20202020, 0x20202020, 0x2b202020,
+    0x61747320, 0x5f636974, 0x74736163, 0x746e693c,
+    0x6628203e, 0x63656c69, 0x65746e6f, 0x5f73746e,
+    0x6c69665b, 0x635f7365, 0x746e756f, 0x29295d5f,
+    0x20200a3b, 0x61642020, 0x205f6174, 0x6572203d,
+    0x65746e69, 0x65727072, 0x61635f74, 0x633c7473,
+    0x74736e6f, 0x61686320, 0x3e2a2072, 0x61262820,
+    0x5b726464, 0x64616568, 0x775f7265, 0x7364726f,
+    0x0a3b295d, 0x20202020, 0x4f202f2f, 0x6f697470,
+    0x206c616e, 0x74636573, 0x736e6f69, 0x20200a2e,
+    0x6e692020, 0x6e692074, 0x20786564, 0x6568203d,
+    0x72656461, 0x726f775f, 0x2b207364, 0x69662820,
+    0x6f63656c, 0x6e65746e, 0x5b5f7374, 0x656c6966,
+    0x6f635f73, 0x5f746e75, 0x202b205d, 0x2f202933,
+    0x0a3b3420, 0x20202020, 0x20746e69, 0x64726f77,
+    0x203d2073, 0x657a6973, 0x34202f20, 0x20200a3b,
+    0x68772020, 0x20656c69, 0x646e6928, 0x2b207865,
+    0x3c203220, 0x6f77203d, 0x29736472, 0x2020200a,
+    0x200a7b20, 0x20202020, 0x69202020, 0x61282066,
+    0x5b726464, 0x65646e69, 0x3d205d78, 0x7830203d,
+    0x64363834, 0x32356636, 0x2f2f2029, 0x6d6f5220,
+    0x20200a48, 0x20202020, 0x0a7b2020, 0x20202020,
+    0x20202020, 0x20202020, 0x746e6975, 0x745f3233,
+    0x6f6c7320, 0x3d207374, 0x64646120, 0x6e695b72,
+    0x20786564, 0x5d31202b, 0x20200a3b, 0x20202020,
+    0x20202020, 0x63752020, 0x3a3a6f6f, 0x65737361,
+    0x28207472, 0x746f6c73, 0x26262073, 0x6c732820,
+    0x2073746f, 0x73282026, 0x73746f6c, 0x31202d20,
+    0x3d202929, 0x2930203d, 0x20200a3b, 0x20202020,
+    0x20202020, 0x63752020, 0x3a3a6f6f, 0x65737361,
+    0x28207472, 0x65646e69, 0x202b2078, 0x202b2032,
+    0x74617473, 0x635f6369, 0x3c747361, 0x3e746e69,
+    0x6c732820, 0x2073746f, 0x2931202b, 0x32202f20,
+    0x2020200a, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x3c202020, 0x6f77203d,
+    0x29736472, 0x20200a3b, 0x20202020, 0x20202020,
+    0x61682020, 0x205f6873, 0x6572203d, 0x65746e69,
+    0x65727072, 0x61635f74, 0x633c7473, 0x74736e6f,
+    0x6e697520, 0x5f363174, 0x3e2a2074, 0x61262820,
+    0x5b726464, 0x65646e69, 0x202b2078, 0x3b295d32,
+    0x2020200a, 0x20202020, 0x20202020, 0x73616820,
+    0x616d5f68, 0x205f6b73, 0x6c73203d, 0x2073746f,
+    0x3b31202d, 0x2020200a, 0x20202020, 0x20202020,
+    0x646e6920, 0x2b207865, 0x2032203d, 0x7328202b,
+    0x73746f6c, 0x31202b20, 0x202f2029, 0x200a3b32,
+    0x20202020, 0x7d202020, 0x2020200a, 0x20202020,
+    0x736c6520, 0x66692065, 0x64612820, 0x695b7264,
+    0x7865646e, 0x3d3d205d, 0x35783020, 0x36643633,
+    0x29323566, 0x202f2f20, 0x536d6f52, 0x2020200a,
+    0x20202020, 0x200a7b20, 0x20202020, 0x20202020,
+    0x75202020, 0x3a6f6f63, 0x7373613a, 0x20747265,
+    0x61747328, 0x5f636974, 0x74736163, 0x746e693c,
+    0x6128203e, 0x5b726464, 0x65646e69, 0x202b2078,
+    0x20295d31, 0x66203d3d, 0x73656c69, 0x756f635f,
+    0x295f746e, 0x20200a3b, 0x20202020, 0x20202020,
+    0x63752020, 0x3a3a6f6f, 0x65737361, 0x28207472,
+    0x65646e69, 0x202b2078, 0x202b2032, 0x656c6966,
+    0x6f635f73, 0x5f746e75, 0x203d3c20, 0x64726f77,
+    0x0a3b2973, 0x20202020, 0x20202020, 0x20202020,
+    0x656c6966, 0x657a6973, 0x3d205f73, 0x64612620,
+    0x695b7264, 0x7865646e, 0x32202b20, 0x200a3b5d,
+    0x20202020, 0x20202020, 0x69202020, 0x7865646e,
+    0x203d2b20, 0x202b2032, 0x656c6966, 0x6f635f73,
+    0x5f746e75, 0x20200a3b, 0x20202020, 0x0a7d2020,
+    0x20202020, 0x20202020, 0x65736c65, 0x20666920,
+    0x64646128, 0x6e695b72, 0x5d786564, 0x203d3d20,
+    0x61357830, 0x66366436, 0x20293235, 0x52202f2f,
+    0x0a5a6d6f, 0x20202020, 0x20202020, 0x69230a7b,
+    0x4f432066, 0x4749464e, 0x4f43555f, 0x41425f4f,
+    0x465f4553, 0x4f525f53, 0x5f53464d, 0x504d4f43,
+    0x53534552, 0x535f4445, 0x41455254, 0x200a534d,
+    0x20202020, 0x20202020, 0x75202020, 0x3a6f6f63,
+    0x7373613a, 0x20747265, 0x64646128, 0x6e695b72,
+    0x20786564, 0x5d31202b, 0x203d3d20, 0x74617473,
+    0x635f6369, 0x3c747361, 0x746e6975, 0x745f3233,
+    0x0a28203e, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x73737a4c, 0x69773a3a,
+    0x776f646e, 0x7469625f, 0x207c2073, 0x73737a4c,
+    0x6f6c3a3a, 0x68616b6f, 0x5f646165, 0x73746962,
+    0x203c3c20, 0x3b292938, 0x6e65230a, 0x0a666964,
+    0x20202020, 0x20202020, 0x20202020, 0x6f6f6375,
+    0x73613a3a, 0x74726573, 0x6e692820, 0x20786564,
+    0x2032202b, 0x6966202b, 0x5f73656c, 0x6e756f63,
+    0x3c205f74, 0x6f77203d, 0x29736472, 0x20200a3b,
+    0x20202020, 0x20202020, 0x65642020, 0x706d6f63,
+    0x73736572, 0x735f6465, 0x73657a69, 0x203d205f,
+    0x64646126, 0x6e695b72, 0x20786564, 0x5d32202b,
+    0x20200a3b, 0x20202020, 0x20202020, 0x6e692020,
+    0x20786564, 0x32203d2b, 0x66202b20, 0x73656c69,
+    0x756f635f, 0x3b5f746e, 0x2020200a, 0x20202020,
+    0x200a7d20, 0x20202020, 0x65202020, 0x0a65736c,
+    0x20202020, 0x20202020, 0x20202020, 0x61657262,
+    0x200a3b6b, 0x7d202020, 0x2020200a, 0x6f637520,
+    0x613a3a6f, 0x72657373, 0x21282074, 0x7c203276,
+    0x6966207c, 0x6973656c, 0x5f73657a, 0x7d0a3b29,
+    0x74730a0a, 0x63697461, 0x746e6920, 0x6c69660a,
+    0x6d616e65, 0x6f635f65, 0x7261706d, 0x63282065,
+    0x74736e6f, 0x61686320, 0x612a2072, 0x6e69202c,
+    0x5f612074, 0x2c6e656c, 0x6e6f6320, 0x63207473,
+    0x20726168, 0x202c622a, 0x20746e69, 0x656c5f62,
+    0x7b0a296e, 0x2020200a, 0x746e6920, 0x6d636220,
+    0x203d2070, 0x3a647473, 0x6d656d3a, 0x20706d63,
+    0x202c6128, 0x73202c62, 0x3a3a6474, 0x206e696d,
+    0x6c5f6128, 0x202c6e65, 0x656c5f62, 0x3b29296e,
+    0x2020200a, 0x20666920, 0x6d636228, 0x3d3d2070,
+    0x0a293020, 0x20202020, 0x20202020, 0x75746572,
+    0x61206e72, 0x6e656c5f, 0x62202d20, 0x6e656c5f,
+    0x20200a3b, 0x6c652020, 0x200a6573, 0x20202020,
+    0x72202020, 0x72757465, 0x6362206e, 0x0a3b706d,
+    0x2f0a0a7d, 0x43202f2f, 0x75706d6f, 0x46206574,
+    0x312d564e, 0x61682061, 0x6f206873, 0x20612066,
+    0x69727473, 0x0a2e676e, 0x74617473, 0x75206369,
+    0x33746e69, 0x0a745f32, 0x31766e66, 0x63282061,
+    0x74736e6f, 0x61686320, 0x732a2072, 0x6e69202c,
+    0x656c2074, 0x7b0a296e, 0x2020200a, 0x6e697520,
+    0x5f323374, 0x20682074, 0x7830203d, 0x63313138,
+    0x35636439, 0x20200a3b, 0x6f662020, 0x69282072,
+    0x6920746e, 0x30203d20, 0x2069203b, 0x656c203c,
+    0x69203b6e, 0x0a292b2b, 0x20202020, 0x20202020,
+    0x203d2068, 0x5e206828, 0x61747320, 0x5f636974,
+    0x74736163, 0x6e69753c, 0x745f3874, 0x7328203e,
+    0x295d695b, 0x202a2029, 0x31307830, 0x31303030,
+    0x0a3b3339, 0x20202020, 0x75746572, 0x68206e72,
+    0x0a7d0a3b, 0x746e690a, 0x6d6f520a, 0x3a3a5346,
+    0x646e6966, 0x6f632820, 0x2074736e, 0x72616863,
+    0x69662a20, 0x616e656c, 0x202c656d, 0x20746e69,
+    0x656c6966, 0x656d616e, 0x6e656c5f, 0x6f632029,
+    0x0a74736e, 0x20200a7b, 0x66692020, 0x61682820,
+    0x295f6873, 0x2020200a, 0x200a7b20, 0x20202020,
+    0x2f202020, 0x6148202f, 0x74206873, 0x656c6261,
+    0x61657320, 0x2c686372, 0x62617420, 0x6920656c,
+    0x656e2073, 0x20726576, 0x6c6c7566, 0x20200a2e,
+    0x20202020, 0x69752020, 0x3233746e, 0x7320745f,
+    0x20746f6c, 0x6e66203d, 0x20613176, 0x6c696628,
+    0x6d616e65, 0x66202c65, 0x6e656c69, 0x5f656d61,
+    0x296e656c, 0x68202620, 0x5f687361, 0x6b73616d,
+    0x200a3b5f, 0x20202020, 0x69202020, 0x6520746e,
+    0x20200a3b, 0x20202020, 0x68772020, 0x20656c69,
+    0x20652828, 0x6168203d, 0x5b5f6873, 0x746f6c73,
+    0x0a29295d, 0x20202020, 0x20202020, 0x20200a7b,
+    0x20202020, 0x20202020, 0x6e692020, 0x20692074,
+    0x2065203d, 0x3b31202d, 0x2020200a, 0x20202020,
+    0x20202020, 0x6e6f6320, 0x63207473, 0x20726168,
+    0x6e5f692a, 0x20656d61, 0x6164203d, 0x205f6174,
+    0x6966202b, 0x616e656c, 0x5f73656d, 0x3b5d695b,
+    0x2020200a, 0x20202020, 0x20202020, 0x746e6920,
+    0x6c5f6920, 0x3d206e65, 0x6c696620, 0x6d616e65,
+    0x5b5f7365, 0x202b2069, 0x2d205d31, 0x6c696620,
+    0x6d616e65, 0x5b5f7365, 0x0a3b5d69, 0x20202020,
+    0x20202020, 0x20202020, 0x28206669, 0x656c6966,
+    0x656d616e, 0x6e656c5f, 0x203d3d20, 0x656c5f69,
+    0x20200a6e, 0x20202020, 0x20202020, 0x20202020,
+    0x26262020, 0x64747320, 0x656d3a3a, 0x706d636d,
+    0x69662820, 0x616e656c, 0x202c656d, 0x616e5f69,
+    0x202c656d, 0x656c5f69, 0x3d20296e, 0x2930203d,
+    0x2020200a, 0x20202020, 0x20202020, 0x20202020,
+    0x74657220, 0x206e7275, 0x200a3b69, 0x20202020,
+    0x20202020, 0x73202020, 0x20746f6c, 0x7328203d,
+    0x20746f6c, 0x2931202b, 0x68202620, 0x5f687361,
+    0x6b73616d, 0x200a3b5f, 0x20202020, 0x7d202020,
+    0x2020200a, 0x20202020, 0x74657220, 0x206e7275,
+    0x0a3b312d, 0x20202020, 0x20200a7d, 0x2f2f2020,
+    0x63694420, 0x6f746f68, 0x7320796d, 0x63726165,
+    0x200a2e68, 0x69202020, 0x6920746e, 0x6c203d20,
+    0x7265776f, 0x756f625f, 0x2820646e, 0x656c6966,
+    0x656d616e, 0x6966202c, 0x616e656c, 0x6c5f656d,
+    0x3b296e65, 0x2020200a, 0x20666920, 0x3c206928,
+    0x6c696620, 0x635f7365, 0x746e756f, 0x20200a5f,
+    0x20202020, 0x26262020, 0x6c696620, 0x6d616e65,
+    0x6f635f65, 0x7261706d, 0x66282065, 0x6e656c69,
+    0x2c656d61, 0x6c696620, 0x6d616e65, 0x656c5f65,
+    0x64202c6e, 0x5f617461, 0x66202b20, 0x6e656c69,
+    0x73656d61, 0x5d695b5f, 0x20200a2c, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x66202020, 0x6e656c69, 0x73656d61,
+    0x20695b5f, 0x5d31202b, 0x66202d20, 0x6e656c69,
+    0x73656d61, 0x5d695b5f, 0x3d3d2029, 0x0a293020,
+    0x20202020, 0x20202020, 0x75746572, 0x69206e72,
+    0x20200a3b, 0x65722020, 0x6e727574, 0x3b312d20,
+    0x0a0a7d0a, 0x0a746e69, 0x466d6f52, 0x6c3a3a53,
+    0x7265776f, 0x756f625f, 0x2820646e, 0x736e6f63,
+    0x68632074, 0x2a207261, 0x656c6966, 0x656d616e,
+    0x6e69202c, 0x69662074, 0x616e656c, 0x6c5f656d,
+    0x20296e65, 0x736e6f63, 0x0a7b0a74, 0x20202020,
+    0x20746e69, 0x69676562, 0x203d206e, 0x200a3b30,
+    0x69202020, 0x6520746e, 0x3d20646e, 0x6c696620,
+    0x635f7365, 0x746e756f, 0x200a3b5f, 0x77202020,
+    0x656c6968, 0x65622820, 0x206e6967, 0x65203d21,
+    0x0a29646e, 0x20202020, 0x20200a7b, 0x20202020,
+    0x6e692020, 0x20692074, 0x6562203d, 0x206e6967,
+    0x6528202b, 0x2d20646e, 0x67656220, 0x20296e69,
+    0x3b32202f, 0x2020200a, 0x20202020, 0x202f2f20,
+    0x706d6f43, 0x20657261, 0x656c6966, 0x6d616e20,
+    0x200a2e65, 0x20202020, 0x63202020, 0x74736e6f,
+    0x61686320, 0x692a2072, 0x6d616e5f, 0x203d2065,
+    0x61746164, 0x202b205f, 0x656c6966, 0x656d616e,
+    0x695b5f73, 0x200a3b5d, 0x20202020, 0x69202020,
+    0x6920746e, 0x6e656c5f, 0x66203d20, 0x6e656c69,
+    0x73656d61, 0x20695b5f, 0x5d31202b, 0x66202d20,
+    0x6e656c69, 0x73656d61, 0x5d695b5f, 0x20200a3b,
+    0x20202020, 0x6e692020, 0x6d632074, 0x203d2070,
+    0x656c6966, 0x656d616e, 0x6d6f635f, 0x65726170,
+    0x69662820, 0x616e656c, 0x202c656d, 0x656c6966,
+    0x656d616e, 0x6e656c5f, 0x5f69202c, 0x656d616e,
+    0x5f69202c, 0x296e656c, 0x20200a3b, 0x20202020,
+    0x66692020, 0x6d632820, 0x3d3c2070, 0x0a293020,
+    0x20202020, 0x20202020, 0x20202020, 0x20646e65,
+    0x3b69203d, 0x2020200a, 0x20202020, 0x736c6520,
+    0x20200a65, 0x20202020, 0x20202020, 0x65622020,
+    0x206e6967, 0x2069203d, 0x3b31202b, 0x2020200a,
+    0x200a7d20, 0x72202020, 0x72757465, 0x6562206e,
+    0x3b6e6967, 0x0a0a7d0a, 0x65727453, 0x2a206d61,
+    0x6d6f520a, 0x3a3a5346, 0x6e65706f, 0x6f632820,
+    0x2074736e, 0x72616863, 0x69662a20, 0x616e656c,
+    0x202c656d, 0x65646f4d, 0x646f6d20, 0x45202c65,
+    0x726f7272, 0x72652620, 0x29726f72, 0x200a7b0a,
+    0x69202020, 0x6d282066, 0x2065646f, 0x4d203d3d,
+    0x3a65646f, 0x4952573a, 0x0a294554, 0x20202020,
+    0x20200a7b, 0x20202020, 0x72652020, 0x20726f72,
+    0x7245203d, 0x3a726f72, 0x4145523a, 0x4e4f5f44,
+    0x0a3b594c, 0x20202020, 0x20202020, 0x75746572,
+    0x6e206e72, 0x706c6c75, 0x0a3b7274, 0x20202020,
+    0x20200a7d, 0x6e692020, 0x20692074, 0x6966203d,
+    0x2820646e, 0x656c6966, 0x656d616e, 0x7473202c,
+    0x733a3a64, 0x656c7274, 0x6628206e, 0x6e656c69,
+    0x29656d61, 0x200a3b29, 0x69202020, 0x69282066,
+    0x30203c20, 0x20200a29, 0x0a7b2020, 0x20202020,
+    0x20202020, 0x6f727265, 0x203d2072, 0x6f727245,
+    0x4e3a3a72, 0x55535f4f, 0x465f4843, 0x3b454c49,
+    0x2020200a, 0x20202020, 0x74657220, 0x206e7275,
+    0x6c6c756e, 0x3b727470, 0x2020200a, 0x200a7d20,
+    0x63202020, 0x74736e6f, 0x61686320, 0x622a2072,
+    0x6e696765, 0x64203d20, 0x5f617461, 0x66202b20,
+    0x63656c69, 0x65746e6f, 0x5f73746e, 0x3b5d695b,
+    0x2020200a, 0x6e6f6320, 0x63207473, 0x20726168,
+    0x646e652a, 0x62203d20, 0x6e696765, 0x66202b20,
+    0x5f656c69, 0x657a6973, 0x29692820, 0x20200a3b,
+    0x6f522020, 0x5353466d, 0x61657274, 0x732a206d,
+    0x20200a3b, 0x66692020, 0x65642820, 0x706d6f63,
+    0x73736572, 0x735f6465, 0x73657a69, 0x2626205f,
+    0x63656420, 0x72706d6f, 0x65737365, 0x69735f64,
+    0x5f73657a, 0x295d695b, 0x2020200a, 0x230a7b20,
+    0x43206669, 0x49464e4f, 0x43555f47, 0x425f4f4f,
+    0x5f455341, 0x525f5346, 0x53464d4f, 0x4d4f435f,
+    0x53455250, 0x5f444553, 0x45525453, 0x0a534d41,
+    0x20202020, 0x20202020, 0x73737a4c, 0x6f636544,
+    0x20726564, 0x6365642a, 0x7265646f, 0x64203d20,
+    0x646f6365, 0x5f737265, 0x6e6f632e, 0x75727473,
+    0x28207463, 0x200a3b29, 0x20202020, 0x69202020,
+    0x21282066, 0x6f636564, 0x29726564, 0x2020200a,
+    0x20202020, 0x200a7b20, 0x20202020, 0x20202020,
+    0x65202020, 0x726f7272, 0x45203d20, 0x726f7272,
+    0x4f543a3a, 0x414d5f4f, 0x4f5f594e, 0x5f4e4550,
+    0x454c4946, 0x200a3b53, 0x20202020, 0x20202020,
+    0x72202020, 0x72757465, 0x756e206e, 0x74706c6c,
+    0x200a3b72, 0x20202020, 0x7d202020, 0x2020200a,
+    0x20202020, 0x3d207320, 0x6f6f7020, 0x632e5f6c,
+    0x74736e6f, 0x74637572, 0x65622820, 0x2c6e6967,
+    0x646e6520, 0x6564202c, 0x706d6f63, 0x73736572,
+    0x735f6465, 0x73657a69, 0x5d695b5f, 0x6564202c,
+    0x65646f63, 0x0a3b2972, 0x20202020, 0x20202020,
+    0x28206669, 0x0a297321, 0x20202020, 0x20202020,
+    0x20202020, 0x6f636564, 0x73726564, 0x65642e5f,
+    0x6f727473, 0x64282079, 0x646f6365, 0x3b297265,
+    0x6c65230a, 0x200a6573, 0x20202020, 0x2f202020,
+    0x6f43202f, 0x6572706d, 0x6f697373, 0x7573206e,
+    0x726f7070, 0x73692074, 0x73696420, 0x656c6261,
+    0x200a2e64, 0x20202020, 0x65202020, 0x726f7272,
+    0x45203d20, 0x726f7272, 0x43413a3a, 0x53534543,
+    0x4e45445f, 0x3b444549, 0x2020200a, 0x20202020,
+    0x74657220, 0x206e7275, 0x6c6c756e, 0x3b727470,
+    0x6e65230a, 0x0a666964, 0x20202020, 0x20200a7d,
+    0x6c652020, 0x200a6573, 0x20202020, 0x73202020,
+    0x70203d20, 0x5f6c6f6f, 0x6e6f632e, 0x75727473,
+    0x28207463, 0x69676562, 0x65202c6e, 0x3b29646e,
+    0x2020200a, 0x20666920, 0x29732128, 0x2020200a,
+    0x20202020, 0x72726520, 0x3d20726f, 0x72724520,
+    0x3a3a726f, 0x5f4f4f54, 0x594e414d, 0x45504f5f,
+    0x49465f4e, 0x3b53454c, 0x2020200a, 0x74657220,
+    0x206e7275, 0x7d0a3b73, 0x6f760a0a, 0x520a6469,
+    0x53466d6f, 0x6c633a3a, 0x2065736f, 0x72745328,
+    0x206d6165, 0x6c69662a, 0x7b0a2965, 0x2020200a,
+    0x6d6f5220, 0x74535346, 0x6d616572, 0x20732a20,
+    0x7473203d, 0x63697461, 0x7361635f, 0x6f523c74,
+    0x5353466d, 0x61657274, 0x3e2a206d, 0x69662820,
+    0x3b29656c, 0x6669230a, 0x4e4f4320, 0x5f474946,
+    0x4f4f4355, 0x5341425f, 0x53465f45, 0x4d4f525f,
+    0x435f5346, 0x52504d4f, 0x45535345, 0x54535f44,
+    0x4d414552, 0x20200a53, 0x66692020, 0x2d732820,
+    0x6365643e, 0x7265646f, 0x200a295f, 0x20202020,
+    0x64202020, 0x646f6365, 0x5f737265, 0x7365642e,
+    0x796f7274, 0x2d732820, 0x6365643e, 0x7265646f,
+    0x0a3b295f, 0x646e6523, 0x200a6669, 0x70202020,
+    0x5f6c6f6f, 0x7365642e, 0x796f7274, 0x29732820,
+    0x0a7d0a3b, 0x6e6f630a, 0x63207473, 0x20726168,
+    0x6f520a2a, 0x3a53466d, 0x70616d3a, 0x6f632820,
+    0x2074736e, 0x72616863, 0x69662a20, 0x616e656c,
+    0x202c656d, 0x20746e69, 0x7a697326, 0x45202c65,
+    0x726f7272, 0x72652620, 0x29726f72, 0x200a7b0a,
+    0x69202020, 0x6920746e, 0x66203d20, 0x20646e69,
+    0x6c696628, 0x6d616e65, 0x73202c65, 0x3a3a6474,
+    0x6c727473, 0x28206e65, 0x656c6966, 0x656d616e,
+    0x0a3b2929, 0x20202020, 0x28206669, 0x203c2069,
+    0x200a2930, 0x7b202020, 0x2020200a, 0x20202020,
+    0x72726520, 0x3d20726f, 0x72724520, 0x3a3a726f,
+    0x535f4f4e, 0x5f484355, 0x454c4946, 0x20200a3b,
+    0x20202020, 0x65722020, 0x6e727574, 0x6c756e20,
+    0x7274706c, 0x20200a3b, 0x0a7d2020, 0x20202020,
+    0x28206669, 0x6f636564, 0x6572706d, 0x64657373,
+    0x7a69735f, 0x205f7365, 0x64202626, 0x6d6f6365,
+    0x73657270, 0x5f646573, 0x657a6973, 0x695b5f73,
+    0x200a295d, 0x7b202020, 0x2020200a, 0x20202020,
+    0x72726520, 0x3d20726f, 0x72724520, 0x3a3a726f,
+    0x5f544f4e, 0x50505553, 0x4554524f, 0x200a3b44,
+    0x20202020, 0x72202020, 0x72757465, 0x756e206e,
+    0x74706c6c, 0x200a3b72, 0x7d202020, 0x2020200a,
+    0x7a697320, 0x203d2065, 0x656c6966, 0x7a69735f,
+    0x69282065, 0x200a3b29, 0x72202020, 0x72757465,
+    0x6164206e, 0x205f6174, 0x6966202b, 0x6f63656c,
+    0x6e65746e, 0x5b5f7374, 0x0a3b5d69, 0x620a0a7d,
+    0x0a6c6f6f, 0x466d6f52, 0x733a3a53, 0x20746174,
+    0x6e6f6328, 0x63207473, 0x20726168, 0x6c69662a,
+    0x6d616e65, 0x53202c65, 0x20746174, 0x61747326,
+    0x45202c74, 0x726f7272, 0x72652620, 0x29726f72,
+    0x200a7b0a, 0x69202020, 0x6920746e, 0x66203d20,
+    0x20646e69, 0x6c696628, 0x6d616e65, 0x73202c65,
+    0x3a3a6474, 0x6c727473, 0x28206e65, 0x656c6966,
+    0x656d616e, 0x0a3b2929, 0x20202020, 0x28206669,
+    0x203c2069, 0x200a2930, 0x7b202020, 0x2020200a,
+    0x20202020, 0x72726520, 0x3d20726f, 0x72724520,
+    0x3a3a726f, 0x535f4f4e, 0x5f484355, 0x454c4946,
+    0x20200a3b, 0x20202020, 0x65722020, 0x6e727574,
+    0x6c616620, 0x0a3b6573, 0x20202020, 0x20200a7d,
+    0x66692020, 0x65642820, 0x706d6f63, 0x73736572,
+    0x735f6465, 0x73657a69, 0x2626205f, 0x63656420,
+    0x72706d6f, 0x65737365, 0x69735f64, 0x5f73657a,
+    0x295d695b, 0x2020200a, 0x20202020, 0x61747320,
+    0x69732e74, 0x3d20657a, 0x63656420, 0x72706d6f,
+    0x65737365, 0x69735f64, 0x5f73657a, 0x3b5d695b,
+    0x2020200a, 0x736c6520, 0x20200a65, 0x20202020,
+    0x74732020, 0x732e7461, 0x20657a69, 0x6966203d,
+    0x735f656c, 0x20657a69, 0x3b296928, 0x2020200a,
+    0x74657220, 0x206e7275, 0x65757274, 0x0a7d0a3b,
+    0x746e690a, 0x6d6f520a, 0x3a3a5346, 0x7473696c,
+    0x6f632820, 0x2074736e, 0x72616863, 0x72702a20,
+    0x78696665, 0x6f63202c, 0x2074736e, 0x7473694c,
+    0x6c6c6143, 0x6b636162, 0x61632620, 0x61626c6c,
+    0x0a296b63, 0x20200a7b, 0x6e692020, 0x72702074,
+    0x78696665, 0x6e656c5f, 0x73203d20, 0x3a3a6474,
+    0x6c727473, 0x28206e65, 0x66657270, 0x3b297869,
+    0x2020200a, 0x746e6920, 0x73696c20, 0x20646574,
+    0x3b30203d, 0x2020200a, 0x726f6620, 0x6e692820,
+    0x20692074, 0x6f6c203d, 0x5f726577, 0x6e756f62,
+    0x70282064, 0x69666572, 0x70202c78, 0x69666572,
+    0x656c5f78, 0x203b296e, 0x203c2069, 0x656c6966,
+    0x6f635f73, 0x5f746e75, 0x2b69203b, 0x200a292b,
+    0x7b202020, 0x2020200a, 0x20202020, 0x6e6f6320,
+    0x63207473, 0x20726168, 0x6e5f692a, 0x20656d61,
+    0x6164203d, 0x205f6174, 0x6966202b, 0x616e656c,
+    0x5f73656d, 0x3b5d695b, 0x2020200a, 0x20202020,
+    0x746e6920, 0x6c5f6920, 0x3d206e65, 0x6c696620,
+    0x6d616e65, 0x5b5f7365, 0x202b2069, 0x2d205d31,
+    0x6c696620, 0x6d616e65, 0x5b5f7365, 0x0a3b5d69,
+    0x20202020, 0x20202020, 0x28206669, 0x656c5f69,
+    0x203c206e, 0x66657270, 0x6c5f7869, 0x200a6e65,
+    0x20202020, 0x20202020, 0x7c202020, 0x7473207c,
+    0x6d3a3a64, 0x6d636d65, 0x69282070, 0x6d616e5f,
+    0x70202c65, 0x69666572, 0x70202c78, 0x69666572,
+    0x656c5f78, 0x2120296e, 0x2930203d, 0x2020200a,
+    0x20202020, 0x20202020, 0x65726220, 0x0a3b6b61,
+    0x20202020, 0x20202020, 0x7473696c, 0x2b2b6465,
+    0x20200a3b, 0x20202020, 0x66692020, 0x63212820,
+    0x626c6c61, 0x206b6361, 0x6e5f6928, 0x2c656d61,
+    0x6c5f6920, 0x29296e65, 0x2020200a, 0x20202020,
+    0x20202020, 0x65726220, 0x0a3b6b61, 0x20202020,
+    0x20200a7d, 0x65722020, 0x6e727574, 0x73696c20,
+    0x3b646574, 0x0a0a7d0a, 0x64696f76, 0x6d6f520a,
+    0x3a3a5346, 0x696c6e75, 0x28206b6e, 0x736e6f63,
+    0x68632074, 0x2a207261, 0x656c6966, 0x656d616e,
+    0x0a7b0a29, 0x20202020, 0x54202f2f, 0x20736968,
+    0x63617073, 0x73692065, 0x66656c20, 0x6e692074,
+    0x746e6574, 0x616e6f69, 0x20796c6c, 0x6e616c62,
+    0x7d0a2e6b, 0x207d0a0a, 0x6e202f2f, 0x73656d61,
+    0x65636170, 0x6f637520, 0x69230a6f, 0x65646e66,
+    0x63752066, 0x625f6f6f, 0x5f657361, 0x725f7366,
+    0x73666d6f, 0x6d6f725f, 0x685f7366, 0x64230a68,
+    0x6e696665, 0x63752065, 0x625f6f6f, 0x5f657361,
+    0x725f7366, 0x73666d6f, 0x6d6f725f, 0x685f7366,
+    0x2f2f0a68, 0x6f637520, 0x62696c6f, 0x4d202d20,
+    0x6f726369, 0x746e6f63, 0x6c6c6f72, 0x6f207265,
+    0x63656a62, 0x726f2074, 0x746e6569, 0x6c206465,
+    0x61726269, 0x202e7972, 0x0a7b7b7b, 0x2f0a2f2f,
+    0x6f43202f, 0x69727970, 0x20746867, 0x20294328,
+    0x35313032, 0x63694e20, 0x73616c6f, 0x68635320,
+    0x7465646f, 0x0a2f2f0a, 0x50202f2f, 0x696d7265,
+    0x6f697373, 0x7369206e, 0x72656820, 0x20796265,
+    0x6e617267, 0x2c646574, 0x65726620, 0x666f2065,
+    0x61686320, 0x2c656772, 0x206f7420, 0x20796e61,
+    0x73726570, 0x6f206e6f, 0x69617462, 0x676e696e,
+    0x2f0a6120, 0x6f63202f, 0x6f207970, 0x68742066,
+    0x73207369, 0x7774666f, 0x20657261, 0x20646e61,
+    0x6f737361, 0x74616963, 0x64206465, 0x6d75636f,
+    0x61746e65, 0x6e6f6974, 0x6c696620, 0x28207365,
+    0x20656874, 0x666f5322, 0x72617774, 0x2c292265,
+    0x202f2f0a, 0x64206f74, 0x206c6165, 0x74206e69,
+    0x53206568, 0x7774666f, 0x20657261, 0x68746977,
+    0x2074756f, 0x74736572, 0x74636972, 0x2c6e6f69,
+    0x636e6920, 0x6964756c, 0x7720676e, 0x6f687469,
+    0x6c207475, 0x74696d69, 0x6f697461, 0x2f2f0a6e,
+    0x65687420, 0x67697220, 0x20737468, 0x75206f74,
+    0x202c6573, 0x79706f63, 0x6f6d202c, 0x79666964,
+    0x656d202c, 0x2c656772, 0x62757020, 0x6873696c,
+    0x6964202c, 0x69727473, 0x65747562, 0x7573202c,
+    0x63696c62, 0x65736e65, 0x2f2f0a2c, 0x646e6120,
+    0x20726f2f, 0x6c6c6573, 0x706f6320, 0x20736569,
+    0x7420666f, 0x53206568, 0x7774666f, 0x2c657261,
+    0x646e6120, 0x206f7420, 0x6d726570, 0x70207469,
+    0x6f737265, 0x7420736e, 0x6877206f, 0x74206d6f,
+    0x2f0a6568, 0x6f53202f, 0x61777466, 0x69206572,
+    0x75662073, 0x73696e72, 0x20646568, 0x64206f74,
+    0x6f73206f, 0x7573202c, 0x63656a62, 0x6f742074,
+    0x65687420, 0x6c6f6620, 0x69776f6c, 0x6320676e,
+    0x69646e6f, 0x6e6f6974, 0x2f0a3a73, 0x2f2f0a2f,
+    0x65685420, 0x6f626120, 0x63206576, 0x7279706f,
+    0x74686769, 0x746f6e20, 0x20656369, 0x20646e61,
+    0x73696874, 0x72657020, 0x7373696d, 0x206e6f69,
+    0x69746f6e, 0x73206563, 0x6c6c6168, 0x20656220,
+    0x6c636e69, 0x64656475, 0x0a6e6920, 0x61202f2f,
+    0x63206c6c, 0x6569706f, 0x726f2073, 0x62757320,
+    0x6e617473, 0x6c616974, 0x726f7020, 0x6e6f6974,
+    0x666f2073, 0x65687420, 0x666f5320, 0x72617774,
+    0x2f0a2e65, 0x2f2f0a2f, 0x45485420, 0x464f5320,
+    0x52415754, 0x53492045, 0x4f525020, 0x45444956,
+    0x41222044, 0x53492053, 0x57202c22, 0x4f485449,
+    0x57205455, 0x41525241, 0x2059544e, 0x4120464f,
+    0x4b20594e, 0x2c444e49, 0x50584520, 0x53534552,
+    0x0a524f20, 0x49202f2f, 0x494c504d, 0x202c4445,
+    0x4c434e49, 0x4e494455, 0x55422047, 0x4f4e2054,
+    0x494c2054, 0x4554494d, 0x4f542044, 0x45485420,
+    0x52415720, 0x544e4152, 0x20534549, 0x4d20464f,
+    0x48435245, 0x41544e41, 0x494c4942, 0x0a2c5954,
+    0x46202f2f, 0x454e5449, 0x46205353, 0x4120524f,
+    0x52415020, 0x55434954, 0x2052414c, 0x50525550,
+    0x2045534f, 0x20444e41, 0x494e4f4e, 0x4952464e,
+    0x4d45474e, 0x2e544e45, 0x204e4920, 0x45204f4e,
+    0x544e4556, 0x41485320, 0x54204c4c, 0x2f0a4548,
+    0x5541202f, 0x524f4854, 0x524f2053, 0x504f4320,
+    0x47495259, 0x48205448, 0x45444c4f, 0x42205352,
+    0x494c2045, 0x454c4241, 0x524f4620, 0x594e4120,
+    0x414c4320, 0x202c4d49, 0x414d4144, 0x20534547,
+    0x4f20524f, 0x52454854, 0x202f2f0a, 0x4241494c,
+    0x54494c49, 0x57202c59, 0x48544548, 0x49205245,
+    0x4e41204e, 0x54434120, 0x204e4f49, 0x4320464f,
+    0x52544e4f, 0x2c544341, 0x524f5420, 0x524f2054,
+    0x48544f20, 0x49575245, 0x202c4553, 0x53495241,
+    0x0a474e49, 0x46202f2f, 0x2c4d4f52, 0x54554f20,
+    0x20464f20, 0x4920524f, 0x4f43204e, 0x43454e4e,
+    0x4e4f4954, 0x54495720, 0x48542048, 0x4f532045,
+    0x41575446, 0x4f204552, 0x48542052, 0x53552045,
+    0x524f2045, 0x48544f20, 0x2f0a5245, 0x4544202f,
+    0x4e494c41, 0x49205347, 0x4854204e, 0x4f532045,
+    0x41575446, 0x0a2e4552, 0x2f0a2f2f, 0x7d7d202f,
+    0x69230a7d, 0x756c636e, 0x22206564, 0x6f6f6375,
+    0x746e692f, 0x69662f66, 0x735f656c, 0x65747379,
+    0x68682e6d, 0x69230a22, 0x756c636e, 0x22206564,
+    0x6f6f6375, 0x6974752f, 0x702f736c, 0x2e6c6f6f,
+    0x0a226868, 0x636e6923, 0x6564756c, 0x63752220,
+    0x632f6f6f, 0x6f6d6d6f, 0x68682e6e, 0x230a0a22,
+    0x6c636e69, 0x20656475, 0x6e6f6322, 0x2f676966,
+    0x6f6f6375, 0x7361622f, 0x73662f65, 0x6d6f722f,
+    0x682e7366, 0x0a0a2268, 0x20666923, 0x464e4f43,
+    0x555f4749, 0x5f4f4f43, 0x45534142, 0x5f53465f,
+    0x464d4f52, 0x4f435f53, 0x4552504d, 0x44455353,
+    0x5254535f, 0x534d4145, 0x6920230a, 0x756c636e,
+    0x22206564, 0x6f6f6375, 0x7361622f, 0x7a6c2f65,
+    0x6c2f7373, 0x2e73737a, 0x0a226868, 0x646e6523,
+    0x0a0a6669, 0x656d616e, 0x63617073, 0x63752065,
+    0x7b206f6f, 0x2f2f0a0a, 0x6552202f, 0x6f206461,
+    0x20796c6e, 0x656c6966, 0x73797320, 0x2c6d6574,
+    0x61657220, 0x61642064, 0x66206174, 0x206d6f72,
+    0x75622061, 0x72656666, 0x2f2f0a2e, 0x2f2f0a2f,
+    0x7542202f, 0x72656666, 0x72747320, 0x75746375,
+    0x202c6572, 0x7474696c, 0x6520656c, 0x6169646e,
+    0x2f0a3a6e, 0x20202f2f, 0x3a323375, 0x6f522720,
+    0x0a27466d, 0x202f2f2f, 0x32337520, 0x756e203a,
+    0x7265626d, 0x20666f20, 0x656c6966, 0x2f2f0a73,
+    0x7520202f, 0x6e5b3233, 0x69203a5d, 0x7865646e,
+    0x69207365, 0x6164206e, 0x62206174, 0x65666675,
+    0x666f2072, 0x6c696620, 0x616e2065, 0x2c73656d,
+    0x726f7320, 0x20646574, 0x66207962, 0x20656c69,
+    0x656d616e, 0x2f2f0a73, 0x7520202f, 0x6e5b3233,
+    0x69203a5d, 0x7865646e, 0x69207365, 0x6164206e,
+    0x62206174, 0x65666675, 0x666f2072, 0x6c696620,
+    0x6f632065, 0x6e65746e, 0x2f2f0a74, 0x7520202f,
+    0x203a3233, 0x65646e69, 0x6e692078, 0x74616420,
+    0x75622061, 0x72656666, 0x206f7420, 0x73726966,
+    0x6e752074, 0x64657375, 0x74796220, 0x2f2f0a65,
+    0x6320202f, 0x5b726168, 0x5d6e5b5d, 0x6966203a,
+    0x6e20656c, 0x73656d61, 0x6f6e202c, 0x657a2074,
+    0x74206f72, 0x696d7265, 0x6574616e, 0x2f2f0a64,
+    0x6320202f, 0x5b726168, 0x5d6e5b5d, 0x6966203a,
+    0x6320656c, 0x65746e6f, 0x0a73746e, 0x0a2f2f2f,
+    0x202f2f2f, 0x73726556, 0x206e6f69, 0x73692032,
+    0x65737520, 0x68772064, 0x66206e65, 0x20656c69,
+    0x746e6f63, 0x73746e65, 0x65726120, 0x696c6120,
+    0x64656e67, 0x20726f20, 0x72616873, 0x62206465,
+    0x65777465, 0x2f0a6e65, 0x69202f2f, 0x746e6564,
+    0x6c616369, 0x6c696620, 0x0a3a7365, 0x202f2f2f,
+    0x32337520, 0x5227203a, 0x27326d6f, 0x2f2f2f0a,
+    0x33752020, 0x6e203a32, 0x65626d75, 0x666f2072,
+    0x6c696620, 0x2f0a7365, 0x20202f2f, 0x5b323375,
+    0x202b206e, 0x203a5d31, 0x65646e69, 0x20736578,
+    0x64206e69, 0x20617461, 0x66667562, 0x6f207265,
+    0x69662066, 0x6e20656c, 0x73656d61, 0x6874202c,
+    0x65206e65, 0x6f20646e, 0x616e2066, 0x0a73656d,
+    0x202f2f2f, 0x32337520, 0x3a5d6e5b, 0x646e6920,
+    0x73657865, 0x206e6920, 0x61746164, 0x66756220,
+    0x20726566, 0x6620666f, 0x20656c69, 0x746e6f63,
+    0x2c746e65, 0x746f6e20, 0x63656e20, 0x61737365,
+    0x796c6972, 0x2f2f2f0a, 0x6e692020, 0x61657263,
+    0x676e6973, 0x2f2f2f0a, 0x33752020, 0x69203a32,
+    0x7865646e, 0x206e6920, 0x61746164, 0x66756220,
+    0x20726566, 0x66206f74, 0x74737269, 0x756e7520,
+    0x20646573, 0x65747962, 0x2f2f2f0a, 0x68632020,
+    0x5d5b7261, 0x3a5d6e5b, 0x6c696620, 0x616e2065,
+    0x2c73656d, 0x746f6e20, 0x72657a20, 0x6574206f,
+    0x6e696d72, 0x64657461, 0x2f2f2f0a, 0x68632020,
+    0x5d5b7261, 0x203a5d5b, 0x656c6966, 0x6e6f6320,
+    0x746e6574, 0x6e612073, 0x61702064, 0x6e696464,
+    0x2f2f0a67, 0x2f2f0a2f, 0x6e49202f, 0x72657620,
+    0x6e6f6973, 0x202c3220, 0x656c6966, 0x7a697320,
+    0x61207365, 0x67206572, 0x6e657669, 0x206e6920,
+    0x616d2061, 0x7461646e, 0x2079726f, 0x657a6973,
+    0x65732073, 0x6f697463, 0x2f0a2e6e, 0x2f0a2f2f,
+    0x4f202f2f, 0x6f697470, 0x6c6c616e, 0x6f662079,
+    0x776f6c6c, 0x62206465, 0x78652079, 0x20617274,
+    0x74636573, 0x736e6f69, 0x6c61202c, 0x656e6769,
+    0x6e6f2064, 0x20323320, 0x73746962, 0x6e69202c,
+    0x796e6120, 0x64726f20, 0x0a2e7265, 0x0a2f2f2f,
+    0x202f2f2f, 0x657a6953, 0x2f0a3a73, 0x20202f2f,
+    0x3a323375, 0x6f522720, 0x0a27536d, 0x202f2f2f,
+    0x32337520, 0x756e203a, 0x7265626d, 0x20666f20,
+    0x656c6966, 0x2f2f0a73, 0x7520202f, 0x6e5b3233,
+    0x66203a5d, 0x20656c69, 0x657a6973, 0x7361202c,
+    0x6f747320, 0x0a646572, 0x0a2f2f2f, 0x202f2f2f,
+    0x68736148, 0x62617420, 0x0a3a656c, 0x202f2f2f,
+    0x32337520, 0x5227203a, 0x27486d6f, 0x2f2f2f0a,
+    0x33752020, 0x6e203a32, 0x65626d75, 0x666f2072,
+    0x6f6c7320, 0x202c7374, 0x6f702061, 0x20726577,
+    0x7420666f, 0x2f0a6f77, 0x20202f2f, 0x5b363175,
+    0x746f6c73, 0x203a5d73, 0x656c6966, 0x646e6920,
+    0x70207865, 0x2073756c, 0x2c656e6f, 0x20726f20,
+    0x6f72657a, 0x726f6620, 0x206e6120, 0x74706d65,
+    0x6c732079, 0x2f0a746f, 0x2f0a2f2f, 0x46202f2f,
+    0x73656c69, 0x65726120, 0x616c7020, 0x20646563,
+    0x74206e69, 0x73206568, 0x20746f6c, 0x65766967,
+    0x7962206e, 0x65687420, 0x564e4620, 0x2061312d,
+    0x68736168, 0x20666f20, 0x69656874, 0x616e2072,
+    0x202c656d, 0x2f0a726f, 0x69202f2f, 0x6874206e,
+    0x6f662065, 0x776f6c6c, 0x20676e69, 0x65657266,
+    0x6f6c7320, 0x6c282074, 0x61656e69, 0x72702072,
+    0x6e69626f, 0x202e2967, 0x65685720, 0x6874206e,
+    0x20657265, 0x6e207369, 0x6168206f, 0x2f0a6873,
+    0x74202f2f, 0x656c6261, 0x6f6c202c, 0x70756b6f,
+    0x65737520, 0x20612073, 0x68636964, 0x6d6f746f,
+    0x65732079, 0x68637261, 0x2f2f0a2e, 0x2f2f0a2f,
+    0x6f43202f, 0x6572706d, 0x6f697373, 0x2f0a3a6e,
+    0x20202f2f, 0x3a323375, 0x6f522720, 0x0a275a6d,
+    0x202f2f2f, 0x32337520, 0x5a4c203a, 0x77205353,
+    0x6f646e69, 0x69625f77, 0x202c7374, 0x73756c70,
+    0x6f6f6c20, 0x6568616b, 0x625f6461, 0x20737469,
+    0x38203c3c, 0x2f2f2f0a, 0x33752020, 0x5d6e5b32,
+    0x6564203a, 0x706d6f63, 0x73736572, 0x66206465,
+    0x20656c69, 0x657a6973, 0x726f202c, 0x72657a20,
+    0x6669206f, 0x6c696620, 0x73692065, 0x6f747320,
+    0x0a646572, 0x0a2f2f2f, 0x202f2f2f, 0x706d6f43,
+    0x73736572, 0x66206465, 0x20656c69, 0x746e6f63,
+    0x73746e65, 0x65726120, 0x535a4c20, 0x6e652053,
+    0x65646f63, 0x74202c64, 0x20796568, 0x20657261,
+    0x6f636564, 0x6572706d, 0x64657373, 0x206e6f20,
+    0x0a656874, 0x202f2f2f, 0x20796c66, 0x6e656877,
+    0x61657220, 0x77202c64, 0x68636968, 0x65656e20,
+    0x61207364, 0x63656420, 0x7265646f, 0x72657020,
+    0x65706f20, 0x6966206e, 0x2820656c, 0x0a656573,
+    0x202f2f2f, 0x706d6f63, 0x73736572, 0x735f6465,
+    0x61657274, 0x6920736d, 0x6f63206e, 0x6769666e,
+    0x74617275, 0x296e6f69, 0x6c630a2e, 0x20737361,
+    0x466d6f52, 0x203a2053, 0x6c627570, 0x46206369,
+    0x53656c69, 0x65747379, 0x0a7b0a6d, 0x20202020,
+    0x202f2f2f, 0x65727453, 0x66206d61, 0x206d6f72,
+    0x6f722061, 0x2e73666d, 0x2020200a, 0x616c6320,
+    0x52207373, 0x53466d6f, 0x65727453, 0x3a206d61,
+    0x62757020, 0x2063696c, 0x65727453, 0x200a6d61,
+    0x7b202020, 0x2020200a, 0x70202020, 0x696c6275,
+    0x200a3a63, 0x20202020, 0x2f202020, 0x43202f2f,
+    0x74736e6f, 0x74637572, 0x6620726f, 0x206d6f72,
+    0x656d2061, 0x79726f6d, 0x75686320, 0x0a2e6b6e,
+    0x20202020, 0x20202020, 0x466d6f52, 0x72745353,
+    0x206d6165, 0x6e6f6328, 0x63207473, 0x20726168,
+    0x6765622a, 0x202c6e69, 0x736e6f63, 0x68632074,
+    0x2a207261, 0x29646e65, 0x69230a3b, 0x4f432066,
+    0x4749464e, 0x4f43555f, 0x41425f4f, 0x465f4553,
+    0x4f525f53, 0x5f53464d, 0x504d4f43, 0x53534552,
+    0x535f4445, 0x41455254, 0x200a534d, 0x20202020,
+    0x2f202020, 0x43202f2f, 0x74736e6f, 0x74637572,
+    0x6620726f, 0x206d6f72, 0x6f632061, 0x6572706d,
+    0x64657373, 0x6d656d20, 0x2079726f, 0x6e756863,
+    0x77202c6b, 0x20687469, 0x20656874, 0x657a6973,
+    0x0a666f20, 0x20202020, 0x20202020, 0x202f2f2f,
+    0x6f636564, 0x6572706d, 0x64657373, 0x74616420,
+    0x200a2e61, 0x20202020, 0x52202020, 0x53466d6f,
+    0x65727453, 0x28206d61, 0x736e6f63, 0x68632074,
+    0x2a207261, 0x69676562, 0x63202c6e, 0x74736e6f,
+    0x61686320, 0x652a2072, 0x202c646e, 0x20746e69,
+    0x657a6973, 0x20200a2c, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x4c202020, 0x4473737a,
+    0x646f6365, 0x2a207265, 0x6f636564, 0x29726564,
+    0x65230a3b, 0x6669646e, 0x2020200a, 0x20202020,
+    0x2f2f2f20, 0x65655320, 0x72745320, 0x3a6d6165,
+    0x6165723a, 0x200a2e64, 0x20202020, 0x69202020,
+    0x7220746e, 0x20646165, 0x61686328, 0x622a2072,
+    0x202c6675, 0x20746e69, 0x6e756f63, 0x6f202974,
+    0x72726576, 0x3b656469, 0x2020200a, 0x20202020,
+    0x2f2f2f20, 0x65655320, 0x72745320, 0x3a6d6165,
+    0x6972773a, 0x0a2e6574, 0x20202020, 0x20202020,
+    0x20746e69, 0x74697277, 0x63282065, 0x74736e6f,
+    0x61686320, 0x622a2072, 0x202c6675, 0x20746e69,
+    0x6e756f63, 0x6f202974, 0x72726576, 0x3b656469,
+    0x2020200a, 0x20202020, 0x2f2f2f20, 0x65655320,
+    0x72745320, 0x3a6d6165, 0x6c6f703a, 0x200a2e6c,
+    0x20202020, 0x69202020, 0x7020746e, 0x206c6c6f,
+    0x6f202928, 0x72726576, 0x3b656469, 0x2020200a,
+    0x20202020, 0x2f2f2f20, 0x65655320, 0x72745320,
+    0x3a6d6165, 0x6565733a, 0x200a2e6b, 0x20202020,
+    0x69202020, 0x7320746e, 0x206b6565, 0x746e6928,
+    0x66666f20, 0x2c746573, 0x65685720, 0x2065636e,
+    0x6e656877, 0x3d206563, 0x65685720, 0x3a65636e,
+    0x5445533a, 0x766f2029, 0x69727265, 0x0a3b6564,
+    0x20202020, 0x20202020, 0x202f2f2f, 0x20656553,
+    0x65727453, 0x3a3a6d61, 0x657a6973, 0x20200a2e,
+    0x20202020, 0x6e692020, 0x69732074, 0x2820657a,
+    0x766f2029, 0x69727265, 0x0a3b6564, 0x20202020,
+    0x72702020, 0x74617669, 0x230a3a65, 0x43206669,
+    0x49464e4f, 0x43555f47, 0x425f4f4f, 0x5f455341,
+    0x525f5346, 0x53464d4f, 0x4d4f435f, 0x53455250,
+    0x5f444553, 0x45525453, 0x0a534d41, 0x20202020,
+    0x20202020, 0x202f2f2f, 0x64616552, 0x6d6f6320,
+    0x73657270, 0x20646573, 0x61746164, 0x20200a2e,
+    0x20202020, 0x6e692020, 0x65722074, 0x635f6461,
+    0x72706d6f, 0x65737365, 0x63282064, 0x20726168,
+    0x6675622a, 0x6e69202c, 0x6f632074, 0x29746e75,
+    0x20200a3b, 0x20202020, 0x2f2f2020, 0x6553202f,
+    0x69206b65, 0x6f63206e, 0x6572706d, 0x64657373,
+    0x74616420, 0x62202c61, 0x65642079, 0x69646f63,
+    0x6620676e, 0x206d6f72, 0x72617473, 0x66692074,
+    0x65656e20, 0x2e646564, 0x2020200a, 0x20202020,
+    0x746e6920, 0x65657320, 0x6f635f6b, 0x6572706d,
+    0x64657373, 0x6e692820, 0x666f2074, 0x74657366,
+    0x6857202c, 0x65636e65, 0x65687720, 0x2965636e,
+    0x65230a3b, 0x6669646e, 0x2020200a, 0x70202020,
+    0x61766972, 0x0a3a6574, 0x20202020, 0x20202020,
+    0x65697266, 0x6320646e, 0x7373616c, 0x6d6f5220,
+    0x0a3b5346, 0x20202020, 0x20202020, 0x202f2f2f,
+    0x656c6946, 0x61747320, 0x202c7472, 0x72727563,
+    0x20746e65, 0x69736f70, 0x6e6f6974, 0x646e6120,
+    0x646e6520, 0x4620202e, 0x6120726f, 0x6d6f6320,
+    0x73657270, 0x20646573, 0x656c6966, 0x20200a2c,
+    0x20202020, 0x2f2f2020, 0x6874202f, 0x69207369,
+    0x68742073, 0x6f702065, 0x69746973, 0x69206e6f,
+    0x6f63206e, 0x6572706d, 0x64657373, 0x74616420,
+    0x200a2e61, 0x20202020, 0x63202020, 0x74736e6f,
+    0x61686320, 0x732a2072, 0x74726174, 0x2a202c5f,
+    0x69676562, 0x202c5f6e, 0x646e652a, 0x230a3b5f,
+    0x43206669, 0x49464e4f, 0x43555f47, 0x425f4f4f,
+    0x5f455341, 0x525f5346, 0x53464d4f, 0x4d4f435f,
+    0x53455250, 0x5f444553, 0x45525453, 0x0a534d41,
+    0x20202020, 0x20202020, 0x202f2f2f, 0x6f636544,
+    0x20726564, 0x20726f66, 0x706d6f63, 0x73736572,
+    0x66206465, 0x2c656c69, 0x20726f20, 0x6c6c756e,
+    0x2e727470, 0x2020200a, 0x20202020, 0x737a4c20,
+    0x63654473, 0x7265646f, 0x65642a20, 0x65646f63,
+    0x0a3b5f72, 0x20202020, 0x20202020, 0x202f2f2f,
+    0x6f636544, 0x6572706d, 0x64657373, 0x7a697320,
+    0x6e612065, 0x6f702064, 0x69746973, 0x0a2e6e6f,
+    0x20202020, 0x20202020, 0x20746e69, 0x657a6973,
+    0x70202c5f, 0x3b5f736f, 0x6e65230a, 0x0a666964,
+    0x20202020, 0x200a3b7d, 0x62757020, 0x3a63696c,
+    0x2020200a, 0x2f2f2f20, 0x6e6f4320, 0x75727473,
+    0x726f7463, 0x6174202c, 0x2073656b, 0x666d6f72,
+    0x64612073, 0x73657264, 0x6e612073, 0x69732064,
+    0x0a2e657a, 0x20202020, 0x466d6f52, 0x63282053,
+    0x74736e6f, 0x6e697520, 0x5f323374, 0x612a2074,
+    0x2c726464, 0x746e6920, 0x7a697320, 0x0a3b2965,
+    0x20202020, 0x202f2f2f, 0x20656553, 0x656c6946,
+    0x74737953, 0x3a3a6d65, 0x6e65706f, 0x20200a2e,
+    0x74532020, 0x6d616572, 0x706f2a20, 0x28206e65,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x656c6966,
+    0x656d616e, 0x6f4d202c, 0x6d206564, 0x2c65646f,
+    0x72724520, 0x2620726f, 0x6f727265, 0x6f202972,
+    0x72726576, 0x3b656469, 0x2020200a, 0x72745320,
+    0x206d6165, 0x65706f2a, 0x6328206e, 0x74736e6f,
+    0x61686320, 0x662a2072, 0x6e656c69, 0x2c656d61,
+    0x646f4d20, 0x6f6d2065, 0x3d206564, 0x646f4d20,
+    0x523a3a65, 0x29444145, 0x2020200a, 0x200a7b20,
+    0x20202020, 0x72202020, 0x72757465, 0x6946206e,
+    0x7953656c, 0x6d657473, 0x706f3a3a, 0x28206e65,
+    0x656c6966, 0x656d616e, 0x6f6d202c, 0x3b296564,
+    0x2020200a, 0x200a7d20, 0x2f202020, 0x53202f2f,
+    0x46206565, 0x53656c69, 0x65747379, 0x633a3a6d,
+    0x65736f6c, 0x20200a2e, 0x6f762020, 0x63206469,
+    0x65736f6c, 0x74532820, 0x6d616572, 0x69662a20,
+    0x2029656c, 0x7265766f, 0x65646972, 0x20200a3b,
+    0x2f2f2020, 0x6553202f, 0x69462065, 0x7953656c,
+    0x6d657473, 0x616d3a3a, 0x20202e70, 0x706d6f43,
+    0x73736572, 0x66206465, 0x73656c69, 0x6e616320,
+    0x746f6e20, 0x20656220, 0x7070616d, 0x0a2e6465,
+    0x20202020, 0x736e6f63, 0x68632074, 0x2a207261,
+    0x2070616d, 0x6e6f6328, 0x63207473, 0x20726168,
+    0x6c69662a, 0x6d616e65, 0x69202c65, 0x2620746e,
+    0x657a6973, 0x7245202c, 0x20726f72, 0x72726526,
+    0x0a29726f, 0x20202020, 0x20202020, 0x7265766f,
+    0x65646972, 0x20200a3b, 0x6f632020, 0x2074736e,
+    0x72616863, 0x616d2a20, 0x63282070, 0x74736e6f,
+    0x61686320, 0x662a2072, 0x6e656c69, 0x2c656d61,
+    0x746e6920, 0x69732620, 0x0a29657a, 0x20202020,
+    0x20200a7b, 0x20202020, 0x65722020, 0x6e727574,
+    0x6c694620, 0x73795365, 0x3a6d6574, 0x70616d3a,
+    0x69662820, 0x616e656c, 0x202c656d, 0x657a6973,
+    0x200a3b29, 0x7d202020, 0x2020200a, 0x2f2f2f20,
+    0x65655320, 0x6c694620, 0x73795365, 0x3a6d6574,
+    0x6174733a, 0x200a2e74, 0x62202020, 0x206c6f6f,
+    0x74617473, 0x6f632820, 0x2074736e, 0x72616863,
+    0x69662a20, 0x616e656c, 0x202c656d, 0x74617453,
+    0x74732620, 0x202c7461, 0x6f727245, 0x65262072,
+    0x726f7272, 0x766f2029, 0x69727265, 0x0a3b6564,
+    0x20202020, 0x202f2f2f, 0x20656553, 0x656c6946,
+    0x74737953, 0x3a3a6d65, 0x7473696c, 0x5520202e,
+    0x61206573, 0x63696420, 0x6f746f68, 0x7320796d,
+    0x63726165, 0x6f742068, 0x6e696620, 0x68742064,
+    0x69662065, 0x20747372, 0x656c6966, 0x20200a2c,
+    0x2f2f2020, 0x6874202f, 0x77206e65, 0x206b6c61,
+    0x20656874, 0x74726f73, 0x6e206465, 0x73656d61,
+    0x20200a2e, 0x6e692020, 0x696c2074, 0x28207473,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x66657270,
+    0x202c7869, 0x736e6f63, 0x694c2074, 0x61437473,
+    0x61626c6c, 0x26206b63, 0x6c6c6163, 0x6b636162,
+    0x766f2029, 0x69727265, 0x0a3b6564, 0x20202020,
+    0x202f2f2f, 0x20656553, 0x656c6946, 0x74737953,
+    0x3a3a6d65, 0x696c6e75, 0x202c6b6e, 0x73696874,
+    0x20736920, 0x6f6e2061, 0x2e706f2d, 0x2020200a,
+    0x696f7620, 0x6e752064, 0x6b6e696c, 0x6f632820,
+    0x2074736e, 0x72616863, 0x69662a20, 0x616e656c,
+    0x2029656d, 0x7265766f, 0x65646972, 0x20200a3b,
+    0x76697270, 0x3a657461, 0x2020200a, 0x2f2f2f20,
+    0x6e694620, 0x20612064, 0x656c6966, 0x6572202c,
+    0x6e727574, 0x73746920, 0x646e6920, 0x6f207865,
+    0x312d2072, 0x20666920, 0x20746f6e, 0x6e756f66,
+    0x200a2e64, 0x69202020, 0x6620746e, 0x20646e69,
+    0x6e6f6328, 0x63207473, 0x20726168, 0x6c69662a,
+    0x6d616e65, 0x69202c65, 0x6620746e, 0x6e656c69,
+    0x5f656d61, 0x296e656c, 0x6e6f6320, 0x0a3b7473,
+    0x20202020, 0x202f2f2f, 0x75746552, 0x74206e72,
+    0x69206568, 0x7865646e, 0x20666f20, 0x20656874,
+    0x73726966, 0x69662074, 0x7720656c, 0x68636968,
+    0x6d616e20, 0x73692065, 0x746f6e20, 0x776f6c20,
+    0x74207265, 0x0a6e6168, 0x20202020, 0x202f2f2f,
+    0x454c4946, 0x454d414e, 0x726f202c, 0x65687420,
+    0x6d756e20, 0x20726562, 0x6620666f, 0x73656c69,
+    0x20666920, 0x656e6f6e, 0x20200a2e, 0x6e692020,
+    0x6f6c2074, 0x5f726577, 0x6e756f62, 0x63282064,
+    0x74736e6f, 0x61686320, 0x662a2072, 0x6e656c69,
+    0x2c656d61, 0x746e6920, 0x6c696620, 0x6d616e65,
+    0x656c5f65, 0x6320296e, 0x74736e6f, 0x20200a3b,
+    0x2f2f2020, 0x6552202f, 0x6e727574, 0x6f747320,
+    0x20646572, 0x657a6973, 0x20666f20, 0x69662061,
+    0x0a2e656c, 0x20202020, 0x20746e69, 0x656c6966,
+    0x7a69735f, 0x69282065, 0x6920746e, 0x6f632029,
+    0x0a74736e, 0x20202020, 0x20200a7b, 0x20202020,
+    0x65722020, 0x6e727574, 0x6c696620, 0x7a697365,
+    0x205f7365, 0x6966203f, 0x6973656c, 0x5f73657a,
+    0x0a5d695b, 0x20202020, 0x20202020, 0x20202020,
+    0x6966203a, 0x6f63656c, 0x6e65746e, 0x5b5f7374,
+    0x202b2069, 0x2d205d31, 0x6c696620, 0x6e6f6365,
+    0x746e6574, 0x695b5f73, 0x200a3b5d, 0x7d202020,
+    0x7020200a, 0x61766972, 0x0a3a6574, 0x20202020,
+    0x202f2f2f, 0x626d754e, 0x6f207265, 0x69662066,
+    0x2e73656c, 0x2020200a, 0x746e6920, 0x6c696620,
+    0x635f7365, 0x746e756f, 0x200a3b5f, 0x2f202020,
+    0x46202f2f, 0x20656c69, 0x656d616e, 0x6e692073,
+    0x65786564, 0x200a2e73, 0x63202020, 0x74736e6f,
+    0x6e697520, 0x5f323374, 0x662a2074, 0x6e656c69,
+    0x73656d61, 0x200a3b5f, 0x2f202020, 0x46202f2f,
+    0x20656c69, 0x746e6f63, 0x73746e65, 0x646e6920,
+    0x73657865, 0x20200a2e, 0x6f632020, 0x2074736e,
+    0x746e6975, 0x745f3233, 0x69662a20, 0x6f63656c,
+    0x6e65746e, 0x3b5f7374, 0x2020200a, 0x2f2f2f20,
+    0x6c694620, 0x69732065, 0x2073657a, 0x20726f66,
+    0x73726576, 0x206e6f69, 0x6f202c32, 0x756e2072,
+    0x74706c6c, 0x66692072, 0x6c696620, 0x61207365,
+    0x63206572, 0x69746e6f, 0x756f7567, 0x200a2e73,
+    0x63202020, 0x74736e6f, 0x6e697520, 0x5f323374,
+    0x662a2074, 0x73656c69, 0x73657a69, 0x200a3b5f,
+    0x2f202020, 0x42202f2f, 0x20657479, 0x61727261,
+    0x69772079, 0x66206874, 0x20656c69, 0x656d616e,
+    0x6e612073, 0x6f632064, 0x6e65746e, 0x0a2e7374,
+    0x20202020, 0x736e6f63, 0x68632074, 0x2a207261,
+    0x61746164, 0x200a3b5f, 0x2f202020, 0x48202f2f,
+    0x20687361, 0x6c626174, 0x6f202c65, 0x756e2072,
+    0x74706c6c, 0x66692072, 0x73626120, 0x2e746e65,
+    0x2020200a, 0x6e6f6320, 0x75207473, 0x31746e69,
+    0x20745f36, 0x7361682a, 0x0a3b5f68, 0x20202020,
+    0x202f2f2f, 0x68736148, 0x62617420, 0x7320656c,
+    0x73746f6c, 0x6d756e20, 0x20726562, 0x756e696d,
+    0x6e6f2073, 0x200a2e65, 0x75202020, 0x33746e69,
+    0x20745f32, 0x68736168, 0x73616d5f, 0x0a3b5f6b,
+    0x20202020, 0x202f2f2f, 0x6f636544, 0x6572706d,
+    0x64657373, 0x6c696620, 0x69732065, 0x2c73657a,
+    0x20726f20, 0x6c6c756e, 0x20727470, 0x6e206669,
+    0x6966206f, 0x6920656c, 0x6f632073, 0x6572706d,
+    0x64657373, 0x20200a2e, 0x6f632020, 0x2074736e,
+    0x746e6975, 0x745f3233, 0x65642a20, 0x706d6f63,
+    0x73736572, 0x735f6465, 0x73657a69, 0x230a3b5f,
+    0x43206669, 0x49464e4f, 0x43555f47, 0x425f4f4f,
+    0x5f455341, 0x525f5346, 0x53464d4f, 0x4d4f435f,
+    0x53455250, 0x5f444553, 0x45525453, 0x0a534d41,
+    0x20202020, 0x202f2f2f, 0x6c6f6f50, 0x20666f20,
+    0x6f636564, 0x73726564, 0x20200a2e, 0x6f502020,
+    0x4c3c6c6f, 0x4473737a, 0x646f6365, 0x202c7265,
+    0x464e4f43, 0x555f4749, 0x5f4f4f43, 0x45534142,
+    0x5f53465f, 0x464d4f52, 0x4f435f53, 0x4552504d,
+    0x44455353, 0x5254535f, 0x534d4145, 0x6564203e,
+    0x65646f63, 0x3b5f7372, 0x6e65230a, 0x0a666964,
+    0x20202020, 0x202f2f2f, 0x6c6f6f50, 0x20666f20,
+    0x65727473, 0x0a2e6d61, 0x20202020, 0x6c6f6f50,
+    0x6d6f523c, 0x74535346, 0x6d616572, 0x3e35202c,
+    0x6f6f7020, 0x0a3b5f6c, 0x0a0a3b7d, 0x2f2f207d,
+    0x6d616e20, 0x61707365, 0x75206563, 0x0a6f6f63,
+    0x6e65230a, 0x20666964, 0x75202f2f, 0x5f6f6f63,
+    0x65736162, 0x5f73665f, 0x666d6f72, 0x6f725f73,
+    0x5f73666d, 0x000a6868,
+};
+
+static const int bench_fs_text_size = sizeof (bench_fs_text);
\ No newline at end of file
@@ -0,0 +1,1729 @@
+/* Auto-generated ROM FS from:
+ *  - hello.txt
+ *  - hello_copy.txt
+ *  - mkromfs.py
+ *  - romfs.cc
+ *  - romfs.hh
+ */
+
+static const uint32_t bench_fs_text_a[] __attribute__ ((aligned (32))) = {
+    0x326d6f52, 0x00000005, 0x00000000, 0x00000009,
+    0x00000017, 0x00000021, 0x00000029, 0x00000031,
+    0x00000048, 0x00000048, 0x000000b4, 0x00002270,
+    0x00004e74, 0x00006af1, 0x6c6c6568, 0x78742e6f,
+    0x6c656874, 0x635f6f6c, 0x2e79706f, 0x6d747874,
+    0x6d6f726b, 0x702e7366, 0x6d6f7279, 0x632e7366,
+    0x6d6f7263, 0x682e7366, 0x00000068, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x6c6c6548, 0x6f77206f, 0x21646c72, 0x4820200a,
+    0x6f6c6c65, 0x726f7720, 0x0a21646c, 0x20202020,
+    0x6c6c6548, 0x6f77206f, 0x21646c72, 0x2020200a,
+    0x48202020, 0x6f6c6c65, 0x726f7720, 0x0a21646c,
+    0x20202020, 0x20202020, 0x6c6c6548, 0x6f77206f,
+    0x21646c72, 0x2020200a, 0x20202020, 0x48202020,
+    0x6f6c6c65, 0x726f7720, 0x0a21646c, 0x752f2123,
+    0x622f7273, 0x702f6e69, 0x6f687479, 0x0a230a6e,
+    0x47222222, 0x72656e65, 0x20657461, 0x4f522061,
+    0x6966204d, 0x7320656c, 0x65747379, 0x22222e6d,
+    0x0a230a22, 0x6f432023, 0x69727970, 0x20746867,
+    0x20294328, 0x35313032, 0x63694e20, 0x73616c6f,
+    0x68635320, 0x7465646f, 0x230a230a, 0x72655020,
+    0x7373696d, 0x206e6f69, 0x68207369, 0x62657265,
+    0x72672079, 0x65746e61, 0x66202c64, 0x20656572,
+    0x6320666f, 0x67726168, 0x74202c65, 0x6e61206f,
+    0x65702079, 0x6e6f7372, 0x74626f20, 0x696e6961,
+    0x6120676e, 0x706f6320, 0x20230a79, 0x7420666f,
+    0x20736968, 0x74666f73, 0x65726177, 0x646e6120,
+    0x73736120, 0x6169636f, 0x20646574, 0x75636f64,
+    0x746e656d, 0x6f697461, 0x6966206e, 0x2073656c,
+    0x65687428, 0x6f532220, 0x61777466, 0x29226572,
+    0x6f74202c, 0x6420230a, 0x206c6165, 0x74206e69,
+    0x53206568, 0x7774666f, 0x20657261, 0x68746977,
+    0x2074756f, 0x74736572, 0x74636972, 0x2c6e6f69,
+    0x636e6920, 0x6964756c, 0x7720676e, 0x6f687469,
+    0x6c207475, 0x74696d69, 0x6f697461, 0x6874206e,
+    0x20230a65, 0x68676972, 0x74207374, 0x7375206f,
+    0x63202c65, 0x2c79706f, 0x646f6d20, 0x2c796669,
+    0x72656d20, 0x202c6567, 0x6c627570, 0x2c687369,
+    0x73696420, 0x62697274, 0x2c657475, 0x62757320,
+    0x6563696c, 0x2c65736e, 0x646e6120, 0x0a726f2f,
+    0x65732023, 0x63206c6c, 0x6569706f, 0x666f2073,
+    0x65687420, 0x666f5320, 0x72617774, 0x61202c65,
+    0x7420646e, 0x6570206f, 0x74696d72, 0x72657020,
+    0x736e6f73, 0x206f7420, 0x6d6f6877, 0x65687420,
+    0x666f5320, 0x72617774, 0x73692065, 0x6620230a,
+    0x696e7275, 0x64656873, 0x206f7420, 0x73206f64,
+    0x73202c6f, 0x656a6275, 0x74207463, 0x6874206f,
+    0x6f662065, 0x776f6c6c, 0x20676e69, 0x646e6f63,
+    0x6f697469, 0x0a3a736e, 0x20230a23, 0x20656854,
+    0x766f6261, 0x6f632065, 0x69727970, 0x20746867,
+    0x69746f6e, 0x61206563, 0x7420646e, 0x20736968,
+    0x6d726570, 0x69737369, 0x6e206e6f, 0x6369746f,
+    0x68732065, 0x206c6c61, 0x69206562, 0x756c636e,
+    0x20646564, 0x230a6e69, 0x6c6c6120, 0x706f6320,
+    0x20736569, 0x7320726f, 0x74736275, 0x69746e61,
+    0x70206c61, 0x6974726f, 0x20736e6f, 0x7420666f,
+    0x53206568, 0x7774666f, 0x2e657261, 0x230a230a,
+    0x45485420, 0x464f5320, 0x52415754, 0x53492045,
+    0x4f525020, 0x45444956, 0x41222044, 0x53492053,
+    0x57202c22, 0x4f485449, 0x57205455, 0x41525241,
+    0x2059544e, 0x4120464f, 0x4b20594e, 0x2c444e49,
+    0x50584520, 0x53534552, 0x0a524f20, 0x4d492023,
+    0x45494c50, 0x49202c44, 0x554c434e, 0x474e4944,
+    0x54554220, 0x544f4e20, 0x4d494c20, 0x44455449,
+    0x204f5420, 0x20454854, 0x52524157, 0x49544e41,
+    0x4f205345, 0x454d2046, 0x41484352, 0x4241544e,
+    0x54494c49, 0x230a2c59, 0x54494620, 0x5353454e,
+    0x524f4620, 0x50204120, 0x49545241, 0x414c5543,
+    0x55502052, 0x534f5052, 0x4e412045, 0x4f4e2044,
+    0x464e494e, 0x474e4952, 0x4e454d45, 0x49202e54,
+    0x4f4e204e, 0x45564520, 0x5320544e, 0x4c4c4148,
+    0x45485420, 0x4120230a, 0x4f485455, 0x4f205352,
+    0x4f432052, 0x49525950, 0x20544847, 0x444c4f48,
+    0x20535245, 0x4c204542, 0x4c424149, 0x4f462045,
+    0x4e412052, 0x4c432059, 0x2c4d4941, 0x4d414420,
+    0x53454741, 0x20524f20, 0x4548544f, 0x20230a52,
+    0x4241494c, 0x54494c49, 0x57202c59, 0x48544548,
+    0x49205245, 0x4e41204e, 0x54434120, 0x204e4f49,
+    0x4320464f, 0x52544e4f, 0x2c544341, 0x524f5420,
+    0x524f2054, 0x48544f20, 0x49575245, 0x202c4553,
+    0x53495241, 0x0a474e49, 0x52462023, 0x202c4d4f,
+    0x2054554f, 0x4f20464f, 0x4e492052, 0x4e4f4320,
+    0x5443454e, 0x204e4f49, 0x48544957, 0x45485420,
+    0x464f5320, 0x52415754, 0x524f2045, 0x45485420,
+    0x45535520, 0x20524f20, 0x4548544f, 0x45442052,
+    0x4e494c41, 0x230a5347, 0x204e4920, 0x20454854,
+    0x54464f53, 0x45524157, 0x0a230a2e, 0x6f706d69,
+    0x61207472, 0x61706772, 0x0a657372, 0x6f706d69,
+    0x73207472, 0x63757274, 0x6d690a74, 0x74726f70,
+    0x73797320, 0x706d690a, 0x2074726f, 0x0a0a736f,
+    0x2e737973, 0x68746170, 0x736e692e, 0x28747265,
+    0x6f202c30, 0x61702e73, 0x6a2e6874, 0x286e696f,
+    0x702e736f, 0x2e687461, 0x6e726964, 0x28656d61,
+    0x69665f5f, 0x5f5f656c, 0x27202c29, 0x2c272e2e,
+    0x2e2e2720, 0x200a2c27, 0x27202020, 0x73737a6c,
+    0x0a292927, 0x6f706d69, 0x6c207472, 0x0a73737a,
+    0x3d20700a, 0x67726120, 0x73726170, 0x72412e65,
+    0x656d7567, 0x6150746e, 0x72657372, 0x73656428,
+    0x70697263, 0x6e6f6974, 0x645f5f3d, 0x5f5f636f,
+    0x2e700a29, 0x5f646461, 0x75677261, 0x746e656d,
+    0x6f2d2728, 0x27202c27, 0x756f2d2d, 0x74757074,
+    0x74202c27, 0x3d657079, 0x70677261, 0x65737261,
+    0x6c69462e, 0x70795465, 0x77272865, 0x0a2c2927,
+    0x20202020, 0x20202020, 0x61666564, 0x3d746c75,
+    0x2e737973, 0x6f647473, 0x0a2c7475, 0x20202020,
+    0x20202020, 0x6174656d, 0x3d726176, 0x4c494627,
+    0x202c2745, 0x706c6568, 0x756f273d, 0x74757074,
+    0x6c696620, 0x0a292765, 0x64612e70, 0x72615f64,
+    0x656d7567, 0x2728746e, 0x2c27692d, 0x2d2d2720,
+    0x64616568, 0x2c277265, 0x74656d20, 0x72617661,
+    0x4156273d, 0x4d414e52, 0x0a2c2745, 0x20202020,
+    0x20202020, 0x706c6568, 0x6567273d, 0x6172656e,
+    0x43206574, 0x61656820, 0x20726564, 0x656c6966,
+    0x700a2927, 0x6464612e, 0x6772615f, 0x6e656d75,
+    0x2d272874, 0x202c2770, 0x732d2d27, 0x63726165,
+    0x61702d68, 0x2c276874, 0x74636120, 0x3d6e6f69,
+    0x70706127, 0x27646e65, 0x656d202c, 0x61766174,
+    0x50273d72, 0x27485441, 0x20200a2c, 0x20202020,
+    0x65642020, 0x6c756166, 0x203d2074, 0x0a2c5d5b,
+    0x20202020, 0x20202020, 0x706c6568, 0x6573273d,
+    0x68637261, 0x6c696620, 0x69207365, 0x4150206e,
+    0x202c4854, 0x206e6163, 0x75206562, 0x20646573,
+    0x65766573, 0x206c6172, 0x656d6974, 0x0a292773,
+    0x64612e70, 0x72615f64, 0x656d7567, 0x2728746e,
+    0x2c27482d, 0x2d2d2720, 0x68736168, 0x61202c27,
+    0x6f697463, 0x73273d6e, 0x65726f74, 0x7572745f,
+    0x0a2c2765, 0x20202020, 0x20202020, 0x706c6568,
+    0x6461273d, 0x20612064, 0x68736168, 0x62617420,
+    0x6620656c, 0x6620726f, 0x65747361, 0x6f6c2072,
+    0x70756b6f, 0x700a2927, 0x6464612e, 0x6772615f,
+    0x6e656d75, 0x2d272874, 0x202c277a, 0x632d2d27,
+    0x72706d6f, 0x27737365, 0x6361202c, 0x6e6f6974,
+    0x7473273d, 0x5f65726f, 0x65757274, 0x200a2c27,
+    0x20202020, 0x68202020, 0x3d706c65, 0x6d6f6327,
+    0x73657270, 0x69662073, 0x2c73656c, 0x65687720,
+    0x6874206e, 0x73207369, 0x73657661, 0x61707320,
+    0x29276563, 0x612e700a, 0x615f6464, 0x6d756772,
+    0x28746e65, 0x6c2d2d27, 0x2d73737a, 0x646e6977,
+    0x622d776f, 0x27737469, 0x7974202c, 0x693d6570,
+    0x202c746e, 0x61666564, 0x3d746c75, 0x73737a6c,
+    0x4e49572e, 0x5f574f44, 0x53544942, 0x20200a2c,
+    0x20202020, 0x656d2020, 0x61766174, 0x42273d72,
+    0x27535449, 0x6568202c, 0x273d706c, 0x53535a4c,
+    0x6e697720, 0x20776f64, 0x657a6973, 0x756d202c,
+    0x6d207473, 0x68637461, 0x63656420, 0x7265646f,
+    0x20200a27, 0x20202020, 0x20272020, 0x666e6f63,
+    0x72756769, 0x6f697461, 0x0a29276e, 0x64612e70,
+    0x72615f64, 0x656d7567, 0x2728746e, 0x7a6c2d2d,
+    0x6c2d7373, 0x616b6f6f, 0x64616568, 0x7469622d,
+    0x202c2773, 0x65707974, 0x746e693d, 0x20200a2c,
+    0x20202020, 0x65642020, 0x6c756166, 0x7a6c3d74,
+    0x4c2e7373, 0x414b4f4f, 0x44414548, 0x5449425f,
+    0x6d202c53, 0x76617465, 0x273d7261, 0x53544942,
+    0x200a2c27, 0x20202020, 0x68202020, 0x3d706c65,
+    0x535a4c27, 0x616d2053, 0x756d6978, 0x616d206d,
+    0x20686374, 0x676e656c, 0x202c6874, 0x7473756d,
+    0x74616d20, 0x64206863, 0x646f6365, 0x63207265,
+    0x69666e6f, 0x61727567, 0x6e6f6974, 0x700a2927,
+    0x6464612e, 0x6772615f, 0x6e656d75, 0x2d272874,
+    0x202c2761, 0x612d2d27, 0x6e67696c, 0x74202c27,
+    0x3d657079, 0x2c746e69, 0x66656420, 0x746c7561,
+    0x202c313d, 0x6174656d, 0x3d726176, 0x54594227,
+    0x2c275345, 0x2020200a, 0x20202020, 0x6c656820,
+    0x61273d70, 0x6e67696c, 0x6c696620, 0x6f632065,
+    0x6e65746e, 0x202c7374, 0x6f702061, 0x20726577,
+    0x7420666f, 0x75206f77, 0x6f742070, 0x27323320,
+    0x2e700a29, 0x5f646461, 0x75677261, 0x746e656d,
+    0x2d2d2728, 0x67696c61, 0x78652d6e, 0x202c2774,
+    0x69746361, 0x273d6e6f, 0x65707061, 0x2c27646e,
+    0x66656420, 0x746c7561, 0x2c5d5b3d, 0x2020200a,
+    0x20202020, 0x74656d20, 0x72617661, 0x5845273d,
+    0x59423d54, 0x27534554, 0x6568202c, 0x273d706c,
+    0x67696c61, 0x6966206e, 0x6320656c, 0x65746e6f,
+    0x2073746e, 0x20726f66, 0x656c6966, 0x69772073,
+    0x74206874, 0x0a276568, 0x20202020, 0x20202020,
+    0x69672027, 0x206e6576, 0x65747865, 0x6f69736e,
+    0x63202c6e, 0x62206e61, 0x73752065, 0x73206465,
+    0x72657665, 0x74206c61, 0x73656d69, 0x700a2927,
+    0x6464612e, 0x6772615f, 0x6e656d75, 0x2d272874,
+    0x202c2764, 0x642d2d27, 0x70756465, 0x61202c27,
+    0x6f697463, 0x73273d6e, 0x65726f74, 0x7572745f,
+    0x0a2c2765, 0x20202020, 0x20202020, 0x706c6568,
+    0x7473273d, 0x2065726f, 0x6e656469, 0x61636974,
+    0x6966206c, 0x6320656c, 0x65746e6f, 0x2073746e,
+    0x796c6e6f, 0x636e6f20, 0x0a292765, 0x64612e70,
+    0x72615f64, 0x656d7567, 0x2728746e, 0x2c27762d,
+    0x2d2d2720, 0x62726576, 0x2765736f, 0x6361202c,
+    0x6e6f6974, 0x7473273d, 0x5f65726f, 0x65757274,
+    0x200a2c27, 0x20202020, 0x68202020, 0x3d706c65,
+    0x70657227, 0x2074726f, 0x706d6f63, 0x73736572,
+    0x206e6f69, 0x69746172, 0x6e61206f, 0x6d692064,
+    0x20656761, 0x657a6973, 0x206e6f20, 0x6e617473,
+    0x64726164, 0x72726520, 0x2927726f, 0x612e700a,
+    0x615f6464, 0x6d756772, 0x28746e65, 0x27532d27,
+    0x2d27202c, 0x746f6e2d, 0x6174732d, 0x27636974,
+    0x6564202c, 0x273d7473, 0x74617473, 0x2c276369,
+    0x2020200a, 0x20202020, 0x74636120, 0x3d6e6f69,
+    0x6f747327, 0x635f6572, 0x74736e6f, 0x63202c27,
+    0x74736e6f, 0x2c27273d, 0x66656420, 0x746c7561,
+    0x7473273d, 0x63697461, 0x0a2c2720, 0x20202020,
+    0x20202020, 0x706c6568, 0x6f64273d, 0x746f6e20,
+    0x74756f20, 0x20747570, 0x74617473, 0x6b206369,
+    0x6f777965, 0x29276472, 0x612e700a, 0x615f6464,
+    0x6d756772, 0x28746e65, 0x6c696627, 0x202c2765,
+    0x6772616e, 0x2a273d73, 0x68202c27, 0x3d706c65,
+    0x6c696627, 0x6f742065, 0x74757020, 0x206e6920,
+    0x656c6966, 0x73797320, 0x276d6574, 0x706f0a29,
+    0x6e6f6974, 0x203d2073, 0x61702e70, 0x5f657372,
+    0x73677261, 0x0a0a2928, 0x656c6966, 0x203d2073,
+    0x6974706f, 0x2e736e6f, 0x656c6966, 0x6c69660a,
+    0x732e7365, 0x2874726f, 0x640a0a29, 0x66206665,
+    0x6131766e, 0x3a297328, 0x2020200a, 0x22222220,
+    0x706d6f43, 0x20657475, 0x62203233, 0x46207469,
+    0x312d564e, 0x61682061, 0x222e6873, 0x200a2222,
+    0x68202020, 0x30203d20, 0x31313878, 0x63643963,
+    0x20200a35, 0x6f662020, 0x20632072, 0x73206e69,
+    0x20200a3a, 0x20202020, 0x20682020, 0x2828203d,
+    0x205e2068, 0x2864726f, 0x20292963, 0x7830202a,
+    0x30303130, 0x33393130, 0x20262029, 0x66667830,
+    0x66666666, 0x200a6666, 0x72202020, 0x72757465,
+    0x0a68206e, 0x6665640a, 0x73616820, 0x61745f68,
+    0x28656c62, 0x656c6966, 0x0a3a2973, 0x20202020,
+    0x4d222222, 0x20656b61, 0x6f206e61, 0x206e6570,
+    0x72646461, 0x69737365, 0x6820676e, 0x20687361,
+    0x6c626174, 0x77202c65, 0x20687469, 0x6f6c2061,
+    0x66206461, 0x6f746361, 0x666f2072, 0x20746120,
+    0x74736f6d, 0x656e6f20, 0x2020200a, 0x6c616820,
+    0x72202c66, 0x72757465, 0x7469206e, 0x69622073,
+    0x7972616e, 0x70657220, 0x65736572, 0x7461746e,
+    0x2e6e6f69, 0x0a222222, 0x20202020, 0x65737361,
+    0x6c207472, 0x66286e65, 0x73656c69, 0x203c2029,
+    0x66667830, 0x200a6666, 0x73202020, 0x73746f6c,
+    0x31203d20, 0x2020200a, 0x69687720, 0x7320656c,
+    0x73746f6c, 0x32203c20, 0x6c202a20, 0x66286e65,
+    0x73656c69, 0x200a3a29, 0x20202020, 0x73202020,
+    0x73746f6c, 0x203d2a20, 0x20200a32, 0x61742020,
+    0x20656c62, 0x305b203d, 0x202a205d, 0x746f6c73,
+    0x20200a73, 0x6f662020, 0x2c692072, 0x69206620,
+    0x6e65206e, 0x72656d75, 0x28657461, 0x656c6966,
+    0x0a3a2973, 0x20202020, 0x20202020, 0x203d2073,
+    0x31766e66, 0x29662861, 0x28202620, 0x746f6c73,
+    0x202d2073, 0x200a2931, 0x20202020, 0x77202020,
+    0x656c6968, 0x62617420, 0x735b656c, 0x200a3a5d,
+    0x20202020, 0x20202020, 0x73202020, 0x28203d20,
+    0x202b2073, 0x26202931, 0x6c732820, 0x2073746f,
+    0x2931202d, 0x2020200a, 0x20202020, 0x62617420,
+    0x735b656c, 0x203d205d, 0x202b2069, 0x20200a31,
+    0x66692020, 0x6f6c7320, 0x25207374, 0x0a3a3220,
+    0x20202020, 0x20202020, 0x6c626174, 0x70612e65,
+    0x646e6570, 0x0a293028, 0x20202020, 0x75746572,
+    0x28206e72, 0x75727473, 0x702e7463, 0x286b6361,
+    0x49493c27, 0x68202c27, 0x5f687361, 0x6967616d,
+    0x73202c63, 0x73746f6c, 0x20200a29, 0x20202020,
+    0x20202020, 0x202b2020, 0x75727473, 0x702e7463,
+    0x286b6361, 0x64253c27, 0x25202748, 0x6e656c20,
+    0x62617428, 0x2c29656c, 0x61742a20, 0x29656c62,
+    0x640a0a29, 0x61206665, 0x6e67696c, 0x746e656d,
+    0x3a296628, 0x2020200a, 0x22222220, 0x75746552,
+    0x74206e72, 0x61206568, 0x6e67696c, 0x746e656d,
+    0x65656e20, 0x20646564, 0x20726f66, 0x69662061,
+    0x222e656c, 0x200a2222, 0x61202020, 0x6e67696c,
+    0x6f203d20, 0x6f697470, 0x612e736e, 0x6e67696c,
+    0x2020200a, 0x726f6620, 0x69206120, 0x706f206e,
+    0x6e6f6974, 0x6c612e73, 0x5f6e6769, 0x3a747865,
+    0x2020200a, 0x20202020, 0x74786520, 0x7962202c,
+    0x20736574, 0x2e61203d, 0x696c7073, 0x3d272874,
+    0x31202c27, 0x20200a29, 0x20202020, 0x66692020,
+    0x652e6620, 0x7773646e, 0x28687469, 0x29747865,
+    0x20200a3a, 0x20202020, 0x20202020, 0x6c612020,
+    0x206e6769, 0x6e69203d, 0x79622874, 0x29736574,
+    0x2020200a, 0x20666920, 0x67696c61, 0x6f6e206e,
+    0x6e692074, 0x2c312820, 0x202c3220, 0x38202c34,
+    0x3631202c, 0x3233202c, 0x200a3a29, 0x20202020,
+    0x70202020, 0x7272652e, 0x2728726f, 0x20646162,
+    0x67696c61, 0x6e656d6e, 0x6f662074, 0x73252072,
+    0x6425203a, 0x20252027, 0x202c6628, 0x67696c61,
+    0x0a29296e, 0x20202020, 0x75746572, 0x61206e72,
+    0x6e67696c, 0x616d0a0a, 0x20636967, 0x7830203d,
+    0x64363634, 0x32356636, 0x67616d0a, 0x765f6369,
+    0x203d2032, 0x32337830, 0x66366436, 0x680a3235,
+    0x5f687361, 0x6967616d, 0x203d2063, 0x38347830,
+    0x66366436, 0x630a3235, 0x72706d6f, 0x5f737365,
+    0x6967616d, 0x203d2063, 0x61357830, 0x66366436,
+    0x730a3235, 0x73657a69, 0x67616d5f, 0x3d206369,
+    0x35783020, 0x36643633, 0x0a323566, 0x5220230a,
+    0x20646165, 0x20646e61, 0x706d6f63, 0x73736572,
+    0x6c696620, 0x0a2e7365, 0x746e6f63, 0x73746e65,
+    0x5b203d20, 0x69730a5d, 0x2073657a, 0x5d5b203d,
+    0x7761720a, 0x7a69735f, 0x203d2065, 0x6f660a30,
+    0x20662072, 0x66206e69, 0x73656c69, 0x20200a3a,
+    0x6f662020, 0x20702072, 0x6f206e69, 0x6f697470,
+    0x732e736e, 0x63726165, 0x61705f68, 0x0a3a6874,
+    0x20202020, 0x20202020, 0x3d207066, 0x2e736f20,
+    0x68746170, 0x696f6a2e, 0x2c70286e, 0x0a296620,
+    0x20202020, 0x20202020, 0x6f206669, 0x61702e73,
+    0x652e6874, 0x74736978, 0x70662873, 0x200a3a29,
+    0x20202020, 0x20202020, 0x62202020, 0x6b616572,
+    0x2020200a, 0x736c6520, 0x200a3a65, 0x20202020,
+    0x66202020, 0x203d2070, 0x20200a66, 0x69772020,
+    0x6f206874, 0x286e6570, 0x20297066, 0x66207361,
+    0x200a3a64, 0x20202020, 0x63202020, 0x65746e6f,
+    0x3d20746e, 0x2e646620, 0x64616572, 0x200a2928,
+    0x72202020, 0x735f7761, 0x20657a69, 0x6c203d2b,
+    0x63286e65, 0x65746e6f, 0x0a29746e, 0x20202020,
+    0x657a6973, 0x30203d20, 0x2020200a, 0x20666920,
+    0x6974706f, 0x2e736e6f, 0x706d6f63, 0x73736572,
+    0x20200a3a, 0x20202020, 0x6f632020, 0x6572706d,
+    0x64657373, 0x6c203d20, 0x2e73737a, 0x6f636e65,
+    0x63286564, 0x65746e6f, 0x202c746e, 0x6974706f,
+    0x2e736e6f, 0x73737a6c, 0x6e69775f, 0x5f776f64,
+    0x73746962, 0x20200a2c, 0x20202020, 0x20202020,
+    0x20202020, 0x706f2020, 0x6e6f6974, 0x7a6c2e73,
+    0x6c5f7373, 0x616b6f6f, 0x64616568, 0x7469625f,
+    0x200a2973, 0x20202020, 0x69202020, 0x656c2066,
+    0x6f63286e, 0x6572706d, 0x64657373, 0x203c2029,
+    0x286e656c, 0x746e6f63, 0x29746e65, 0x20200a3a,
+    0x20202020, 0x20202020, 0x69732020, 0x3d20657a,
+    0x6e656c20, 0x6e6f6328, 0x746e6574, 0x20200a29,
+    0x20202020, 0x20202020, 0x6f632020, 0x6e65746e,
+    0x203d2074, 0x706d6f63, 0x73736572, 0x200a6465,
+    0x69202020, 0x706f2066, 0x6e6f6974, 0x65762e73,
+    0x736f6272, 0x6e612065, 0x706f2064, 0x6e6f6974,
+    0x6f632e73, 0x6572706d, 0x0a3a7373, 0x20202020,
+    0x20202020, 0x6e697270, 0x3e3e2074, 0x73797320,
+    0x6474732e, 0x2c727265, 0x73252720, 0x6425203a,
+    0x203e2d20, 0x73256425, 0x20252027, 0x202c6628,
+    0x657a6973, 0x20726f20, 0x286e656c, 0x746e6f63,
+    0x29746e65, 0x20200a2c, 0x20202020, 0x20202020,
+    0x20202020, 0x656c2020, 0x6f63286e, 0x6e65746e,
+    0x202c2974, 0x25282027, 0x2966332e, 0x20252027,
+    0x6f6c6628, 0x6c287461, 0x63286e65, 0x65746e6f,
+    0x2929746e, 0x73202f20, 0x29657a69, 0x2020200a,
+    0x20202020, 0x20202020, 0x20202020, 0x20666920,
+    0x657a6973, 0x736c6520, 0x27272065, 0x20200a29,
+    0x6f632020, 0x6e65746e, 0x612e7374, 0x6e657070,
+    0x6f632864, 0x6e65746e, 0x200a2974, 0x73202020,
+    0x73657a69, 0x7070612e, 0x28646e65, 0x657a6973,
+    0x230a0a29, 0x72655620, 0x6e6f6973, 0x69203220,
+    0x656e2073, 0x64656465, 0x65687720, 0x6966206e,
+    0x6320656c, 0x65746e6f, 0x2073746e, 0x20657261,
+    0x20746f6e, 0x746e6f63, 0x6f756769, 0x203a7375,
+    0x746e6f63, 0x73746e65, 0x79616d20, 0x0a656220,
+    0x68732023, 0x64657261, 0x646e6120, 0x64617020,
+    0x676e6964, 0x79616d20, 0x20656220, 0x65736e69,
+    0x64657472, 0x4820202e, 0x65646165, 0x61682072,
+    0x6e6f2073, 0x6f6d2065, 0x69206572, 0x7865646e,
+    0x7361202c, 0x6c696620, 0x20230a65, 0x746e6f63,
+    0x73746e65, 0x61747320, 0x69207472, 0x6f6e2073,
+    0x68742074, 0x6e652065, 0x666f2064, 0x6c696620,
+    0x616e2065, 0x2c73656d, 0x646e6120, 0x73206120,
+    0x69746365, 0x67206e6f, 0x73657669, 0x6c696620,
+    0x20230a65, 0x657a6973, 0x760a2e73, 0x203d2032,
+    0x6c6f6f62, 0x74706f28, 0x736e6f69, 0x6465642e,
+    0x6f207075, 0x706f2072, 0x6e6f6974, 0x6c612e73,
+    0x206e6769, 0x31203d21, 0x20726f20, 0x6974706f,
+    0x2e736e6f, 0x67696c61, 0x78655f6e, 0x6e0a2974,
+    0x73656d61, 0x27203d20, 0x6f6a2e27, 0x66286e69,
+    0x73656c69, 0x65680a29, 0x72656461, 0x7a69735f,
+    0x203d2065, 0x202a2034, 0x2b203328, 0x2a203220,
+    0x6e656c20, 0x6c696628, 0x20297365, 0x3128202b,
+    0x20666920, 0x65203276, 0x2065736c, 0x0a292930,
+    0x65646e69, 0x20736578, 0x305b203d, 0x6e690a5d,
+    0x20786564, 0x0a30203d, 0x20726f66, 0x6e692066,
+    0x6c696620, 0x0a3a7365, 0x20202020, 0x65646e69,
+    0x3d2b2078, 0x6e656c20, 0x0a296628, 0x20202020,
+    0x65646e69, 0x2e736578, 0x65707061, 0x6928646e,
+    0x7865646e, 0x61640a29, 0x3d206174, 0x616e5b20,
+    0x5d73656d, 0x66666f0a, 0x73746573, 0x5b203d20,
+    0x61640a5d, 0x705f6174, 0x69646461, 0x3d20676e,
+    0x640a3020, 0x70756465, 0x7661735f, 0x3d206465,
+    0x620a3020, 0x73626f6c, 0x7b203d20, 0x6f660a7d,
+    0x2c662072, 0x6e6f6320, 0x746e6574, 0x6973202c,
+    0x6920657a, 0x697a206e, 0x69662870, 0x2c73656c,
+    0x6e6f6320, 0x746e6574, 0x73202c73, 0x73657a69,
+    0x200a3a29, 0x61202020, 0x6e67696c, 0x61203d20,
+    0x6e67696c, 0x746e656d, 0x0a296628, 0x20202020,
+    0x2079656b, 0x6328203d, 0x65746e6f, 0x202c746e,
+    0x657a6973, 0x20200a29, 0x66692020, 0x706f2820,
+    0x6e6f6974, 0x65642e73, 0x20707564, 0x20646e61,
+    0x2079656b, 0x62206e69, 0x73626f6c, 0x2020200a,
+    0x20202020, 0x20202020, 0x646e6120, 0x65682820,
+    0x72656461, 0x7a69735f, 0x202b2065, 0x626f6c62,
+    0x656b5b73, 0x20295d79, 0x6c612025, 0x206e6769,
+    0x30203d3d, 0x200a3a29, 0x20202020, 0x6f202020,
+    0x65736666, 0x612e7374, 0x6e657070, 0x6c622864,
+    0x5b73626f, 0x5d79656b, 0x20200a29, 0x20202020,
+    0x65642020, 0x5f707564, 0x65766173, 0x3d2b2064,
+    0x6e656c20, 0x6e6f6328, 0x746e6574, 0x20200a29,
+    0x20202020, 0x6f632020, 0x6e69746e, 0x200a6575,
+    0x23202020, 0x696c4120, 0x656d6e67, 0x6920746e,
+    0x65722073, 0x6974616c, 0x74206576, 0x6d69206f,
+    0x20656761, 0x72617473, 0x77202c74, 0x68636968,
+    0x73756d20, 0x65622074, 0x696c6120, 0x64656e67,
+    0x6f6f7420, 0x20200a2e, 0x61702020, 0x203d2064,
+    0x6568282d, 0x72656461, 0x7a69735f, 0x202b2065,
+    0x65646e69, 0x25202978, 0x696c6120, 0x200a6e67,
+    0x64202020, 0x2e617461, 0x65707061, 0x2728646e,
+    0x2027305c, 0x6170202a, 0x200a2964, 0x64202020,
+    0x5f617461, 0x64646170, 0x20676e69, 0x70203d2b,
+    0x200a6461, 0x69202020, 0x7865646e, 0x203d2b20,
+    0x0a646170, 0x20202020, 0x7366666f, 0x2e737465,
+    0x65707061, 0x6928646e, 0x7865646e, 0x20200a29,
+    0x6c622020, 0x2e73626f, 0x64746573, 0x75616665,
+    0x6b28746c, 0x202c7965, 0x65646e69, 0x200a2978,
+    0x64202020, 0x2e617461, 0x65707061, 0x6328646e,
+    0x65746e6f, 0x0a29746e, 0x20202020, 0x65646e69,
+    0x3d2b2078, 0x6e656c20, 0x6e6f6328, 0x746e6574,
+    0x66690a29, 0x3a327620, 0x2020200a, 0x646e6920,
+    0x73657865, 0x203d2b20, 0x7366666f, 0x20737465,
+    0x695b202b, 0x7865646e, 0x6c650a5d, 0x0a3a6573,
+    0x20202020, 0x65646e69, 0x20736578, 0x5b203d2b,
+    0x202b206f, 0x286e656c, 0x66202963, 0x6f20726f,
+    0x2063202c, 0x7a206e69, 0x6f287069, 0x65736666,
+    0x202c7374, 0x746e6f63, 0x73746e65, 0x680a5d29,
+    0x73203d20, 0x63757274, 0x61702e74, 0x27286b63,
+    0x2749493c, 0x616d202c, 0x5f636967, 0x69203276,
+    0x32762066, 0x736c6520, 0x616d2065, 0x2c636967,
+    0x6e656c20, 0x6c696628, 0x29297365, 0x646e690a,
+    0x73657865, 0x73203d20, 0x63757274, 0x61702e74,
+    0x27286b63, 0x4964253c, 0x20252027, 0x286e656c,
+    0x65646e69, 0x29736578, 0x692a202c, 0x7865646e,
+    0x0a297365, 0x3d207366, 0x2e272720, 0x6e696f6a,
+    0x2c685b28, 0x646e6920, 0x73657865, 0x202b205d,
+    0x61746164, 0x6d690a29, 0x5f656761, 0x67696c61,
+    0x203d206e, 0x2878616d, 0x205d345b, 0x615b202b,
+    0x6e67696c, 0x746e656d, 0x20296628, 0x20726f66,
+    0x6e692066, 0x6c696620, 0x295d7365, 0x65730a0a,
+    0x6f697463, 0x3d20736e, 0x0a5d5b20, 0x76206669,
+    0x200a3a32, 0x73202020, 0x69746365, 0x2e736e6f,
+    0x65707061, 0x7328646e, 0x63757274, 0x61702e74,
+    0x27286b63, 0x2549493c, 0x20274964, 0x656c2025,
+    0x6f63286e, 0x6e65746e, 0x2c297374, 0x7a697320,
+    0x6d5f7365, 0x63696761, 0x20200a2c, 0x20202020,
+    0x656c2020, 0x6f63286e, 0x6e65746e, 0x2c297374,
+    0x6c5b2a20, 0x63286e65, 0x6f662029, 0x20632072,
+    0x63206e69, 0x65746e6f, 0x5d73746e, 0x690a2929,
+    0x6e612066, 0x69732879, 0x2973657a, 0x20200a3a,
+    0x65732020, 0x6f697463, 0x612e736e, 0x6e657070,
+    0x74732864, 0x74637572, 0x6361702e, 0x3c27286b,
+    0x64254949, 0x25202749, 0x6e656c20, 0x7a697328,
+    0x2c297365, 0x6d6f6320, 0x73657270, 0x616d5f73,
+    0x2c636967, 0x2020200a, 0x20202020, 0x20202020,
+    0x74706f20, 0x736e6f69, 0x737a6c2e, 0x69775f73,
+    0x776f646e, 0x7469625f, 0x207c2073, 0x6974706f,
+    0x2e736e6f, 0x73737a6c, 0x6f6f6c5f, 0x6568616b,
+    0x625f6461, 0x20737469, 0x38203c3c, 0x20200a2c,
+    0x20202020, 0x20202020, 0x732a2020, 0x73657a69,
+    0x690a2929, 0x706f2066, 0x6e6f6974, 0x61682e73,
+    0x0a3a6873, 0x20202020, 0x74636573, 0x736e6f69,
+    0x7070612e, 0x28646e65, 0x68736168, 0x6261745f,
+    0x6628656c, 0x73656c69, 0x730a2929, 0x69746365,
+    0x5f736e6f, 0x64646170, 0x20676e69, 0x0a30203d,
+    0x73206669, 0x69746365, 0x3a736e6f, 0x2020200a,
+    0x63657320, 0x6e6f6974, 0x61705f73, 0x6e696464,
+    0x203d2067, 0x6e656c2d, 0x29736628, 0x34202520,
+    0x2020200a, 0x20736620, 0x27203d2b, 0x2027305c,
+    0x6573202a, 0x6f697463, 0x705f736e, 0x69646461,
+    0x200a676e, 0x66202020, 0x3d2b2073, 0x2e272720,
+    0x6e696f6a, 0x63657328, 0x6e6f6974, 0x0a0a2973,
+    0x6f206669, 0x6f697470, 0x762e736e, 0x6f627265,
+    0x0a3a6573, 0x20202020, 0x6f206669, 0x6f697470,
+    0x632e736e, 0x72706d6f, 0x3a737365, 0x2020200a,
+    0x20202020, 0x6f747320, 0x20646572, 0x7573203d,
+    0x656c286d, 0x2963286e, 0x726f6620, 0x69206320,
+    0x6f63206e, 0x6e65746e, 0x0a297374, 0x20202020,
+    0x20202020, 0x6e697270, 0x3e3e2074, 0x73797320,
+    0x6474732e, 0x2c727265, 0x6f632720, 0x6572706d,
+    0x6f697373, 0x25203a6e, 0x3e2d2064, 0x20642520,
+    0x332e2528, 0x20272966, 0x72282025, 0x735f7761,
+    0x2c657a69, 0x2020200a, 0x20202020, 0x20202020,
+    0x20202020, 0x6f747320, 0x2c646572, 0x6f6c6620,
+    0x73287461, 0x65726f74, 0x2f202964, 0x77617220,
+    0x7a69735f, 0x66692065, 0x77617220, 0x7a69735f,
+    0x6c652065, 0x31206573, 0x0a29302e, 0x20202020,
+    0x6f706572, 0x3d207472, 0x200a5b20, 0x20202020,
+    0x20202020, 0x28202020, 0x61656827, 0x27726564,
+    0x6568202c, 0x72656461, 0x7a69735f, 0x0a2c2965,
+    0x20202020, 0x20202020, 0x20202020, 0x616e2728,
+    0x2773656d, 0x656c202c, 0x616e286e, 0x2973656d,
+    0x200a2c29, 0x20202020, 0x20202020, 0x28202020,
+    0x6e6f6327, 0x746e6574, 0x202c2773, 0x65646e69,
+    0x202d2078, 0x286e656c, 0x656d616e, 0x2d202973,
+    0x74616420, 0x61705f61, 0x6e696464, 0x0a2c2967,
+    0x20202020, 0x20202020, 0x20202020, 0x61702728,
+    0x6e696464, 0x202c2767, 0x61746164, 0x6461705f,
+    0x676e6964, 0x73202b20, 0x69746365, 0x5f736e6f,
+    0x64646170, 0x29676e69, 0x20200a2c, 0x20202020,
+    0x20202020, 0x27282020, 0x74636573, 0x736e6f69,
+    0x73202c27, 0x6c286d75, 0x73286e65, 0x6f662029,
+    0x20732072, 0x73206e69, 0x69746365, 0x29736e6f,
+    0x200a2c29, 0x20202020, 0x20202020, 0x28202020,
+    0x746f7427, 0x2c276c61, 0x6e656c20, 0x29736628,
+    0x200a2c29, 0x20202020, 0x20202020, 0x5d202020,
+    0x2020200a, 0x20666920, 0x6974706f, 0x2e736e6f,
+    0x75646564, 0x200a3a70, 0x20202020, 0x72202020,
+    0x726f7065, 0x70612e74, 0x646e6570, 0x64272828,
+    0x70756465, 0x76617320, 0x2c276465, 0x64656420,
+    0x735f7075, 0x64657661, 0x200a2929, 0x66202020,
+    0x6e20726f, 0x2c656d61, 0x7a697320, 0x6e692065,
+    0x70657220, 0x3a74726f, 0x2020200a, 0x20202020,
+    0x69727020, 0x3e20746e, 0x7973203e, 0x74732e73,
+    0x72726564, 0x2527202c, 0x25203a73, 0x25202764,
+    0x616e2820, 0x202c656d, 0x657a6973, 0x690a0a29,
+    0x706f2066, 0x6e6f6974, 0x65682e73, 0x72656461,
+    0x20200a3a, 0x61702020, 0x203d2064, 0x6e656c28,
+    0x29736628, 0x33202b20, 0x202f2029, 0x202a2034,
+    0x202d2034, 0x286e656c, 0x0a297366, 0x20202020,
+    0x70206669, 0x0a3a6461, 0x20202020, 0x20202020,
+    0x2b207366, 0x7473203d, 0x74637572, 0x6361702e,
+    0x4227286b, 0x30202c27, 0x202a2029, 0x0a646170,
+    0x20202020, 0x64726f77, 0x203d2073, 0x75727473,
+    0x752e7463, 0x6361706e, 0x3c27286b, 0x27496425,
+    0x28202520, 0x286e656c, 0x20297366, 0x2934202f,
+    0x7366202c, 0x20200a29, 0x696c2020, 0x2073656e,
+    0x205b203d, 0x202a2f27, 0x6f747541, 0x6e65672d,
+    0x74617265, 0x52206465, 0x46204d4f, 0x72662053,
+    0x273a6d6f, 0x200a5d20, 0x6c202020, 0x73656e69,
+    0x203d2b20, 0x2027205b, 0x2d20202a, 0x27732520,
+    0x66202520, 0x726f6620, 0x69206620, 0x6966206e,
+    0x2073656c, 0x20200a5d, 0x74612020, 0x62697274,
+    0x20657475, 0x2728203d, 0x615f5f20, 0x69727474,
+    0x65747562, 0x28205f5f, 0x696c6128, 0x64656e67,
+    0x64252820, 0x27292929, 0x69202520, 0x6567616d,
+    0x696c615f, 0x200a6e67, 0x20202020, 0x20202020,
+    0x69202020, 0x6d692066, 0x5f656761, 0x67696c61,
+    0x203e206e, 0x6c652034, 0x27206573, 0x200a2927,
+    0x6c202020, 0x73656e69, 0x203d2b20, 0x2027205b,
+    0x2c272f2a, 0x2c272720, 0x73252720, 0x736e6f63,
+    0x69752074, 0x3233746e, 0x2520745f, 0x255d5b73,
+    0x203d2073, 0x200a277b, 0x20202020, 0x20202020,
+    0x25202020, 0x706f2820, 0x6e6f6974, 0x74732e73,
+    0x63697461, 0x706f202c, 0x6e6f6974, 0x65682e73,
+    0x72656461, 0x7461202c, 0x62697274, 0x29657475,
+    0x200a5d20, 0x66202020, 0x6920726f, 0x206e6920,
+    0x6e617278, 0x30286567, 0x656c202c, 0x6f77286e,
+    0x29736472, 0x2934202c, 0x20200a3a, 0x20202020,
+    0x20772020, 0x205b203d, 0x25783027, 0x2c783830,
+    0x20252027, 0x6f662069, 0x20692072, 0x77206e69,
+    0x7364726f, 0x693a695b, 0x205d342b, 0x20200a5d,
+    0x20202020, 0x696c2020, 0x2e73656e, 0x65707061,
+    0x2728646e, 0x20202020, 0x202b2027, 0x2e272027,
+    0x6e696f6a, 0x29772820, 0x20200a29, 0x696c2020,
+    0x2073656e, 0x5b203d2b, 0x3b7d2720, 0x27202c27,
+    0x27202c27, 0x6f637325, 0x2074736e, 0x20746e69,
+    0x735f7325, 0x20657a69, 0x6973203d, 0x666f657a,
+    0x73252820, 0x0a273b29, 0x20202020, 0x20202020,
+    0x20202020, 0x6f282025, 0x6f697470, 0x732e736e,
+    0x69746174, 0x6f202c63, 0x6f697470, 0x682e736e,
+    0x65646165, 0x6f202c72, 0x6f697470, 0x682e736e,
+    0x65646165, 0x5d202972, 0x2020200a, 0x74706f20,
+    0x736e6f69, 0x74756f2e, 0x2e747570, 0x74697277,
+    0x5c272865, 0x6a2e276e, 0x286e696f, 0x656e696c,
+    0x0a292973, 0x65736c65, 0x20200a3a, 0x706f2020,
+    0x6e6f6974, 0x756f2e73, 0x74757074, 0x6972772e,
+    0x66286574, 0x000a2973, 0x75202f2f, 0x6c6f6f63,
+    0x2d206269, 0x63694d20, 0x6f636f72, 0x6f72746e,
+    0x72656c6c, 0x6a626f20, 0x20746365, 0x6569726f,
+    0x6465746e, 0x62696c20, 0x79726172, 0x7b7b202e,
+    0x2f2f0a7b, 0x202f2f0a, 0x79706f43, 0x68676972,
+    0x43282074, 0x30322029, 0x4e203531, 0x6c6f6369,
+    0x53207361, 0x646f6863, 0x2f0a7465, 0x2f2f0a2f,
+    0x72655020, 0x7373696d, 0x206e6f69, 0x68207369,
+    0x62657265, 0x72672079, 0x65746e61, 0x66202c64,
+    0x20656572, 0x6320666f, 0x67726168, 0x74202c65,
+    0x6e61206f, 0x65702079, 0x6e6f7372, 0x74626f20,
+    0x696e6961, 0x6120676e, 0x202f2f0a, 0x79706f63,
+    0x20666f20, 0x73696874, 0x666f7320, 0x72617774,
+    0x6e612065, 0x73612064, 0x69636f73, 0x64657461,
+    0x636f6420, 0x6e656d75, 0x69746174, 0x66206e6f,
+    0x73656c69, 0x68742820, 0x53222065, 0x7774666f,
+    0x22657261, 0x2f0a2c29, 0x6f74202f, 0x61656420,
+    0x6e69206c, 0x65687420, 0x666f5320, 0x72617774,
+    0x69772065, 0x756f6874, 0x65722074, 0x69727473,
+    0x6f697463, 0x69202c6e, 0x756c636e, 0x676e6964,
+    0x74697720, 0x74756f68, 0x6d696c20, 0x74617469,
+    0x0a6e6f69, 0x74202f2f, 0x72206568, 0x74686769,
+    0x6f742073, 0x65737520, 0x6f63202c, 0x202c7970,
+    0x69646f6d, 0x202c7966, 0x6772656d, 0x70202c65,
+    0x696c6275, 0x202c6873, 0x74736964, 0x75626972,
+    0x202c6574, 0x6c627573, 0x6e656369, 0x0a2c6573,
+    0x61202f2f, 0x6f2f646e, 0x65732072, 0x63206c6c,
+    0x6569706f, 0x666f2073, 0x65687420, 0x666f5320,
+    0x72617774, 0x61202c65, 0x7420646e, 0x6570206f,
+    0x74696d72, 0x72657020, 0x736e6f73, 0x206f7420,
+    0x6d6f6877, 0x65687420, 0x202f2f0a, 0x74666f53,
+    0x65726177, 0x20736920, 0x6e727566, 0x65687369,
+    0x6f742064, 0x206f6420, 0x202c6f73, 0x6a627573,
+    0x20746365, 0x74206f74, 0x66206568, 0x6f6c6c6f,
+    0x676e6977, 0x6e6f6320, 0x69746964, 0x3a736e6f,
+    0x0a2f2f0a, 0x54202f2f, 0x61206568, 0x65766f62,
+    0x706f6320, 0x67697279, 0x6e207468, 0x6369746f,
+    0x6e612065, 0x68742064, 0x70207369, 0x696d7265,
+    0x6f697373, 0x6f6e206e, 0x65636974, 0x61687320,
+    0x62206c6c, 0x6e692065, 0x64756c63, 0x69206465,
+    0x2f2f0a6e, 0x6c6c6120, 0x706f6320, 0x20736569,
+    0x7320726f, 0x74736275, 0x69746e61, 0x70206c61,
+    0x6974726f, 0x20736e6f, 0x7420666f, 0x53206568,
+    0x7774666f, 0x2e657261, 0x0a2f2f0a, 0x54202f2f,
+    0x53204548, 0x5754464f, 0x20455241, 0x50205349,
+    0x49564f52, 0x20444544, 0x20534122, 0x2c225349,
+    0x54495720, 0x54554f48, 0x52415720, 0x544e4152,
+    0x464f2059, 0x594e4120, 0x4e494b20, 0x45202c44,
+    0x45525058, 0x4f205353, 0x2f2f0a52, 0x504d4920,
+    0x4445494c, 0x4e49202c, 0x44554c43, 0x20474e49,
+    0x20545542, 0x20544f4e, 0x494d494c, 0x20444554,
+    0x54204f54, 0x57204548, 0x41525241, 0x4549544e,
+    0x464f2053, 0x52454d20, 0x4e414843, 0x49424154,
+    0x5954494c, 0x2f2f0a2c, 0x54494620, 0x5353454e,
+    0x524f4620, 0x50204120, 0x49545241, 0x414c5543,
+    0x55502052, 0x534f5052, 0x4e412045, 0x4f4e2044,
+    0x464e494e, 0x474e4952, 0x4e454d45, 0x49202e54,
+    0x4f4e204e, 0x45564520, 0x5320544e, 0x4c4c4148,
+    0x45485420, 0x202f2f0a, 0x48545541, 0x2053524f,
+    0x4320524f, 0x5259504f, 0x54484749, 0x4c4f4820,
+    0x53524544, 0x20454220, 0x4241494c, 0x4620454c,
+    0x4120524f, 0x4320594e, 0x4d49414c, 0x4144202c,
+    0x4547414d, 0x524f2053, 0x48544f20, 0x2f0a5245,
+    0x494c202f, 0x4c494241, 0x2c595449, 0x45485720,
+    0x52454854, 0x204e4920, 0x41204e41, 0x4f495443,
+    0x464f204e, 0x4e4f4320, 0x43415254, 0x54202c54,
+    0x2054524f, 0x4f20524f, 0x52454854, 0x45534957,
+    0x5241202c, 0x4e495349, 0x2f2f0a47, 0x4f524620,
+    0x4f202c4d, 0x4f205455, 0x524f2046, 0x204e4920,
+    0x4e4e4f43, 0x49544345, 0x57204e4f, 0x20485449,
+    0x20454854, 0x54464f53, 0x45524157, 0x20524f20,
+    0x20454854, 0x20455355, 0x4f20524f, 0x52454854,
+    0x202f2f0a, 0x4c414544, 0x53474e49, 0x204e4920,
+    0x20454854, 0x54464f53, 0x45524157, 0x2f2f0a2e,
+    0x202f2f0a, 0x0a7d7d7d, 0x636e6923, 0x6564756c,
+    0x63752220, 0x622f6f6f, 0x2f657361, 0x722f7366,
+    0x73666d6f, 0x6d6f722f, 0x682e7366, 0x0a0a2268,
+    0x636e6923, 0x6564756c, 0x6c613c20, 0x69726f67,
+    0x3e6d6874, 0x6e69230a, 0x64756c63, 0x633c2065,
+    0x69727473, 0x0a3e676e, 0x6d616e0a, 0x61707365,
+    0x75206563, 0x206f6f63, 0x0a0a0a7b, 0x466d6f52,
+    0x523a3a53, 0x53466d6f, 0x65727453, 0x3a3a6d61,
+    0x466d6f52, 0x72745353, 0x206d6165, 0x6e6f6328,
+    0x63207473, 0x20726168, 0x6765622a, 0x202c6e69,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x29646e65,
+    0x2020200a, 0x73203a20, 0x74726174, 0x6228205f,
+    0x6e696765, 0x62202c29, 0x6e696765, 0x6228205f,
+    0x6e696765, 0x65202c29, 0x205f646e, 0x646e6528,
+    0x69230a29, 0x4f432066, 0x4749464e, 0x4f43555f,
+    0x41425f4f, 0x465f4553, 0x4f525f53, 0x5f53464d,
+    0x504d4f43, 0x53534552, 0x535f4445, 0x41455254,
+    0x200a534d, 0x20202020, 0x64202c20, 0x646f6365,
+    0x205f7265, 0x6c756e28, 0x7274706c, 0x73202c29,
+    0x5f657a69, 0x29302820, 0x6f70202c, 0x28205f73,
+    0x230a2930, 0x69646e65, 0x0a7b0a66, 0x230a0a7d,
+    0x43206669, 0x49464e4f, 0x43555f47, 0x425f4f4f,
+    0x5f455341, 0x525f5346, 0x53464d4f, 0x4d4f435f,
+    0x53455250, 0x5f444553, 0x45525453, 0x0a534d41,
+    0x6d6f520a, 0x3a3a5346, 0x466d6f52, 0x72745353,
+    0x3a6d6165, 0x6d6f523a, 0x74535346, 0x6d616572,
+    0x6f632820, 0x2074736e, 0x72616863, 0x65622a20,
+    0x2c6e6967, 0x6e6f6320, 0x63207473, 0x20726168,
+    0x646e652a, 0x20200a2c, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x69202020, 0x7320746e, 0x2c657a69,
+    0x737a4c20, 0x63654473, 0x7265646f, 0x65642a20,
+    0x65646f63, 0x200a2972, 0x3a202020, 0x61747320,
+    0x205f7472, 0x67656228, 0x2c296e69, 0x67656220,
+    0x205f6e69, 0x67656228, 0x2c296e69, 0x646e6520,
+    0x6528205f, 0x2c29646e, 0x63656420, 0x7265646f,
+    0x6428205f, 0x646f6365, 0x2c297265, 0x2020200a,
+    0x73202020, 0x5f657a69, 0x69732820, 0x2c29657a,
+    0x736f7020, 0x3028205f, 0x0a7b0a29, 0x690a0a7d,
+    0x520a746e, 0x53466d6f, 0x6f523a3a, 0x5353466d,
+    0x61657274, 0x723a3a6d, 0x5f646165, 0x706d6f63,
+    0x73736572, 0x28206465, 0x72616863, 0x75622a20,
+    0x69202c66, 0x6320746e, 0x746e756f, 0x0a7b0a29,
+    0x20202020, 0x20746e69, 0x203d206c, 0x3a647473,
+    0x6e696d3a, 0x6f632820, 0x2c746e75, 0x7a697320,
+    0x2d205f65, 0x736f7020, 0x0a3b295f, 0x20202020,
+    0x28206669, 0x0a296c21, 0x20202020, 0x20202020,
+    0x75746572, 0x2d206e72, 0x200a3b32, 0x69202020,
+    0x6f20746e, 0x3d207475, 0x0a3b3020, 0x20202020,
+    0x6c696877, 0x6f282065, 0x3c207475, 0x0a296c20,
+    0x20202020, 0x20200a7b, 0x20202020, 0x6e692020,
+    0x73752074, 0x0a3b6465, 0x20202020, 0x20202020,
+    0x20746e69, 0x203d2072, 0x6f636564, 0x5f726564,
+    0x65643e2d, 0x65646f63, 0x65622820, 0x5f6e6967,
+    0x6e65202c, 0x2d205f64, 0x67656220, 0x2c5f6e69,
+    0x65737520, 0x62202c64, 0x2b206675, 0x74756f20,
+    0x20200a2c, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x202d206c, 0x2974756f, 0x20200a3b,
+    0x20202020, 0x65622020, 0x5f6e6967, 0x203d2b20,
+    0x64657375, 0x20200a3b, 0x20202020, 0x756f2020,
+    0x3d2b2074, 0x0a3b7220, 0x20202020, 0x20202020,
+    0x28206669, 0x26207221, 0x75212026, 0x29646573,
+    0x2020200a, 0x20202020, 0x20202020, 0x202f2f20,
+    0x6e757254, 0x65746163, 0x61642064, 0x0a2e6174,
+    0x20202020, 0x20202020, 0x20202020, 0x61657262,
+    0x200a3b6b, 0x7d202020, 0x2020200a, 0x736f7020,
+    0x3d2b205f, 0x74756f20, 0x20200a3b, 0x65722020,
+    0x6e727574, 0x74756f20, 0x6f203f20, 0x3a207475,
+    0x3b312d20, 0x0a0a7d0a, 0x0a746e69, 0x466d6f52,
+    0x523a3a53, 0x53466d6f, 0x65727453, 0x3a3a6d61,
+    0x6b656573, 0x6d6f635f, 0x73657270, 0x20646573,
+    0x746e6928, 0x66666f20, 0x2c746573, 0x65685720,
+    0x2065636e, 0x6e656877, 0x0a296563, 0x20200a7b,
+    0x6e692020, 0x726f2074, 0x6e696769, 0x20200a3b,
+    0x77732020, 0x68637469, 0x68772820, 0x65636e65,
+    0x20200a29, 0x0a7b2020, 0x20202020, 0x65736163,
+    0x65685720, 0x3a65636e, 0x5445533a, 0x20200a3a,
+    0x20202020, 0x726f2020, 0x6e696769, 0x30203d20,
+    0x20200a3b, 0x20202020, 0x72622020, 0x3b6b6165,
+    0x2020200a, 0x73616320, 0x68572065, 0x65636e65,
+    0x55433a3a, 0x200a3a52, 0x20202020, 0x6f202020,
+    0x69676972, 0x203d206e, 0x5f736f70, 0x20200a3b,
+    0x20202020, 0x72622020, 0x3b6b6165, 0x2020200a,
+    0x73616320, 0x68572065, 0x65636e65, 0x4e453a3a,
+    0x200a3a44, 0x20202020, 0x6f202020, 0x69676972,
+    0x203d206e, 0x657a6973, 0x200a3b5f, 0x20202020,
+    0x62202020, 0x6b616572, 0x20200a3b, 0x65642020,
+    0x6c756166, 0x200a3a74, 0x20202020, 0x61202020,
+    0x72657373, 0x6e755f74, 0x63616572, 0x6c626168,
+    0x29282065, 0x20200a3b, 0x0a7d2020, 0x20202020,
+    0x28206669, 0x7366666f, 0x3c207465, 0x726f2d20,
+    0x6e696769, 0x207c7c20, 0x7366666f, 0x3e207465,
+    0x7a697320, 0x2d205f65, 0x69726f20, 0x296e6967,
+    0x2020200a, 0x20202020, 0x74657220, 0x206e7275,
+    0x0a3b312d, 0x20202020, 0x20746e69, 0x20736f70,
+    0x726f203d, 0x6e696769, 0x6f202b20, 0x65736666,
+    0x200a3b74, 0x69202020, 0x70282066, 0x3c20736f,
+    0x736f7020, 0x200a295f, 0x7b202020, 0x2020200a,
+    0x20202020, 0x202f2f20, 0x206e6143, 0x20746f6e,
+    0x62206f67, 0x776b6361, 0x2c647261, 0x63656420,
+    0x2065646f, 0x69616761, 0x7266206e, 0x73206d6f,
+    0x74726174, 0x20200a2e, 0x20202020, 0x642a2020,
+    0x646f6365, 0x205f7265, 0x7a4c203d, 0x65447373,
+    0x65646f63, 0x29282072, 0x20200a3b, 0x20202020,
+    0x65622020, 0x5f6e6967, 0x73203d20, 0x74726174,
+    0x200a3b5f, 0x20202020, 0x70202020, 0x205f736f,
+    0x3b30203d, 0x2020200a, 0x200a7d20, 0x77202020,
+    0x656c6968, 0x6f702820, 0x3c205f73, 0x736f7020,
+    0x20200a29, 0x0a7b2020, 0x20202020, 0x20202020,
+    0x72616863, 0x66756220, 0x5d32335b, 0x20200a3b,
+    0x20202020, 0x6e692020, 0x20722074, 0x6572203d,
+    0x635f6461, 0x72706d6f, 0x65737365, 0x62282064,
+    0x202c6675, 0x3a647473, 0x6e696d3a, 0x746e693c,
+    0x7328203e, 0x6f657a69, 0x62282066, 0x2c296675,
+    0x2020200a, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x6f702020, 0x202d2073, 0x5f736f70,
+    0x0a3b2929, 0x20202020, 0x20202020, 0x28206669,
+    0x203c2072, 0x200a2930, 0x20202020, 0x20202020,
+    0x72202020, 0x72757465, 0x312d206e, 0x20200a3b,
+    0x0a7d2020, 0x20202020, 0x75746572, 0x70206e72,
+    0x3b5f736f, 0x0a0a7d0a, 0x646e6523, 0x2f206669,
+    0x4f43202f, 0x4749464e, 0x4f43555f, 0x41425f4f,
+    0x465f4553, 0x4f525f53, 0x5f53464d, 0x504d4f43,
+    0x53534552, 0x535f4445, 0x41455254, 0x0a0a534d,
+    0x0a746e69, 0x466d6f52, 0x523a3a53, 0x53466d6f,
+    0x65727453, 0x3a3a6d61, 0x64616572, 0x68632820,
+    0x2a207261, 0x2c667562, 0x746e6920, 0x756f6320,
+    0x0a29746e, 0x69230a7b, 0x4f432066, 0x4749464e,
+    0x4f43555f, 0x41425f4f, 0x465f4553, 0x4f525f53,
+    0x5f53464d, 0x504d4f43, 0x53534552, 0x535f4445,
+    0x41455254, 0x200a534d, 0x69202020, 0x64282066,
+    0x646f6365, 0x295f7265, 0x2020200a, 0x20202020,
+    0x74657220, 0x206e7275, 0x64616572, 0x6d6f635f,
+    0x73657270, 0x20646573, 0x66756228, 0x6f63202c,
+    0x29746e75, 0x65230a3b, 0x6669646e, 0x2020200a,
+    0x746e6920, 0x3d206c20, 0x64747320, 0x696d3a3a,
+    0x6e693c6e, 0x28203e74, 0x6e756f63, 0x65202c74,
+    0x205f646e, 0x6562202d, 0x5f6e6967, 0x200a3b29,
+    0x69202020, 0x21282066, 0x200a296c, 0x20202020,
+    0x72202020, 0x72757465, 0x322d206e, 0x20200a3b,
+    0x6c652020, 0x200a6573, 0x7b202020, 0x2020200a,
+    0x20202020, 0x64747320, 0x6f633a3a, 0x28207970,
+    0x69676562, 0x202c5f6e, 0x69676562, 0x2b205f6e,
+    0x202c6c20, 0x29667562, 0x20200a3b, 0x20202020,
+    0x65622020, 0x5f6e6967, 0x203d2b20, 0x200a3b6c,
+    0x20202020, 0x72202020, 0x72757465, 0x3b6c206e,
+    0x2020200a, 0x7d0a7d20, 0x6e690a0a, 0x6f520a74,
+    0x3a53466d, 0x6d6f523a, 0x74535346, 0x6d616572,
+    0x72773a3a, 0x20657469, 0x6e6f6328, 0x63207473,
+    0x20726168, 0x6675622a, 0x6e69202c, 0x6f632074,
+    0x29746e75, 0x200a7b0a, 0x72202020, 0x72757465,
+    0x312d206e, 0x0a7d0a3b, 0x746e690a, 0x6d6f520a,
+    0x3a3a5346, 0x466d6f52, 0x72745353, 0x3a6d6165,
+    0x6c6f703a, 0x2928206c, 0x230a7b0a, 0x43206669,
+    0x49464e4f, 0x43555f47, 0x425f4f4f, 0x5f455341,
+    0x525f5346, 0x53464d4f, 0x4d4f435f, 0x53455250,
+    0x5f444553, 0x45525453, 0x0a534d41, 0x20202020,
+    0x28206669, 0x6f636564, 0x5f726564, 0x20200a29,
+    0x20202020, 0x65722020, 0x6e727574, 0x7a697320,
+    0x2d205f65, 0x736f7020, 0x230a3b5f, 0x69646e65,
+    0x20200a66, 0x65722020, 0x6e727574, 0x646e6520,
+    0x202d205f, 0x69676562, 0x0a3b5f6e, 0x690a0a7d,
+    0x520a746e, 0x53466d6f, 0x6f523a3a, 0x5353466d,
+    0x61657274, 0x733a3a6d, 0x206b6565, 0x746e6928,
+    0x66666f20, 0x2c746573, 0x65685720, 0x2065636e,
+    0x6e656877, 0x2a2f6563, 0x2a544553, 0x7b0a292f,
+    0x6669230a, 0x4e4f4320, 0x5f474946, 0x4f4f4355,
+    0x5341425f, 0x53465f45, 0x4d4f525f, 0x435f5346,
+    0x52504d4f, 0x45535345, 0x54535f44, 0x4d414552,
+    0x20200a53, 0x66692020, 0x65642820, 0x65646f63,
+    0x0a295f72, 0x20202020, 0x20202020, 0x75746572,
+    0x73206e72, 0x5f6b6565, 0x706d6f63, 0x73736572,
+    0x28206465, 0x7366666f, 0x202c7465, 0x6e656877,
+    0x3b296563, 0x6e65230a, 0x0a666964, 0x20202020,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x6769726f,
+    0x0a3b6e69, 0x20202020, 0x74697773, 0x28206863,
+    0x6e656877, 0x0a296563, 0x20202020, 0x20200a7b,
+    0x61632020, 0x57206573, 0x636e6568, 0x533a3a65,
+    0x0a3a5445, 0x20202020, 0x20202020, 0x6769726f,
+    0x3d206e69, 0x61747320, 0x3b5f7472, 0x2020200a,
+    0x20202020, 0x65726220, 0x0a3b6b61, 0x20202020,
+    0x65736163, 0x65685720, 0x3a65636e, 0x5255433a,
+    0x20200a3a, 0x20202020, 0x726f2020, 0x6e696769,
+    0x62203d20, 0x6e696765, 0x200a3b5f, 0x20202020,
+    0x62202020, 0x6b616572, 0x20200a3b, 0x61632020,
+    0x57206573, 0x636e6568, 0x453a3a65, 0x0a3a444e,
+    0x20202020, 0x20202020, 0x6769726f, 0x3d206e69,
+    0x646e6520, 0x200a3b5f, 0x20202020, 0x62202020,
+    0x6b616572, 0x20200a3b, 0x65642020, 0x6c756166,
+    0x200a3a74, 0x20202020, 0x61202020, 0x72657373,
+    0x6e755f74, 0x63616572, 0x6c626168, 0x29282065,
+    0x20200a3b, 0x0a7d2020, 0x20202020, 0x28206669,
+    0x7366666f, 0x3c207465, 0x61747320, 0x205f7472,
+    0x726f202d, 0x6e696769, 0x207c7c20, 0x7366666f,
+    0x3e207465, 0x646e6520, 0x202d205f, 0x6769726f,
+    0x0a296e69, 0x20202020, 0x20202020, 0x75746572,
+    0x2d206e72, 0x200a3b31, 0x62202020, 0x6e696765,
+    0x203d205f, 0x6769726f, 0x2b206e69, 0x66666f20,
+    0x3b746573, 0x2020200a, 0x74657220, 0x206e7275,
+    0x69676562, 0x2d205f6e, 0x61747320, 0x3b5f7472,
+    0x0a0a7d0a, 0x0a746e69, 0x466d6f52, 0x523a3a53,
+    0x53466d6f, 0x65727453, 0x3a3a6d61, 0x657a6973,
+    0x0a292820, 0x69230a7b, 0x4f432066, 0x4749464e,
+    0x4f43555f, 0x41425f4f, 0x465f4553, 0x4f525f53,
+    0x5f53464d, 0x504d4f43, 0x53534552, 0x535f4445,
+    0x41455254, 0x200a534d, 0x69202020, 0x64282066,
+    0x646f6365, 0x295f7265, 0x2020200a, 0x20202020,
+    0x74657220, 0x206e7275, 0x657a6973, 0x230a3b5f,
+    0x69646e65, 0x20200a66, 0x65722020, 0x6e727574,
+    0x646e6520, 0x202d205f, 0x72617473, 0x0a3b5f74,
+    0x520a0a7d, 0x53466d6f, 0x6f523a3a, 0x2053466d,
+    0x6e6f6328, 0x75207473, 0x33746e69, 0x20745f32,
+    0x6464612a, 0x69202c72, 0x7320746e, 0x29657a69,
+    0x2020200a, 0x66203a20, 0x73656c69, 0x73657a69,
+    0x6e28205f, 0x706c6c75, 0x2c297274, 0x73616820,
+    0x28205f68, 0x6c6c756e, 0x29727470, 0x6168202c,
+    0x6d5f6873, 0x5f6b7361, 0x29302820, 0x20200a2c,
+    0x20202020, 0x6f636564, 0x6572706d, 0x64657373,
+    0x7a69735f, 0x205f7365, 0x6c756e28, 0x7274706c,
+    0x0a7b0a29, 0x20202020, 0x6f6f6375, 0x73613a3a,
+    0x74726573, 0x69732820, 0x3e20657a, 0x3231203d,
+    0x200a3b29, 0x62202020, 0x206c6f6f, 0x3d203276,
+    0x64646120, 0x5d305b72, 0x203d3d20, 0x32337830,
+    0x66366436, 0x203b3235, 0x52202f2f, 0x0a326d6f,
+    0x20202020, 0x6f6f6375, 0x73613a3a, 0x74726573,
+    0x32762820, 0x207c7c20, 0x72646461, 0x205d305b,
+    0x30203d3d, 0x36363478, 0x35663664, 0x203b2932,
+    0x52202f2f, 0x0a466d6f, 0x20202020, 0x656c6966,
+    0x6f635f73, 0x5f746e75, 0x61203d20, 0x5b726464,
+    0x0a3b5d31, 0x20202020, 0x20746e69, 0x64616568,
+    0x775f7265, 0x7364726f, 0x33203d20, 0x32202b20,
+    0x66202a20, 0x73656c69, 0x756f635f, 0x205f746e,
+    0x7628202b, 0x203f2032, 0x203a2031, 0x0a3b2930,
+    0x20202020, 0x6f6f6375, 0x73613a3a, 0x74726573,
+    0x69732820, 0x3e20657a, 0x2034203d, 0x6568202a,
+    0x72656461, 0x726f775f, 0x3b297364, 0x2020200a,
+    0x6c696620, 0x6d616e65, 0x205f7365, 0x6126203d,
+    0x5b726464, 0x0a3b5d32, 0x20202020, 0x656c6966,
+    0x746e6f63, 0x73746e65, 0x203d205f, 0x64646126,
+    0x20325b72, 0x6966202b, 0x5f73656c, 0x6e756f63,
+    0x2b205f74, 0x32762820, 0x31203f20, 0x30203a20,
+    0x0a3b5d29, 0x20202020, 0x6f6f6375, 0x73613a3a,
+    0x74726573, 0x69732820, 0x3e20657a, 0x2034203d,
+    0x6568202a, 0x72656461, 0x726f775f, 0x200a7364,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x73202b20, 0x69746174, 0x61635f63, 0x693c7473,
+    0x203e746e, 0x6c696628, 0x6e6f6365, 0x746e6574,
+    0x665b5f73, 0x73656c69, 0x756f635f, 0x5d5f746e,
+    0x0a3b2929, 0x20202020, 0x61746164, 0x203d205f,
+    0x6e696572, 0x70726574, 0x5f746572, 0x74736163,
+    0x6e6f633c, 0x63207473, 0x20726168, 0x28203e2a,
+    0x64646126, 0x65685b72, 0x72656461, 0x726f775f,
+    0x295d7364, 0x20200a3b, 0x2f2f2020, 0x74704f20,
+    0x616e6f69, 0x6573206c, 0x6f697463, 0x0a2e736e,
+    0x20202020, 0x20746e69, 0x65646e69, 0x203d2078,
+    0x64616568, 0x775f7265, 0x7364726f, 0x28202b20,
+    0x656c6966, 0x746e6f63, 0x73746e65, 0x69665b5f,
+    0x5f73656c, 0x6e756f63, 0x205d5f74, 0x2933202b,
+    0x34202f20, 0x20200a3b, 0x6e692020, 0x6f772074,
+    0x20736472, 0x6973203d, 0x2f20657a, 0x0a3b3420,
+    0x20202020, 0x6c696877, 0x69282065, 0x7865646e,
+    0x32202b20, 0x203d3c20, 0x64726f77, 0x200a2973,
+    0x7b202020, 0x2020200a, 0x20202020, 0x20666920,
+    0x64646128, 0x6e695b72, 0x5d786564, 0x203d3d20,
+    0x38347830, 0x66366436, 0x20293235, 0x52202f2f,
+    0x0a486d6f, 0x20202020, 0x20202020, 0x20200a7b,
+    0x20202020, 0x20202020, 0x69752020, 0x3233746e,
+    0x7320745f, 0x73746f6c, 0x61203d20, 0x5b726464,
+    0x65646e69, 0x202b2078, 0x0a3b5d31, 0x20202020,
+    0x20202020, 0x20202020, 0x6f6f6375, 0x73613a3a,
+    0x74726573, 0x6c732820, 0x2073746f, 0x28202626,
+    0x746f6c73, 0x20262073, 0x6f6c7328, 0x2d207374,
+    0x29293120, 0x203d3d20, 0x0a3b2930, 0x20202020,
+    0x20202020, 0x20202020, 0x6f6f6375, 0x73613a3a,
+    0x74726573, 0x6e692820, 0x20786564, 0x2032202b,
+    0x7473202b, 0x63697461, 0x7361635f, 0x6e693c74,
+    0x28203e74, 0x746f6c73, 0x202b2073, 0x2f202931,
+    0x200a3220, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x203d3c20,
+    0x64726f77, 0x0a3b2973, 0x20202020, 0x20202020,
+    0x20202020, 0x68736168, 0x203d205f, 0x6e696572,
+    0x70726574, 0x5f746572, 0x74736163, 0x6e6f633c,
+    0x75207473, 0x31746e69, 0x20745f36, 0x28203e2a,
+    0x64646126, 0x6e695b72, 0x20786564, 0x5d32202b,
+    0x200a3b29, 0x20202020, 0x20202020, 0x68202020,
+    0x5f687361, 0x6b73616d, 0x203d205f, 0x746f6c73,
+    0x202d2073, 0x200a3b31, 0x20202020, 0x20202020,
+    0x69202020, 0x7865646e, 0x203d2b20, 0x202b2032,
+    0x6f6c7328, 0x2b207374, 0x20293120, 0x3b32202f,
+    0x2020200a, 0x20202020, 0x200a7d20, 0x20202020,
+    0x65202020, 0x2065736c, 0x28206669, 0x72646461,
+    0x646e695b, 0x205d7865, 0x30203d3d, 0x36333578,
+    0x35663664, 0x2f202932, 0x6f52202f, 0x200a536d,
+    0x20202020, 0x7b202020, 0x2020200a, 0x20202020,
+    0x20202020, 0x6f637520, 0x613a3a6f, 0x72657373,
+    0x73282074, 0x69746174, 0x61635f63, 0x693c7473,
+    0x203e746e, 0x64646128, 0x6e695b72, 0x20786564,
+    0x5d31202b, 0x3d3d2029, 0x6c696620, 0x635f7365,
+    0x746e756f, 0x0a3b295f, 0x20202020, 0x20202020,
+    0x20202020, 0x6f6f6375, 0x73613a3a, 0x74726573,
+    0x6e692820, 0x20786564, 0x2032202b, 0x6966202b,
+    0x5f73656c, 0x6e756f63, 0x3c205f74, 0x6f77203d,
+    0x29736472, 0x20200a3b, 0x20202020, 0x20202020,
+    0x69662020, 0x6973656c, 0x5f73657a, 0x26203d20,
+    0x72646461, 0x646e695b, 0x2b207865, 0x3b5d3220,
+    0x2020200a, 0x20202020, 0x20202020, 0x646e6920,
+    0x2b207865, 0x2032203d, 0x6966202b, 0x5f73656c,
+    0x6e756f63, 0x0a3b5f74, 0x20202020, 0x20202020,
+    0x20200a7d, 0x20202020, 0x6c652020, 0x69206573,
+    0x61282066, 0x5b726464, 0x65646e69, 0x3d205d78,
+    0x7830203d, 0x64366135, 0x32356636, 0x2f2f2029,
+    0x6d6f5220, 0x20200a5a, 0x20202020, 0x0a7b2020,
+    0x20666923, 0x464e4f43, 0x555f4749, 0x5f4f4f43,
+    0x45534142, 0x5f53465f, 0x464d4f52, 0x4f435f53,
+    0x4552504d, 0x44455353, 0x5254535f, 0x534d4145,
+    0x2020200a, 0x20202020, 0x20202020, 0x6f637520,
+    0x613a3a6f, 0x72657373, 0x61282074, 0x5b726464,
+    0x65646e69, 0x202b2078, 0x3d205d31, 0x7473203d,
+    0x63697461, 0x7361635f, 0x69753c74, 0x3233746e,
+    0x203e745f, 0x20200a28, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x7a4c2020, 0x3a3a7373,
+    0x646e6977, 0x625f776f, 0x20737469, 0x7a4c207c,
+    0x3a3a7373, 0x6b6f6f6c, 0x61656861, 0x69625f64,
+    0x3c207374, 0x2938203c, 0x230a3b29, 0x69646e65,
+    0x20200a66, 0x20202020, 0x20202020, 0x63752020,
+    0x3a3a6f6f, 0x65737361, 0x28207472, 0x65646e69,
+    0x202b2078, 0x202b2032, 0x656c6966, 0x6f635f73,
+    0x5f746e75, 0x203d3c20, 0x64726f77, 0x0a3b2973,
+    0x20202020, 0x20202020, 0x20202020, 0x6f636564,
+    0x6572706d, 0x64657373, 0x7a69735f, 0x205f7365,
+    0x6126203d, 0x5b726464, 0x65646e69, 0x202b2078,
+    0x0a3b5d32, 0x20202020, 0x20202020, 0x20202020,
+    0x65646e69, 0x3d2b2078, 0x2b203220, 0x6c696620,
+    0x635f7365, 0x746e756f, 0x200a3b5f, 0x20202020,
+    0x7d202020, 0x2020200a, 0x20202020, 0x736c6520,
+    0x20200a65, 0x20202020, 0x20202020, 0x72622020,
+    0x3b6b6165, 0x2020200a, 0x200a7d20, 0x75202020,
+    0x3a6f6f63, 0x7373613a, 0x20747265, 0x32762128,
+    0x207c7c20, 0x656c6966, 0x657a6973, 0x3b295f73,
+    0x0a0a7d0a, 0x74617473, 0x69206369, 0x660a746e,
+    0x6e656c69, 0x5f656d61, 0x706d6f63, 0x20657261,
+    0x6e6f6328, 0x63207473, 0x20726168, 0x202c612a,
+    0x20746e69, 0x656c5f61, 0x63202c6e, 0x74736e6f,
+    0x61686320, 0x622a2072, 0x6e69202c, 0x5f622074,
+    0x296e656c, 0x200a7b0a, 0x69202020, 0x6220746e,
+    0x20706d63, 0x7473203d, 0x6d3a3a64, 0x6d636d65,
+    0x61282070, 0x2c62202c, 0x64747320, 0x696d3a3a,
+    0x6128206e, 0x6e656c5f, 0x5f62202c, 0x296e656c,
+    0x200a3b29, 0x69202020, 0x62282066, 0x20706d63,
+    0x30203d3d, 0x20200a29, 0x20202020, 0x65722020,
+    0x6e727574, 0x6c5f6120, 0x2d206e65, 0x6c5f6220,
+    0x0a3b6e65, 0x20202020, 0x65736c65, 0x2020200a,
+    0x20202020, 0x74657220, 0x206e7275, 0x706d6362,
+    0x0a7d0a3b, 0x2f2f2f0a, 0x6d6f4320, 0x65747570,
+    0x564e4620, 0x2061312d, 0x68736168, 0x20666f20,
+    0x74732061, 0x676e6972, 0x74730a2e, 0x63697461,
+    0x6e697520, 0x5f323374, 0x6e660a74, 0x20613176,
+    0x6e6f6328, 0x63207473, 0x20726168, 0x202c732a,
+    0x20746e69, 0x296e656c, 0x200a7b0a, 0x75202020,
+    0x33746e69, 0x20745f32, 0x203d2068, 0x31387830,
+    0x64396331, 0x0a3b3563, 0x20202020, 0x20726f66,
+    0x746e6928, 0x3d206920, 0x203b3020, 0x203c2069,
+    0x3b6e656c, 0x2b2b6920, 0x20200a29, 0x20202020,
+    0x20682020, 0x6828203d, 0x73205e20, 0x69746174,
+    0x61635f63, 0x753c7473, 0x38746e69, 0x203e745f,
+    0x695b7328, 0x2029295d, 0x7830202a, 0x30303130,
+    0x33393130, 0x20200a3b, 0x65722020, 0x6e727574,
+    0x0a3b6820, 0x690a0a7d, 0x520a746e, 0x53466d6f,
+    0x69663a3a, 0x2820646e, 0x736e6f63, 0x68632074,
+    0x2a207261, 0x656c6966, 0x656d616e, 0x6e69202c,
+    0x69662074, 0x616e656c, 0x6c5f656d, 0x20296e65,
+    0x736e6f63, 0x0a7b0a74, 0x20202020, 0x28206669,
+    0x68736168, 0x200a295f, 0x7b202020, 0x2020200a,
+    0x20202020, 0x202f2f20, 0x68736148, 0x62617420,
+    0x7320656c, 0x63726165, 0x74202c68, 0x656c6261,
+    0x20736920, 0x6576656e, 0x75662072, 0x0a2e6c6c,
+    0x20202020, 0x20202020, 0x746e6975, 0x745f3233,
+    0x6f6c7320, 0x203d2074, 0x31766e66, 0x66282061,
+    0x6e656c69, 0x2c656d61, 0x6c696620, 0x6d616e65,
+    0x656c5f65, 0x2620296e, 0x73616820, 0x616d5f68,
+    0x3b5f6b73, 0x2020200a, 0x20202020, 0x746e6920,
+    0x0a3b6520, 0x20202020, 0x20202020, 0x6c696877,
+    0x28282065, 0x203d2065, 0x68736168, 0x6c735b5f,
+    0x295d746f, 0x20200a29, 0x20202020, 0x0a7b2020,
+    0x20202020, 0x20202020, 0x20202020, 0x20746e69,
+    0x203d2069, 0x202d2065, 0x200a3b31, 0x20202020,
+    0x20202020, 0x63202020, 0x74736e6f, 0x61686320,
+    0x692a2072, 0x6d616e5f, 0x203d2065, 0x61746164,
+    0x202b205f, 0x656c6966, 0x656d616e, 0x695b5f73,
+    0x200a3b5d, 0x20202020, 0x20202020, 0x69202020,
+    0x6920746e, 0x6e656c5f, 0x66203d20, 0x6e656c69,
+    0x73656d61, 0x20695b5f, 0x5d31202b, 0x66202d20,
+    0x6e656c69, 0x73656d61, 0x5d695b5f, 0x20200a3b,
+    0x20202020, 0x20202020, 0x66692020, 0x69662820,
+    0x616e656c, 0x6c5f656d, 0x3d206e65, 0x5f69203d,
+    0x0a6e656c, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x73202626, 0x3a3a6474, 0x636d656d,
+    0x2820706d, 0x656c6966, 0x656d616e, 0x5f69202c,
+    0x656d616e, 0x5f69202c, 0x296e656c, 0x203d3d20,
+    0x200a2930, 0x20202020, 0x20202020, 0x20202020,
+    0x72202020, 0x72757465, 0x3b69206e, 0x2020200a,
+    0x20202020, 0x20202020, 0x6f6c7320, 0x203d2074,
+    0x6f6c7328, 0x202b2074, 0x26202931, 0x73616820,
+    0x616d5f68, 0x3b5f6b73, 0x2020200a, 0x20202020,
+    0x200a7d20, 0x20202020, 0x72202020, 0x72757465,
+    0x312d206e, 0x20200a3b, 0x0a7d2020, 0x20202020,
+    0x44202f2f, 0x6f686369, 0x796d6f74, 0x61657320,
+    0x2e686372, 0x2020200a, 0x746e6920, 0x3d206920,
+    0x776f6c20, 0x625f7265, 0x646e756f, 0x69662820,
+    0x616e656c, 0x202c656d, 0x656c6966, 0x656d616e,
+    0x6e656c5f, 0x200a3b29, 0x69202020, 0x69282066,
+    0x66203c20, 0x73656c69, 0x756f635f, 0x0a5f746e,
+    0x20202020, 0x20202020, 0x66202626, 0x6e656c69,
+    0x5f656d61, 0x706d6f63, 0x20657261, 0x6c696628,
+    0x6d616e65, 0x66202c65, 0x6e656c69, 0x5f656d61,
+    0x2c6e656c, 0x74616420, 0x2b205f61, 0x6c696620,
+    0x6d616e65, 0x5b5f7365, 0x0a2c5d69, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x6c696620, 0x6d616e65,
+    0x5b5f7365, 0x202b2069, 0x2d205d31, 0x6c696620,
+    0x6d616e65, 0x5b5f7365, 0x20295d69, 0x30203d3d,
+    0x20200a29, 0x20202020, 0x65722020, 0x6e727574,
+    0x0a3b6920, 0x20202020, 0x75746572, 0x2d206e72,
+    0x7d0a3b31, 0x6e690a0a, 0x6f520a74, 0x3a53466d,
+    0x776f6c3a, 0x625f7265, 0x646e756f, 0x6f632820,
+    0x2074736e, 0x72616863, 0x69662a20, 0x616e656c,
+    0x202c656d, 0x20746e69, 0x656c6966, 0x656d616e,
+    0x6e656c5f, 0x6f632029, 0x0a74736e, 0x20200a7b,
+    0x6e692020, 0x65622074, 0x206e6967, 0x3b30203d,
+    0x2020200a, 0x746e6920, 0x646e6520, 0x66203d20,
+    0x73656c69, 0x756f635f, 0x3b5f746e, 0x2020200a,
+    0x69687720, 0x2820656c, 0x69676562, 0x3d21206e,
+    0x646e6520, 0x20200a29, 0x0a7b2020, 0x20202020,
+    0x20202020, 0x20746e69, 0x203d2069, 0x69676562,
+    0x202b206e, 0x646e6528, 0x62202d20, 0x6e696765,
+    0x202f2029, 0x200a3b32, 0x20202020, 0x2f202020,
+    0x6f43202f, 0x7261706d, 0x69662065, 0x6e20656c,
+    0x2e656d61, 0x2020200a, 0x20202020, 0x6e6f6320,
+    0x63207473, 0x20726168, 0x6e5f692a, 0x20656d61,
+    0x6164203d, 0x205f6174, 0x6966202b, 0x616e656c,
+    0x5f73656d, 0x3b5d695b, 0x2020200a, 0x20202020,
+    0x746e6920, 0x6c5f6920, 0x3d206e65, 0x6c696620,
+    0x6d616e65, 0x5b5f7365, 0x202b2069, 0x2d205d31,
+    0x6c696620, 0x6d616e65, 0x5b5f7365, 0x0a3b5d69,
+    0x20202020, 0x20202020, 0x20746e69, 0x20706d63,
+    0x6966203d, 0x616e656c, 0x635f656d, 0x61706d6f,
+    0x28206572, 0x656c6966, 0x656d616e, 0x6966202c,
+    0x616e656c, 0x6c5f656d, 0x202c6e65, 0x616e5f69,
+    0x202c656d, 0x656c5f69, 0x0a3b296e, 0x20202020,
+    0x20202020, 0x28206669, 0x20706d63, 0x30203d3c,
+    0x20200a29, 0x20202020, 0x20202020, 0x6e652020,
+    0x203d2064, 0x200a3b69, 0x20202020, 0x65202020,
+    0x0a65736c, 0x20202020, 0x20202020, 0x20202020,
+    0x69676562, 0x203d206e, 0x202b2069, 0x200a3b31,
+    0x7d202020, 0x2020200a, 0x74657220, 0x206e7275,
+    0x69676562, 0x7d0a3b6e, 0x74530a0a, 0x6d616572,
+    0x520a2a20, 0x53466d6f, 0x706f3a3a, 0x28206e65,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x656c6966,
+    0x656d616e, 0x6f4d202c, 0x6d206564, 0x2c65646f,
+    0x72724520, 0x2620726f, 0x6f727265, 0x7b0a2972,
+    0x2020200a, 0x20666920, 0x646f6d28, 0x3d3d2065,
+    0x646f4d20, 0x573a3a65, 0x45544952, 0x20200a29,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x6f727265,
+    0x203d2072, 0x6f727245, 0x523a3a72, 0x5f444145,
+    0x594c4e4f, 0x20200a3b, 0x20202020, 0x65722020,
+    0x6e727574, 0x6c756e20, 0x7274706c, 0x20200a3b,
+    0x0a7d2020, 0x20202020, 0x20746e69, 0x203d2069,
+    0x646e6966, 0x69662820, 0x616e656c, 0x202c656d,
+    0x3a647473, 0x7274733a, 0x206e656c, 0x6c696628,
+    0x6d616e65, 0x3b292965, 0x2020200a, 0x20666920,
+    0x3c206928, 0x0a293020, 0x20202020, 0x20200a7b,
+    0x20202020, 0x72652020, 0x20726f72, 0x7245203d,
+    0x3a726f72, 0x5f4f4e3a, 0x48435553, 0x4c49465f,
+    0x200a3b45, 0x20202020, 0x72202020, 0x72757465,
+    0x756e206e, 0x74706c6c, 0x200a3b72, 0x7d202020,
+    0x2020200a, 0x6e6f6320, 0x63207473, 0x20726168,
+    0x6765622a, 0x3d206e69, 0x74616420, 0x2b205f61,
+    0x6c696620, 0x6e6f6365, 0x746e6574, 0x695b5f73,
+    0x200a3b5d, 0x63202020, 0x74736e6f, 0x61686320,
+    0x652a2072, 0x3d20646e, 0x67656220, 0x2b206e69,
+    0x6c696620, 0x69735f65, 0x2820657a, 0x0a3b2969,
+    0x20202020, 0x466d6f52, 0x72745353, 0x206d6165,
+    0x0a3b732a, 0x20202020, 0x28206669, 0x6f636564,
+    0x6572706d, 0x64657373, 0x7a69735f, 0x205f7365,
+    0x64202626, 0x6d6f6365, 0x73657270, 0x5f646573,
+    0x657a6973, 0x695b5f73, 0x200a295d, 0x7b202020,
+    0x6669230a, 0x4e4f4320, 0x5f474946, 0x4f4f4355,
+    0x5341425f, 0x53465f45, 0x4d4f525f, 0x435f5346,
+    0x52504d4f, 0x45535345, 0x54535f44, 0x4d414552,
+    0x20200a53, 0x20202020, 0x7a4c2020, 0x65447373,
+    0x65646f63, 0x642a2072, 0x646f6365, 0x3d207265,
+    0x63656420, 0x7265646f, 0x632e5f73, 0x74736e6f,
+    0x74637572, 0x3b292820, 0x2020200a, 0x20202020,
+    0x20666920, 0x65642128, 0x65646f63, 0x200a2972,
+    0x20202020, 0x7b202020, 0x2020200a, 0x20202020,
+    0x20202020, 0x72726520, 0x3d20726f, 0x72724520,
+    0x3a3a726f, 0x5f4f4f54, 0x594e414d, 0x45504f5f,
+    0x49465f4e, 0x3b53454c, 0x2020200a, 0x20202020,
+    0x20202020, 0x74657220, 0x206e7275, 0x6c6c756e,
+    0x3b727470, 0x2020200a, 0x20202020, 0x200a7d20,
+    0x20202020, 0x73202020, 0x70203d20, 0x5f6c6f6f,
+    0x6e6f632e, 0x75727473, 0x28207463, 0x69676562,
+    0x65202c6e, 0x202c646e, 0x6f636564, 0x6572706d,
+    0x64657373, 0x7a69735f, 0x5b5f7365, 0x202c5d69,
+    0x6f636564, 0x29726564, 0x20200a3b, 0x20202020,
+    0x66692020, 0x73212820, 0x20200a29, 0x20202020,
+    0x20202020, 0x65642020, 0x65646f63, 0x2e5f7372,
+    0x74736564, 0x20796f72, 0x63656428, 0x7265646f,
+    0x230a3b29, 0x65736c65, 0x2020200a, 0x20202020,
+    0x202f2f20, 0x706d6f43, 0x73736572, 0x206e6f69,
+    0x70707573, 0x2074726f, 0x64207369, 0x62617369,
+    0x2e64656c, 0x2020200a, 0x20202020, 0x72726520,
+    0x3d20726f, 0x72724520, 0x3a3a726f, 0x45434341,
+    0x445f5353, 0x45494e45, 0x200a3b44, 0x20202020,
+    0x72202020, 0x72757465, 0x756e206e, 0x74706c6c,
+    0x230a3b72, 0x69646e65, 0x20200a66, 0x0a7d2020,
+    0x20202020, 0x65736c65, 0x2020200a, 0x20202020,
+    0x3d207320, 0x6f6f7020, 0x632e5f6c, 0x74736e6f,
+    0x74637572, 0x65622820, 0x2c6e6967, 0x646e6520,
+    0x200a3b29, 0x69202020, 0x21282066, 0x200a2973,
+    0x20202020, 0x65202020, 0x726f7272, 0x45203d20,
+    0x726f7272, 0x4f543a3a, 0x414d5f4f, 0x4f5f594e,
+    0x5f4e4550, 0x454c4946, 0x200a3b53, 0x72202020,
+    0x72757465, 0x3b73206e, 0x0a0a7d0a, 0x64696f76,
+    0x6d6f520a, 0x3a3a5346, 0x736f6c63, 0x53282065,
+    0x61657274, 0x662a206d, 0x29656c69, 0x200a7b0a,
+    0x52202020, 0x53466d6f, 0x65727453, 0x2a206d61,
+    0x203d2073, 0x74617473, 0x635f6369, 0x3c747361,
+    0x466d6f52, 0x72745353, 0x206d6165, 0x28203e2a,
+    0x656c6966, 0x230a3b29, 0x43206669, 0x49464e4f,
+    0x43555f47, 0x425f4f4f, 0x5f455341, 0x525f5346,
+    0x53464d4f, 0x4d4f435f, 0x53455250, 0x5f444553,
+    0x45525453, 0x0a534d41, 0x20202020, 0x28206669,
+    0x643e2d73, 0x646f6365, 0x295f7265, 0x2020200a,
+    0x20202020, 0x63656420, 0x7265646f, 0x642e5f73,
+    0x72747365, 0x2820796f, 0x643e2d73, 0x646f6365,
+    0x295f7265, 0x65230a3b, 0x6669646e, 0x2020200a,
+    0x6f6f7020, 0x642e5f6c, 0x72747365, 0x2820796f,
+    0x0a3b2973, 0x630a0a7d, 0x74736e6f, 0x61686320,
+    0x0a2a2072, 0x466d6f52, 0x6d3a3a53, 0x28207061,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x656c6966,
+    0x656d616e, 0x6e69202c, 0x73262074, 0x2c657a69,
+    0x72724520, 0x2620726f, 0x6f727265, 0x7b0a2972,
+    0x2020200a, 0x746e6920, 0x3d206920, 0x6e696620,
+    0x66282064, 0x6e656c69, 0x2c656d61, 0x64747320,
+    0x74733a3a, 0x6e656c72, 0x69662820, 0x616e656c,
+    0x2929656d, 0x20200a3b, 0x66692020, 0x20692820,
+    0x2930203c, 0x2020200a, 0x200a7b20, 0x20202020,
+    0x65202020, 0x726f7272, 0x45203d20, 0x726f7272,
+    0x4f4e3a3a, 0x4355535f, 0x49465f48, 0x0a3b454c,
+    0x20202020, 0x20202020, 0x75746572, 0x6e206e72,
+    0x706c6c75, 0x0a3b7274, 0x20202020, 0x20200a7d,
+    0x66692020, 0x65642820, 0x706d6f63, 0x73736572,
+    0x735f6465, 0x73657a69, 0x2626205f, 0x63656420,
+    0x72706d6f, 0x65737365, 0x69735f64, 0x5f73657a,
+    0x295d695b, 0x2020200a, 0x200a7b20, 0x20202020,
+    0x65202020, 0x726f7272, 0x45203d20, 0x726f7272,
+    0x4f4e3a3a, 0x55535f54, 0x524f5050, 0x3b444554,
+    0x2020200a, 0x20202020, 0x74657220, 0x206e7275,
+    0x6c6c756e, 0x3b727470, 0x2020200a, 0x200a7d20,
+    0x73202020, 0x20657a69, 0x6966203d, 0x735f656c,
+    0x20657a69, 0x3b296928, 0x2020200a, 0x74657220,
+    0x206e7275, 0x61746164, 0x202b205f, 0x656c6966,
+    0x746e6f63, 0x73746e65, 0x5d695b5f, 0x0a7d0a3b,
+    0x6f6f620a, 0x6f520a6c, 0x3a53466d, 0x6174733a,
+    0x63282074, 0x74736e6f, 0x61686320, 0x662a2072,
+    0x6e656c69, 0x2c656d61, 0x61745320, 0x73262074,
+    0x2c746174, 0x72724520, 0x2620726f, 0x6f727265,
+    0x7b0a2972, 0x2020200a, 0x746e6920, 0x3d206920,
+    0x6e696620, 0x66282064, 0x6e656c69, 0x2c656d61,
+    0x64747320, 0x74733a3a, 0x6e656c72, 0x69662820,
+    0x616e656c, 0x2929656d, 0x20200a3b, 0x66692020,
+    0x20692820, 0x2930203c, 0x2020200a, 0x200a7b20,
+    0x20202020, 0x65202020, 0x726f7272, 0x45203d20,
+    0x726f7272, 0x4f4e3a3a, 0x4355535f, 0x49465f48,
+    0x0a3b454c, 0x20202020, 0x20202020, 0x75746572,
+    0x66206e72, 0x65736c61, 0x20200a3b, 0x0a7d2020,
+    0x20202020, 0x28206669, 0x6f636564, 0x6572706d,
+    0x64657373, 0x7a69735f, 0x205f7365, 0x64202626,
+    0x6d6f6365, 0x73657270, 0x5f646573, 0x657a6973,
+    0x695b5f73, 0x200a295d, 0x20202020, 0x73202020,
+    0x2e746174, 0x657a6973, 0x64203d20, 0x6d6f6365,
+    0x73657270, 0x5f646573, 0x657a6973, 0x695b5f73,
+    0x200a3b5d, 0x65202020, 0x0a65736c, 0x20202020,
+    0x20202020, 0x74617473, 0x7a69732e, 0x203d2065,
+    0x656c6966, 0x7a69735f, 0x69282065, 0x200a3b29,
+    0x72202020, 0x72757465, 0x7274206e, 0x0a3b6575,
+    0x690a0a7d, 0x520a746e, 0x53466d6f, 0x696c3a3a,
+    0x28207473, 0x736e6f63, 0x68632074, 0x2a207261,
+    0x66657270, 0x202c7869, 0x736e6f63, 0x694c2074,
+    0x61437473, 0x61626c6c, 0x26206b63, 0x6c6c6163,
+    0x6b636162, 0x0a7b0a29, 0x20202020, 0x20746e69,
+    0x66657270, 0x6c5f7869, 0x3d206e65, 0x64747320,
+    0x74733a3a, 0x6e656c72, 0x72702820, 0x78696665,
+    0x200a3b29, 0x69202020, 0x6c20746e, 0x65747369,
+    0x203d2064, 0x200a3b30, 0x66202020, 0x2820726f,
+    0x20746e69, 0x203d2069, 0x65776f6c, 0x6f625f72,
+    0x20646e75, 0x65727028, 0x2c786966, 0x65727020,
+    0x5f786966, 0x296e656c, 0x2069203b, 0x6966203c,
+    0x5f73656c, 0x6e756f63, 0x203b5f74, 0x292b2b69,
+    0x2020200a, 0x200a7b20, 0x20202020, 0x63202020,
+    0x74736e6f, 0x61686320, 0x692a2072, 0x6d616e5f,
+    0x203d2065, 0x61746164, 0x202b205f, 0x656c6966,
+    0x656d616e, 0x695b5f73, 0x200a3b5d, 0x20202020,
+    0x69202020, 0x6920746e, 0x6e656c5f, 0x66203d20,
+    0x6e656c69, 0x73656d61, 0x20695b5f, 0x5d31202b,
+    0x66202d20, 0x6e656c69, 0x73656d61, 0x5d695b5f,
+    0x20200a3b, 0x20202020, 0x66692020, 0x5f692820,
+    0x206e656c, 0x7270203c, 0x78696665, 0x6e656c5f,
+    0x2020200a, 0x20202020, 0x20202020, 0x207c7c20,
+    0x3a647473, 0x6d656d3a, 0x20706d63, 0x6e5f6928,
+    0x2c656d61, 0x65727020, 0x2c786966, 0x65727020,
+    0x5f786966, 0x296e656c, 0x203d2120, 0x200a2930,
+    0x20202020, 0x20202020, 0x62202020, 0x6b616572,
+    0x20200a3b, 0x20202020, 0x696c2020, 0x64657473,
+    0x0a3b2b2b, 0x20202020, 0x20202020, 0x28206669,
+    0x6c616321, 0x6361626c, 0x6928206b, 0x6d616e5f,
+    0x69202c65, 0x6e656c5f, 0x200a2929, 0x20202020,
+    0x20202020, 0x62202020, 0x6b616572, 0x20200a3b,
+    0x0a7d2020, 0x20202020, 0x75746572, 0x6c206e72,
+    0x65747369, 0x7d0a3b64, 0x6f760a0a, 0x520a6469,
+    0x53466d6f, 0x6e753a3a, 0x6b6e696c, 0x6f632820,
+    0x2074736e, 0x72616863, 0x69662a20, 0x616e656c,
+    0x0a29656d, 0x20200a7b, 0x2f2f2020, 0x69685420,
+    0x70732073, 0x20656361, 0x6c207369, 0x20746665,
+    0x65746e69, 0x6f69746e, 0x6c6c616e, 0x6c622079,
+    0x2e6b6e61, 0x0a0a7d0a, 0x2f2f207d, 0x6d616e20,
+    0x61707365, 0x75206563, 0x0a6f6f63, 0x6e666923,
+    0x20666564, 0x6f6f6375, 0x7361625f, 0x73665f65,
+    0x6d6f725f, 0x725f7366, 0x73666d6f, 0x0a68685f,
+    0x66656423, 0x20656e69, 0x6f6f6375, 0x7361625f,
+    0x73665f65, 0x6d6f725f, 0x725f7366, 0x73666d6f,
+    0x0a68685f, 0x75202f2f, 0x6c6f6f63, 0x2d206269,
+    0x63694d20, 0x6f636f72, 0x6f72746e, 0x72656c6c,
+    0x6a626f20, 0x20746365, 0x6569726f, 0x6465746e,
+    0x62696c20, 0x79726172, 0x7b7b202e, 0x2f2f0a7b,
+    0x202f2f0a, 0x79706f43, 0x68676972, 0x43282074,
+    0x30322029, 0x4e203531, 0x6c6f6369, 0x53207361,
+    0x646f6863, 0x2f0a7465, 0x2f2f0a2f, 0x72655020,
+    0x7373696d, 0x206e6f69, 0x68207369, 0x62657265,
+    0x72672079, 0x65746e61, 0x66202c64, 0x20656572,
+    0x6320666f, 0x67726168, 0x74202c65, 0x6e61206f,
+    0x65702079, 0x6e6f7372, 0x74626f20, 0x696e6961,
+    0x6120676e, 0x202f2f0a, 0x79706f63, 0x20666f20,
+    0x73696874, 0x666f7320, 0x72617774, 0x6e612065,
+    0x73612064, 0x69636f73, 0x64657461, 0x636f6420,
+    0x6e656d75, 0x69746174, 0x66206e6f, 0x73656c69,
+    0x68742820, 0x53222065, 0x7774666f, 0x22657261,
+    0x2f0a2c29, 0x6f74202f, 0x61656420, 0x6e69206c,
+    0x65687420, 0x666f5320, 0x72617774, 0x69772065,
+    0x756f6874, 0x65722074, 0x69727473, 0x6f697463,
+    0x69202c6e, 0x756c636e, 0x676e6964, 0x74697720,
+    0x74756f68, 0x6d696c20, 0x74617469, 0x0a6e6f69,
+    0x74202f2f, 0x72206568, 0x74686769, 0x6f742073,
+    0x65737520, 0x6f63202c, 0x202c7970, 0x69646f6d,
+    0x202c7966, 0x6772656d, 0x70202c65, 0x696c6275,
+    0x202c6873, 0x74736964, 0x75626972, 0x202c6574,
+    0x6c627573, 0x6e656369, 0x0a2c6573, 0x61202f2f,
+    0x6f2f646e, 0x65732072, 0x63206c6c, 0x6569706f,
+    0x666f2073, 0x65687420, 0x666f5320, 0x72617774,
+    0x61202c65, 0x7420646e, 0x6570206f, 0x74696d72,
+    0x72657020, 0x736e6f73, 0x206f7420, 0x6d6f6877,
+    0x65687420, 0x202f2f0a, 0x74666f53, 0x65726177,
+    0x20736920, 0x6e727566, 0x65687369, 0x6f742064,
+    0x206f6420, 0x202c6f73, 0x6a627573, 0x20746365,
+    0x74206f74, 0x66206568, 0x6f6c6c6f, 0x676e6977,
+    0x6e6f6320, 0x69746964, 0x3a736e6f, 0x0a2f2f0a,
+    0x54202f2f, 0x61206568, 0x65766f62, 0x706f6320,
+    0x67697279, 0x6e207468, 0x6369746f, 0x6e612065,
+    0x68742064, 0x70207369, 0x696d7265, 0x6f697373,
+    0x6f6e206e, 0x65636974, 0x61687320, 0x62206c6c,
+    0x6e692065, 0x64756c63, 0x69206465, 0x2f2f0a6e,
+    0x6c6c6120, 0x706f6320, 0x20736569, 0x7320726f,
+    0x74736275, 0x69746e61, 0x70206c61, 0x6974726f,
+    0x20736e6f, 0x7420666f, 0x53206568, 0x7774666f,
+    0x2e657261, 0x0a2f2f0a, 0x54202f2f, 0x53204548,
+    0x5754464f, 0x20455241, 0x50205349, 0x49564f52,
+    0x20444544, 0x20534122, 0x2c225349, 0x54495720,
+    0x54554f48, 0x52415720, 0x544e4152, 0x464f2059,
+    0x594e4120, 0x4e494b20, 0x45202c44, 0x45525058,
+    0x4f205353, 0x2f2f0a52, 0x504d4920, 0x4445494c,
+    0x4e49202c, 0x44554c43, 0x20474e49, 0x20545542,
+    0x20544f4e, 0x494d494c, 0x20444554, 0x54204f54,
+    0x57204548, 0x41525241, 0x4549544e, 0x464f2053,
+    0x52454d20, 0x4e414843, 0x49424154, 0x5954494c,
+    0x2f2f0a2c, 0x54494620, 0x5353454e, 0x524f4620,
+    0x50204120, 0x49545241, 0x414c5543, 0x55502052,
+    0x534f5052, 0x4e412045, 0x4f4e2044, 0x464e494e,
+    0x474e4952, 0x4e454d45, 0x49202e54, 0x4f4e204e,
+    0x45564520, 0x5320544e, 0x4c4c4148, 0x45485420,
+    0x202f2f0a, 0x48545541, 0x2053524f, 0x4320524f,
+    0x5259504f, 0x54484749, 0x4c4f4820, 0x53524544,
+    0x20454220, 0x4241494c, 0x4620454c, 0x4120524f,
+    0x4320594e, 0x4d49414c, 0x4144202c, 0x4547414d,
+    0x524f2053, 0x48544f20, 0x2f0a5245, 0x494c202f,
+    0x4c494241, 0x2c595449, 0x45485720, 0x52454854,
+    0x204e4920, 0x41204e41, 0x4f495443, 0x464f204e,
+    0x4e4f4320, 0x43415254, 0x54202c54, 0x2054524f,
+    0x4f20524f, 0x52454854, 0x45534957, 0x5241202c,
+    0x4e495349, 0x2f2f0a47, 0x4f524620, 0x4f202c4d,
+    0x4f205455, 0x524f2046, 0x204e4920, 0x4e4e4f43,
+    0x49544345, 0x57204e4f, 0x20485449, 0x20454854,
+    0x54464f53, 0x45524157, 0x20524f20, 0x20454854,
+    0x20455355, 0x4f20524f, 0x52454854, 0x202f2f0a,
+    0x4c414544, 0x53474e49, 0x204e4920, 0x20454854,
+    0x54464f53, 0x45524157, 0x2f2f0a2e, 0x202f2f0a,
+    0x0a7d7d7d, 0x636e6923, 0x6564756c, 0x63752220,
+    0x692f6f6f, 0x2f66746e, 0x656c6966, 0x7379735f,
+    0x2e6d6574, 0x0a226868, 0x636e6923, 0x6564756c,
+    0x63752220, 0x752f6f6f, 0x736c6974, 0x6f6f702f,
+    0x68682e6c, 0x69230a22, 0x756c636e, 0x22206564,
+    0x6f6f6375, 0x6d6f632f, 0x2e6e6f6d, 0x0a226868,
+    0x6e69230a, 0x64756c63, 0x63222065, 0x69666e6f,
+    0x63752f67, 0x622f6f6f, 0x2f657361, 0x722f7366,
+    0x73666d6f, 0x2268682e, 0x69230a0a, 0x4f432066,
+    0x4749464e, 0x4f43555f, 0x41425f4f, 0x465f4553,
+    0x4f525f53, 0x5f53464d, 0x504d4f43, 0x53534552,
+    0x535f4445, 0x41455254, 0x230a534d, 0x636e6920,
+    0x6564756c, 0x63752220, 0x622f6f6f, 0x2f657361,
+    0x73737a6c, 0x737a6c2f, 0x68682e73, 0x65230a22,
+    0x6669646e, 0x616e0a0a, 0x7073656d, 0x20656361,
+    0x6f6f6375, 0x0a0a7b20, 0x202f2f2f, 0x64616552,
+    0x6c6e6f20, 0x69662079, 0x7320656c, 0x65747379,
+    0x72202c6d, 0x20646165, 0x61746164, 0x6f726620,
+    0x2061206d, 0x66667562, 0x0a2e7265, 0x0a2f2f2f,
+    0x202f2f2f, 0x66667542, 0x73207265, 0x63757274,
+    0x65727574, 0x696c202c, 0x656c7474, 0x646e6520,
+    0x3a6e6169, 0x2f2f2f0a, 0x33752020, 0x27203a32,
+    0x466d6f52, 0x2f2f0a27, 0x7520202f, 0x203a3233,
+    0x626d756e, 0x6f207265, 0x69662066, 0x0a73656c,
+    0x202f2f2f, 0x32337520, 0x3a5d6e5b, 0x646e6920,
+    0x73657865, 0x206e6920, 0x61746164, 0x66756220,
+    0x20726566, 0x6620666f, 0x20656c69, 0x656d616e,
+    0x73202c73, 0x6574726f, 0x79622064, 0x6c696620,
+    0x616e2065, 0x0a73656d, 0x202f2f2f, 0x32337520,
+    0x3a5d6e5b, 0x646e6920, 0x73657865, 0x206e6920,
+    0x61746164, 0x66756220, 0x20726566, 0x6620666f,
+    0x20656c69, 0x746e6f63, 0x0a746e65, 0x202f2f2f,
+    0x32337520, 0x6e69203a, 0x20786564, 0x64206e69,
+    0x20617461, 0x66667562, 0x74207265, 0x6966206f,
+    0x20747372, 0x73756e75, 0x62206465, 0x0a657479,
+    0x202f2f2f, 0x61686320, 0x5b5d5b72, 0x203a5d6e,
+    0x656c6966, 0x6d616e20, 0x202c7365, 0x20746f6e,
+    0x6f72657a, 0x72657420, 0x616e696d, 0x0a646574,
+    0x202f2f2f, 0x61686320, 0x5b5d5b72, 0x203a5d6e,
+    0x656c6966, 0x6e6f6320, 0x746e6574, 0x2f2f0a73,
+    0x2f2f0a2f, 0x6556202f, 0x6f697372, 0x2032206e,
+    0x75207369, 0x20646573, 0x6e656877, 0x6c696620,
+    0x6f632065, 0x6e65746e, 0x61207374, 0x61206572,
+    0x6e67696c, 0x6f206465, 0x68732072, 0x64657261,
+    0x74656220, 0x6e656577, 0x2f2f2f0a, 0x65646920,
+    0x6369746e, 0x66206c61, 0x73656c69, 0x2f2f0a3a,
+    0x7520202f, 0x203a3233, 0x6d6f5227, 0x2f0a2732,
+    0x20202f2f, 0x3a323375, 0x6d756e20, 0x20726562,
+    0x6620666f, 0x73656c69, 0x2f2f2f0a, 0x33752020,
+    0x206e5b32, 0x5d31202b, 0x6e69203a, 0x65786564,
+    0x6e692073, 0x74616420, 0x75622061, 0x72656666,
+    0x20666f20, 0x656c6966, 0x6d616e20, 0x202c7365,
+    0x6e656874, 0x646e6520, 0x20666f20, 0x656d616e,
+    0x2f2f0a73, 0x7520202f, 0x6e5b3233, 0x69203a5d,
+    0x7865646e, 0x69207365, 0x6164206e, 0x62206174,
+    0x65666675, 0x666f2072, 0x6c696620, 0x6f632065,
+    0x6e65746e, 0x6e202c74, 0x6e20746f, 0x73656365,
+    0x69726173, 0x2f0a796c, 0x20202f2f, 0x72636e69,
+    0x69736165, 0x2f0a676e, 0x20202f2f, 0x3a323375,
+    0x646e6920, 0x69207865, 0x6164206e, 0x62206174,
+    0x65666675, 0x6f742072, 0x72696620, 0x75207473,
+    0x6573756e, 0x79622064, 0x2f0a6574, 0x20202f2f,
+    0x72616863, 0x6e5b5d5b, 0x66203a5d, 0x20656c69,
+    0x656d616e, 0x6e202c73, 0x7a20746f, 0x206f7265,
+    0x6d726574, 0x74616e69, 0x2f0a6465, 0x20202f2f,
+    0x72616863, 0x5d5b5d5b, 0x6966203a, 0x6320656c,
+    0x65746e6f, 0x2073746e, 0x20646e61, 0x64646170,
+    0x0a676e69, 0x0a2f2f2f, 0x202f2f2f, 0x76206e49,
+    0x69737265, 0x32206e6f, 0x6966202c, 0x7320656c,
+    0x73657a69, 0x65726120, 0x76696720, 0x69206e65,
+    0x2061206e, 0x646e616d, 0x726f7461, 0x69732079,
+    0x2073657a, 0x74636573, 0x2e6e6f69, 0x2f2f2f0a,
+    0x2f2f2f0a, 0x74704f20, 0x616e6f69, 0x20796c6c,
+    0x6c6c6f66, 0x6465776f, 0x20796220, 0x72747865,
+    0x65732061, 0x6f697463, 0x202c736e, 0x67696c61,
+    0x2064656e, 0x33206e6f, 0x69622032, 0x202c7374,
+    0x61206e69, 0x6f20796e, 0x72656472, 0x2f2f0a2e,
+    0x2f2f0a2f, 0x6953202f, 0x3a73657a, 0x2f2f2f0a,
+    0x33752020, 0x27203a32, 0x536d6f52, 0x2f2f0a27,
+    0x7520202f, 0x203a3233, 0x626d756e, 0x6f207265,
+    0x69662066, 0x0a73656c, 0x202f2f2f, 0x32337520,
+    0x3a5d6e5b, 0x6c696620, 0x69732065, 0x202c657a,
+    0x73207361, 0x65726f74, 0x2f2f0a64, 0x2f2f0a2f,
+    0x6148202f, 0x74206873, 0x656c6261, 0x2f2f0a3a,
+    0x7520202f, 0x203a3233, 0x6d6f5227, 0x2f0a2748,
+    0x20202f2f, 0x3a323375, 0x6d756e20, 0x20726562,
+    0x7320666f, 0x73746f6c, 0x2061202c, 0x65776f70,
+    0x666f2072, 0x6f777420, 0x2f2f2f0a, 0x31752020,
+    0x6c735b36, 0x5d73746f, 0x6966203a, 0x6920656c,
+    0x7865646e, 0x756c7020, 0x6e6f2073, 0x6f202c65,
+    0x657a2072, 0x66206f72, 0x6120726f, 0x6d65206e,
+    0x20797470, 0x746f6c73, 0x2f2f2f0a, 0x2f2f2f0a,
+    0x6c694620, 0x61207365, 0x70206572, 0x6563616c,
+    0x6e692064, 0x65687420, 0x6f6c7320, 0x69672074,
+    0x206e6576, 0x74207962, 0x46206568, 0x312d564e,
+    0x61682061, 0x6f206873, 0x68742066, 0x20726965,
+    0x656d616e, 0x726f202c, 0x2f2f2f0a, 0x206e6920,
+    0x20656874, 0x6c6c6f66, 0x6e69776f, 0x72662067,
+    0x73206565, 0x20746f6c, 0x6e696c28, 0x20726165,
+    0x626f7270, 0x29676e69, 0x5720202e, 0x206e6568,
+    0x72656874, 0x73692065, 0x206f6e20, 0x68736168,
+    0x2f2f2f0a, 0x62617420, 0x202c656c, 0x6b6f6f6c,
+    0x75207075, 0x20736573, 0x69642061, 0x746f6863,
+    0x20796d6f, 0x72616573, 0x0a2e6863, 0x0a2f2f2f,
+    0x202f2f2f, 0x706d6f43, 0x73736572, 0x3a6e6f69,
+    0x2f2f2f0a, 0x33752020, 0x27203a32, 0x5a6d6f52,
+    0x2f2f0a27, 0x7520202f, 0x203a3233, 0x53535a4c,
+    0x6e697720, 0x5f776f64, 0x73746962, 0x6c70202c,
+    0x6c207375, 0x616b6f6f, 0x64616568, 0x7469625f,
+    0x3c3c2073, 0x2f0a3820, 0x20202f2f, 0x5b323375,
+    0x203a5d6e, 0x6f636564, 0x6572706d, 0x64657373,
+    0x6c696620, 0x69732065, 0x202c657a, 0x7a20726f,
+    0x206f7265, 0x66206669, 0x20656c69, 0x73207369,
+    0x65726f74, 0x2f2f0a64, 0x2f2f0a2f, 0x6f43202f,
+    0x6572706d, 0x64657373, 0x6c696620, 0x6f632065,
+    0x6e65746e, 0x61207374, 0x4c206572, 0x2053535a,
+    0x6f636e65, 0x2c646564, 0x65687420, 0x72612079,
+    0x65642065, 0x706d6f63, 0x73736572, 0x6f206465,
+    0x6874206e, 0x2f2f0a65, 0x6c66202f, 0x68772079,
+    0x72206e65, 0x2c646165, 0x69687720, 0x6e206863,
+    0x73646565, 0x64206120, 0x646f6365, 0x70207265,
+    0x6f207265, 0x206e6570, 0x656c6966, 0x65732820,
+    0x2f2f0a65, 0x6f63202f, 0x6572706d, 0x64657373,
+    0x7274735f, 0x736d6165, 0x206e6920, 0x666e6f63,
+    0x72756769, 0x6f697461, 0x0a2e296e, 0x73616c63,
+    0x6f522073, 0x2053466d, 0x7570203a, 0x63696c62,
+    0x6c694620, 0x73795365, 0x0a6d6574, 0x20200a7b,
+    0x2f2f2020, 0x7453202f, 0x6d616572, 0x6f726620,
+    0x2061206d, 0x666d6f72, 0x200a2e73, 0x63202020,
+    0x7373616c, 0x6d6f5220, 0x74535346, 0x6d616572,
+    0x70203a20, 0x696c6275, 0x74532063, 0x6d616572,
+    0x2020200a, 0x200a7b20, 0x20202020, 0x62757020,
+    0x3a63696c, 0x2020200a, 0x20202020, 0x2f2f2f20,
+    0x6e6f4320, 0x75727473, 0x726f7463, 0x6f726620,
+    0x2061206d, 0x6f6d656d, 0x63207972, 0x6b6e7568,
+    0x20200a2e, 0x20202020, 0x6f522020, 0x5353466d,
+    0x61657274, 0x6328206d, 0x74736e6f, 0x61686320,
+    0x622a2072, 0x6e696765, 0x6f63202c, 0x2074736e,
+    0x72616863, 0x6e652a20, 0x0a3b2964, 0x20666923,
+    0x464e4f43, 0x555f4749, 0x5f4f4f43, 0x45534142,
+    0x5f53465f, 0x464d4f52, 0x4f435f53, 0x4552504d,
+    0x44455353, 0x5254535f, 0x534d4145, 0x2020200a,
+    0x20202020, 0x2f2f2f20, 0x6e6f4320, 0x75727473,
+    0x726f7463, 0x6f726620, 0x2061206d, 0x706d6f63,
+    0x73736572, 0x6d206465, 0x726f6d65, 0x68632079,
+    0x2c6b6e75, 0x74697720, 0x68742068, 0x69732065,
+    0x6f20657a, 0x20200a66, 0x20202020, 0x2f2f2020,
+    0x6564202f, 0x706d6f63, 0x73736572, 0x64206465,
+    0x2e617461, 0x2020200a, 0x20202020, 0x6d6f5220,
+    0x74535346, 0x6d616572, 0x6f632820, 0x2074736e,
+    0x72616863, 0x65622a20, 0x2c6e6967, 0x6e6f6320,
+    0x63207473, 0x20726168, 0x646e652a, 0x6e69202c,
+    0x69732074, 0x0a2c657a, 0x20202020, 0x20202020,
+    0x20202020, 0x20202020, 0x20202020, 0x737a4c20,
+    0x63654473, 0x7265646f, 0x65642a20, 0x65646f63,
+    0x0a3b2972, 0x646e6523, 0x200a6669, 0x20202020,
+    0x2f202020, 0x53202f2f, 0x53206565, 0x61657274,
+    0x723a3a6d, 0x2e646165, 0x2020200a, 0x20202020,
+    0x746e6920, 0x61657220, 0x63282064, 0x20726168,
+    0x6675622a, 0x6e69202c, 0x6f632074, 0x29746e75,
+    0x65766f20, 0x64697272, 0x200a3b65, 0x20202020,
+    0x2f202020, 0x53202f2f, 0x53206565, 0x61657274,
+    0x773a3a6d, 0x65746972, 0x20200a2e, 0x20202020,
+    0x6e692020, 0x72772074, 0x20657469, 0x6e6f6328,
+    0x63207473, 0x20726168, 0x6675622a, 0x6e69202c,
+    0x6f632074, 0x29746e75, 0x65766f20, 0x64697272,
+    0x200a3b65, 0x20202020, 0x2f202020, 0x53202f2f,
+    0x53206565, 0x61657274, 0x703a3a6d, 0x2e6c6c6f,
+    0x2020200a, 0x20202020, 0x746e6920, 0x6c6f7020,
+    0x2928206c, 0x65766f20, 0x64697272, 0x200a3b65,
+    0x20202020, 0x2f202020, 0x53202f2f, 0x53206565,
+    0x61657274, 0x733a3a6d, 0x2e6b6565, 0x2020200a,
+    0x20202020, 0x746e6920, 0x65657320, 0x6928206b,
+    0x6f20746e, 0x65736666, 0x57202c74, 0x636e6568,
+    0x68772065, 0x65636e65, 0x57203d20, 0x636e6568,
+    0x533a3a65, 0x20295445, 0x7265766f, 0x65646972,
+    0x20200a3b, 0x20202020, 0x2f2f2020, 0x6553202f,
+    0x74532065, 0x6d616572, 0x69733a3a, 0x0a2e657a,
+    0x20202020, 0x20202020, 0x20746e69, 0x657a6973,
+    0x20292820, 0x7265766f, 0x65646972, 0x20200a3b,
+    0x20202020, 0x76697270, 0x3a657461, 0x6669230a,
+    0x4e4f4320, 0x5f474946, 0x4f4f4355, 0x5341425f,
+    0x53465f45, 0x4d4f525f, 0x435f5346, 0x52504d4f,
+    0x45535345, 0x54535f44, 0x4d414552, 0x20200a53,
+    0x20202020, 0x2f2f2020, 0x6552202f, 0x63206461,
+    0x72706d6f, 0x65737365, 0x61642064, 0x0a2e6174,
+    0x20202020, 0x20202020, 0x20746e69, 0x64616572,
+    0x6d6f635f, 0x73657270, 0x20646573, 0x61686328,
+    0x622a2072, 0x202c6675, 0x20746e69, 0x6e756f63,
+    0x0a3b2974, 0x20202020, 0x20202020, 0x202f2f2f,
+    0x6b656553, 0x206e6920, 0x706d6f63, 0x73736572,
+    0x64206465, 0x2c617461, 0x20796220, 0x6f636564,
+    0x676e6964, 0x6f726620, 0x7473206d, 0x20747261,
+    0x6e206669, 0x65646565, 0x200a2e64, 0x20202020,
+    0x69202020, 0x7320746e, 0x5f6b6565, 0x706d6f63,
+    0x73736572, 0x28206465, 0x20746e69, 0x7366666f,
+    0x202c7465, 0x6e656857, 0x77206563, 0x636e6568,
+    0x0a3b2965, 0x646e6523, 0x200a6669, 0x20202020,
+    0x69727020, 0x65746176, 0x20200a3a, 0x20202020,
+    0x72662020, 0x646e6569, 0x616c6320, 0x52207373,
+    0x53466d6f, 0x20200a3b, 0x20202020, 0x2f2f2020,
+    0x6946202f, 0x7320656c, 0x74726174, 0x7563202c,
+    0x6e657272, 0x6f702074, 0x69746973, 0x61206e6f,
+    0x6520646e, 0x202e646e, 0x726f4620, 0x63206120,
+    0x72706d6f, 0x65737365, 0x69662064, 0x0a2c656c,
+    0x20202020, 0x20202020, 0x202f2f2f, 0x73696874,
+    0x20736920, 0x20656874, 0x69736f70, 0x6e6f6974,
+    0x206e6920, 0x706d6f63, 0x73736572, 0x64206465,
+    0x2e617461, 0x2020200a, 0x20202020, 0x6e6f6320,
+    0x63207473, 0x20726168, 0x6174732a, 0x2c5f7472,
+    0x65622a20, 0x5f6e6967, 0x652a202c, 0x3b5f646e,
+    0x6669230a, 0x4e4f4320, 0x5f474946, 0x4f4f4355,
+    0x5341425f, 0x53465f45, 0x4d4f525f, 0x435f5346,
+    0x52504d4f, 0x45535345, 0x54535f44, 0x4d414552,
+    0x20200a53, 0x20202020, 0x2f2f2020, 0x6544202f,
+    0x65646f63, 0x6f662072, 0x6f632072, 0x6572706d,
+    0x64657373, 0x6c696620, 0x6f202c65, 0x756e2072,
+    0x74706c6c, 0x200a2e72, 0x20202020, 0x4c202020,
+    0x4473737a, 0x646f6365, 0x2a207265, 0x6f636564,
+    0x5f726564, 0x20200a3b, 0x20202020, 0x2f2f2020,
+    0x6544202f, 0x706d6f63, 0x73736572, 0x73206465,
+    0x20657a69, 0x20646e61, 0x69736f70, 0x6e6f6974,
+    0x20200a2e, 0x20202020, 0x6e692020, 0x69732074,
+    0x2c5f657a, 0x736f7020, 0x230a3b5f, 0x69646e65,
+    0x20200a66, 0x3b7d2020, 0x7020200a, 0x696c6275,
+    0x200a3a63, 0x2f202020, 0x43202f2f, 0x74736e6f,
+    0x74637572, 0x202c726f, 0x656b6174, 0x6f722073,
+    0x2073666d, 0x72646461, 0x20737365, 0x20646e61,
+    0x657a6973, 0x20200a2e, 0x6f522020, 0x2053466d,
+    0x6e6f6328, 0x75207473, 0x33746e69, 0x20745f32,
+    0x6464612a, 0x69202c72, 0x7320746e, 0x29657a69,
+    0x20200a3b, 0x2f2f2020, 0x6553202f, 0x69462065,
+    0x7953656c, 0x6d657473, 0x706f3a3a, 0x0a2e6e65,
+    0x20202020, 0x65727453, 0x2a206d61, 0x6e65706f,
+    0x6f632820, 0x2074736e, 0x72616863, 0x69662a20,
+    0x616e656c, 0x202c656d, 0x65646f4d, 0x646f6d20,
+    0x45202c65, 0x726f7272, 0x72652620, 0x29726f72,
+    0x65766f20, 0x64697272, 0x200a3b65, 0x53202020,
+    0x61657274, 0x6f2a206d, 0x206e6570, 0x6e6f6328,
+    0x63207473, 0x20726168, 0x6c69662a, 0x6d616e65,
+    0x4d202c65, 0x2065646f, 0x65646f6d, 0x4d203d20,
+    0x3a65646f, 0x4145523a, 0x200a2944, 0x7b202020,
+    0x2020200a, 0x20202020, 0x74657220, 0x206e7275,
+    0x656c6946, 0x74737953, 0x3a3a6d65, 0x6e65706f,
+    0x69662820, 0x616e656c, 0x202c656d, 0x65646f6d,
+    0x200a3b29, 0x7d202020, 0x2020200a, 0x2f2f2f20,
+    0x65655320, 0x6c694620, 0x73795365, 0x3a6d6574,
+    0x6f6c633a, 0x0a2e6573, 0x20202020, 0x64696f76,
+    0x6f6c6320, 0x28206573, 0x65727453, 0x2a206d61,
+    0x656c6966, 0x766f2029, 0x69727265, 0x0a3b6564,
+    0x20202020, 0x202f2f2f, 0x20656553, 0x656c6946,
+    0x74737953, 0x3a3a6d65, 0x2e70616d, 0x6f432020,
+    0x6572706d, 0x64657373, 0x6c696620, 0x63207365,
+    0x6e206e61, 0x6220746f, 0x616d2065, 0x64657070,
+    0x20200a2e, 0x6f632020, 0x2074736e, 0x72616863,
+    0x616d2a20, 0x63282070, 0x74736e6f, 0x61686320,
+    0x662a2072, 0x6e656c69, 0x2c656d61, 0x746e6920,
+    0x69732620, 0x202c657a, 0x6f727245, 0x65262072,
+    0x726f7272, 0x20200a29, 0x20202020, 0x766f2020,
+    0x69727265, 0x0a3b6564, 0x20202020, 0x736e6f63,
+    0x68632074, 0x2a207261, 0x2070616d, 0x6e6f6328,
+    0x63207473, 0x20726168, 0x6c69662a, 0x6d616e65,
+    0x69202c65, 0x2620746e, 0x657a6973, 0x20200a29,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x75746572,
+    0x46206e72, 0x53656c69, 0x65747379, 0x6d3a3a6d,
+    0x28207061, 0x656c6966, 0x656d616e, 0x6973202c,
+    0x3b29657a, 0x2020200a, 0x200a7d20, 0x2f202020,
+    0x53202f2f, 0x46206565, 0x53656c69, 0x65747379,
+    0x733a3a6d, 0x2e746174, 0x2020200a, 0x6f6f6220,
+    0x7473206c, 0x28207461, 0x736e6f63, 0x68632074,
+    0x2a207261, 0x656c6966, 0x656d616e, 0x7453202c,
+    0x26207461, 0x74617473, 0x7245202c, 0x20726f72,
+    0x72726526, 0x2029726f, 0x7265766f, 0x65646972,
+    0x20200a3b, 0x2f2f2020, 0x6553202f, 0x69462065,
+    0x7953656c, 0x6d657473, 0x696c3a3a, 0x202e7473,
+    0x65735520, 0x64206120, 0x6f686369, 0x796d6f74,
+    0x61657320, 0x20686372, 0x66206f74, 0x20646e69,
+    0x20656874, 0x73726966, 0x69662074, 0x0a2c656c,
+    0x20202020, 0x202f2f2f, 0x6e656874, 0x6c617720,
+    0x6874206b, 0x6f732065, 0x64657472, 0x6d616e20,
+    0x0a2e7365, 0x20202020, 0x20746e69, 0x7473696c,
+    0x6f632820, 0x2074736e, 0x72616863, 0x72702a20,
+    0x78696665, 0x6f63202c, 0x2074736e, 0x7473694c,
+    0x6c6c6143, 0x6b636162, 0x61632620, 0x61626c6c,
+    0x20296b63, 0x7265766f, 0x65646972, 0x20200a3b,
+    0x2f2f2020, 0x6553202f, 0x69462065, 0x7953656c,
+    0x6d657473, 0x6e753a3a, 0x6b6e696c, 0x6874202c,
+    0x69207369, 0x20612073, 0x6f2d6f6e, 0x200a2e70,
+    0x76202020, 0x2064696f, 0x696c6e75, 0x28206b6e,
+    0x736e6f63, 0x68632074, 0x2a207261, 0x656c6966,
+    0x656d616e, 0x766f2029, 0x69727265, 0x0a3b6564,
+    0x72702020, 0x74617669, 0x200a3a65, 0x2f202020,
+    0x46202f2f, 0x20646e69, 0x69662061, 0x202c656c,
+    0x75746572, 0x69206e72, 0x69207374, 0x7865646e,
+    0x20726f20, 0x6920312d, 0x6f6e2066, 0x6f662074,
+    0x2e646e75, 0x2020200a, 0x746e6920, 0x6e696620,
+    0x63282064, 0x74736e6f, 0x61686320, 0x662a2072,
+    0x6e656c69, 0x2c656d61, 0x746e6920, 0x6c696620,
+    0x6d616e65, 0x656c5f65, 0x6320296e, 0x74736e6f,
+    0x20200a3b, 0x2f2f2020, 0x6552202f, 0x6e727574,
+    0x65687420, 0x646e6920, 0x6f207865, 0x68742066,
+    0x69662065, 0x20747372, 0x656c6966, 0x69687720,
+    0x6e206863, 0x20656d61, 0x6e207369, 0x6c20746f,
+    0x7265776f, 0x61687420, 0x20200a6e, 0x2f2f2020,
+    0x4946202f, 0x414e454c, 0x202c454d, 0x7420726f,
+    0x6e206568, 0x65626d75, 0x666f2072, 0x6c696620,
+    0x69207365, 0x6f6e2066, 0x0a2e656e, 0x20202020,
+    0x20746e69, 0x65776f6c, 0x6f625f72, 0x20646e75,
+    0x6e6f6328, 0x63207473, 0x20726168, 0x6c69662a,
+    0x6d616e65, 0x69202c65, 0x6620746e, 0x6e656c69,
+    0x5f656d61, 0x296e656c, 0x6e6f6320, 0x0a3b7473,
+    0x20202020, 0x202f2f2f, 0x75746552, 0x73206e72,
+    0x65726f74, 0x69732064, 0x6f20657a, 0x20612066,
+    0x656c6966, 0x20200a2e, 0x6e692020, 0x69662074,
+    0x735f656c, 0x20657a69, 0x746e6928, 0x20296920,
+    0x736e6f63, 0x20200a74, 0x0a7b2020, 0x20202020,
+    0x20202020, 0x75746572, 0x66206e72, 0x73656c69,
+    0x73657a69, 0x203f205f, 0x656c6966, 0x657a6973,
+    0x695b5f73, 0x20200a5d, 0x20202020, 0x20202020,
+    0x203a2020, 0x656c6966, 0x746e6f63, 0x73746e65,
+    0x20695b5f, 0x5d31202b, 0x66202d20, 0x63656c69,
+    0x65746e6f, 0x5f73746e, 0x3b5d695b, 0x2020200a,
+    0x200a7d20, 0x69727020, 0x65746176, 0x20200a3a,
+    0x2f2f2020, 0x754e202f, 0x7265626d, 0x20666f20,
+    0x656c6966, 0x200a2e73, 0x69202020, 0x6620746e,
+    0x73656c69, 0x756f635f, 0x3b5f746e, 0x2020200a,
+    0x2f2f2f20, 0x6c694620, 0x616e2065, 0x2073656d,
+    0x65646e69, 0x2e736578, 0x2020200a, 0x6e6f6320,
+    0x75207473, 0x33746e69, 0x20745f32, 0x6c69662a,
+    0x6d616e65, 0x3b5f7365, 0x2020200a, 0x2f2f2f20,
+    0x6c694620, 0x6f632065, 0x6e65746e, 0x69207374,
+    0x7865646e, 0x0a2e7365, 0x20202020, 0x736e6f63,
+    0x69752074, 0x3233746e, 0x2a20745f, 0x656c6966,
+    0x746e6f63, 0x73746e65, 0x200a3b5f, 0x2f202020,
+    0x46202f2f, 0x20656c69, 0x657a6973, 0x6f662073,
+    0x65762072, 0x6f697372, 0x2c32206e, 0x20726f20,
+    0x6c6c756e, 0x20727470, 0x66206669, 0x73656c69,
+    0x65726120, 0x6e6f6320, 0x75676974, 0x2e73756f,
+    0x2020200a, 0x6e6f6320, 0x75207473, 0x33746e69,
+    0x20745f32, 0x6c69662a, 0x7a697365, 0x3b5f7365,
+    0x2020200a, 0x2f2f2f20, 0x74794220, 0x72612065,
+    0x20796172, 0x68746977, 0x6c696620, 0x616e2065,
+    0x2073656d, 0x20646e61, 0x746e6f63, 0x73746e65,
+    0x20200a2e, 0x6f632020, 0x2074736e, 0x72616863,
+    0x61642a20, 0x3b5f6174, 0x2020200a, 0x2f2f2f20,
+    0x73614820, 0x61742068, 0x2c656c62, 0x20726f20,
+    0x6c6c756e, 0x20727470, 0x61206669, 0x6e657362,
+    0x200a2e74, 0x63202020, 0x74736e6f, 0x6e697520,
+    0x5f363174, 0x682a2074, 0x5f687361, 0x20200a3b,
+    0x2f2f2020, 0x6148202f, 0x74206873, 0x656c6261,
+    0x6f6c7320, 0x6e207374, 0x65626d75, 0x696d2072,
+    0x2073756e, 0x2e656e6f, 0x2020200a, 0x6e697520,
+    0x5f323374, 0x61682074, 0x6d5f6873, 0x5f6b7361,
+    0x20200a3b, 0x2f2f2020, 0x6544202f, 0x706d6f63,
+    0x73736572, 0x66206465, 0x20656c69, 0x657a6973,
+    0x6f202c73, 0x756e2072, 0x74706c6c, 0x66692072,
+    0x206f6e20, 0x656c6966, 0x20736920, 0x706d6f63,
+    0x73736572, 0x0a2e6465, 0x20202020, 0x736e6f63,
+    0x69752074, 0x3233746e, 0x2a20745f, 0x6f636564,
+    0x6572706d, 0x64657373, 0x7a69735f, 0x3b5f7365,
+    0x6669230a, 0x4e4f4320, 0x5f474946, 0x4f4f4355,
+    0x5341425f, 0x53465f45, 0x4d4f525f, 0x435f5346,
+    0x52504d4f, 0x45535345, 0x54535f44, 0x4d414552,
+    0x20200a53, 0x2f2f2020, 0x6f50202f, 0x6f206c6f,
+    0x65642066, 0x65646f63, 0x0a2e7372, 0x20202020,
+    0x6c6f6f50, 0x737a4c3c, 0x63654473, 0x7265646f,
+    0x4f43202c, 0x4749464e, 0x4f43555f, 0x41425f4f,
+    0x465f4553, 0x4f525f53, 0x5f53464d, 0x504d4f43,
+    0x53534552, 0x535f4445, 0x41455254, 0x203e534d,
+    0x6f636564, 0x73726564, 0x230a3b5f, 0x69646e65,
+    0x20200a66, 0x2f2f2020, 0x6f50202f, 0x6f206c6f,
+    0x74732066, 0x6d616572, 0x20200a2e, 0x6f502020,
+    0x523c6c6f, 0x53466d6f, 0x65727453, 0x202c6d61,
+    0x70203e35, 0x5f6c6f6f, 0x3b7d0a3b, 0x207d0a0a,
+    0x6e202f2f, 0x73656d61, 0x65636170, 0x6f637520,
+    0x230a0a6f, 0x69646e65, 0x2f2f2066, 0x6f637520,
+    0x61625f6f, 0x665f6573, 0x6f725f73, 0x5f73666d,
+    0x666d6f72, 0x68685f73, 0x0000000a, 0x536d6f52,
+    0x00000005, 0x0000006c, 0x0000006c, 0x000021bb,
+    0x00002c04, 0x00001c7d,
+};
+
+static const int bench_fs_text_a_size = sizeof (bench_fs_text_a);
\ No newline at end of file
@@ -0,0 +1,943 @@
+/* Auto-generated ROM FS from:
+ *  - hello.txt
+ *  - mkromfs.py
+ *  - romfs.cc
+ *  - romfs.hh
+ */
+
+static const uint32_t bench_fs_text_z[] = {
+    0x466d6f52, 0x00000004, 0x00000000, 0x00000009,
+    0x00000013, 0x0000001b, 0x00000023, 0x00000041,
+    0x00001322, 0x00002aa3, 0x000039f1, 0x6c6c6568,
+    0x78742e6f, 0x726b6d74, 0x73666d6f, 0x7279702e,
+    0x73666d6f, 0x7263632e, 0x73666d6f, 0xa468682e,
+    0xcb966d59, 0x6fef827c, 0x922c5bb9, 0x40825418,
+    0x8087e00e, 0x4fe12510, 0x805b480a, 0x65c89100,
+    0xca9d5bf7, 0xdbb4625f, 0xcd0bf7a5, 0xb76fd1d2,
+    0xa970a442, 0xf6680010, 0xe596755b, 0x6459ba61,
+    0x4a051916, 0x59904d9f, 0x50c036ad, 0x3037efdc,
+    0xc165db80, 0x8e9411d2, 0x8cb74341, 0xb369e506,
+    0x09922eda, 0x20530e45, 0x33264c99, 0xd33a0559,
+    0x2cdbb763, 0x4e053937, 0x251b48c6, 0x4a26e896,
+    0xb66d1c81, 0xd2ce9d9b, 0x18001959, 0x68801664,
+    0x99576cd9, 0x36b69c05, 0x25d958e2, 0x09078185,
+    0x69f66d60, 0x376cc000, 0x1e943d2b, 0xc4794b37,
+    0xb8f1c16d, 0x30e68609, 0xe98a7d2b, 0x04084c61,
+    0x2c62e86c, 0xc449b889, 0x9228252b, 0x6b363c08,
+    0x2a66dca5, 0x0059b702, 0x7d1b5f62, 0x20aed28e,
+    0x0301d950, 0x04afb675, 0x8943376e, 0x3256ccad,
+    0xc6898881, 0xb4185345, 0x3266528a, 0xc3462851,
+    0x9088496c, 0x791ca643, 0x0ed2de05, 0xa6d57d1b,
+    0x0b76a120, 0x53646c74, 0x6c900817, 0x91adcb76,
+    0xb6e7610e, 0x63825a5a, 0x0813f161, 0x457b3656,
+    0xf22bd4d0, 0xe4d8dcba, 0xdb2830ad, 0xb341e36d,
+    0x2d9ccd01, 0x6c5db8c3, 0xdab97143, 0x12150201,
+    0xe288d8e1, 0x50982b14, 0x1a116bec, 0xf6a52c9b,
+    0x813491fb, 0x094d6c83, 0xd22bad0c, 0x4486a278,
+    0x813b67a8, 0x06645050, 0x448fe037, 0xd0747722,
+    0x67ba59db, 0xae596112, 0xd8712bb7, 0xb254a3ac,
+    0x275c8400, 0x5b59b554, 0x813111a2, 0xf1e6add9,
+    0xc0c5b6b7, 0x892e4147, 0x73e55a54, 0x78840e9d,
+    0x58e94055, 0xb0fb566c, 0xe5465a14, 0xdeba0549,
+    0xa1881520, 0x1459d0d6, 0x63eedc4a, 0xb4390d42,
+    0xb1022c6c, 0x63dd0a20, 0x876c5db6, 0x300904a2,
+    0x7bd58682, 0x77ee0c92, 0x048c2042, 0x0721242c,
+    0xbf1dd189, 0x222d422e, 0x7d1a118a, 0xa057a91a,
+    0x490381d4, 0x152ac8a9, 0x935a7d2a, 0x24d1a244,
+    0x30082a12, 0x6722e341, 0x23925e8d, 0xa8567d1a,
+    0xd4081107, 0xa5ea34a8, 0x192d4066, 0xc3401c00,
+    0xa8d3a44b, 0xd6a2d181, 0xa9452306, 0x529f868a,
+    0x9b261526, 0x4752a650, 0xd0101562, 0x5a95e9d0,
+    0xf2681420, 0xa9e4100a, 0x8518f0d4, 0x12479ac6,
+    0xe72955b1, 0xb0302624, 0x1a4e2447, 0x43a5166d,
+    0x838a03a4, 0xc489a442, 0x51c232c2, 0x4ee38051,
+    0xb0189d2b, 0x884ad126, 0x436345b8, 0xc200d3aa,
+    0x4aad1a0a, 0x90a94fa1, 0xc1245c44, 0xc6380d2c,
+    0x9c916a34, 0x1f21a4a8, 0x41eeb80c, 0x588d4932,
+    0x28514d18, 0x6c98328d, 0x50506932, 0x921ac3a2,
+    0x3a14e494, 0x31b2427d, 0x40203d1a, 0x3aa61121,
+    0x22542804, 0xf4449d60, 0x9b30c034, 0xc14bb411,
+    0x8a85aba0, 0x360d4a34, 0xaa115982, 0x2e8e4430,
+    0x8d1a1413, 0x10114258, 0x66cc9ca1, 0xa8a12120,
+    0xc32c1a05, 0x5bf00930, 0x08110e62, 0x236ac5ba,
+    0x56d2abc8, 0x00161282, 0x4e5c8581, 0xcc53a903,
+    0x084c4f45, 0x4684c4cc, 0xc43cc921, 0x19d1a28e,
+    0xa2d8ec8a, 0x5ca51a1d, 0x1181206a, 0xafea3c10,
+    0x803a29a2, 0x2621ae68, 0x439c4c95, 0xb85c17e2,
+    0x4dab3024, 0xb96fe1b6, 0x1b16245d, 0x03e09e95,
+    0x1e949d1b, 0xcaa53bf7, 0x03ba63eb, 0x0573f362,
+    0x3012bc3d, 0x854b71a0, 0x4bb474a3, 0x88e136ad,
+    0x3051c684, 0x42580851, 0x84b76a2b, 0x7b0c50c6,
+    0x6ee5a625, 0xb26cdbb0, 0xcd7efd8a, 0x4059b669,
+    0x8c1329a3, 0x932e5d9e, 0x20155a81, 0xd99e1400,
+    0xe4dcb97a, 0x794999f2, 0x1b60c6c1, 0x917a8284,
+    0x10047589, 0xdb205237, 0x690095ae, 0x4b16a5dc,
+    0x72c7ce2d, 0x962edcb4, 0x7aba7d9b, 0xbe251b52,
+    0x802157c6, 0x4b36accb, 0x42647c25, 0xe5499494,
+    0xcb29f3b6, 0xba75c340, 0x0b42005c, 0xe1e6a52b,
+    0xa2949e65, 0xa02a8e8c, 0x77038544, 0x40218a3d,
+    0x351b5a06, 0xba6ceb86, 0x73e75b4f, 0x728416ba,
+    0x8d2bb921, 0x1e76c3d2, 0x464ff60c, 0xa528d3a4,
+    0x6d59b402, 0x97600097, 0x32de40d6, 0xfe7ca140,
+    0x8a2a9436, 0x912b2ec4, 0x2a129105, 0x3a951ad4,
+    0x91234d83, 0x67eb097e, 0x6ca0881b, 0x822c4b37,
+    0xa1211086, 0x17b5bc96, 0x04b3d202, 0x403b3626,
+    0x68634634, 0xc7861508, 0xeddbb474, 0xdcb061c4,
+    0xb26e631b, 0x41a12e1c, 0xb40d52aa, 0xf60469e9,
+    0xa0ae5b41, 0x84a7a4fc, 0x362dc8b9, 0xc9e800e9,
+    0x82b06323, 0x1b97c446, 0x926c74a8, 0x94dd1800,
+    0x1b906ca5, 0x3437be04, 0xd40ca7e7, 0xdcb0744f,
+    0xba73b7d2, 0x5a56ee5b, 0x75e5d2fd, 0xc7cf0968,
+    0x581026e4, 0x36a8c88b, 0x4fe0111b, 0x18102aa2,
+    0x67e88683, 0xdfb20519, 0x5dddb56f, 0x31f366c2,
+    0x63cb8c5e, 0x056edbb7, 0x44a2b981, 0x35afe6d5,
+    0x0adcb520, 0x58b81b32, 0xb474235b, 0x7303425a,
+    0x0a84b5b0, 0x8d200257, 0xd2e6db44, 0x432fdb96,
+    0xeddd9651, 0xbe25eb36, 0x5ab12def, 0xbaf3866e,
+    0x59166e5e, 0x806e44e8, 0x5559b291, 0x5db675c3,
+    0x9743a227, 0xea34e955, 0x5faf3e25, 0x956a52a1,
+    0x8591f433, 0x786237b4, 0x632c44a0, 0x322d47b2,
+    0xa0a953b5, 0xa187a8c4, 0xa1acdeb4, 0x57ddb671,
+    0x0d1b04a2, 0x2a68c7d2, 0x6340b412, 0xe2909372,
+    0x0d08204f, 0x312970b9, 0xd0c507b9, 0x4d536f4a,
+    0xb56fdfb2, 0x1b224cd8, 0xe5a34f15, 0x7dca9463,
+    0xa441973e, 0x45346851, 0x693caba2, 0x0d514a0b,
+    0x1babd2e2, 0x87ada96a, 0x2dddb3d1, 0x9a5edf0b,
+    0xb25ed6cb, 0x977c0a1b, 0x09b66105, 0xaa2a3e44,
+    0x21c54451, 0x15a59a75, 0x1d51e123, 0x28cc80a4,
+    0xd01d3761, 0x983157ae, 0x0b1764d8, 0x5600dd7d,
+    0x6e4c31fb, 0xd605f9f6, 0x281006e0, 0x2f48e6cc,
+    0x65f11941, 0xd1c55bb6, 0x1a1b5600, 0x7085caa4,
+    0xc8ba0d44, 0xd63b2410, 0x4879a7eb, 0x54b11645,
+    0x1919a59e, 0x8d06c9e8, 0x13210ebd, 0xd3de8d04,
+    0x0422b474, 0x54723252, 0x7b16e449, 0x324ad84d,
+    0x4601e903, 0x40227ae6, 0xe120ecd8, 0xeb860fb1,
+    0x24d9b273, 0x0d0e3100, 0x3123a6c8, 0xe6c69cb4,
+    0xa8e1f5bc, 0x514a848d, 0x7d8538b2, 0xdc683757,
+    0xa5fbb5ac, 0x156aeaca, 0x3454a8b4, 0xc4480b92,
+    0x3569e347, 0x7a556809, 0xe4651b07, 0xb8315608,
+    0x57d83c9b, 0x8aa46263, 0x894c6fc5, 0x6edecdbb,
+    0x03dcb850, 0x15307463, 0x1b0ae0b6, 0x0de4849b,
+    0xec901a01, 0x6ae1cd6d, 0x7cce868d, 0x80dea010,
+    0x28221782, 0x21dcc884, 0xc88d2f61, 0x400f2866,
+    0xb6004d1d, 0x5ad27deb, 0x03f9252c, 0xa12090c9,
+    0x4f399840, 0xf9d69ab0, 0x40580402, 0xd9080a74,
+    0xad1bd62c, 0x610573b0, 0x44917d5c, 0x8d4b7226,
+    0x0170e9d6, 0xa7c46c0a, 0x6edeb26b, 0x26b2f1e4,
+    0x6b5636fd, 0x43f8b14d, 0xcc950821, 0x51a03278,
+    0x722e9411, 0x08c81804, 0x88716987, 0x92772e39,
+    0xa46dd970, 0x14dcb742, 0x4f907387, 0xb82ec343,
+    0xa8e6460e, 0x03caf111, 0x98130a03, 0x2e2dc45c,
+    0x65519807, 0x9b0034d7, 0x124c44c4, 0xedba0d27,
+    0x2ecab031, 0xf1d29972, 0xa1014024, 0x92a6eddb,
+    0x65ce0c31, 0x4e5ab120, 0x55a74623, 0x4501a2a5,
+    0x68e7860d, 0x4a480797, 0x4cb18296, 0x8c89132f,
+    0xb239c7c6, 0x24a1e658, 0x408614b3, 0x5cf114dc,
+    0x79260ac9, 0x350aa044, 0x06bc18e4, 0xca946351,
+    0xb1a11264, 0x0033264c, 0x3367cc00, 0x81c96830,
+    0x300066a5, 0x5b562ed1, 0x42e4d6a5, 0x4e65421b,
+    0x58ba5f47, 0x94114b6c, 0x3445912d, 0x3ead0ddb,
+    0xb6401136, 0x1b04ca86, 0x37c8920d, 0xf4cc9d1b,
+    0x488a7136, 0x902c2906, 0x0b62d75d, 0x2ddbb815,
+    0x0d4ef1e1, 0x4f74c786, 0x36a6bc95, 0x6ddb8016,
+    0xdb2030f7, 0x4a56d6ed, 0x61966dd8, 0x62d89d58,
+    0x5b913737, 0xc82b37ac, 0x4205ae44, 0x6e30892e,
+    0xbe589196, 0x3121be20, 0xbe440fb9, 0x4893e436,
+    0x0f368c27, 0x24dacc25, 0xc40c7a22, 0x407b971a,
+    0x266c8288, 0x86f09319, 0x9c51caf2, 0x328386ca,
+    0x08f52209, 0x57985b45, 0x401c0446, 0xe59759ba,
+    0x048b5469, 0x2220e353, 0x86dad68d, 0x49d9c814,
+    0xc9112f9e, 0x69d7ad59, 0x2932848d, 0x254893a1,
+    0xa496c505, 0x84225206, 0xb79299aa, 0xa48eae73,
+    0x9031e37c, 0x3de4c54a, 0xdc0d03f0, 0x39915650,
+    0x95d21286, 0x58c95211, 0x52915082, 0x0b37ac4b,
+    0x926cb882, 0x6e098189, 0xd6a55b56, 0xc812c0e4,
+    0x5b572edd, 0x705dd21d, 0x72edd8b0, 0x93f23c89,
+    0x46b69349, 0xdab961d1, 0x0ddbf62b, 0x0563d39e,
+    0x920e3589, 0x8c583300, 0xa4644bf6, 0x61e4cd49,
+    0xd0a0741b, 0xcaa89192, 0x18370a81, 0x91ca9255,
+    0xd3b20d1b, 0x435bb767, 0x599474c3, 0x914529a5,
+    0x7fa40600, 0xcaa2a55b, 0xba05991f, 0x0d1865cb,
+    0xb7664192, 0x058282dc, 0x85d04a1b, 0x1a413124,
+    0x70df8a3a, 0xf66d5aba, 0x41309beb, 0x624119e6,
+    0x1a8243da, 0xf196fdca, 0x00a83574, 0x1b9484c1,
+    0x65e9e615, 0xc38a90b9, 0x04dcb92e, 0x3c198c42,
+    0x1653d6f5, 0x2355dadc, 0x46219766, 0x87bb73c9,
+    0x1928d106, 0x0e80b112, 0x8e507382, 0xa58396c4,
+    0x6d65101b, 0xa100f6d6, 0x2a31518a, 0x3304c88c,
+    0x0bce1040, 0x8c0136c5, 0xab4864ce, 0x576e8481,
+    0x069f8825, 0x8b7361c5, 0x258758e2, 0x6380ceb9,
+    0xc4809364, 0xa8613684, 0x6252d286, 0xe996955b,
+    0x4516b975, 0x6dabb0e6, 0xb169cf86, 0x7861caa1,
+    0xd6a64d9a, 0x6b9ab549, 0x7e2d0932, 0xa10a32ed,
+    0x68ad42bc, 0x15eddcb0, 0x024e6df1, 0xdbb763ed,
+    0xb921056e, 0x3575c3dc, 0xe7da86b0, 0x4406bd69,
+    0xc3307331, 0x0a72a442, 0x76669595, 0x1d9018e0,
+    0x609b366c, 0x02c56518, 0x81140b61, 0xdd1a31e2,
+    0xa5a08474, 0xf56e58b9, 0x8e9271f0, 0x343be314,
+    0x11c7d282, 0x289b4eaa, 0x4c803b13, 0xa50bf7ed,
+    0xb1248aa4, 0xe5c698b9, 0xc28d5a63, 0x08b474c3,
+    0x21824a54, 0x38bc0d20, 0x5a975321, 0x94e1e2ad,
+    0x4181255c, 0xd2e28794, 0xd9eb1056, 0x9a9b166f,
+    0x11036520, 0x00a48f94, 0xd8782576, 0xb214616d,
+    0x5a620cdb, 0x2e3930eb, 0xa1f891f6, 0xd32390c9,
+    0xac748b73, 0x30717982, 0xe292ecb0, 0x07255959,
+    0xacc470e5, 0x1d512d32, 0x8a839d08, 0xb92385fa,
+    0xdb364818, 0x776e0c81, 0x5684f532, 0x951764cb,
+    0x1608f4b2, 0x6382db40, 0xdd93b264, 0x0eb723dc,
+    0x36547d1d, 0xf0bc25eb, 0xdc882536, 0x006c8ee5,
+    0x962da718, 0xc3ae7dfb, 0xb1905768, 0x658dca12,
+    0xe2dd9d72, 0x2606c633, 0x1f4e93e5, 0x84514000,
+    0xaf975144, 0x2bb7acdd, 0x322ebc15, 0x42ec0a0b,
+    0x6c732d70, 0x24b68583, 0x8e4f9f71, 0x0d0f7943,
+    0x1a64e9ce, 0x32f8c90d, 0x64842879, 0xcbb05112,
+    0x1005c242, 0xa3c0c958, 0x82599420, 0x7d4b95c2,
+    0xc4922dc9, 0x3b0c00be, 0x8c1ca184, 0xb3335d96,
+    0x6c6b484a, 0x926ed8b7, 0x64ca0581, 0x37b2f212,
+    0xf4c692b5, 0x6518dbb2, 0x14889327, 0xb091ca6c,
+    0x71002edc, 0x38a011b2, 0xc10ce382, 0x39526151,
+    0x20a25905, 0x820c13b1, 0x9c1b5164, 0xb265dd82,
+    0x37ae45b8, 0x6488407b, 0x204a6b16, 0xb020114a,
+    0x6e8381dc, 0x0902ddb7, 0x6dddb369, 0xe89c5bf7,
+    0x0ddb3639, 0xb26241e6, 0x68e70a93, 0x6cfc9013,
+    0x5c900126, 0x254b362c, 0x0d67dda6, 0xca6d70b1,
+    0x460bb961, 0x8d432ec9, 0x101aca22, 0x4205c858,
+    0x86001238, 0x2d6fdb46, 0x43427810, 0x040e9678,
+    0x24632724, 0x772e6e91, 0x859d9042, 0xbad26736,
+    0x25e00526, 0x05bfb7c2, 0x0deb963c, 0x6223a4b5,
+    0x52841509, 0x681a5b36, 0xb4672559, 0x478282dd,
+    0xaec2a277, 0xa19ee1cd, 0xb66fdf86, 0x01f72d4a,
+    0xce858421, 0x20815b57, 0x7b10e250, 0x23aeb10d,
+    0x868990c1, 0x75fb1562, 0x4937367d, 0x84d8284c,
+    0xe5c99362, 0xc07aabd6, 0xb9130665, 0x2c248585,
+    0x0c9aafe3, 0x04495338, 0x992841aa, 0x037225c8,
+    0x3e048280, 0x14085722, 0x9536aea0, 0xcb0aa2b0,
+    0x828c546c, 0x8b1c2961, 0x5b490ad1, 0xaa415798,
+    0x2a84290b, 0x48217fcc, 0x9786c583, 0x402ad439,
+    0xcaea2000, 0x4153c2c3, 0xbae184d8, 0xc0851b56,
+    0x40493628, 0x64230339, 0x252cddb0, 0x58215723,
+    0x316bf66d, 0x44866eb8, 0xeb6c0806, 0xd97805f7,
+    0x35676305, 0x976cc420, 0x6cec825b, 0x83386037,
+    0xb76cc5d2, 0x7b6785d8, 0x5956a1be, 0xeddbb120,
+    0xdde842d7, 0x44e00201, 0x37ad5ea1, 0xe086a206,
+    0x72c34112, 0x366ca98a, 0x4c9c4dcb, 0xa2033124,
+    0xafe2430c, 0xf2965d7b, 0x47412916, 0x19ee2c19,
+    0x74e1be45, 0x9a4586b4, 0x0b1e2429, 0x70e84530,
+    0x90099a24, 0x94c3e100, 0x71ac2c5a, 0x6297dcb2,
+    0x91583996, 0xae12636b, 0x541264ca, 0x2649b413,
+    0xd9b703c0, 0x2a3bd7ac, 0x1bd665b0, 0x36fcc085,
+    0x84c64049, 0x90427b50, 0x71c06ed8, 0x5cf48829,
+    0xb8566e83, 0x9506428e, 0x2094ad1b, 0x05053992,
+    0xb9a1eaca, 0x5b562ec8, 0x23388465, 0x2d5d90d1,
+    0xd8b6e1e0, 0xb981e06c, 0x27372cdd, 0x16ed5d51,
+    0x41a21d9b, 0x8583ba6d, 0x4f412152, 0xa3848821,
+    0x9211976f, 0x6815cae0, 0x3ead25c8, 0x6f308832,
+    0x2514e80c, 0x1636bc90, 0x93ebc903, 0x54823c09,
+    0x86e2343b, 0x2b0dbece, 0xeb6cdc20, 0x5d1005d3,
+    0xbb10c808, 0x73cd9a7d, 0x642eddb2, 0x65283377,
+    0x7dcb562c, 0xc2212e88, 0xc39a8d08, 0x255db675,
+    0xe52dbb16, 0x3f0a2278, 0xf4de8edd, 0x1406b917,
+    0x90c016c9, 0x66d36686, 0x53a65d90, 0x6ed904a1,
+    0xb33f2362, 0x5461ab84, 0xb6acc2ae, 0xbc8980c0,
+    0x09f13638, 0x20539213, 0x43ee5bb3, 0x8c8d4461,
+    0xd50b523e, 0x2128e1a6, 0x4b8d4430, 0x06919473,
+    0x8d1920d1, 0xba72e9ce, 0xe792eed8, 0x72edd848,
+    0x93f23c89, 0x46889349, 0xdab361db, 0x30f4756c,
+    0x7218858e, 0xd4845103, 0xb3c32534, 0x3da2405a,
+    0x181e5115, 0x215bf287, 0x51126410, 0x529a0852,
+    0x29501938, 0x186148e1, 0x2e4f9e94, 0x43c25bb5,
+    0x03daad28, 0xea6a1942, 0x1b96acec, 0x46b084a5,
+    0xecd7b2c2, 0x9d4dcb36, 0x06a12274, 0x334ce00d,
+    0xc2d6e940, 0x125e6d49, 0x9f0a5c0c, 0xd223e916,
+    0x521836ba, 0x69835098, 0xeb7c896e, 0x245ec16d,
+    0x002015ea, 0xd6e56110, 0x7ac0851b, 0xcf434936,
+    0x136335d6, 0x4bc0d00d, 0x6fdab923, 0xbeaf7145,
+    0x03808c14, 0xb6aaf411, 0xd86a4410, 0x741ca6d1,
+    0x0409b280, 0xe4751b36, 0x948324dc, 0xe815bda2,
+    0x8c311baf, 0xb86d234a, 0x8a22815c, 0xee5b02f0,
+    0x5eb6d504, 0x3f77e583, 0x77df920d, 0x27add8af,
+    0x035f90d1, 0xdbb76c5b, 0x451b76ed, 0x0e64c396,
+    0x2079f2ac, 0x5436129c, 0x0e9a556d, 0xb961d15e,
+    0xb5be16da, 0xeed7c950, 0x98121b96, 0x486b1665,
+    0x22e64610, 0x6c28fb7a, 0xd9404496, 0x04d913e4,
+    0x776198c0, 0xa5966824, 0x10b3b3ae, 0x4153ea85,
+    0x41c6021a, 0x9e0c0b2b, 0xa59330b9, 0x71f66144,
+    0xd6e5c90d, 0x654878ab, 0x8a412702, 0x5bd6eef2,
+    0x1ade8a95, 0xea85b213, 0xdcb66fc7, 0x47114b2e,
+    0x962e4db2, 0x11d980f0, 0xdbba7325, 0xb1c30865,
+    0x12ccc6a2, 0x6c8c0519, 0x8c20e036, 0x1b12e8c6,
+    0xce8570a1, 0xddb0103d, 0xf0e91324, 0xd1246fb8,
+    0xce908d1d, 0x2c622937, 0x2963ce4a, 0xa34924d3,
+    0x14880f2d, 0x745912a5, 0x6329cdce, 0x1765688b,
+    0xbede0d2b, 0x96d51b1d, 0xfe834858, 0x6ccdc690,
+    0x8c6ed8b7, 0x04a206d1, 0x8b01f265, 0x16174caf,
+    0x644c635b, 0xc1741913, 0xb891a21e, 0x2b18450b,
+    0x7295ada1, 0x59b42751, 0x9382296c, 0xa3100495,
+    0xb49e94b4, 0x0deb3648, 0x322262b5, 0x252d9879,
+    0x136b2f22, 0xf5a444f9, 0x1ade4012, 0x61a02de2,
+    0x61231659, 0x430cdcaf, 0x9c8d0e64, 0xbb70f279,
+    0x724dc80e, 0x6cc45b09, 0xa4a53bb6, 0xcf3137b2,
+    0xe340608e, 0x6dddb9a2, 0x9b9183b2, 0x10ebcc8a,
+    0x7fc8a170, 0x0d1cff0a, 0x1b68ded2, 0xc1ac4963,
+    0x415790ff, 0x48b369a9, 0xfa01f72d, 0x64239a4b,
+    0x4227dcba, 0x6e59b938, 0x4bba2106, 0x800b37ac,
+    0x82926cf8, 0xda908768, 0x1cb01b36, 0x3a0d8658,
+    0x020b35f8, 0xdb814433, 0x2adb36ac, 0xab37ad94,
+    0x2ac8642a, 0xc8859b51, 0x04493728, 0x1b207cfa,
+    0x776eb4c9, 0xaedc1042, 0xc993c142, 0x04a9736e,
+    0x3120a494, 0x4afa8858, 0xd54c0a43, 0x1661cba2,
+    0x006e2111, 0x454f90a1, 0x0469d342, 0x023341ae,
+    0x3441be0c, 0x65804a90, 0x693b752d, 0x907e84c5,
+    0x72448bb8, 0x5db97127, 0x0c616d6c, 0xd3d68e8d,
+    0xa624131a, 0x881df103, 0x77e984a0, 0x4c900d58,
+    0xdbba5822, 0x503ceb84, 0x8742250d, 0xa4943867,
+    0xb6972674, 0x35cac635, 0x6534db3a, 0xdda0b1e4,
+    0x6df9966e, 0x112b509c, 0xaa2cddb0, 0xe953a9c1,
+    0x4c350ab2, 0x7d2b3756, 0x1a4374b6, 0xa491c2e8,
+    0x2ee92331, 0x2f734b0a, 0xc86cc49a, 0x78900201,
+    0x35698340, 0xca458888, 0xda701447, 0xb261456c,
+    0x354e4cbe, 0x0142f8fa, 0x45191042, 0x72369c84,
+    0x50469a78, 0x004819a5, 0xb669e748, 0x250250d8,
+    0xa0bfb910, 0xd1927600, 0x3e41a606, 0xcb828c62,
+    0x8695b96c, 0x5a64274f, 0x77f2e55d, 0x06448610,
+    0xdbb1c149, 0xa43bd7ed, 0x1b1eea82, 0x5f65cea4,
+    0x6b400804, 0xa318d075, 0x2f27f74a, 0x1665e4e1,
+    0xd2d285fb, 0xb870292c, 0xb1698354, 0xf61e048f,
+    0xc9862d8b, 0xc503b965, 0xe3961275, 0xf1d24e3c,
+    0xc3cac53b, 0xa20c4d6e, 0xc8172360, 0x7017a5db,
+    0x722ed9b0, 0x25cd5890, 0x5d14a333, 0x299924ce,
+    0x304be285, 0x8e255e9c, 0xc1481f84, 0xd599762b,
+    0xae3457a6, 0x12a59996, 0xe0c20deb, 0xa0241b53,
+    0x02022064, 0x5206ac0c, 0xdeaa7579, 0xca382335,
+    0x1b1a5e5f, 0xeff3edec, 0x7e157a82, 0x59bd69e7,
+    0x3b066450, 0x2176987d, 0x448a9411, 0x480300d3,
+    0xe3e0a18c, 0xa60d7551, 0x7b1043c6, 0x1bb62cda,
+    0x0fe49625, 0x82a94af9, 0xddba6faf, 0x9721002e,
+    0x9b56ee5d, 0x355c95a5, 0x659972cb, 0x9554d409,
+    0xb273d996, 0x301e86ce, 0x618c309b, 0xcb970040,
+    0x1d5b17e4, 0xb46cdfbe, 0xd912a4d8, 0x63d33605,
+    0xa3c15bb9, 0x4601ba6e, 0xdcb26cd9, 0x15fb16a4,
+    0xba63cbaa, 0x69e58601, 0xcbc684b2, 0x4a099064,
+    0x5eb961e5, 0xd80bd265, 0x91436100, 0x87821401,
+    0x435eb86f, 0x09b467c3, 0x94435146, 0x095326c8,
+    0x4e41d68c, 0x6cf88822, 0x4e053937, 0xd9b768c7,
+    0x4341b72c, 0x6de30954, 0x76eedcb4, 0x00c8e892,
+    0x03b420c3, 0xbc62cb46, 0xe1e42cc8, 0x41b21c2c,
+    0x940d0766, 0x006936ce, 0x67e34bc8, 0xe9c683b2,
+    0x4406906f, 0x3001373e, 0x8704c6dc, 0xd386a51b,
+    0x9c8d006e, 0x2fa32428, 0x8745cc09, 0x4812b474,
+    0xa56b363e, 0xd12368dc, 0x4e808a17, 0x1d1b0ea2,
+    0x3babc2a6, 0xb66e2020, 0x0403b1d5, 0x4b6b76e4,
+    0x2863453c, 0x649c8818, 0x488b3155, 0x69c232a5,
+    0x364a899a, 0x4454621b, 0xeb301ea2, 0x90f62ec8,
+    0xadeedb70, 0xce0d0571, 0x191be1e8, 0x24e2d218,
+    0xebb21d1b, 0x79984464, 0xb09696ed, 0x84981499,
+    0x9e0d1612, 0x093674d1, 0x36b7ae5c, 0x0a4c2b51,
+    0xd478db36, 0x6873c06c, 0x17ee7c8b, 0x6ee0105b,
+    0x85408076, 0x2276ba44, 0xe60a8540, 0xcc1a3b14,
+    0x364ba446, 0xf7ed4b81, 0x6dd9a820, 0x1522c189,
+    0x444f80a5, 0x5ec8c851, 0x812b6886, 0x06a45054,
+    0x848ff837, 0xe0747722, 0x486645db, 0xc61a9436,
+    0xdcba6641, 0xb282c7ad, 0x02c8928d, 0xd29d7811,
+    0x087065d5, 0x66a7cb44, 0xde069cb7, 0x1d1917de,
+    0x6125bc44, 0x74ce156d, 0xd5512247, 0xb161e503,
+    0x51c0ee5b, 0x24a51b6b, 0x8878eb16, 0x5b8aa256,
+    0x89918841, 0x888db973, 0xb0f1e634, 0x80c4cab0,
+    0xd98e752b, 0x081fb275, 0x6c142e10, 0xc390a0d3,
+    0x4411ba73, 0x21612162, 0xe84e3c88, 0x1d72f9f1,
+    0x985014e9, 0x4ad5e8d3, 0x08a406bd, 0x414e4d1a,
+    0xea53a950, 0x16259ad4, 0x50912089, 0x190f8241,
+    0xf46a5013, 0xead31891, 0x883840b5, 0xa741a546,
+    0x01322b55, 0xe200c868, 0x265d1a06, 0x8d0e449d,
+    0x1a31b016, 0x34544c2d, 0xe93491fa, 0x3285da34,
+    0xb0103c92, 0x4c87c686, 0xa300d1aa, 0x87509047,
+    0x80a74e45, 0xd2342ec4, 0xa9ca9540, 0x35a1394f,
+    0x223a8285, 0xb568d378, 0x1c201d2a, 0x24151a54,
+    0x9621264e, 0x088cce12, 0xe864711a, 0x8a37a1c5,
+    0x2ce2455c, 0x98561d1a, 0xd5501006, 0x7d0a556a,
+    0xf122844c, 0x69648926, 0x54a341c6, 0x2145058d,
+    0xc765fc88, 0x54920982, 0x6bc2c06a, 0x94694889,
+    0x8e9369c3, 0x30168782, 0x200795d4, 0x15ead3a1,
+    0xe9d19091, 0x8d081102, 0x4221d631, 0xee4413a1,
+    0x01a6c127, 0xd28dda84, 0x60050d5f, 0x50a2712c,
+    0xd012b469, 0x2486518d, 0xa4207281, 0x10c5cad4,
+    0xea4c8590, 0x0d014163, 0xf128440d, 0x4f849967,
+    0x7010dec2, 0x2bdc4588, 0x5ec51e71, 0x9010b692,
+    0x2b0c84b0, 0x4aa57102, 0x7a2a649e, 0x25864668,
+    0x890e3922, 0x178524ec, 0xc657d008, 0xd5e810c8,
+    0x0461e32a, 0xe7818808, 0x46927e55, 0x12e862d8,
+    0x7e842989, 0x0797fb42, 0xd0773e08, 0x76a4c200,
+    0xd98e759b, 0x6459b275, 0x8ead2b12, 0xd8976fdf,
+    0x2c3b37ac, 0x9773cdbe, 0xd0f6addc, 0x16adcb2b,
+    0x4f281489, 0xb20dcb33, 0x5ab96fcf, 0x6c8b966e,
+    0x3b5629f8, 0x3626d09d, 0x614838eb, 0xb60deb56,
+    0x58b873cb, 0x2841616c, 0x11f6821c, 0x8c485518,
+    0xea9c6a34, 0x984a0674, 0x11a26c9c, 0x50826406,
+    0xfc701b28, 0x453b1664, 0x9520e586, 0x72b6ac58,
+    0x2504bf40, 0x92755b76, 0x00900a53, 0x0920750a,
+    0x956e4088, 0x528988f1, 0x3a102652, 0x4054e803,
+    0x702218d2, 0x1d0ad26c, 0xa4469d3e, 0x50f5ebd1,
+    0xf4ebd338, 0x8b4e0d2a, 0x7e8d395f, 0x81a64fa5,
+    0xda342248, 0x818a4a85, 0xbf122d1a, 0x0602aa53,
+    0x98a94d83, 0x31240050, 0x40f08967, 0x95237263,
+    0xb66cebba, 0x5762145c, 0xf5a69d2b, 0xc0140865,
+    0x7d0b5714, 0x018612cc, 0x618c1133, 0xb8be114e,
+    0xcfe6d984, 0x6ac47836, 0x6468fb56, 0x32a05367,
+    0x6563cc54, 0x9841dbb0, 0xdb201461, 0xb120a39d,
+    0x20031eda, 0xf4903795, 0x143e2b21, 0x0fc064b1,
+    0x45d45000, 0xd831bbe2, 0x3b572fd3, 0xa3b2119d,
+    0x0c3371c1, 0x103a6744, 0x37a2d08d, 0x9119a146,
+    0x077440c4, 0xa481acd1, 0x0e592005, 0x47441e98,
+    0xc29c3943, 0x393106c4, 0x30f72d5c, 0x430c4c61,
+    0x5d5f857b, 0x8f2787a2, 0x450a50bc, 0xb60d23a1,
+    0xf01408e0, 0x528f6cd9, 0xccd6ad77, 0x86d91541,
+    0x1205ea86, 0xd91eb319, 0x8aab9e20, 0x681b39c8,
+    0x1ea44534, 0x569e4831, 0x4c49735a, 0x60b656ec,
+    0x8e6dc8e8, 0x7c190005, 0x905b976e, 0x20b365c4,
+    0x768812f3, 0x0c263120, 0x7bb720c0, 0x65d9a645,
+    0xe74c0819, 0xa91b4186, 0x75cf45d5, 0x42ad904f,
+    0xf011a82e, 0x31a82cd9, 0xbfca8d01, 0x54029f2d,
+    0x2d2b3684, 0xf435389c, 0xcd6dd9a0, 0x39904991,
+    0x1605c6c7, 0x672548c1, 0x60129693, 0x7509e001,
+    0x4445f888, 0x930160d1, 0x71278214, 0xc2d8ea46,
+    0xd34f7285, 0x2603d4fc, 0x22244893, 0x012868a3,
+    0x05f9f2e5, 0xb775e552, 0x4037ec58, 0x0a44b0c8,
+    0x7b701936, 0x2d2b572c, 0x5b4ad686, 0x162e15e8,
+    0x0cd199fb, 0x005116c4, 0x2bb72edd, 0xe027d971,
+    0x862a9d54, 0x68111a62, 0x74c393c2, 0xf6ad5485,
+    0x754e35da, 0x4e25033a, 0x682b4ce8, 0x65635030,
+    0x61ecd7b5, 0x8603b811, 0xe0248fe6, 0x3672088a,
+    0x6e2c306b, 0x5e05c992, 0x0d4665d1, 0x03774196,
+    0x666fa822, 0xca251034, 0x9a23f0d2, 0x9bf6eedc,
+    0x38d08ea5, 0xcc842b11, 0x2271ac52, 0x038d0d89,
+    0x27d5a253, 0xac1fd84c, 0x02337281, 0x7178b71a,
+    0x48ad3a94, 0x7d82e371, 0x7ec7ef18, 0x3a2d1a3b,
+    0xd9f13b88, 0xab37ed5c, 0xcbc1f328, 0xacd9b264,
+    0xd0655b37, 0x26c12467, 0x5fe9ca8d, 0x6484dbba,
+    0x8a0d1be4, 0x44195bd8, 0xd0b756a4, 0xc16c5a2a,
+    0xacd9b701, 0x48ba51c2, 0x69099227, 0xc397af89,
+    0x7cd68460, 0x9fc8506c, 0x8259525a, 0xb72edd80,
+    0x66cb5021, 0x080dd524, 0x9d645ab0, 0xc84a1b22,
+    0x31631e4c, 0x2fc68c07, 0xecad2283, 0x7cf91297,
+    0x19618782, 0x43deba0d, 0x9ebd3d1b, 0xddb5912a,
+    0x242b37ec, 0x3b569cb1, 0x83580c78, 0x0a94b067,
+    0xdbb772cd, 0x0c74a351, 0x385cd20d, 0x6e855089,
+    0x8d3b014a, 0x1aebf432, 0x705c3920, 0x95153b00,
+    0x1d03421c, 0x28317ca5, 0xc0140b93, 0x2ad0b722,
+    0x9b16ed5d, 0x4655c061, 0x2a5a151a, 0x2268c7be,
+    0xb66e4809, 0x65cedc6a, 0xf44b255d, 0x1b4bc2c2,
+    0x64c39695, 0xdb86a0af, 0x300a0470, 0x4042b66c,
+    0x278c498a, 0xa74eb281, 0xcf18d156, 0x093ec504,
+    0x7ad3ce8d, 0xc1ecdbb2, 0x08cb94b4, 0x07f00050,
+    0x52303180, 0x25016b09, 0x95b49a2e, 0x612b0a09,
+    0x00142d98, 0x5dbab1e8, 0x78e1566e, 0x14165dcc,
+    0x84851162, 0x1da93024, 0x1f64dd96, 0x205fbe94,
+    0xd4e9d3a1, 0xbf1e4d6a, 0x3e8d0355, 0xd4a042bf,
+    0x35fab5e8, 0xa752bf4e, 0x11a440d3, 0xa5426d1a,
+    0x8684a945, 0xd5a95f89, 0xa6410301, 0xd2e2c6d4,
+    0xe0495528, 0x8870d121, 0x42772a19, 0xa06dd8c8,
+    0xf89302c1, 0x0a8b76ac, 0x824e6540, 0x50042796,
+    0xbe1d0b32, 0xe01405ea, 0x6aa2cdde, 0xfc993f23,
+    0xb2e78dcf, 0x03624859, 0x5cd8931b, 0x7963c830,
+    0x6d63c3d7, 0xe70602b8, 0x889eb273, 0x700587e8,
+    0xaa48750b, 0x82642b87, 0xddb9207b, 0xb6518a2c,
+    0x10784683, 0x85a4f229, 0x39113026, 0xd912e457,
+    0x67cb8a05, 0x4790090b, 0x0d797702, 0x51e2e3b0,
+    0xcb960799, 0x2188376c, 0x7221c21a, 0xe14614da,
+    0x25114379, 0x5907020b, 0x20f6ac04, 0x69094db2,
+    0x74190680, 0x9202db90, 0x5f8b6063, 0x85114061,
+    0x5215ca29, 0xa61a0d70, 0x5432105a, 0xb6328fee,
+    0x72ef0683, 0xac2cddb4, 0x851db703, 0x0d8b36e0,
+    0x7d2a41ca, 0xebdfa0a3, 0xddaa4c0a, 0x274125e6,
+    0x16ae3a79, 0x9ab065fb, 0xbe913323, 0xa74f870a,
+    0x7a34a951, 0x340e54fd, 0x830afdfa, 0xc5d7a253,
+    0x53a95f03, 0x0852a0e9, 0x52a1368d, 0x8b868da2,
+    0xead4af44, 0xd3a08180, 0x1944666a, 0x65c9a294,
+    0x6e0c883b, 0xb320f255, 0xbd69e7ba, 0x2d235d59,
+    0xe7c61890, 0x8e0c425f, 0x0bb26ecb, 0x02613585,
+    0xcb8a1d0f, 0x80884e67, 0xaba5be94, 0x6bcb969d,
+    0xed880b34, 0x30306bf6, 0xabe18e6e, 0x63a307da,
+    0xe02ec8b2, 0x92ca9764, 0x4b9554e3, 0xf6c5bed8,
+    0x8b7db12f, 0x953d56ec, 0xdb36367c, 0x606e3c80,
+    0x450ab2b1, 0x94b5e704, 0x364e70b6, 0x6c909aeb,
+    0xca0d8b76, 0xdcb72a41, 0x0f822dad, 0x77ee5c08,
+    0x2ad04d7b, 0xb019b123, 0x3182154d, 0x5930094b,
+    0x3116e7ac, 0x3ff08f4e, 0x78f40459, 0xdd704237,
+    0x0085e42b, 0x3612891d, 0x4739581b, 0xd4aa43b9,
+    0x2b3dbe87, 0x430e9415, 0xf4f81edf, 0x20eab4a8,
+    0xdaa4c7f7, 0x9683df21, 0x58b365c9, 0xa0cbb66e,
+    0x4c6249ca, 0x6d5d3115, 0x0d7532c2, 0x2d6cc586,
+    0x2b52a20c, 0x2d15e85b, 0xdb806036, 0x2861d6ec,
+    0xc61324dd, 0xa625489b, 0x015fbe97, 0xf1591b22,
+    0x293103cd, 0x6e5c4130, 0xa4905b97, 0xa212b365,
+    0x4444d5b5, 0x18909516, 0x12c6a23a, 0xea4d3031,
+    0xc250141b, 0x85740382, 0xdaf6ad54, 0x20e64d35,
+    0x16dda964, 0x0d066d25, 0x597ad3ce, 0x0af72a1c,
+    0x878aaa91, 0xa951a74f, 0x54fd7a34, 0xfdfa340e,
+    0xa253830a, 0x5f03c5d7, 0xa0e953a9, 0x368d0852,
+    0x8da252a1, 0xaf448b86, 0x8180ead4, 0x6d6ad3a0,
+    0x6c59b2e8, 0xdc18f076, 0x3f4febab, 0xa58f6c09,
+    0x9c106d23, 0x64eb1654, 0xa2ac26f5, 0x06b7f124,
+    0x597541c6, 0x5f65ce94, 0xc3aa0c04, 0xa55cb264,
+    0x0907b186, 0x3aeb0c49, 0x36ad5990, 0xee3c28cb,
+    0x5b94b164, 0x65cbb6ae, 0x9132a4c1, 0x372cda28,
+    0xc243403b, 0x0d026d03, 0x00532aac, 0x6819a978,
+    0x3c82db76, 0x2a3b776e, 0x0abf482c, 0xea5289bd,
+    0x4c7a1b22, 0x15222247, 0x48048730, 0xf6f40972,
+    0x4a993141, 0x3b1e4256, 0x926d7410, 0x40cab40b,
+    0xd6f91412, 0x48d015e6, 0x78618682, 0xc9da0c59,
+    0x664db336, 0xbe04b953, 0x1468205f, 0xb2e497c8,
+    0xf8f2951a, 0xd8a4d936, 0x1bc1a56c, 0x8e6e18b5,
+    0x068faf44, 0x0015fcea, 0x5d635a9a, 0x26a42d40,
+    0x84b2d12d, 0xfb35a484, 0x64e5bebd, 0x67ca87b9,
+    0x0bc89520, 0x681b2a63, 0x3f074e48, 0x74828c5c,
+    0x36e31568, 0x41b3b6fd, 0x586c14d1, 0x58b7d3c4,
+    0x3112a56d, 0x93069914, 0x8c061b24, 0x0f512694,
+    0x673bd08d, 0x0a7a4132, 0xf4836c87, 0x54d4a01f,
+    0x8d260d80, 0xba61e9ce, 0xd1656c5a, 0x79d20d1e,
+    0xf80c3069, 0xad8c287c, 0x29bb2e9f, 0x66903563,
+    0xdc191536, 0x2f22a3ac, 0x210ec00d, 0xdca020c1,
+    0xb120a380, 0x23372cda, 0x868992d8, 0x09213ba8,
+    0xf9f26505, 0x78e03e05, 0x6dd87011, 0x08372188,
+    0xe072ee24, 0x064814ca, 0x17bc0143, 0x936f73c8,
+    0x836a7a4d, 0x959433c5, 0xf525e885, 0x48d99822,
+    0xdeb473a3, 0xbb99a1ac, 0x4ac406da, 0x068d1213,
+    0x089e2065, 0x90925244, 0xa8c05ef2, 0x94304b42,
+    0x432ae857, 0xe344cf00, 0x274dbc30, 0xda246b13,
+    0x1a9935cd, 0x2b35a288, 0x2e90b67d, 0x0e80c481,
+    0x9c2980ea, 0x1b84beca, 0xabdeb29d, 0x64122114,
+    0xea1a53e8, 0xc4b0452d, 0x75ea7c1b, 0xdddcb961,
+    0x40193182, 0x60d264c9, 0x5a1e024c, 0xe0491938,
+    0x1f29e750, 0x52dbfef8, 0xd29d1b03, 0xd8b474c3,
+    0xd830f6eb, 0x228927dd, 0x069d129f, 0x0911224c,
+    0x3c1b001b, 0xdfde8d33, 0xcd5cb272, 0x0d25687d,
+    0x2bd0bea2, 0x469e9495, 0xc601b8f1, 0x18545ee8,
+    0xf8a280db, 0xf0d98c49, 0x4959a352, 0xae32b99e,
+    0x7694bc92, 0xc9da20d0, 0x1e81e2e6, 0x2c3e188f,
+    0xa6705ed3, 0xb298a06f, 0x51762edb, 0x4285d9a0,
+    0x74e99a7a, 0xbc30c347, 0x6b73664d, 0x35cdda24,
+    0x76880e99, 0xb67d2b35, 0xd98b33a6, 0x81ac2ec7,
+    0x49a7ceb7, 0xc98d2351, 0xba11278a, 0x9b966e58,
+    0x445b851b, 0x4c9e26d4, 0x3b5d625a, 0x65d9a635,
+    0xdf0689b9, 0x7d8d1075, 0x1bedc4c9, 0x97c634bb,
+    0x06119e20, 0x59b96fef, 0x11de632e, 0x27f4a6a5,
+    0x24c83023, 0x5799acc7, 0x61175a45, 0x4dfc9630,
+    0x594cd037, 0x18f1886d, 0x759b998d, 0x2fcc41d6,
+    0xda0c5b13, 0x4db336c9, 0x97714d66, 0x2b15e4cb,
+    0x33b4b67d, 0x462adc8b, 0x3e1d2a31, 0xd1a4469d,
+    0x3850f5eb, 0x2af4ebd3, 0x5f8b4e0d, 0xf5eb54a3,
+    0x0a347d2a, 0xd4a61141, 0x985a542a, 0xfa956848,
+    0x3410509d, 0x3f4d6d1a, 0xdb685497, 0x0dab53e7,
+    0x2b37f0cc, 0xa5d5dea1, 0xcea53d31, 0x5aba61e9,
+    0x11416b6c, 0x7579d20d, 0x67d20d0d, 0x27ddaf32,
+    0x602291c2, 0xa297e901, 0xee069338, 0xde7d2b40,
+    0xddb462bf, 0xe00b722e, 0x5186ad4d, 0x166dd8b5,
+    0x9685f852, 0x4e903c79, 0xda993225, 0xa1a26ce8,
+    0xd2438a5e, 0x90798b14, 0x9bd6ac0c, 0x88e69665,
+    0x08d57d1b, 0xa608f235, 0xb96fef46, 0x42642e59,
+    0x43b4d81e, 0x5cb86de3, 0x133ee284, 0x37eddc50,
+    0x063181a1, 0xe46b2641, 0xd033baca, 0xc98409bb,
+    0x82be69e2, 0x2c6ccb62, 0x462cf788, 0xc5dab0c1,
+    0x0656252a, 0x51c56ec8, 0xca0a5fbe, 0x0981458e,
+    0xba7315c6, 0x9b966e58, 0x90aee819, 0xacdbd1a0,
+    0xd029db36, 0x26612397, 0x0341cc88, 0x828c0f6e,
+    0x0c0668c7, 0x96615582, 0x61410e09, 0x140889af,
+    0x06b19b21, 0x3919c456, 0x7bf62a4c, 0xc8588240,
+    0x3821f3c2, 0x55a210d9, 0xe534681b, 0x10175204,
+    0x0f624449, 0xd58e7222, 0xb3b44322, 0xa376c405,
+    0x051498c1, 0xba01e9be, 0x21436e5d, 0x5a82a418,
+    0xd9825132, 0x13218e6d, 0x09dc0079, 0x820c002f,
+    0xad2bd086, 0x6a34a0d1, 0x315b5a75, 0xa316c8b0,
+    0x2d48b473, 0x8a0451e6, 0x51486e20, 0x40a1cbb3,
+    0x2dddb071, 0xd5053936, 0x9539536c, 0xb30ae97e,
+    0x72c2ae5b, 0xcacde57f, 0xb9163aae, 0x30a55c3c,
+    0x33264ebc, 0xc9e61c1b, 0xd6a49a63, 0x8c196fcd,
+    0x907660a0, 0xc5c0cee1, 0x20981d3c, 0x9cb672a5,
+    0x04504e8e, 0x9020f21a, 0xa6b15f07, 0x2b3ce946,
+    0x33ace09c, 0xebdcc8e0, 0xa6ec9a76, 0xe9127b52,
+    0x0033264c, 0x3367cc00, 0x1ab9ea32, 0x7141e1d0,
+    0x114eaa42, 0x53e754a3, 0x6c2c30ab, 0x89086d8b,
+    0xdb36acd4, 0xaf41f52a, 0x8418635f, 0x6bcce644,
+    0x4710994d, 0xd357b4d1, 0x0150148a, 0x0af2e5cb,
+    0x0aa45c40, 0x050db101, 0xa052364e, 0x20980496,
+    0xe4dcb4d5, 0xda2deb16, 0x351b66ca, 0x976cd9d6,
+    0x7380a10c, 0x45049339, 0x81b76ca3, 0x6b36c205,
+    0x6163da75, 0x502a0a2f, 0x896326db, 0x41a0ede0,
+    0xcadbd7b5, 0x59714590, 0xb477d341, 0x3286c80c,
+    0xc4931880, 0xe1b2955c, 0xe52a65d7, 0xedf96859,
+    0x8c17b222, 0x233141b6, 0xc8de0048, 0xad281205,
+    0xaf6955c6, 0x564ecca1, 0x6b480b4b, 0x6a5a09f2,
+    0xb401662e, 0x52fa46d7, 0x8cb49145, 0x9852434d,
+    0x3ac44cd7, 0x9fd9d5f1, 0x105241d2, 0x804b9092,
+    0xa4499303, 0x4eb2c109, 0xb67142a7, 0x01b7edd8,
+    0xe405cbac, 0x4a897007, 0x7e302748, 0x56ee0148,
+    0xe4d6a55b, 0xfb491b5e, 0x7acb766e, 0x28e345e8,
+    0x87b4a203, 0xf01765a2, 0xfb15eddc, 0x756d1068,
+    0x41df5cf1, 0x6c694730, 0x85a138c4, 0x14e4cb97,
+    0xd08e4d4b, 0xb67d1b43, 0x2d1b53f2, 0x190be486,
+    0x362d6170, 0x4cdab0e2, 0xbd1b5e04, 0xb15fe596,
+    0xebb6ee5b, 0x37dfe622, 0xa62d2829, 0x881120cc,
+    0x734903cf, 0x25c6d8af, 0x229faf74, 0x94119d4c,
+    0x70db8606, 0x9d940d34, 0x8d06e7e4, 0xb074c392,
+    0x1584dad7, 0xedd66872, 0xfb63d935, 0xc12b1e00,
+    0xae6b4cd1, 0xa5ec1f81, 0x98d12c98, 0x80b0484a,
+    0xe5d6a51b, 0xf18a5a6e, 0x982dad41, 0x0afb8683,
+    0x150a3f85, 0x1a8d5252, 0x3f9d3aa7, 0xeb3672f1,
+    0x6341d29d, 0x41462fb4, 0xb4485e2a, 0x11691898,
+    0x65af423a, 0x8a9d0e94, 0x090367cb, 0x6cc24ffc,
+    0x84899150, 0x1b01219e, 0xc245741a, 0x7ca51b5d,
+    0x407bb736, 0x31228d48, 0x44840859, 0x6a52b3e4,
+    0x21c69d8f, 0xacab11a1, 0x76b30465, 0x630f3988,
+    0x894c902f, 0x7839002a, 0x716c6834, 0xa4c42bb8,
+    0x2890a326, 0x861d5c8e, 0xe16bda75, 0x92952ab3,
+    0xd7b074c3, 0x74d1a4ca, 0x35edd6f0, 0x119f8cd2,
+    0x11d66bca, 0x35a6c438, 0xbc0d29d4, 0x4034566d,
+    0x49ea298d, 0x5e049485, 0x31901b58, 0xa0244503,
+    0xa4140773, 0x98615697, 0x4c78ce92, 0x2ba48419,
+    0x0d130300, 0x9156c290, 0x976dd954, 0x2c87283b,
+    0x283a5b56, 0x31af6644, 0xa840df3a, 0xd6a51b88,
+    0xfa1019e4, 0x3026c405, 0x24d09daa, 0x4a90e127,
+    0x382555a1, 0xa973aad1, 0xf3e0bed5, 0xeddbb823,
+    0x5a4936d7, 0x15190217, 0xf66dd3bc, 0x40db3846,
+    0x2d1a0a84, 0x0d6fe5ca, 0x06ca9a8c, 0xcbdee034,
+    0xe930b068, 0x22f0c49d, 0x5e0d26a3, 0x51aa49a5,
+    0x55226a57, 0x44900e62, 0x8d112424, 0xa2418b4a,
+    0xeaf4e957, 0x2a9d6565, 0x6d5db746, 0x7882cb96,
+    0x14b4d657, 0x76c4b4a8, 0x59b73129, 0x9599820d,
+    0x2209d960, 0x3c901b04, 0x9429d382, 0x632e958e,
+    0x26489e41, 0xf5449f08, 0xa95f9f3a, 0x8a7468d5,
+    0x4c931afd, 0x193da3a2, 0xdbb153e0, 0x0221c7ed,
+    0x43c2a28d, 0xcb8a5519, 0x28094967, 0xa51b96ac,
+    0x9520bf86, 0x210609a8, 0x0622baf2, 0xd6af73e9,
+    0xbad135ed, 0x2c326c8c, 0xdd881711, 0xb95feb45,
+    0x55566fda, 0xa59a2d51, 0xaad1b66f, 0xd9903375,
+    0x1b2d4259, 0x856c2a9b, 0x02dcb682, 0xd9b973c3,
+    0x3024836c, 0x264d820c, 0xce5b883c, 0x1879f2e8,
+    0xfa74a8e4, 0xf5686873, 0xddd310f7, 0xd4a04203,
+    0xa981aee8, 0xfa54ead7, 0x23821468, 0xa854a84d,
+    0xd1a2c1a6, 0xa03af52b, 0xda346820, 0x9729fa9b,
+    0x0bd180a2, 0x99155e44, 0x6e10cc18, 0x8ca90472,
+    0xb934cd65, 0x716d6c5d, 0x50192e94, 0x202311f2,
+    0x97a00ed5, 0x6e641800, 0xd159f256, 0x9d3ae740,
+    0x4dc51255, 0x35abd3a0, 0x8b427dfa, 0x268d4d4e,
+    0x7c129098, 0x37b60d80, 0xddcaad4b, 0x6d5db720,
+    0xc481cb96, 0x047d7343, 0x579accc5, 0xd8be7d0b,
+    0x9615cb95, 0x4bb769cf, 0xb26ea30d, 0x76220501,
+    0x5a2081db, 0x57b26563, 0xd09b76ee, 0xbbf56b20,
+    0xaa2e744d, 0xcd756093, 0x7a032075, 0xa54b1448,
+    0x8488bc6f, 0x2d3b3271, 0xe822a8b0, 0x14e4cb97,
+    0x515a4b33, 0xad1b9842, 0x24372ec1, 0x2354da60,
+    0x868d0164, 0x0c3f6cc5, 0xe10357b8, 0xa8e4927f,
+    0x4e9d73a0, 0x1b3a34a8, 0xfa756ae4, 0x499d1625,
+    0x1212d1a2, 0xb478f3fd, 0xe4214805, 0xff5081be,
+    0x89277186, 0xc5f66dc4, 0xdcc6a750, 0x8cad2bab,
+    0x158b32f8, 0xb769cf96, 0x4e70043b, 0x277a7286,
+    0x7dfa94aa, 0xa7419b7e, 0xfaf46b56, 0xf46b3082,
+    0x2e314d6a, 0xb5457523, 0xa1271acc, 0xf6ad5d85,
+    0xa42a249b, 0x4c351aec, 0x653b3662, 0x312508bd,
+    0xcb069ca9, 0x25c8b661, 0xa04b6b56, 0x197ba34b,
+    0x0e0385a0, 0xd8a8349e, 0x1d9b966e, 0x0461c77e,
+    0x9339f00c, 0x118e00e2, 0xa1024ac6, 0x91c7e9d3,
+    0xa0ead7a3, 0x0a0d4671, 0xa1a25383, 0xa95fa7c6,
+    0x52a0e953, 0xa1368d08, 0x48084952, 0x9dfa9568,
+    0x1a341050, 0x17a94d6d, 0xc9fa6c39, 0x0c887c65,
+    0xecf6556e, 0x5fe75a84, 0xe6440197, 0x89bc112e,
+    0x5b56dcf4, 0x227a9075, 0xed5bb8f4, 0x873dc1f6,
+    0x9142d449, 0x410604b7, 0x6e58b463, 0x3d79514a,
+    0x0f70c3b6, 0x67d76288, 0x968d636e, 0x701b8958,
+    0x3bd7644c, 0x5414e84d, 0x431c915b, 0x88332663,
+    0x7b239218, 0xad782854, 0x80ec0932, 0x79612760,
+    0x2349d928, 0xe0092b64, 0x9916e481, 0xae9b044a,
+    0x82e41934, 0x4a52d760, 0x84b40c80, 0xfca034d2,
+    0xfdfad469, 0xa443ab4e, 0x9ad4e857, 0xa0721465,
+    0x6e59b903, 0x54915b97, 0x655bd76d, 0x1060e0b2,
+    0xaec4b5ba, 0x8d63e1ee, 0x1b23e0b6, 0x64cbce9d,
+    0xe7ceadaf, 0x9a0c595f, 0xb1f01640, 0xd335ed56,
+    0x9ffe9fff, 0x42154054, 0x55a94fa1, 0x0744b428,
+    0x650a3ca0, 0xbc131f83, 0x27e688cc, 0xc9da0c93,
+    0x5158ba61, 0xa2102be3, 0x4bd76d40, 0x08510828,
+    0xc2001224, 0x7dfb56ac, 0x535215b2, 0x7aa61a0d,
+    0x6e9c981b, 0x1011d183, 0x3b166420, 0x32288545,
+    0xacdb91a1, 0xb22cdb36, 0x9c0d5341, 0xb1604298,
+    0x5730a054, 0x4a16cd08, 0x03824ada, 0xac5b3214,
+    0xc81b3184, 0x83856cc4, 0x2dc803b9, 0x5a039532,
+    0x90c2ca6c, 0x0213244f, 0x928c8328, 0x212d03a0,
+    0x3f288d34, 0xbf3e751a, 0xe9d0aa53, 0x2635fa15,
+    0xab1c4599, 0x1bd6ac7a, 0x15cace65, 0x5e957856,
+    0x6d2be9c8, 0x303742c0, 0xf72bd9d0, 0x10e84d3b,
+    0xc980f535, 0x0b6f01a4, 0x5dd36e15, 0xdb00a83e,
+    0x990b2ee7, 0x2b7e85ec, 0x4ed94253, 0xa2f13444,
+    0x8d584c38, 0x99327282, 0xaa2b97ae, 0x0a239494,
+    0x90aedbb4, 0x686491aa, 0xdbb836d5, 0x14b1232d,
+    0xc06d9809, 0x2cdab162, 0x1b95112f, 0x893784c8,
+    0x69423460, 0x0d950f4c, 0x15cb36bc, 0x5f6bc786,
+    0xca128c0d, 0xd4b9bde1, 0x7a013290, 0x6082ced7,
+    0x068be013, 0x201053c8, 0x28a781dc, 0x850daa0c,
+    0x48366c46, 0x13608a89, 0xdebc355b, 0x150c412a,
+    0xcb5626a4, 0x72cbde7d, 0xf7add8af, 0x4784705b,
+    0xe412844c, 0x534a8491, 0xeb5ceac6, 0x8d12b1e9,
+    0x2911bed2, 0x2414ad5c, 0x00284793, 0xaf6957d9,
+    0xdb36acdb, 0x96ac6c29, 0xbf86a51b, 0x508f9520,
+    0xad116424, 0x35a86bda, 0x58acb84d, 0x89b1222a,
+    0x09b26b4c, 0xd1c6db68, 0xd9905e66, 0x90a8e212,
+    0xf90e00f4, 0x4623907c, 0x0e9d3ac9, 0xb663dbc6,
+    0x47c605dc, 0xf2b7bb36, 0x0c3e2141, 0x07a09ac1,
+    0xc34607b1, 0xb2cd376b, 0x2d1b4bd2, 0x1d28e491,
+    0x36ecd890, 0xc38a65cb, 0x6597b563, 0x5f929228,
+    0x05fae292, 0x2edd7840, 0x95d025b7, 0x41213014,
+    0xf6ad5d85, 0xa52a249b, 0xaad1b66f, 0xdbba016b,
+    0x296e0383, 0x6edf8e15, 0xc7828c0f, 0xa4dcb068,
+    0x9548a512, 0x8145c088, 0x5f5290bd, 0x2d55902f,
+    0x8d70e103, 0x5336fac0, 0x3c0482a0, 0x8d586136,
+    0x21209e84, 0x2cc58db4, 0xdbb09357, 0x9761242c,
+    0x2ffa4e17, 0x968bf131, 0x7c1b59ea, 0x91000028,
+    0xebd66cda, 0x20cd9625, 0xf6edd8ba, 0xc38afdfa,
+    0xecd7b273, 0xcafd3ad7, 0xc5026ddf, 0x910ad1a2,
+    0x6ed30a88, 0x47fc88b2, 0x7978f992, 0x149b962d,
+    0xa6205b82, 0x81616cda, 0xe8ba8d06, 0xb2651b05,
+    0x5b9072cb, 0x2dab56ec, 0x1b06e88e, 0x13caa695,
+    0x40922d1b, 0x86952b25, 0x489779e5, 0x1c01602f,
+    0x76e8f090, 0x3ce485fb, 0x94407b36, 0x4c391465,
+    0x98306582, 0xe21464cd, 0xda848f28, 0x8e9d0a32,
+    0x8d406fd1, 0x02d550d0, 0x376ddb78, 0xbaa49d3b,
+    0xc8300032, 0xb2d1002d, 0x0b32afd8, 0x074b3839,
+    0x8159902c, 0x7b1ba7c2, 0x5f424638, 0x1e943d1b,
+    0x807c4b37, 0xb8f12132, 0x30e68609, 0x2cdd3824,
+    0x8d00812c, 0xa324289c, 0x45cc092f, 0x12b47487,
+    0x6b363e48, 0x2368dca5, 0x808a17d1, 0x1b0ea24e,
+    0xabc2a61d, 0x6e20203b, 0x03b1d5b6, 0x6b76e404,
+    0x63453c4b, 0x9c881828, 0x8b315564, 0xc232a548,
+    0x4a899a69, 0x54621b36, 0x301ea244, 0xf62ec8eb,
+    0xeedb7090, 0x0d0571ad, 0x1be1e8ce, 0xe2d21819,
+    0xb21d1b24, 0x984464eb, 0x9696ed79, 0x981499b0,
+    0x0d161284, 0x3674d19e, 0xb7ae5c09, 0x4c2b5136,
+    0x78db360a, 0x73c06cd4, 0xee7c8b68, 0xe0105b17,
+    0x4080766e, 0x76ba4485, 0x0a854022, 0x1a3b14e6,
+    0x4ba446cc, 0xed4b8136, 0xd9a820f7, 0x22c1896d,
+    0x4f80a515, 0xc8c85144, 0x2b68865e, 0xa4505481,
+    0x8ff83706, 0x74772284, 0x6645dbe0, 0x1a943648,
+    0xba6641c6, 0x82c7addc, 0xc8928db2, 0x9d781102,
+    0x7065d5d2, 0xa7cb4408, 0x069cb766, 0x1917dede,
+    0x25bc441d, 0xce156d61, 0x51224774, 0x61e503d5,
+    0xc0ee5bb1, 0xa51b6b51, 0x78eb1624, 0x8aa25688,
+    0x9188415b, 0x8db97389, 0xf1e63488, 0xc4cab0b0,
+    0x8e752b80, 0x1fb275d9, 0x142e1008, 0x90a0d36c,
+    0x11ba73c3, 0x61216244, 0x4e3c8821, 0x72f9f1e8,
+    0x5014e91d, 0xd5e8d398, 0xa406bd4a, 0x4e4d1a08,
+    0x53a95041, 0x259ad4ea, 0x91208916, 0x0f824150,
+    0x6a501319, 0xd31891f4, 0x3840b5ea, 0x41a54688,
+    0x322b55a7, 0x00c86801, 0x5d1a06e2, 0x0e449d26,
+    0x31b0168d, 0x544c2d1a, 0x3491fa34, 0x85da34e9,
+    0x103c9232, 0x87c686b0, 0x00d1aa4c, 0x509047a3,
+    0xa74e4587, 0x342ec480, 0xca9540d2, 0xa1394fa9,
+    0x3a828535, 0x68d37822, 0x201d2ab5, 0x151a541c,
+    0x21264e24, 0x8cce1296, 0x64711a08, 0x37a1c5e8,
+    0xe2455c8a, 0x561d1a2c, 0x50100698, 0x0a556ad5,
+    0x22844c7d, 0x648926f1, 0xa341c669, 0x45058d54,
+    0x65fc8821, 0x920982c7, 0xc2c06a54, 0x6948896b,
+    0x9369c394, 0x1687828e, 0x0795d430, 0xead3a120,
+    0xd1909115, 0x081102e9, 0x21d6318d, 0x4413a142,
+    0xa6c127ee, 0x8dda8401, 0x050d5fd2, 0xa2712c60,
+    0x12b46950, 0x86518dd0, 0x20728124, 0xc5cad4a4,
+    0x4c859010, 0x014163ea, 0x28440d0d, 0x849967f1,
+    0x10dec24f, 0xdc458870, 0xc51e712b, 0x10b6925e,
+    0x0c84b090, 0xa571022b, 0x2a649e4a, 0x8646687a,
+    0x0e392225, 0x8524ec89, 0x57d00817, 0xe810c8c6,
+    0x61e32ad5, 0x81880804, 0x927e55e7, 0xe862d846,
+    0x84298912, 0x97fb427e, 0x773e0807, 0xa4c200d0,
+    0x8e759b76, 0x59b275d9, 0xad2b1264, 0x976fdf8e,
+    0x66e94683, 0x36add997, 0xe77e2dcb, 0x2cddb979,
+    0xa275d9b6, 0xfd1122d1, 0x1b1fe8d6, 0x09e0be9c,
+    0xc377601b, 0x6d1b03a6, 0x0c6edfb6, 0xa3826aa0,
+    0x9c8d2a6e, 0xb1132274, 0x53766e58, 0xe4469018,
+    0x8a281029, 0x3ae1cc1e, 0x5f8f2635, 0x9fc681aa,
+    0x5950a15f, 0x54a35f43, 0x7d2af5eb, 0x11410a34,
+    0xa316d4a6, 0x120d0953, 0x02aa53bf, 0xa94d8306,
+    0x7540068c, 0x2f5b9ad2, 0x81a83257, 0x5bb62e0d,
+    0x25ac9075, 0x6d58b7b1, 0xc29d5bb6, 0x081563c3,
+    0xb017e4a4, 0xf685be88, 0x862d2b35, 0x0d4a20c9,
+    0x7620f3b2, 0xb2da819c, 0x2cc805c9, 0xd20d4b76,
+    0xf11416c2, 0x62c30048, 0xd6acd9ba, 0x66b8945b,
+    0x03a17463, 0x4b375ed0, 0x976e3491, 0x868c7051,
+    0x5dba69d9, 0x3b6d2408, 0x2474ba0d, 0xe6cc4843,
+    0x9e04a953, 0x341a41a4, 0xeb56219c, 0x3bc4b6ad,
+    0x4eac7b2b, 0xc50c7367, 0x0e5ddd6e, 0x83593c0b,
+    0x1c080a78, 0x5178ea8f, 0x8ac58e63, 0xdbb9c166,
+    0x50714aee, 0xc16c898d, 0x1ff92354, 0x7963f9c8,
+    0x42400089, 0x0b82a195, 0x176fe9be, 0x22cac915,
+    0xcc0d5a21, 0x195183e0, 0x61d18ead, 0xa6eb56b9,
+    0xba5d4ca4, 0xd01b2bde, 0x27c246e0, 0x98b4951b,
+    0x081aa124, 0xb518d0bf, 0x86550a41, 0x85b47303,
+    0x41324106, 0x894dd48a, 0x0408b477, 0x1802b259,
+    0x6cc30683, 0xc1edd9b4, 0x86a7b7e2, 0xa92454e6,
+    0x7b976ed9, 0xc9487c28, 0xa0886269, 0x2031366d,
+    0x3ae7528e, 0xa59ed470, 0xa4ccb66f, 0x8d690ae1,
+    0x512474b4, 0x6a85d9b7, 0xc8288519, 0x8a097225,
+    0x4d0298a4, 0x4060c01b, 0x32b220e5, 0x1b68c286,
+    0x30cc9aad, 0x14dd9b97, 0x891402e6, 0x8424c405,
+    0x1379228a, 0x1b4670db, 0x03e8be75, 0x528c2d1b,
+    0x86a03637, 0x5144f206, 0x23dcd8a0, 0x8681b961,
+    0x8aa2b7ce, 0x6fe9fe13, 0xe6ca9527, 0x58ab1b43,
+    0x6054766e, 0x6125afd8, 0xd08ead19, 0x75dd1a50,
+    0x376b8b16, 0x2370e89d, 0xca8d1361, 0x50124cda,
+    0x825f048d, 0x003350e7, 0xb8222e6c, 0x44966c58,
+    0x92120b63, 0xf8b01b84, 0x1923e253, 0x22a4c804,
+    0x540906f4, 0x19b68445, 0x1bd29e05, 0xc9a9b810,
+    0xe1d13648, 0x72df4618, 0x429987bc, 0xd0a03b36,
+    0xa788c4a5, 0x61e701dc, 0x8a043eb6, 0xdb28f036,
+    0x9024ecee, 0x72e9c639, 0x96b5881e, 0x4d1b2084,
+    0x231adc9e, 0x42e64c79, 0x84a5b401, 0xb7032626,
+    0x36b8840a, 0x26944844, 0xd33967a6, 0xb1a26e45,
+    0xa59e0c66, 0xe4d4b66f, 0x5db70ae1, 0x8821b66d,
+    0xb7ccc68d, 0x2b66984b, 0xaad3e776, 0xe24ae6cc,
+    0x4bd4115d, 0x0d094871, 0xb07441a2, 0x604284d8,
+    0xcc8341fa, 0x0a68730b, 0x7023d9a4, 0x2e45106c,
+    0xa5787b97, 0xd86a33a6, 0xce8e0e79, 0x05de3816,
+    0x9dba6c03, 0xe227ca85, 0x0a818c3c, 0x70782b37,
+    0x19e70441, 0x70db9605, 0x62043bba, 0x2fa3e868,
+    0x112a368c, 0xc686951a, 0x171112a7, 0x21bed0c6,
+    0xf62c4821, 0x1c94b59b, 0x84902136, 0xab4e8d4e,
+    0x5128664b, 0x08cd2fb4, 0x95b42161, 0xb661dd06,
+    0x83969099, 0xb00d36a6, 0x60703778, 0x5622c1d9,
+    0x2d4a4b12, 0x99b2f180, 0xc128c844, 0x534a06b1,
+    0x5c0d5e2e, 0x3df42254, 0x3602a515, 0x4c9620e5,
+    0x0d4b978e, 0x51252889, 0xd7be8d1b, 0x0639b875,
+    0x0539a0e6, 0xb463d392, 0x6ddf0612, 0x8120915f,
+    0x45612e63, 0x6125280c, 0xd2ce8d11, 0x41d019f2,
+    0x99334306, 0x7a12a44e, 0x526b5c90, 0x2b538570,
+    0x819c3a55, 0xe044562e, 0x7483d0d7, 0xe44598b9,
+    0x2533c125, 0x1b360c85, 0x13245120, 0x7082e4c9,
+    0xbadd8a34, 0x251b37ba, 0x6b61c696, 0x36a4912d,
+    0x46a0d094, 0xa47a7ad3, 0xf12c0c80, 0x2a988d5e,
+    0xa8b952ac, 0x44364e04, 0x8ee08dcf, 0xd0a3eb36,
+    0x10c0844c, 0x1a90a360, 0x8d2f3121, 0x44379890,
+    0x2c44b608, 0x8817dc66, 0x6669c960, 0xeec607b6,
+    0x8680100b, 0xf1225485, 0xc7a60d05, 0xac5b9068,
+    0x902641a2, 0x8f6200d1, 0xad0c801b, 0x091241e0,
+    0x210425b9, 0x6b46a91d, 0x951f11ea, 0x913666b4,
+    0x4c48a318, 0xcaad7b36, 0x82b474c3, 0x852e5346,
+    0x1196ed58, 0x422ac810, 0xc525a3b1, 0xad0b37ea,
+    0x1962d88a, 0x55901805, 0x6cd4c83b, 0xee55d8b6,
+    0x11002015, 0x4464ea3c, 0x40f00b32, 0x29107c82,
+    0xe163ae59, 0x840a190e, 0x7a80486c, 0xa0905089,
+    0xe8ac0c01, 0xa1a5c51a, 0x574485a2, 0xded21d5b,
+    0x5bfb12c9, 0x170c624f, 0xeb86bbe0, 0x9499b56e,
+    0x944b6600, 0x226a8832, 0x068db012, 0xd9b26255,
+    0x6e2c83db, 0xb62c4a98, 0x77a624eb, 0x6cda910a,
+    0xd3a7e1c5, 0x3d9ad4a8, 0x1a07aa7e, 0x41857e7d,
+    0xe46bd1a9, 0xa9d4af31, 0x0429d0f4, 0xa9509b46,
+    0x45234a51, 0x75ea57a2, 0x69d04040, 0xa5bf34b5,
+    0xdb36c2fc, 0xe35df881, 0xb028b265, 0x4d7b37f4,
+    0x0120d1d2, 0x7341960d, 0x8380deb4, 0x3212b36f,
+    0xd51b65c9, 0xb074c392, 0xeda5bdb4, 0x4040692f,
+    0x130e8242, 0x5008cb19, 0xe865ca00, 0x714334c8,
+    0x4760841c, 0xa6140473, 0x8e910a77, 0xda94d2ca,
+    0x274e959d, 0x804e9d85, 0xc94964a5, 0x9026c288,
+    0x6cdd5224, 0x8b2675c7, 0x96926eac, 0x638adde8,
+    0x0496b472, 0x27ff24ac, 0x373cdcbd, 0x4243294b,
+    0xbfe2e248, 0xf3affc95, 0xd9be85ab, 0x44682b6c,
+    0xf13ba2ca, 0xe6ce8edf, 0xef581b0b, 0x103b2642,
+    0xd6ecdb49, 0x11dd6060, 0x59b45783, 0x9031d66d,
+    0x3dcbc0dd, 0x6aecb007, 0x8ba15a74, 0x4b625ecc,
+    0xc1ebe94d, 0x00784f13, 0xbbc100ee, 0x91856e58,
+    0x36ed4885, 0x9f0e0569, 0x6852a34e, 0x1ca8faf5,
+    0x15faf569, 0xfa35d604, 0x52bf4e35, 0xa440d3a7,
+    0x426d1a11, 0x84a945a5, 0xa95f8986, 0x410301d5,
+    0x79cfd4a6, 0x928d3a52, 0xdbb76341, 0xb965a349,
+    0x3614c4af, 0x4fd89042, 0x252b97fa, 0x8b52437c,
+    0x72c3a21d, 0x57ac4a90, 0x43b0335b, 0xa81b1ae6,
+    0x1f2d6514, 0x84c3dab2, 0xd880f158, 0xb28120af,
+    0x1bc84685, 0xcd823c1b, 0x748b0e72, 0x2172a342,
+    0xc3ad048b, 0x918d0c21, 0x3d62c4f5, 0xf6ed5060,
+    0x6e2c306b, 0xdaaba184, 0x1debb62c, 0x03774196,
+    0x60a4fc21, 0x980d2b71, 0xb411c37e, 0x65038edd,
+    0xd8a0139d, 0x24f99036, 0x2461d906, 0x434ad08b,
+    0x76aca946, 0x12b6698d, 0x918518c5, 0x476eddb1,
+    0xc2953401, 0xddb473df, 0x30f6362d, 0x3d2447d8,
+    0x68a87029, 0xd8d0f7d6, 0x1b66d75a, 0x9793b094,
+    0xc2a4454b, 0x89032220, 0xb8304840, 0x13d9a511,
+    0xc8746143, 0x81c76d60, 0xf6a08d02, 0x05520932,
+    0x9521e82b, 0x71b6ac58, 0xee0c8298, 0x36e1f655,
+    0xa7434146, 0x9ad4a8d3, 0x07aa7e3d, 0x857e7d1a,
+    0x6bd1a941, 0xd4af31ec, 0x29d0f4a9, 0x509b4604,
+    0x616a51a9, 0xea57a221, 0xd0404075, 0x8e34b569,
+    0x21a62c51, 0xa34b59b2, 0xeb125e66, 0xb73201e4,
+    0xcb966d5d, 0x91e4d285, 0x40e8659a, 0x01954723,
+    0x42881004, 0x1c26f929, 0x8d757a83, 0xf82e5085,
+    0x5b104b25, 0x51361e42, 0x6d920907, 0x7d086602,
+    0xb823a52f, 0xcb566c5d, 0x10748e4d, 0xc7d0c142,
+    0x8d4573a3, 0x4c74c7d6, 0x966ec808, 0x6484591b,
+    0xd9482317, 0xb261a380, 0x67c60d59, 0xd6988942,
+    0x351a1ba4, 0x4628414e, 0x17a4d408, 0xe64c6953,
+    0xca40f055, 0x133e8685, 0x6a57cae3, 0x959d3a5e,
+    0xc1673452, 0xf122ef54, 0x5367dbb2, 0x1ec17dab,
+    0x9da99524, 0xb661cb46, 0x6522848e, 0x2cdab107,
+    0xd9882037, 0x0d6ee585, 0x34a0940d, 0x7c907ddb,
+    0x0221d036, 0x4b728b86, 0xd6646c08, 0x64ca3150,
+    0x20b0fb16, 0x347121ad, 0x5ec92b29, 0xf404c94a,
+    0xa9a18816, 0x49346851, 0x602ffd48, 0x1c190054,
+    0x915b976e, 0x543e560c, 0xcd904412, 0x37d7d7c0,
+    0x6cc7228d, 0xaeecdcb7, 0xd45bbb75, 0x79108de2,
+    0xe4504591, 0x1b7962d3, 0xb06dc7c8, 0x91c125dc,
+    0xb7eddba1, 0xc8dcb801, 0xc1114702, 0x61a3c9dc,
+    0xdeba8d48, 0x44131be3, 0x1b9f2284, 0x165fa521,
+    0x84702317, 0x9b36812d, 0xd7644c70, 0x14e84d3b,
+    0xdbf85354, 0x432663c3, 0x24651810, 0x5f1a0034,
+    0xf255be4a, 0xf6d691af, 0xddc8854d, 0x7825b72e,
+    0x238cb8b5, 0xb1a11aa9, 0x9754a06f, 0x53410680,
+    0x6704b7b2, 0xddb05160, 0xb762cb1c, 0x3183eddb,
+    0xc92b1207, 0x9a0d53ef, 0xe1a4402c, 0xbc19cfe6,
+    0x48cb76cc, 0xa1c1651c, 0xc3c2dcaa, 0x2d599061,
+    0xddb7a125, 0xc9dbf62d, 0x21a66cb8, 0x16808c05,
+    0xdb300332, 0xb47180ac, 0x37108407, 0x4e1dd923,
+    0xb9804d58, 0x61ef463a, 0x29c45ab6, 0x4c093973,
+    0x3b948245, 0x6247e99a, 0xae091331, 0xb272e176,
+    0xabf08691, 0x03d39a10, 0x0d2143e5, 0xb161c5b2,
+    0x634d8691, 0xd7efb204, 0xad3bbb7e, 0xeb36b6b8,
+    0x624f1c59, 0x80501342, 0xeb368085, 0x70dfb67c,
+    0xdeda2d3d, 0x8500193b, 0x35c1ba4f, 0x26759811,
+    0x84b59b36, 0x64a333aa, 0x45ee051a, 0x81a47711,
+    0xad4b3760, 0x9b36d2c9, 0xc3829ca1, 0x840ebc65,
+    0x88d93290, 0x12c76c2c, 0xde9a8d2b, 0xc2231b67,
+    0x23394246, 0x90909c97, 0xad06f521, 0x41480c7c,
+    0x6a8ea313, 0x0b699546, 0x632c4da8, 0x068d6110,
+    0xd1214ee4, 0xe1ee2ec8, 0x48e0092b, 0x0134f424,
+    0x76f72ddb, 0xc38a8948, 0x264d5f6e, 0x50a74599,
+    0x9053b469, 0x768088aa, 0xc4b6adeb, 0x11712224,
+    0xb34b8e0d, 0xd25659b7, 0x89fd4a44, 0x5edf6b96,
+    0xbed7f7fa, 0xd9a01312, 0xb473a348, 0x70e28ede,
+    0x0dd1082b, 0xf83a0d32, 0xe3002571, 0x3e9891b4,
+    0x002ab097, 0xb424820c, 0xaeaca056, 0xfc04f975,
+    0x4dbb5519, 0x03005374, 0x8ed0069d, 0xddb04457,
+    0x9520c703, 0xd93526c8, 0xf52db404, 0x40df62d5,
+    0x5ab970a5, 0xb810d66e, 0x4eb197ce, 0x566cdbba,
+    0x48ac8057, 0x1e0d8bce, 0xa06e1409, 0x26bbafb1,
+    0x0529158c, 0x0d6dc3ba, 0x96ac9008, 0xd9c5c05b,
+    0x8eba2089, 0xaf32670a, 0x3d540682, 0xfd0e3231,
+    0x1fefe32c, 0x3d88027b, 0x8fdeb473, 0xadb766a5,
+    0x10b8ec06, 0x41468960, 0xc42f9632, 0xadeb361a,
+    0xba70d9b2, 0xcad2c601, 0xe4860569, 0x9e4d5b6e,
+    0x4713c5ea, 0x86a0289a, 0x4e5ea15a, 0x952b3ce2,
+    0xbb20f386, 0x82966eda, 0xc2da3c6a, 0x140c16b4,
+    0x1768c72e, 0x966c3089, 0x8f84a51b, 0xcc0d8b54,
+    0xb1112178, 0xe13f450f, 0x4990b931, 0xb219f323,
+    0x3522c944, 0x11912712, 0x79cb36f0, 0x6dc548d4,
+    0x41c63db1, 0x4c0b186d, 0xb26ec34a, 0x03a35591,
+    0x0681b6e4, 0x25aa43d6, 0xdb36c894, 0x277ec985,
+    0x350b5f51, 0xfb95481e, 0xb638bc75, 0xe58bb892,
+    0x7444e649, 0xe4ab4689, 0x8c1437c4, 0x7d3a5486,
+    0xa3498d3a, 0x71a0ead7, 0x54e8d7a7, 0xbf169d1a,
+    0xead7a946, 0x1468fa54, 0xa84d2382, 0x30b5a854,
+    0xf52bd190, 0x6820a03a, 0x7e9ada34, 0x7dfb162a,
+    0xc12316b1, 0x6e0c982a, 0x859a3357, 0xbd4c794e,
+    0x617c8518, 0x73095762, 0xb95c9ecb, 0x271336f1,
+    0x1359b765, 0x03f96f82, 0x61235848, 0xa46a9bb6,
+    0xd46012d4, 0x196da8c2, 0x016e08a9, 0xf4151f42,
+    0x1c312004, 0x17dc8294, 0x2cdc4817, 0x822c3b36,
+    0x781b5bea, 0x19ea4a50, 0xecd77930, 0x969d1b56,
+    0x0d3866bf, 0x58208cc8, 0x40215ab4, 0x00000000,
+    0x5a6d6f52, 0x00000408, 0x0000006c, 0x000021bb,
+    0x00002c04, 0x00001c7d,
+};
+
+static const int bench_fs_text_z_size = sizeof (bench_fs_text_z);
\ No newline at end of file
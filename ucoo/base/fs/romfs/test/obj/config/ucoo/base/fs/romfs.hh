@@ -0,0 +1,5 @@
+#ifndef obj_config_ucoo_base_fs_romfs_hh
+#define obj_config_ucoo_base_fs_romfs_hh
+// Generated from configuration.
+#define CONFIG_UCOO_BASE_FS_ROMFS_COMPRESSED_STREAMS (2)
+#endif
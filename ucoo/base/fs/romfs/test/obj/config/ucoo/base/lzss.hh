@@ -0,0 +1,6 @@
+#ifndef obj_config_ucoo_base_lzss_hh
+#define obj_config_ucoo_base_lzss_hh
+// Generated from configuration.
+#define CONFIG_UCOO_BASE_LZSS_WINDOW_BITS (8)
+#define CONFIG_UCOO_BASE_LZSS_LOOKAHEAD_BITS (4)
+#endif
@@ -0,0 +1,14 @@
+/* Auto-generated ROM FS from:
+ *  - hello.txt
+ */
+
+static const uint32_t test_fs[] = {
+    0x466d6f52, 0x00000001, 0x00000000, 0x00000009,
+    0x00000027, 0x6c6c6568, 0x78742e6f, 0x6d59a474,
+    0x827ccb96, 0x5bb96fef, 0x5418922c, 0xe00e4082,
+    0x25108087, 0x480a4fe1, 0x0000805b, 0x5a6d6f52,
+    0x00000408, 0x0000006c, 0x486d6f52, 0x00000002,
+    0x00010000,
+};
+
+static const int test_fs_size = sizeof (test_fs);
\ No newline at end of file
@@ -28,6 +28,24 @@
 #include "test_fs.h"
 #include <cstdio>
 
+/// Print listed files with their size.
+struct Lister
+{
+    ucoo::FileSystem &fs;
+    bool print (const char *name, int name_size)
+    {
+        char filename[32];
+        ucoo::FileSystem::Stat stat;
+        ucoo::FileSystem::Error error;
+        snprintf (filename, sizeof (filename), "%.*s", name_size, name);
+        if (fs.stat (filename, stat, error))
+            printf ("%s: %d bytes\n", filename, stat.size);
+        else
+            printf ("%s: stat error\n", filename);
+        return true;
+    }
+};
+
 int
 main (int argc, const char **argv)
 {
@@ -52,6 +70,12 @@ main (int argc, const char **argv)
                 fwrite (buf, r, 1, stdout);
         }
         printf ("\ndone\n");
+        char buf[5];
+        if (s->seek (0) == 0 && s->read (buf, sizeof (buf)) == sizeof (buf))
+            printf ("rewind: %.*s\n", static_cast<int> (sizeof (buf)), buf);
+        else
+            printf ("seek error\n");
+        printf ("size: %d, tell: %d\n", s->size (), s->tell ());
         romfs.close (s);
     }
     else
@@ -72,4 +96,7 @@ main (int argc, const char **argv)
     }
     else
         printf ("fopen error\n");
+    Lister lister { romfs };
+    int listed = romfs.list ("", { &lister, &Lister::print });
+    printf ("%d files\n", listed);
 }
@@ -0,0 +1,200 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "lzss.hh"
+
+#include <algorithm>
+
+namespace ucoo {
+
+LzssEncoder::LzssEncoder ()
+    : data_ {}, start_ (window_size), end_ (window_size), bits_ (0),
+      bits_nb_ (0)
+{
+}
+
+int
+LzssEncoder::encode (const char *buf, int count)
+{
+    int used = 0;
+    while (used < count)
+    {
+        if (end_ == 2 * window_size)
+        {
+            if (!encode_pending ())
+                break;
+            // Keep a window of history.
+            std::copy (data_ + end_ - window_size, data_ + end_, data_);
+            start_ = end_ = window_size;
+        }
+        int n = std::min (count - used, 2 * window_size - end_);
+        std::copy (buf + used, buf + used + n, data_ + end_);
+        end_ += n;
+        used += n;
+    }
+    return used;
+}
+
+bool
+LzssEncoder::flush ()
+{
+    if (!encode_pending ())
+        return false;
+    if (out_.room () < 4)
+        return false;
+    put (0, 1 + window_bits + lookahead_bits);
+    if (bits_nb_)
+        put (0, 8 - bits_nb_);
+    return true;
+}
+
+bool
+LzssEncoder::encode_pending ()
+{
+    // Worst case is only literals.
+    out_.rewind ();
+    if (out_.room () < ((end_ - start_) * 9 + bits_nb_ + 7) / 8)
+        return false;
+    int p = start_;
+    while (p < end_)
+    {
+        // Search longest match, nearest first.
+        int match_length = 0, match_distance = 0;
+        int length_max = std::min (lookahead_size, end_ - p);
+        int q_min = p - window_size;
+        for (int q = p - 1; q >= q_min; q--)
+        {
+            if (data_[q] != data_[p])
+                continue;
+            int l = 1;
+            while (l < length_max && data_[q + l] == data_[p + l])
+                l++;
+            if (l > match_length)
+            {
+                match_length = l;
+                match_distance = p - q;
+                if (l == length_max)
+                    break;
+            }
+        }
+        if (match_length >= match_min)
+        {
+            put (0, 1);
+            put (match_distance - 1, window_bits);
+            put (match_length - 1, lookahead_bits);
+            p += match_length;
+        }
+        else
+        {
+            put (0x100 | static_cast<uint8_t> (data_[p]), 9);
+            p++;
+        }
+    }
+    start_ = end_;
+    return true;
+}
+
+void
+LzssEncoder::put (uint32_t value, int bits)
+{
+    bits_ = bits_ << bits | value;
+    bits_nb_ += bits;
+    while (bits_nb_ >= 8)
+    {
+        bits_nb_ -= 8;
+        *out_.write (1) = bits_ >> bits_nb_;
+    }
+}
+
+LzssDecoder::LzssDecoder ()
+    : step_ (TAG), bits_ (0), bits_nb_ (0), distance_ (0), length_ (0),
+      pos_ (0), window_ {}
+{
+}
+
+int
+LzssDecoder::decode (const char *in_buf, int in_count, int &in_used,
+                     char *out_buf, int out_count)
+{
+    static const int bits_needed[] = { 1, 8, window_bits, lookahead_bits };
+    int in = 0, out = 0;
+    while (out < out_count)
+    {
+        if (step_ == COPY)
+        {
+            char c = window_[(pos_ - distance_ - 1) & (window_size - 1)];
+            window_[pos_] = c;
+            pos_ = (pos_ + 1) & (window_size - 1);
+            out_buf[out++] = c;
+            if (--length_ == 0)
+                step_ = TAG;
+            continue;
+        }
+        // Get needed bits.
+        int need = bits_needed[step_];
+        while (bits_nb_ < need && in < in_count)
+        {
+            bits_ = bits_ << 8 | static_cast<uint8_t> (in_buf[in++]);
+            bits_nb_ += 8;
+        }
+        if (bits_nb_ < need)
+            break;
+        bits_nb_ -= need;
+        int v = (bits_ >> bits_nb_) & ((1 << need) - 1);
+        switch (step_)
+        {
+        case TAG:
+            step_ = v ? LITERAL : DISTANCE;
+            break;
+        case LITERAL:
+            window_[pos_] = v;
+            pos_ = (pos_ + 1) & (window_size - 1);
+            out_buf[out++] = v;
+            step_ = TAG;
+            break;
+        case DISTANCE:
+            distance_ = v;
+            step_ = LENGTH;
+            break;
+        case LENGTH:
+            if (distance_ == 0 && v == 0)
+            {
+                // Flush marker, skip padding.
+                bits_nb_ -= bits_nb_ % 8;
+                step_ = TAG;
+            }
+            else
+            {
+                length_ = v + 1;
+                step_ = COPY;
+            }
+            break;
+        default:
+            assert_unreachable ();
+        }
+    }
+    in_used = in;
+    return out;
+}
+
+} // namespace ucoo
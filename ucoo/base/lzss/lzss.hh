@@ -0,0 +1,145 @@
+#ifndef ucoo_base_lzss_lzss_hh
+#define ucoo_base_lzss_lzss_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/common.hh"
+#include "ucoo/utils/buffer.hh"
+
+#include "config/ucoo/base/lzss.hh"
+
+namespace ucoo {
+
+/// LZSS parameters, shared by encoder and decoder.
+///
+/// Compressed data is a bit stream, most significant bit first, of:
+///  - literal: 1, 8 bits byte.
+///  - back reference: 0, window_bits of (distance - 1), lookahead_bits of
+///    (length - 1).
+///  - flush marker: a back reference with zero distance and length fields,
+///    followed by zero padding up to the next byte boundary.
+///
+/// History is initialised with zeros before the first byte.
+///
+/// This is the same layout as heatshrink, except for the flush marker which
+/// is never produced by a heatshrink encoder as a one byte back reference
+/// is never worth it.  See lzss.py for a host implementation.
+struct Lzss
+{
+    /// Window size, maximum back reference distance.
+    static const int window_bits = CONFIG_UCOO_BASE_LZSS_WINDOW_BITS;
+    static const int window_size = 1 << window_bits;
+    /// Lookahead size, maximum back reference length.
+    static const int lookahead_bits = CONFIG_UCOO_BASE_LZSS_LOOKAHEAD_BITS;
+    static const int lookahead_size = 1 << lookahead_bits;
+    /// Minimum length for a back reference to be shorter than literals.
+    static const int match_min = (1 + window_bits + lookahead_bits) / 9 + 1;
+    static_assert (match_min >= 2, "flush marker must not be a valid match");
+};
+
+/// Streaming LZSS encoder, with bounded memory.
+class LzssEncoder : public Lzss
+{
+  public:
+    /// Constructor.
+    LzssEncoder ();
+    /// Take up to COUNT bytes from BUF to be encoded.  Return the number of
+    /// consumed bytes, which can be less than COUNT if output is not read.
+    int encode (const char *buf, int count);
+    /// Encode all pending data and add a flush marker so that decoder can
+    /// decode everything up to here.  Return false if there is not enough
+    /// room in output, read output and try again.
+    bool flush ();
+    /// Return pointer to encoded data ready to be read.
+    const char *output () const { return out_.read (); }
+    /// Return the number of encoded bytes ready to be read.
+    int output_size () const { return out_.size (); }
+    /// Drop read encoded data.
+    void output_drop (int n) { out_.drop (n); }
+  private:
+    /// Encode data between start_ and end_, return false if there is not
+    /// enough room in output.
+    bool encode_pending ();
+    /// Add bits to output.
+    void put (uint32_t value, int bits);
+  private:
+    /// History window followed by data to be encoded.
+    char data_[2 * window_size];
+    /// Index of first data to be encoded.
+    int start_;
+    /// Index after last data to be encoded.
+    int end_;
+    /// Bits not output yet.
+    uint32_t bits_;
+    /// Number of bits not output yet.
+    int bits_nb_;
+    /// Output bytes, large enough for the worst case of a block of literals
+    /// and a flush marker.
+    Buffer<char, window_size * 9 / 8 + 4> out_;
+};
+
+/// Streaming LZSS decoder, with bounded memory.
+class LzssDecoder : public Lzss
+{
+  public:
+    /// Constructor.
+    LzssDecoder ();
+    /// Decode up to IN_COUNT bytes from IN_BUF, to up to OUT_COUNT bytes in
+    /// OUT_BUF.  Stop when input is exhausted or output is full.  Return the
+    /// number of decoded bytes, store the number of consumed bytes in
+    /// IN_USED.
+    int decode (const char *in_buf, int in_count, int &in_used,
+                char *out_buf, int out_count);
+  private:
+    /// Decoding step.
+    enum Step
+    {
+        /// Expecting a tag bit.
+        TAG,
+        /// Expecting literal bits.
+        LITERAL,
+        /// Expecting back reference distance bits.
+        DISTANCE,
+        /// Expecting back reference length bits.
+        LENGTH,
+        /// Copying back reference bytes.
+        COPY,
+    };
+    Step step_;
+    /// Bits not decoded yet.
+    uint32_t bits_;
+    /// Number of bits not decoded yet.
+    int bits_nb_;
+    /// Back reference distance minus one.
+    int distance_;
+    /// Remaining bytes to copy.
+    int length_;
+    /// Index of next byte in window.
+    int pos_;
+    /// History of decoded bytes.
+    char window_[window_size];
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_lzss_lzss_hh
@@ -0,0 +1,136 @@
+#!/usr/bin/python
+#
+"""Encode or decode LZSS compressed data, see lzss.hh for format."""
+#
+# Copyright (C) 2016 Nicolas Schodet
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+#
+import argparse
+import sys
+
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+
+class BitWriter:
+    """Write a bit stream, most significant bit first."""
+
+    def __init__(self):
+        self.out = bytearray()
+        self.bits = 0
+        self.bits_nb = 0
+
+    def put(self, value, bits):
+        self.bits = (self.bits << bits) | value
+        self.bits_nb += bits
+        while self.bits_nb >= 8:
+            self.bits_nb -= 8
+            self.out.append((self.bits >> self.bits_nb) & 0xff)
+        self.bits &= (1 << self.bits_nb) - 1
+
+    def align(self):
+        if self.bits_nb:
+            self.put(0, 8 - self.bits_nb)
+
+def encode(data, window_bits=WINDOW_BITS, lookahead_bits=LOOKAHEAD_BITS):
+    """Encode data, return compressed data.  A flush marker is added at the
+    end so that the output can be decoded up to the last byte."""
+    window_size = 1 << window_bits
+    lookahead_size = 1 << lookahead_bits
+    match_min = (1 + window_bits + lookahead_bits) // 9 + 1
+    # Initial history is made of zeros.
+    data = bytearray(window_size) + bytearray(data)
+    w = BitWriter()
+    p = window_size
+    while p < len(data):
+        match_length, match_distance = 0, 0
+        length_max = min(lookahead_size, len(data) - p)
+        for q in range(p - 1, p - window_size - 1, -1):
+            if data[q] != data[p]:
+                continue
+            l = 1
+            while l < length_max and data[q + l] == data[p + l]:
+                l += 1
+            if l > match_length:
+                match_length, match_distance = l, p - q
+                if l == length_max:
+                    break
+        if match_length >= match_min:
+            w.put(0, 1)
+            w.put(match_distance - 1, window_bits)
+            w.put(match_length - 1, lookahead_bits)
+            p += match_length
+        else:
+            w.put(0x100 | data[p], 9)
+            p += 1
+    w.put(0, 1 + window_bits + lookahead_bits)
+    w.align()
+    return bytes(w.out)
+
+def decode(data, window_bits=WINDOW_BITS, lookahead_bits=LOOKAHEAD_BITS):
+    """Decode data, return decompressed data."""
+    window_size = 1 << window_bits
+    out = bytearray(window_size)
+    data = bytearray(data)
+    state = dict(bits=0, bits_nb=0, pos=0)
+    def get(n):
+        while state['bits_nb'] < n:
+            if state['pos'] >= len(data):
+                raise EOFError
+            state['bits'] = (state['bits'] << 8) | data[state['pos']]
+            state['bits_nb'] += 8
+            state['pos'] += 1
+        state['bits_nb'] -= n
+        v = (state['bits'] >> state['bits_nb']) & ((1 << n) - 1)
+        state['bits'] &= (1 << state['bits_nb']) - 1
+        return v
+    try:
+        while True:
+            if get(1):
+                out.append(get(8))
+            else:
+                distance = get(window_bits)
+                length = get(lookahead_bits)
+                if distance == 0 and length == 0:
+                    # Flush marker, skip padding.
+                    state['bits_nb'] -= state['bits_nb'] % 8
+                    state['bits'] &= (1 << state['bits_nb']) - 1
+                else:
+                    for i in range(length + 1):
+                        out.append(out[-distance - 1])
+    except EOFError:
+        pass
+    return bytes(out[window_size:])
+
+if __name__ == '__main__':
+    p = argparse.ArgumentParser(description=__doc__)
+    p.add_argument('-d', '--decode', action='store_true',
+            help='decode instead of encode')
+    p.add_argument('-w', '--window-bits', type=int, default=WINDOW_BITS,
+            metavar='BITS', help='window size, as a power of two')
+    p.add_argument('-l', '--lookahead-bits', type=int, default=LOOKAHEAD_BITS,
+            metavar='BITS', help='maximum match length, as a power of two')
+    p.add_argument('input', nargs='?', type=argparse.FileType('rb'),
+            default=getattr(sys.stdin, 'buffer', sys.stdin),
+            help='input file, default to standard input')
+    options = p.parse_args()
+    f = decode if options.decode else encode
+    out = f(options.input.read(), options.window_bits,
+            options.lookahead_bits)
+    getattr(sys.stdout, 'buffer', sys.stdout).write(out)
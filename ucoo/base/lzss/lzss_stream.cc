@@ -0,0 +1,111 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "lzss_stream.hh"
+
+namespace ucoo {
+
+LzssStream::LzssStream (Stream &stream, bool flush_on_write)
+    : stream_ (stream), flush_on_write_ (flush_on_write)
+{
+}
+
+void
+LzssStream::block (bool block)
+{
+    Stream::block (block);
+    stream_.block (block);
+}
+
+int
+LzssStream::read (char *buf, int count)
+{
+    while (1)
+    {
+        // Decode pending compressed data.
+        if (!in_.empty ())
+        {
+            int used;
+            int r = decoder_.decode (in_.read (), in_.size (), used,
+                                     buf, count);
+            in_.drop (used);
+            if (r)
+                return r;
+        }
+        // Need more compressed data, will only block if nothing was
+        // decoded.
+        in_.rewind ();
+        int r = stream_.read (in_.write (), in_.room ());
+        if (r <= 0)
+            return r;
+        in_.written (r);
+    }
+}
+
+int
+LzssStream::write (const char *buf, int count)
+{
+    int written = 0;
+    while (written < count)
+    {
+        int r = encoder_.encode (buf + written, count - written);
+        written += r;
+        if (!output () && !r)
+            break;
+    }
+    if (flush_on_write_)
+        flush ();
+    return written;
+}
+
+int
+LzssStream::poll ()
+{
+    return in_.size () + stream_.poll ();
+}
+
+bool
+LzssStream::flush ()
+{
+    while (!encoder_.flush ())
+    {
+        if (!output ())
+            return false;
+    }
+    return output () && stream_.flush ();
+}
+
+bool
+LzssStream::output ()
+{
+    while (encoder_.output_size ())
+    {
+        int r = stream_.write (encoder_.output (), encoder_.output_size ());
+        if (r <= 0)
+            return false;
+        encoder_.output_drop (r);
+    }
+    return true;
+}
+
+} // namespace ucoo
@@ -0,0 +1,72 @@
+#ifndef ucoo_base_lzss_lzss_stream_hh
+#define ucoo_base_lzss_lzss_stream_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/lzss/lzss.hh"
+#include "ucoo/intf/stream.hh"
+
+namespace ucoo {
+
+/// Stream decorator, compress data written to the underlying stream and
+/// decompress data read from it.
+class LzssStream : public Stream
+{
+  public:
+    /// Constructor, if FLUSH_ON_WRITE is true, data is flushed after each
+    /// write, else it is only flushed on explicit flush call or when
+    /// internal buffer is full.
+    LzssStream (Stream &stream, bool flush_on_write = true);
+    /// See Stream::block.
+    void block (bool block = true) override;
+    /// See Stream::read.
+    int read (char *buf, int count) override;
+    /// See Stream::write.
+    int write (const char *buf, int count) override;
+    /// See Stream::poll.  Return the number of compressed bytes available,
+    /// which is not the number of decompressed bytes, but is not zero if
+    /// some data is available.
+    int poll () override;
+    /// See Stream::flush.  Send all written data to underlying stream and
+    /// flush it.
+    bool flush () override;
+  private:
+    /// Write encoder output to underlying stream, return false if not
+    /// everything was written.
+    bool output ();
+  private:
+    /// Underlying stream.
+    Stream &stream_;
+    /// Whether to flush after each write.
+    bool flush_on_write_;
+    /// Encoder for written data.
+    LzssEncoder encoder_;
+    /// Decoder for read data.
+    LzssDecoder decoder_;
+    /// Compressed data read but not decoded yet.
+    Buffer<char, 32> in_;
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_lzss_lzss_stream_hh
@@ -0,0 +1,126 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/lzss/lzss_stream.hh"
+#include "ucoo/base/proto/proto.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/stream_test.hh"
+
+#include <algorithm>
+#include <cstring>
+
+/// Nothing is received in this benchmark.
+class NullHandler : public ucoo::Proto::Handler
+{
+  public:
+    void proto_handle (ucoo::Proto &proto, char cmd, const uint8_t *args,
+                       int size) override { }
+};
+
+/// Generate telemetry like traffic.
+static void
+generate (ucoo::TestMemStream &raw)
+{
+    NullHandler handler;
+    ucoo::Proto proto (handler, raw);
+    int x = 1000, y = 1500, a = 0;
+    for (int i = 0; raw.room () > 64; i++)
+    {
+        x += i % 7 - 3;
+        y += i % 5 - 2;
+        a = (a + 13) & 0xffff;
+        proto.send ('P', "hhH", x, y, a);
+        if (i % 4 == 0)
+            proto.send ('S', "BB", i & 0xf, 0);
+        if (i % 16 == 0)
+            proto.send ('T', "L", i * 1000);
+    }
+}
+
+/// Compress raw traffic, one write per frame.
+static void
+bench_encode (ucoo::BenchSuite &bsuite, const char *name,
+              ucoo::TestMemStream &raw, ucoo::TestMemStream &compressed,
+              bool flush_on_write)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::LzssStream s (compressed, flush_on_write);
+    const char *p = raw.data (), *end = raw.data () + raw.written ();
+    while (p != end)
+    {
+        const char *frame_end = std::find (p, end, '\n') + 1;
+        bench.start ();
+        s.write (p, frame_end - p);
+        bench.stop (frame_end - p);
+        p = frame_end;
+    }
+    s.flush ();
+    int ratio_milli = static_cast<int64_t> (compressed.written ()) * 1000
+        / raw.written ();
+    bench.info ("raw=%d compressed=%d ratio=%d.%03d", raw.written (),
+                compressed.written (), ratio_milli / 1000,
+                ratio_milli % 1000);
+}
+
+/// Decompress traffic.
+static void
+bench_decode (ucoo::BenchSuite &bsuite, const char *name,
+              ucoo::TestMemStream &raw, ucoo::TestMemStream &compressed)
+{
+    ucoo::Bench bench (bsuite, name);
+    ucoo::LzssStream s (compressed);
+    char buf[64];
+    const char *p = raw.data ();
+    bool ok = true;
+    while (1)
+    {
+        bench.start ();
+        int r = s.read (buf, sizeof (buf));
+        bench.stop (std::max (r, 0));
+        if (r <= 0)
+            break;
+        ok = ok && std::equal (buf, buf + r, p);
+        p += r;
+    }
+    if (!ok || p != raw.data () + raw.written ())
+        bench.info ("decode error");
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("lzss");
+    static ucoo::TestMemStream raw, compressed;
+    generate (raw);
+    bsuite.group ("proto");
+    bench_encode (bsuite, "encode:flush", raw, compressed, true);
+    bench_decode (bsuite, "decode:flush", raw, compressed);
+    compressed.clear ();
+    bench_encode (bsuite, "encode:noflush", raw, compressed, false);
+    bench_decode (bsuite, "decode:noflush", raw, compressed);
+    return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef obj_config_ucoo_base_proto_hh
+#define obj_config_ucoo_base_proto_hh
+// Generated from configuration.
+#define CONFIG_UCOO_BASE_PROTO_STATS_LATENCY_BINS (7)
+#define CONFIG_UCOO_BASE_PROTO_STATS_COMMAND ('Q')
+#define CONFIG_UCOO_BASE_PROTO_STATS (false)
+#define CONFIG_UCOO_BASE_PROTO_ACCEPT_BUFFER_SIZE (32)
+#define CONFIG_UCOO_BASE_PROTO_BATCH_BUFFER_SIZE (128)
+#define CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE (16)
+#endif
@@ -0,0 +1,127 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/lzss/lzss_stream.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/stream_test.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/// Compress then decompress, check result, return compressed size or -1.
+static int
+round_trip (const char *data, int size, int chunk, bool flush_on_write)
+{
+    ucoo::TestMemStream mem;
+    int written = 0;
+    {
+        ucoo::LzssStream s (mem, flush_on_write);
+        while (written < size)
+        {
+            int r = s.write (data + written, std::min (chunk, size - written));
+            if (r <= 0)
+                return -1;
+            written += r;
+        }
+        if (!s.flush ())
+            return -1;
+    }
+    int compressed = mem.written ();
+    static char out[8192];
+    int out_size = 0;
+    ucoo::LzssStream s (mem);
+    int r;
+    while ((r = s.read (out + out_size, std::min<int> (chunk, sizeof (out)
+                                                        - out_size))) > 0)
+        out_size += r;
+    if (out_size != size || std::memcmp (data, out, size) != 0)
+        return -1;
+    return compressed;
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("lzss");
+    static char text[4096];
+    for (int i = 0, n = 0; i < static_cast<int> (sizeof (text)); n++)
+    {
+        int r = snprintf (text + i, sizeof (text) - i, "!p%04x%04x\n",
+                          n & 0xfff, (n * 3) & 0xfff);
+        i += std::min<int> (r, sizeof (text) - i);
+    }
+    static char noise[4096];
+    for (char &c : noise)
+        c = std::rand ();
+    {
+        ucoo::Test test (tsuite, "text round trip");
+        for (int chunk : { 1, 7, 64, 4096 })
+        {
+            int r = round_trip (text, sizeof (text), chunk, false);
+            test_fail_break_unless (test, r > 0);
+            test_fail_break_unless (test, r < static_cast<int> (sizeof (text))
+                                    * 3 / 4);
+        }
+    }
+    {
+        ucoo::Test test (tsuite, "text round trip with flushes");
+        for (int chunk : { 1, 11, 4096 })
+        {
+            int r = round_trip (text, sizeof (text), chunk, true);
+            test_fail_break_unless (test, r > 0);
+        }
+    }
+    {
+        ucoo::Test test (tsuite, "noise round trip");
+        for (int chunk : { 1, 100, 4096 })
+        {
+            bool flush = chunk == 100;
+            int r = round_trip (noise, sizeof (noise), chunk, flush);
+            test_fail_break_unless (test, r > 0);
+            // Literals are 9 bits, flush markers at most 4 bytes.
+            int flushes = flush ? sizeof (noise) / chunk + 1 : 1;
+            test_fail_break_unless (test, r <= static_cast<int> (
+                    sizeof (noise)) * 9 / 8 + flushes * 4);
+        }
+    }
+    {
+        ucoo::Test test (tsuite, "decode host encoded");
+        // Output of: echo -n 'hello hello hello!' | lzss.py
+        static const uint8_t encoded[] = {
+            0xb4, 0x59, 0x6d, 0x96, 0xcb, 0x7c, 0x80, 0x0b, 0x52, 0x10,
+            0x00, 0x00 };
+        ucoo::TestMemStream mem;
+        mem.write (reinterpret_cast<const char *> (encoded),
+                   sizeof (encoded));
+        ucoo::LzssStream s (mem);
+        char out[32];
+        int r = s.read (out, sizeof (out));
+        if (r != 18 || std::memcmp (out, "hello hello hello!", 18) != 0)
+            test.fail ();
+    }
+    return tsuite.report () ? 0 : 1;
+}
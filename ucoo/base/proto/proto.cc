@@ -22,95 +22,252 @@
 //
 // }}}
 #include "proto.hh"
+#include "ucoo/utils/crc.hh"
 
+#include <algorithm>
 #include <cctype>
+#include <cstring>
 
 namespace ucoo {
 
 Proto::Proto (Handler &handler, Stream &stream)
-    : handler_ (handler), stream_ (stream), step_ (IDLE)
+    : handler_ (handler), stream_ (stream), mode_ (Mode::TEXT), step_ (IDLE),
+      binary_size_ (0), cobs_code_ (0), cobs_left_ (0), batch_ (nullptr)
 {
+    reset_batch_stats ();
 }
 
 void
 Proto::accept ()
 {
-    int c;
-    while ((c = stream_.getc ()) != -1)
+    char buf[CONFIG_UCOO_BASE_PROTO_ACCEPT_BUFFER_SIZE];
+    int r;
+    while ((r = stream_.read (buf, sizeof (buf))) > 0)
+        accept_buf (buf, r);
+}
+
+void
+Proto::accept_buf (const char *buf, int count)
+{
+    const char *p = buf, *end = buf + count;
+    while (p != end)
     {
-        if (c == '!')
-            step_ = BANG;
-        else
+        if (mode_ == Mode::BINARY)
         {
-            switch (step_)
-            {
-            case IDLE:
-                // Nothing received yet.
-                break;
-            case BANG:
-                // Bang received yet.
-                if (std::isalpha (c))
-                {
-                    cmd_ = c;
-                    size_ = 0;
-                    step_ = COMMAND;
-                }
-                else
-                {
-                    handler_.proto_handle (*this, '?', 0, 0);
-                    step_ = IDLE;
-                }
+            accept_binary (*p++);
+            continue;
+        }
+        if (step_ == IDLE)
+        {
+            // Fast path, skip garbage up to next frame.
+            p = static_cast<const char *> (std::memchr (p, '!', end - p));
+            if (!p)
                 break;
-            case COMMAND:
-                // Command received yet.
-                if (c == '\r' || c == '\n')
-                {
-                    handler_.proto_handle (*this, cmd_, args_, size_);
-                    step_ = IDLE;
-                }
-                else if (c == '\'')
-                    step_ = ARG_CHAR;
-                else if (c == '"')
-                    step_ = ARG_STRING;
-                else
-                {
-                    step_ = ARG_DIGIT;
-                    accept_digit (c);
-                }
+        }
+        else if (step_ == COMMAND)
+        {
+            // Fast path, decode arguments.
+            p = accept_hex (p, end);
+            if (p == end)
                 break;
-            case ARG_DIGIT:
+        }
+        accept_step (static_cast<unsigned char> (*p++));
+    }
+}
+
+void
+Proto::set_mode (Mode mode)
+{
+    mode_ = mode;
+    step_ = IDLE;
+    binary_size_ = 0;
+    cobs_code_ = 0;
+    cobs_left_ = 0;
+}
+
+/// Convert an hex digit, return -1 if not an hex digit.
+static inline int
+hex_value (uint8_t c)
+{
+    if (static_cast<uint8_t> (c - '0') < 10)
+        return c - '0';
+    c |= 0x20;
+    if (static_cast<uint8_t> (c - 'a') < 6)
+        return c - 'a' + 10;
+    return -1;
+}
+
+const char *
+Proto::accept_hex (const char *p, const char *end)
+{
+    int n = std::min<int> ((end - p) / 2,
+                           CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE - size_);
+    uint8_t *args = args_ + size_;
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        int h = hex_value (p[2 * i]);
+        int l = hex_value (p[2 * i + 1]);
+        if ((h | l) < 0)
+            break;
+        args[i] = h << 4 | l;
+    }
+    size_ += i;
+    return p + 2 * i;
+}
+
+void
+Proto::accept_step (int c)
+{
+    if (c == '!')
+    {
+        stats_.frame_start ();
+        step_ = BANG;
+    }
+    else
+    {
+        switch (step_)
+        {
+        case IDLE:
+            // Nothing received yet.
+            break;
+        case BANG:
+            // Bang received yet.
+            if (std::isalpha (c))
+            {
+                cmd_ = c;
+                size_ = 0;
                 step_ = COMMAND;
+            }
+            else
+            {
+                handle_error ();
+                step_ = IDLE;
+            }
+            break;
+        case COMMAND:
+            // Command received yet.
+            if (c == '\r' || c == '\n')
+            {
+                handle_frame (args_, size_);
+                step_ = IDLE;
+            }
+            else if (c == '\'')
+                step_ = ARG_CHAR;
+            else if (c == '"')
+                step_ = ARG_STRING;
+            else
+            {
+                step_ = ARG_DIGIT;
                 accept_digit (c);
-                break;
-            case ARG_CHAR:
-                step_ = COMMAND;
+            }
+            break;
+        case ARG_DIGIT:
+            step_ = COMMAND;
+            accept_digit (c);
+            break;
+        case ARG_CHAR:
+            step_ = COMMAND;
+            accept_char (c);
+            break;
+        case ARG_STRING:
+            if (c == '\r' || c == '\n')
+            {
+                handle_frame (args_, size_);
+                step_ = IDLE;
+            }
+            else
+            {
                 accept_char (c);
-                break;
-            case ARG_STRING:
-                if (c == '\r' || c == '\n')
-                {
-                    handler_.proto_handle (*this, cmd_, args_, size_);
-                    step_ = IDLE;
-                }
-                else
-                {
-                    accept_char (c);
-                }
-                break;
             }
+            break;
         }
     }
 }
 
+void
+Proto::accept_binary (uint8_t b)
+{
+    if (b == 0)
+    {
+        // End of frame, ignore empty frames.
+        if (cobs_code_)
+        {
+            int size = binary_size_ - 2;
+            bool ok = binary_size_ >= 2 && cobs_left_ == 0
+                && std::isalpha (cmd_);
+            if (ok)
+            {
+                uint8_t crc = crc8_update (0, cmd_);
+                for (int i = 0; i < size; i++)
+                    crc = crc8_update (crc, args_[i]);
+                ok = crc == args_[size];
+            }
+            if (ok)
+                handle_frame (args_, size);
+            else
+                handle_error (binary_size_ < 0);
+        }
+        binary_size_ = 0;
+        cobs_code_ = 0;
+        cobs_left_ = 0;
+    }
+    else if (binary_size_ >= 0)
+    {
+        if (cobs_code_ == 0)
+            stats_.frame_start ();
+        if (cobs_left_ == 0)
+        {
+            // New block, the previous one ended with a zero unless it was a
+            // full block.
+            if (cobs_code_ && cobs_code_ != 0xff)
+                accept_binary_put (0);
+            cobs_code_ = b;
+            cobs_left_ = b - 1;
+        }
+        else
+        {
+            accept_binary_put (b);
+            cobs_left_--;
+        }
+    }
+}
+
+void
+Proto::accept_binary_put (uint8_t b)
+{
+    if (binary_size_ == 0)
+        cmd_ = b;
+    else if (binary_size_ <= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE + 1)
+        args_[binary_size_ - 1] = b;
+    else
+    {
+        // Too long, drop frame.
+        binary_size_ = -1;
+        return;
+    }
+    binary_size_++;
+}
+
+void
+Proto::handle_frame (const uint8_t *args, int size)
+{
+    stats_.frame_received ();
+    if (!stats_.query (*this, cmd_, args, size))
+        handler_.proto_handle (*this, cmd_, args, size);
+}
+
+void
+Proto::handle_error (bool overflow/*false*/)
+{
+    stats_.frame_error (overflow);
+    handler_.proto_handle (*this, '?', 0, 0);
+}
+
 void
 Proto::send (char cmd)
 {
-    char buf[3];
-    char *p = buf;
-    *p++ = '!';
-    *p++ = cmd;
-    *p++ = '\n';
-    stream_.write (buf, p - buf);
+    send_buf (cmd, 0, 0);
 }
 
 void
@@ -139,39 +296,39 @@ send_byte (char *buf, uint8_t b)
     buf[1] = hexchars[b & 0xf];
 }
 
-static char *
-send_arg (char *buf, char fmt, int v)
+/// Store an argument in big endian according to its format, return pointer
+/// past it.
+static uint8_t *
+send_arg (uint8_t *buf, char fmt, int v)
 {
+    int n;
     switch (fmt)
     {
     case 'L':
     case 'l':
-        send_byte (buf, (v >> 24) & 0xff);
-        buf += 2;
-        send_byte (buf, (v >> 16) & 0xff);
-        buf += 2;
+        n = 4;
+        break;
     case 'H':
     case 'h':
-        send_byte (buf, (v >> 8) & 0xff);
-        buf += 2;
+        n = 2;
+        break;
     case 'B':
     case 'b':
-        send_byte (buf, v & 0xff);
-        buf += 2;
+        n = 1;
         break;
     default:
         assert_unreachable ();
     }
+    for (int i = n - 1; i >= 0; i--)
+        *buf++ = v >> (8 * i);
     return buf;
 }
 
 void
 Proto::send (char cmd, const char *fmt, int a0, int a1, int a2, int a3)
 {
-    char buf[3 + 4 * 4 * 2]; // Large enough for the largest frame.
-    char *p = buf;
-    *p++ = '!';
-    *p++ = cmd;
+    uint8_t buf[4 * 4]; // Large enough for the largest frame.
+    uint8_t *p = buf;
     if (*fmt)
     {
         p = send_arg (p, *fmt++, a0);
@@ -188,13 +345,17 @@ Proto::send (char cmd, const char *fmt, int a0, int a1, int a2, int a3)
             }
         }
     }
-    *p++ = '\n';
-    stream_.write (buf, p - buf);
+    send_buf (cmd, buf, p - buf);
 }
 
 void
 Proto::send_buf (char cmd, const uint8_t *args, int size)
 {
+    if (mode_ == Mode::BINARY)
+    {
+        send_binary (cmd, args, size);
+        return;
+    }
     int i;
     char buf[3 + 2 * size];
     char *p = buf;
@@ -206,7 +367,108 @@ Proto::send_buf (char cmd, const uint8_t *args, int size)
         p += 2;
     }
     *p++ = '\n';
-    stream_.write (buf, p - buf);
+    write_frame (buf, p - buf);
+}
+
+void
+Proto::send_binary (char cmd, const uint8_t *args, int size)
+{
+    // Frame content is command, arguments and CRC, COBS encoded: each zero
+    // byte is replaced by the offset to the next one, or to the end of a 254
+    // bytes block.  A zero marks the end of frame.
+    uint8_t buf[1 + size + 1 + (size + 2) / 254 + 1 + 1];
+    uint8_t *code_p = buf, *p = buf + 1;
+    uint8_t crc = 0;
+    for (int i = -1; i <= size; i++)
+    {
+        uint8_t b;
+        if (i == -1)
+            b = cmd;
+        else if (i < size)
+            b = args[i];
+        else
+            b = crc;
+        crc = crc8_update (crc, b);
+        if (b)
+            *p++ = b;
+        if (!b || p - code_p == 0xff)
+        {
+            *code_p = p - code_p;
+            code_p = p++;
+        }
+    }
+    *code_p = p - code_p;
+    *p++ = 0;
+    write_frame (reinterpret_cast<const char *> (buf), p - buf);
+}
+
+void
+Proto::reset_batch_stats ()
+{
+    batch_stats_ = BatchStats ();
+}
+
+void
+Proto::write_frame (const char *frame, int size)
+{
+    stats_.frame_sent ();
+    if (batch_)
+        batch_->add (frame, size);
+    else
+        stream_.write (frame, size);
+}
+
+Proto::Batch::Batch (Proto &proto)
+    : proto_ (proto), outer_ (!proto.batch_), frames_ (0), size_ (0)
+{
+    if (outer_)
+        proto_.batch_ = this;
+}
+
+Proto::Batch::~Batch ()
+{
+    if (outer_)
+    {
+        flush ();
+        proto_.batch_ = nullptr;
+        if (frames_)
+        {
+            proto_.batch_stats_.batches++;
+            proto_.batch_stats_.frames += frames_;
+        }
+    }
+}
+
+void
+Proto::Batch::flush ()
+{
+    if (size_)
+    {
+        proto_.stream_.write (buf_, size_);
+        proto_.batch_stats_.writes++;
+        proto_.batch_stats_.bytes += size_;
+        size_ = 0;
+    }
+}
+
+void
+Proto::Batch::add (const char *frame, int size)
+{
+    frames_++;
+    if (size_ + size > static_cast<int> (sizeof (buf_)))
+        flush ();
+    if (size > static_cast<int> (sizeof (buf_)))
+    {
+        // Too large, bypass buffer.
+        proto_.stream_.write (frame, size);
+        proto_.batch_stats_.writes++;
+        proto_.batch_stats_.bytes += size;
+    }
+    else
+    {
+        std::memcpy (buf_ + size_, frame, size);
+        size_ += size;
+    }
 }
 
 void
@@ -215,7 +477,7 @@ Proto::accept_digit (int c)
     // Test for argument list overflow.
     if (size_ >= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE)
       {
-	handler_.proto_handle (*this, '?', 0, 0);
+	handle_error (true);
 	step_ = IDLE;
 	return;
       }
@@ -228,7 +490,7 @@ Proto::accept_digit (int c)
 	c -= 'A' - 10;
     else
       {
-	handler_.proto_handle (*this, '?', 0, 0);
+	handle_error ();
 	step_ = IDLE;
 	return;
       }
@@ -245,7 +507,7 @@ Proto::accept_char (int c)
     // Test for argument list overflow or unwanted char.
     if (size_ >= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE || !std::isprint (c))
       {
-	handler_.proto_handle (*this, '?', 0, 0);
+	handle_error (size_ >= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE);
 	step_ = IDLE;
 	return;
       }
@@ -25,15 +25,33 @@
 // }}}
 #include "ucoo/common.hh"
 #include "ucoo/intf/stream.hh"
+#include "ucoo/base/proto/proto_stats.hh"
+
+#include <type_traits>
 
 #include "config/ucoo/base/proto.hh"
 
 namespace ucoo {
 
 /// Support for old proto protocol.
+///
+/// In text mode, frames are "!" followed by the command letter, arguments
+/// as pairs of hex digits and a new line.
+///
+/// In binary mode, frames contain the command letter, raw arguments and a
+/// CRC8 of both, COBS encoded, followed by a zero byte.  This halves the
+/// used bandwidth and corrupted frames are rejected.
 class Proto
 {
   public:
+    /// Wire format.
+    enum class Mode
+    {
+        /// Hex text frames.
+        TEXT,
+        /// COBS binary frames with CRC.
+        BINARY,
+    };
     /// Receivers should implement this interface.
     class Handler
     {
@@ -42,11 +60,66 @@ class Proto
         virtual void proto_handle (Proto &proto, char cmd,
                                    const uint8_t *args, int size) = 0;
     };
+    /// Batch statistics, use them to check that batching is effective.
+    struct BatchStats
+    {
+        /// Number of finished batches.
+        uint32_t batches;
+        /// Number of frames sent inside a batch.
+        uint32_t frames;
+        /// Number of stream writes done for batches.
+        uint32_t writes;
+        /// Number of bytes written for batches.
+        uint32_t bytes;
+    };
+    /// Accumulate frames sent during its lifetime, and write them to the
+    /// stream using a single write when destroyed, or when its buffer is
+    /// full.  Typical use is to send all frames of one loop iteration:
+    ///
+    ///   {
+    ///       Proto::Batch b (proto);
+    ///       proto.send (...);
+    ///       proto.send (...);
+    ///   }
+    ///
+    /// Nested batches are merged with the outer one.
+    class Batch
+    {
+      public:
+        /// Start batching frames sent with PROTO.
+        explicit Batch (Proto &proto);
+        /// Write remaining frames and stop batching.
+        ~Batch ();
+        /// Write accumulated frames now.
+        void flush ();
+      private:
+        /// Add a frame to the batch.
+        void add (const char *frame, int size);
+        friend class Proto;
+      private:
+        /// Batched protocol.
+        Proto &proto_;
+        /// Whether this is the outer batch.
+        bool outer_;
+        /// Number of frames in this batch.
+        int frames_;
+        /// Used buffer size.
+        int size_;
+        /// Accumulated frames.
+        char buf_[CONFIG_UCOO_BASE_PROTO_BATCH_BUFFER_SIZE];
+    };
   public:
     /// Constructor.
     Proto (Handler &handler, Stream &stream);
     /// Read from stream and handle any received message.
     void accept ();
+    /// Change wire format, for both directions.  This can be done at any
+    /// time, even from the handler, remaining received data is decoded
+    /// using the new format.  Both sides must agree, for example by using a
+    /// command which is acknowledged before changing mode.
+    void set_mode (Mode mode);
+    /// Get current wire format.
+    Mode get_mode () const { return mode_; }
     /// Send a message with no argument.
     void send (char cmd);
     /// Send a message with one argument.
@@ -59,7 +132,44 @@ class Proto
     void send (char cmd, const char *fmt, int a0, int a1, int a2, int a3);
     /// Send a message, with a byte buffer.
     void send_buf (char cmd, const uint8_t *args, int size);
+    /// Send a message, with any number of arguments.  Arguments layout is
+    /// given as template arguments, see ProtoArg, for example:
+    ///
+    ///   proto.send<'h', 'h', 'L'> ('p', x, y, time);
+    ///
+    /// This is only enabled when the number of arguments matches the layout.
+    template<char... Fmt, typename... Args>
+    typename std::enable_if<sizeof... (Fmt) == sizeof... (Args)>::type
+    send (char cmd, Args... args);
+    /// Get batch statistics.
+    const BatchStats &get_batch_stats () const { return batch_stats_; }
+    /// Reset batch statistics.
+    void reset_batch_stats ();
+    /// Get link statistics, they are only available when enabled in
+    /// configuration.
+    ProtoStats<CONFIG_UCOO_BASE_PROTO_STATS> &get_stats () { return stats_; }
   private:
+    /// Pass the received frame to handler, unless this is a statistics
+    /// query.
+    void handle_frame (const uint8_t *args, int size);
+    /// Report an invalid received frame to handler, OVERFLOW if too many
+    /// arguments.
+    void handle_error (bool overflow = false);
+    /// Write a complete frame, to stream or to current batch.
+    void write_frame (const char *frame, int size);
+    /// Handle received characters.
+    void accept_buf (const char *buf, int count);
+    /// Decode pairs of hex digits, stop at the first non hex digit or when
+    /// arguments are full, return the first unused character.
+    const char *accept_hex (const char *p, const char *end);
+    /// Handle one received character.
+    void accept_step (int c);
+    /// Handle one received byte in binary mode.
+    void accept_binary (uint8_t b);
+    /// Store one decoded byte in binary mode.
+    void accept_binary_put (uint8_t b);
+    /// Send a message in binary mode.
+    void send_binary (char cmd, const uint8_t *args, int size);
     /// Accept a digit to be used for args.
     void accept_digit (int c);
     /// Accept a quoted char to be used for args.
@@ -69,6 +179,8 @@ class Proto
     Handler &handler_;
     /// Connected stream.
     Stream &stream_;
+    /// Current wire format.
+    Mode mode_;
     /// Decoding step.
     enum Step
     {
@@ -88,12 +200,27 @@ class Proto
     Step step_;
     /// Received message current size.
     int size_;
-    /// Message arguments being received.
-    uint8_t args_[CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE];
+    /// Message arguments being received, with room for CRC in binary mode.
+    uint8_t args_[CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE + 1];
     /// Command being received.
     char cmd_;
+    /// Binary mode, number of decoded bytes including command, or -1 if
+    /// frame is dropped.
+    int binary_size_;
+    /// Binary mode, last COBS code or 0 at start of frame.
+    uint8_t cobs_code_;
+    /// Binary mode, remaining bytes in the current COBS block.
+    uint8_t cobs_left_;
+    /// Current batch, or nullptr if not batching.
+    Batch *batch_;
+    /// Batch statistics.
+    BatchStats batch_stats_;
+    /// Link statistics.
+    ProtoStats<CONFIG_UCOO_BASE_PROTO_STATS> stats_;
 };
 
 } // namespace ucoo
 
+#include "ucoo/base/proto/proto.tcc"
+
 #endif // ucoo_base_proto_proto_hh
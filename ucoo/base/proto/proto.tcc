@@ -0,0 +1,44 @@
+#ifndef ucoo_base_proto_proto_tcc
+#define ucoo_base_proto_proto_tcc
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto_arg.hh"
+
+namespace ucoo {
+
+template<char... Fmt, typename... Args>
+inline typename std::enable_if<sizeof... (Fmt) == sizeof... (Args)>::type
+Proto::send (char cmd, Args... args)
+{
+    static_assert (ProtoLayout<Fmt...>::size
+                   <= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE,
+                   "arguments too large");
+    uint8_t buf[ProtoLayout<Fmt...>::size + 1];
+    ProtoLayout<Fmt...>::encode (buf, args...);
+    send_buf (cmd, buf, ProtoLayout<Fmt...>::size);
+}
+
+} // namespace ucoo
+
+#endif // ucoo_base_proto_proto_tcc
@@ -0,0 +1,166 @@
+#ifndef ucoo_base_proto_proto_arg_hh
+#define ucoo_base_proto_proto_arg_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/utils/bytes.hh"
+#include "ucoo/common.hh"
+
+namespace ucoo {
+
+class Proto;
+
+/// Proto argument traits, from its format letter.  Letters are the same as
+/// the ones used by the Python struct module: lower case for signed, upper
+/// case for unsigned, b for byte, h for half word and l for word.  Arguments
+/// are transmitted in big endian.
+template<char F>
+struct ProtoArg;
+
+template<>
+struct ProtoArg<'b'>
+{
+    typedef int8_t type;
+    static const int size = 1;
+    static type decode (const uint8_t *p) { return p[0]; }
+    static void encode (uint8_t *p, type v) { p[0] = v; }
+};
+
+template<>
+struct ProtoArg<'B'>
+{
+    typedef uint8_t type;
+    static const int size = 1;
+    static type decode (const uint8_t *p) { return p[0]; }
+    static void encode (uint8_t *p, type v) { p[0] = v; }
+};
+
+template<>
+struct ProtoArg<'h'>
+{
+    typedef int16_t type;
+    static const int size = 2;
+    static type decode (const uint8_t *p) { return bytes_pack (p[0], p[1]); }
+    static void encode (uint8_t *p, type v)
+    {
+        p[0] = bytes_unpack (v, 1);
+        p[1] = bytes_unpack (v, 0);
+    }
+};
+
+template<>
+struct ProtoArg<'H'>
+{
+    typedef uint16_t type;
+    static const int size = 2;
+    static type decode (const uint8_t *p) { return bytes_pack (p[0], p[1]); }
+    static void encode (uint8_t *p, type v)
+    {
+        p[0] = bytes_unpack (v, 1);
+        p[1] = bytes_unpack (v, 0);
+    }
+};
+
+template<>
+struct ProtoArg<'l'>
+{
+    typedef int32_t type;
+    static const int size = 4;
+    static type decode (const uint8_t *p)
+    {
+        return bytes_pack (p[0], p[1], p[2], p[3]);
+    }
+    static void encode (uint8_t *p, type v)
+    {
+        p[0] = bytes_unpack (v, 3);
+        p[1] = bytes_unpack (v, 2);
+        p[2] = bytes_unpack (v, 1);
+        p[3] = bytes_unpack (v, 0);
+    }
+};
+
+template<>
+struct ProtoArg<'L'>
+{
+    typedef uint32_t type;
+    static const int size = 4;
+    static type decode (const uint8_t *p)
+    {
+        return bytes_pack (p[0], p[1], p[2], p[3]);
+    }
+    static void encode (uint8_t *p, type v)
+    {
+        p[0] = bytes_unpack (v, 3);
+        p[1] = bytes_unpack (v, 2);
+        p[2] = bytes_unpack (v, 1);
+        p[3] = bytes_unpack (v, 0);
+    }
+};
+
+/// Layout of a list of arguments.
+template<char... Fmt>
+struct ProtoLayout;
+
+template<>
+struct ProtoLayout<>
+{
+    /// Total size in bytes.
+    static const int size = 0;
+    /// Call F with PROTO and already decoded VALUES.
+    template<typename F, typename... Values>
+    static void decode_call (const F &f, Proto &proto, const uint8_t *args,
+                             Values... values)
+    {
+        f (proto, values...);
+    }
+    /// Encode nothing.
+    static void encode (uint8_t *p) { }
+};
+
+template<char F0, char... Fmt>
+struct ProtoLayout<F0, Fmt...>
+{
+    /// Total size in bytes.
+    static const int size = ProtoArg<F0>::size + ProtoLayout<Fmt...>::size;
+    /// Decode arguments from ARGS and call F with PROTO, already decoded
+    /// VALUES and decoded arguments.
+    template<typename F, typename... Values>
+    static void decode_call (const F &f, Proto &proto, const uint8_t *args,
+                             Values... values)
+    {
+        ProtoLayout<Fmt...>::decode_call (f, proto, args + ProtoArg<F0>::size,
+                                          values...,
+                                          ProtoArg<F0>::decode (args));
+    }
+    /// Encode V0 and VALUES to P.
+    template<typename V0, typename... Values>
+    static void encode (uint8_t *p, V0 v0, Values... values)
+    {
+        ProtoArg<F0>::encode (p, v0);
+        ProtoLayout<Fmt...>::encode (p + ProtoArg<F0>::size, values...);
+    }
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_proto_proto_arg_hh
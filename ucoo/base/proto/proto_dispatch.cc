@@ -0,0 +1,70 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto_dispatch.hh"
+
+namespace ucoo {
+
+ProtoDispatcher::ProtoDispatcher (Proto::Handler *fallback/*nullptr*/)
+    : commands_ (), fallback_ (fallback)
+{
+}
+
+void
+ProtoDispatcher::remove (char cmd)
+{
+    int i = index (cmd);
+    assert (i >= 0);
+    commands_[i].call = nullptr;
+}
+
+void
+ProtoDispatcher::proto_handle (Proto &proto, char cmd, const uint8_t *args,
+                               int size)
+{
+    int i = index (cmd);
+    if (i >= 0)
+    {
+        const Command &command = commands_[i];
+        if (command.call && command.size == size)
+        {
+            command.call (command, proto, args);
+            return;
+        }
+    }
+    if (fallback_)
+        fallback_->proto_handle (proto, cmd, args, size);
+}
+
+int
+ProtoDispatcher::index (char cmd)
+{
+    if (cmd >= 'A' && cmd <= 'Z')
+        return cmd - 'A';
+    else if (cmd >= 'a' && cmd <= 'z')
+        return cmd - 'a' + 26;
+    else
+        return -1;
+}
+
+} // namespace ucoo
@@ -0,0 +1,92 @@
+#ifndef ucoo_base_proto_proto_dispatch_hh
+#define ucoo_base_proto_proto_dispatch_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto.hh"
+#include "ucoo/base/proto/proto_arg.hh"
+#include "ucoo/utils/function.hh"
+
+#include <type_traits>
+
+namespace ucoo {
+
+/// Proto handler calling a different callback for each command, with
+/// decoded arguments.
+///
+/// Commands are registered with their argument layout, using the same
+/// letters as Proto::send, see ProtoArg.  Arguments size is checked and
+/// arguments are decoded before the callback is called.
+class ProtoDispatcher : public Proto::Handler
+{
+  public:
+    /// Callback type for a given argument layout.
+    template<char... Fmt>
+    using Callback = Function<void (Proto &, typename ProtoArg<Fmt>::type...)>;
+  public:
+    /// Constructor.  Unknown commands, commands with wrong arguments size
+    /// and errors are passed to FALLBACK if not null, else ignored.
+    ProtoDispatcher (Proto::Handler *fallback = nullptr);
+    /// Register a callback for command CMD (a letter), with given arguments
+    /// layout.  Replace any previously registered callback.
+    template<char... Fmt>
+    void add (char cmd, const Callback<Fmt...> &callback);
+    /// Unregister command CMD.
+    void remove (char cmd);
+    /// See Proto::Handler::proto_handle.
+    void proto_handle (Proto &proto, char cmd, const uint8_t *args,
+                       int size) override;
+  private:
+    /// Registered command.
+    struct Command
+    {
+        /// Decode arguments and call callback, or nullptr if not registered.
+        void (*call) (const Command &command, Proto &proto,
+                      const uint8_t *args);
+        /// Expected arguments size.
+        int size;
+        /// Callback, real type depends on arguments layout.
+        typename std::aligned_storage<sizeof (Callback<>),
+                 alignof (Callback<>)>::type callback;
+    };
+    /// Number of possible commands, one per letter.
+    static const int commands_nb = 52;
+  private:
+    /// Return command index, or -1 if not a letter.
+    static int index (char cmd);
+    /// Decode arguments and call callback.
+    template<char... Fmt>
+    static void call (const Command &command, Proto &proto,
+                      const uint8_t *args);
+  private:
+    /// Registered commands, indexed by letter.
+    Command commands_[commands_nb];
+    /// Handler for anything not handled, or nullptr.
+    Proto::Handler *fallback_;
+};
+
+} // namespace ucoo
+
+#include "ucoo/base/proto/proto_dispatch.tcc"
+
+#endif // ucoo_base_proto_proto_dispatch_hh
@@ -0,0 +1,59 @@
+#ifndef ucoo_base_proto_proto_dispatch_tcc
+#define ucoo_base_proto_proto_dispatch_tcc
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include <new>
+
+namespace ucoo {
+
+template<char... Fmt>
+void
+ProtoDispatcher::add (char cmd, const Callback<Fmt...> &callback)
+{
+    static_assert (sizeof (Callback<Fmt...>) == sizeof (Callback<>),
+                   "callback does not fit");
+    static_assert (ProtoLayout<Fmt...>::size
+                   <= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE,
+                   "arguments too large");
+    int i = index (cmd);
+    assert (i >= 0);
+    Command &command = commands_[i];
+    command.call = &ProtoDispatcher::call<Fmt...>;
+    command.size = ProtoLayout<Fmt...>::size;
+    new (&command.callback) Callback<Fmt...> (callback);
+}
+
+template<char... Fmt>
+void
+ProtoDispatcher::call (const Command &command, Proto &proto,
+                       const uint8_t *args)
+{
+    const Callback<Fmt...> &callback =
+        *reinterpret_cast<const Callback<Fmt...> *> (&command.callback);
+    ProtoLayout<Fmt...>::decode_call (callback, proto, args);
+}
+
+} // namespace ucoo
+
+#endif // ucoo_base_proto_proto_dispatch_tcc
@@ -0,0 +1,136 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "proto_stats.hh"
+#include "proto.hh"
+#include "ucoo/utils/format.hh"
+
+#include <algorithm>
+
+#if CONFIG_UCOO_BASE_PROTO_STATS
+
+namespace ucoo {
+
+ProtoStats<true>::ProtoStats (const char *name/*"proto"*/)
+    : TraceBufferBase (name), started_ (false)
+{
+    reset ();
+    TraceRegistry::register_trace_buffer (*this);
+}
+
+ProtoStats<true>::~ProtoStats ()
+{
+    TraceRegistry::unregister_trace_buffer (*this);
+}
+
+void
+ProtoStats<true>::reset ()
+{
+    received = sent = errors = overflows = 0;
+    std::fill (latency, latency + latency_bins, 0);
+}
+
+void
+ProtoStats<true>::frame_end ()
+{
+    if (started_)
+    {
+        uint32_t l = (clock_ () - start_) >> 2;
+        int bin = 0;
+        while (l && bin < latency_bins - 1)
+        {
+            l >>= 2;
+            bin++;
+        }
+        latency[bin]++;
+        started_ = false;
+    }
+}
+
+bool
+ProtoStats<true>::query (Proto &proto, char cmd, const uint8_t *args,
+                         int size)
+{
+    if (!CONFIG_UCOO_BASE_PROTO_STATS_COMMAND
+        || cmd != CONFIG_UCOO_BASE_PROTO_STATS_COMMAND)
+        return false;
+    int page = size ? args[0] : 0;
+    switch (page)
+    {
+    case 0:
+        proto.send<'L', 'L', 'L', 'L'> (cmd, received, sent, errors,
+                                        overflows);
+        break;
+    case 1:
+        {
+            static_assert (1 + 2 * latency_bins
+                           <= CONFIG_UCOO_BASE_PROTO_ARGS_MAX_SIZE,
+                           "too many latency bins for query");
+            uint8_t buf[1 + 2 * latency_bins];
+            buf[0] = page;
+            for (int i = 0; i < latency_bins; i++)
+            {
+                uint32_t v = std::min<uint32_t> (latency[i], 0xffff);
+                buf[1 + 2 * i] = v >> 8;
+                buf[1 + 2 * i + 1] = v;
+            }
+            proto.send_buf (cmd, buf, sizeof (buf));
+        }
+        break;
+    case 2:
+        reset ();
+        proto.send<'B'> (cmd, page);
+        break;
+    default:
+        // Unknown page, let the handler see it.
+        return false;
+    }
+    return true;
+}
+
+bool
+ProtoStats<true>::dump (std::function<bool (
+            const char *str, int str_size)> dump_callback) const
+{
+    char buf[128];
+    int r = format (buf, sizeof (buf),
+                    "received=%u sent=%u errors=%u overflows=%u\n",
+                    received, sent, errors, overflows);
+    bool ok = dump_callback (buf, std::min<int> (r, sizeof (buf) - 1) + 1);
+    r = format (buf, sizeof (buf), "latency:");
+    for (int i = 0; i < latency_bins && r < static_cast<int> (sizeof (buf));
+         i++)
+    {
+        if (i == latency_bins - 1)
+            r += format (buf + r, sizeof (buf) - r, " >=%u:%u\n",
+                         1u << (2 * i), latency[i]);
+        else
+            r += format (buf + r, sizeof (buf) - r, " <%u:%u",
+                         1u << (2 * (i + 1)), latency[i]);
+    }
+    return ok && dump_callback (buf, std::min<int> (r, sizeof (buf) - 1) + 1);
+}
+
+} // namespace ucoo
+
+#endif // CONFIG_UCOO_BASE_PROTO_STATS
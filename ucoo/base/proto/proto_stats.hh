@@ -0,0 +1,144 @@
+#ifndef ucoo_base_proto_proto_stats_hh
+#define ucoo_base_proto_proto_stats_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/common.hh"
+#include "ucoo/utils/function.hh"
+#include "ucoo/utils/trace.hh"
+
+#include "config/ucoo/base/proto.hh"
+
+namespace ucoo {
+
+class Proto;
+
+/// Link statistics, enabled or not depending on the template argument, see
+/// Proto::get_stats.
+///
+/// When a clock is set, the time between the start of a received frame and
+/// its end is recorded in a histogram.  First bin counts latencies lower
+/// than 4 ticks, each following bin is four times wider than the previous
+/// one, and the last bin counts everything else.
+///
+/// Statistics can be dumped using TraceRegistry, or queried with the
+/// statistics command (stats_command in configuration), handled directly
+/// by Proto:
+///
+///  - no argument or page 0: answer with the four counters as 32 bit
+///  values, see ProtoStats<true> members,
+///  - page 1: answer with page number, then latency histogram bins as 16 bit
+///  saturated values,
+///  - page 2: reset statistics, answer with page number.
+template<bool ENABLED>
+class ProtoStats
+{
+};
+
+template<>
+class ProtoStats<true> : public TraceBufferBase
+{
+  public:
+    /// Number of latency histogram bins.
+    static const int latency_bins = CONFIG_UCOO_BASE_PROTO_STATS_LATENCY_BINS;
+    /// Clock used to measure latency, returns ticks of any unit.
+    typedef Function<uint32_t ()> Clock;
+  public:
+    /// Constructor, register to TraceRegistry.
+    ProtoStats (const char *name = "proto");
+    /// Destructor, unregister.
+    ~ProtoStats ();
+    /// Set clock used to measure latency.
+    void set_clock (const Clock &clock) { clock_ = clock; }
+    /// Reset statistics.
+    void reset ();
+    /// Start of a received frame.
+    void frame_start ()
+    {
+        if (clock_)
+        {
+            start_ = clock_ ();
+            started_ = true;
+        }
+    }
+    /// Received frame passed to handler.
+    void frame_received () { received++; frame_end (); }
+    /// Invalid frame received, OVERFLOW if too many arguments.
+    void frame_error (bool overflow)
+    {
+        errors++;
+        if (overflow)
+            overflows++;
+        frame_end ();
+    }
+    /// Frame sent.
+    void frame_sent () { sent++; }
+    /// Handle statistics query, return true if handled.
+    bool query (Proto &proto, char cmd, const uint8_t *args, int size);
+    /// See TraceBufferBase::dump.
+    bool dump (std::function<bool (
+            const char *str, int str_size)> dump_callback) const override;
+  private:
+    /// End of a received frame.
+    void frame_end ();
+  public:
+    /// Number of valid received frames.
+    uint32_t received;
+    /// Number of sent frames.
+    uint32_t sent;
+    /// Number of invalid received frames, reported to handler as '?'.
+    uint32_t errors;
+    /// Number of received frames with too many arguments, also counted in
+    /// errors.
+    uint32_t overflows;
+    /// Latency histogram.
+    uint32_t latency[latency_bins];
+  private:
+    /// Latency clock.
+    Clock clock_;
+    /// Start of the current received frame.
+    uint32_t start_;
+    /// Whether a frame start time was recorded.
+    bool started_;
+};
+
+template<>
+class ProtoStats<false>
+{
+  public:
+    typedef Function<uint32_t ()> Clock;
+  public:
+    ProtoStats (const char *name = "proto") { }
+    void set_clock (const Clock &clock) { }
+    void reset () { }
+    void frame_start () { }
+    void frame_received () { }
+    void frame_error (bool overflow) { }
+    void frame_sent () { }
+    bool query (Proto &proto, char cmd, const uint8_t *args, int size)
+        { return false; }
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_proto_proto_stats_hh
@@ -0,0 +1,282 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto.hh"
+#include "ucoo/base/proto/proto_dispatch.hh"
+
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/stream_test.hh"
+
+#ifdef TARGET_host
+# include "ucoo/arch/host/host_stream.hh"
+# include <fcntl.h>
+#endif
+
+/// Count received frames.
+class CountHandler : public ucoo::Proto::Handler
+{
+  public:
+    void proto_handle (ucoo::Proto &proto, char cmd, const uint8_t *args,
+                       int size) override
+    {
+        frames++;
+        if (cmd == '?')
+            errors++;
+    }
+  public:
+    int frames = 0;
+    int errors = 0;
+};
+
+/// Classic handler, with a switch and hand written decoding.
+class SwitchHandler : public ucoo::Proto::Handler
+{
+  public:
+    void proto_handle (ucoo::Proto &proto, char cmd, const uint8_t *args,
+                       int size) override
+    {
+#define c(cmd, size) ((cmd) << 8 | (size))
+        switch (c (cmd, size))
+        {
+        case c ('p', 8):
+            position (proto, ucoo::bytes_pack (args[0], args[1]),
+                      ucoo::bytes_pack (args[2], args[3]),
+                      ucoo::bytes_pack (args[4], args[5], args[6], args[7]));
+            break;
+        case c ('s', 1):
+            state (proto, args[0]);
+            break;
+        case c ('k', 0):
+            ping (proto);
+            break;
+        default:
+            break;
+        }
+#undef c
+    }
+    void position (ucoo::Proto &proto, int16_t x, int16_t y, int32_t t)
+    {
+        sum += x + y + t;
+    }
+    void state (ucoo::Proto &proto, uint8_t s) { sum += s; }
+    void ping (ucoo::Proto &proto) { sum++; }
+  public:
+    int sum = 0;
+};
+
+/// Send a telemetry like message.
+static inline void
+send_frame (ucoo::Proto &proto, int i)
+{
+    switch (i % 3)
+    {
+    case 0:
+        proto.send ('p', "hhl", i, -i, i * 1000);
+        break;
+    case 1:
+        proto.send ('s', "B", i & 0xf);
+        break;
+    default:
+        proto.send ('k');
+        break;
+    }
+}
+
+/// Send a telemetry like message, using typed send.
+static inline void
+send_frame_typed (ucoo::Proto &proto, int i)
+{
+    switch (i % 3)
+    {
+    case 0:
+        proto.send<'h', 'h', 'l'> ('p', i, -i, i * 1000);
+        break;
+    case 1:
+        proto.send<'B'> ('s', i & 0xf);
+        break;
+    default:
+        proto.send<> ('k');
+        break;
+    }
+}
+
+/// Encode frames, measuring time, and return encoded size.
+template<void (*send) (ucoo::Proto &proto, int i) = send_frame>
+static int
+bench_send (ucoo::BenchSuite &bsuite, const char *name,
+            ucoo::Proto::Mode mode, char *buf, int size)
+{
+    ucoo::Bench bench (bsuite, name);
+    CountHandler handler;
+    ucoo::TestChunkStream stream (nullptr, 0, 0, buf, size);
+    ucoo::Proto proto (handler, stream);
+    proto.set_mode (mode);
+    int frames = 0;
+    uint64_t start = ucoo::bench_time_ns ();
+    while (stream.room () > 32)
+        send (proto, frames++);
+    int used = size - stream.room ();
+    bench.add (ucoo::bench_time_ns () - start, frames, used);
+    bench.info ("%d bytes per frame", used / frames);
+    return used;
+}
+
+/// Send loop iterations of several frames to a real stream, with or without
+/// batching.
+static void
+bench_batch (ucoo::BenchSuite &bsuite, const char *name, ucoo::Stream &stream,
+             ucoo::Proto::Mode mode, bool batch)
+{
+    static const int loops = 256, frames_per_loop = 6;
+    ucoo::Bench bench (bsuite, name);
+    CountHandler handler;
+    ucoo::Proto proto (handler, stream);
+    proto.set_mode (mode);
+    for (int j = 0; j < loops; j++)
+    {
+        uint64_t start = ucoo::bench_time_ns ();
+        if (batch)
+        {
+            ucoo::Proto::Batch b (proto);
+            for (int i = 0; i < frames_per_loop; i++)
+                send_frame (proto, i);
+        }
+        else
+        {
+            for (int i = 0; i < frames_per_loop; i++)
+                send_frame (proto, i);
+        }
+        bench.add (ucoo::bench_time_ns () - start, frames_per_loop);
+    }
+    const ucoo::Proto::BatchStats &stats = proto.get_batch_stats ();
+    if (stats.batches)
+        bench.info ("%u frames per batch, %u bytes per write",
+                    unsigned (stats.frames / stats.batches),
+                    unsigned (stats.bytes / stats.writes));
+}
+
+/// Decode BUF using the given read chunk size.
+static void
+bench_accept (ucoo::BenchSuite &bsuite, const char *name,
+              ucoo::Proto::Mode mode, const char *buf, int size, int chunk)
+{
+    ucoo::Bench bench (bsuite, name);
+    CountHandler handler;
+    for (int i = 0; i < 16; i++)
+    {
+        ucoo::TestChunkStream stream (buf, size, chunk);
+        ucoo::Proto proto (handler, stream);
+        proto.set_mode (mode);
+        int frames = handler.frames;
+        uint64_t start = ucoo::bench_time_ns ();
+        while (stream.poll ())
+            proto.accept ();
+        bench.add (ucoo::bench_time_ns () - start, handler.frames - frames,
+                   size);
+    }
+    if (handler.errors)
+        bench.info ("%d errors", handler.errors);
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("proto");
+    static char text[4096], binary[4096];
+    bsuite.group ("send");
+    int text_size = bench_send (bsuite, "text", ucoo::Proto::Mode::TEXT,
+                                text, sizeof (text));
+    int binary_size = bench_send (bsuite, "binary",
+                                  ucoo::Proto::Mode::BINARY, binary,
+                                  sizeof (binary));
+    bench_send<send_frame_typed> (bsuite, "text:typed",
+                                  ucoo::Proto::Mode::TEXT, text,
+                                  sizeof (text));
+    bench_send<send_frame_typed> (bsuite, "binary:typed",
+                                  ucoo::Proto::Mode::BINARY, binary,
+                                  sizeof (binary));
+    bsuite.group ("batch");
+    {
+#ifdef TARGET_host
+        // Each write is a system call.
+        ucoo::HostStream stream (-1, open ("/dev/null", O_WRONLY));
+#else
+        ucoo::Stream &stream = ucoo::test_stream ();
+#endif
+        bench_batch (bsuite, "text", stream, ucoo::Proto::Mode::TEXT, false);
+        bench_batch (bsuite, "text:batch", stream, ucoo::Proto::Mode::TEXT,
+                     true);
+        bench_batch (bsuite, "binary", stream, ucoo::Proto::Mode::BINARY,
+                     false);
+        bench_batch (bsuite, "binary:batch", stream,
+                     ucoo::Proto::Mode::BINARY, true);
+    }
+    bsuite.group ("accept");
+    // A one byte chunk is the same access pattern as the old per character
+    // parser.
+    bench_accept (bsuite, "text:1", ucoo::Proto::Mode::TEXT, text, text_size,
+                  1);
+    bench_accept (bsuite, "text:16", ucoo::Proto::Mode::TEXT, text,
+                  text_size, 16);
+    bench_accept (bsuite, "text:64", ucoo::Proto::Mode::TEXT, text,
+                  text_size, 64);
+    bench_accept (bsuite, "binary:1", ucoo::Proto::Mode::BINARY, binary,
+                  binary_size, 1);
+    bench_accept (bsuite, "binary:64", ucoo::Proto::Mode::BINARY, binary,
+                  binary_size, 64);
+    bsuite.group ("dispatch");
+    {
+        static const uint8_t args[] = { 0, 1, 0, 2, 0, 0, 0, 3 };
+        static const struct { char cmd; int size; } msgs[] = {
+            { 'p', 8 }, { 's', 1 }, { 'k', 0 }, { 'x', 0 },
+        };
+        SwitchHandler handler;
+        ucoo::ProtoDispatcher dispatcher;
+        dispatcher.add<'h', 'h', 'l'> ('p', { &handler,
+                                              &SwitchHandler::position });
+        dispatcher.add<'B'> ('s', { &handler, &SwitchHandler::state });
+        dispatcher.add ('k', ucoo::ProtoDispatcher::Callback<> (
+                &handler, &SwitchHandler::ping));
+        ucoo::TestChunkStream stream (nullptr, 0, 0);
+        ucoo::Proto proto (handler, stream);
+        ucoo::Proto::Handler *handlers[] = { &handler, &dispatcher };
+        const char *names[] = { "switch", "table" };
+        for (int h = 0; h < 2; h++)
+        {
+            ucoo::Bench bench (bsuite, names[h]);
+            for (int j = 0; j < 64; j++)
+            {
+                uint64_t start = ucoo::bench_time_ns ();
+                for (int i = 0; i < 256; i++)
+                    handlers[h]->proto_handle (proto, msgs[i % 4].cmd, args,
+                                               msgs[i % 4].size);
+                bench.add (ucoo::bench_time_ns () - start, 256);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,353 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto.hh"
+
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/test/stream_test.hh"
+#include "ucoo/utils/trace.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+/// Log received frames as text.
+class LogHandler : public ucoo::Proto::Handler
+{
+  public:
+    void proto_handle (ucoo::Proto &proto, char cmd, const uint8_t *args,
+                       int size) override
+    {
+        // Mode switch commands.
+        if (cmd == 'M')
+            proto.set_mode (ucoo::Proto::Mode::BINARY);
+        else if (cmd == 'T')
+            proto.set_mode (ucoo::Proto::Mode::TEXT);
+        log += cmd;
+        for (int i = 0; i < size; i++)
+        {
+            char buf[3];
+            snprintf (buf, sizeof (buf), "%02x", args[i]);
+            log += buf;
+        }
+        log += ';';
+    }
+  public:
+    std::string log;
+};
+
+/// Fake clock, advance by a fixed step each time it is read.
+static uint32_t clock_now, clock_step;
+
+static uint32_t
+clock_read ()
+{
+    clock_now += clock_step;
+    return clock_now;
+}
+
+/// Decode INPUT using any chunk size, return false if log does not match
+/// EXPECTED.
+static bool
+check (ucoo::Test &test, const std::string &input, const char *expected,
+       ucoo::Proto::Mode mode = ucoo::Proto::Mode::TEXT)
+{
+    int input_size = input.size ();
+    for (int chunk = 1; chunk <= input_size; chunk++)
+    {
+        ucoo::TestChunkStream stream (input.data (), input_size, chunk);
+        LogHandler handler;
+        ucoo::Proto proto (handler, stream);
+        proto.set_mode (mode);
+        while (stream.poll ())
+            proto.accept ();
+        if (handler.log != expected)
+        {
+            test.info ("chunk %d: \"%s\" != \"%s\"", chunk,
+                       handler.log.c_str (), expected);
+            return false;
+        }
+    }
+    return true;
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("proto");
+    tsuite.group ("decode");
+    {
+        ucoo::Test test (tsuite, "frames");
+        do {
+            test_fail_break_unless (test, check (test, "!a\n", "a;"));
+            test_fail_break_unless (test, check (test, "!a0102\r!B",
+                                                 "a0102;"));
+            test_fail_break_unless (test, check (
+                    test, "garbage!a0102abcdEF\n\n!z'x\"str\n",
+                    "a0102abcdef;z78737472;"));
+            test_fail_break_unless (test, check (
+                    test, "!a01!b02\n", "b02;"));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "errors");
+        do {
+            test_fail_break_unless (test, check (test, "!0\n!a0g\n!a0\n",
+                                                 "?;?;?;"));
+            test_fail_break_unless (test, check (
+                    test, "!a00112233445566778899aabbccddeeff\n!b\n",
+                    "a00112233445566778899aabbccddeeff;b;"));
+            test_fail_break_unless (test, check (
+                    test, "!a00112233445566778899aabbccddeeff00\n!b\n",
+                    "?;b;"));
+        } while (0);
+    }
+    tsuite.group ("send");
+    {
+        ucoo::Test test (tsuite, "typed send");
+        do {
+            char out[512];
+            ucoo::TestChunkStream stream ("", 0, 1, out, sizeof (out));
+            LogHandler handler;
+            ucoo::Proto proto (handler, stream);
+            proto.send ('a', "hBl", -2, 0x1234, 0x87654321u);
+            proto.send<'h', 'B', 'l'> ('a', -2, 0x1234, 0x87654321u);
+            proto.send<> ('k');
+            proto.send<'b', 'B', 'h', 'H', 'l', 'L'> ('m', -1, 2, -3, 4, -5,
+                                                       6);
+            test_fail_break_unless (test, stream.output ()
+                                    == "!afffe3487654321\n"
+                                    "!afffe3487654321\n!k\n"
+                                    "!mff02fffd0004fffffffb00000006\n");
+            stream.clear ();
+            proto.set_mode (ucoo::Proto::Mode::BINARY);
+            proto.send<'h', 'B', 'l'> ('a', -2, 0x1234, 0x87654321u);
+            test_fail_break_unless (test, check (
+                    test, stream.output (), "afffe3487654321;",
+                    ucoo::Proto::Mode::BINARY));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "batch");
+        do {
+            char out[512];
+            ucoo::TestChunkStream stream ("", 0, 1, out, sizeof (out));
+            LogHandler handler;
+            ucoo::Proto proto (handler, stream);
+            {
+                ucoo::Proto::Batch b (proto);
+                proto.send ('a');
+                {
+                    // Merged with outer batch.
+                    ucoo::Proto::Batch inner (proto);
+                    proto.send ('b', "b", 1);
+                }
+                proto.send ('c', "h", 2);
+                test_fail_break_unless (test, stream.writes == 0);
+            }
+            test_fail_break_unless (test, stream.writes == 1);
+            test_fail_break_unless (test, stream.output ()
+                                    == "!a\n!b01\n!c0002\n");
+            // Flush when full, 35 bytes frames.
+            static const uint8_t args[16] = { 0 };
+            {
+                ucoo::Proto::Batch b (proto);
+                for (int i = 0; i < 10; i++)
+                    proto.send_buf ('d', args, sizeof (args));
+            }
+            int per_write = CONFIG_UCOO_BASE_PROTO_BATCH_BUFFER_SIZE / 35;
+            int writes = (10 + per_write - 1) / per_write;
+            test_fail_break_unless (test, stream.writes == 1 + writes);
+            test_fail_break_unless (test, stream.output ().size ()
+                                    == 15 + 10 * 35);
+            // Not batched.
+            proto.send ('e');
+            const ucoo::Proto::BatchStats &stats = proto.get_batch_stats ();
+            test.info ("batches=%u frames=%u writes=%u bytes=%u",
+                       unsigned (stats.batches), unsigned (stats.frames),
+                       unsigned (stats.writes), unsigned (stats.bytes));
+            test_fail_break_unless (test, stats.batches == 2
+                                    && stats.frames == 13
+                                    && stats.writes == unsigned (1 + writes)
+                                    && stats.bytes == 15 + 10 * 35);
+        } while (0);
+    }
+    tsuite.group ("stats");
+    {
+        ucoo::Test test (tsuite, "counters");
+        do {
+            std::string input ("!a01\n!0\n!a0g\n"
+                               "!a00112233445566778899aabbccddeeff00\n"
+                               "!b\n");
+            ucoo::TestChunkStream stream (input.data (), input.size (), 3);
+            LogHandler handler;
+            ucoo::Proto proto (handler, stream);
+            while (stream.poll ())
+                proto.accept ();
+            proto.send ('c');
+            const ucoo::ProtoStats<true> &stats = proto.get_stats ();
+            test_fail_break_unless (test, handler.log == "a01;?;?;?;b;");
+            test_fail_break_unless (test, stats.received == 2
+                                    && stats.sent == 1 && stats.errors == 3
+                                    && stats.overflows == 1);
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "latency");
+        do {
+            std::string input ("!a\n!b\n"), input2 ("!a\n");
+            ucoo::TestChunkStream stream (input.data (), input.size (), 1);
+            LogHandler handler;
+            ucoo::Proto proto (handler, stream);
+            ucoo::ProtoStats<true> &stats = proto.get_stats ();
+            stats.set_clock (clock_read);
+            clock_step = 10;
+            proto.accept ();
+            clock_step = 100;
+            ucoo::TestChunkStream stream2 (input2.data (), input2.size (),
+                                           1);
+            ucoo::Proto proto2 (handler, stream2);
+            proto2.get_stats ().set_clock (clock_read);
+            proto2.accept ();
+            // First bin is [0, 4), then [4, 16), [16, 64), [64, 256)...
+            test_fail_break_unless (test, stats.latency[1] == 2);
+            test_fail_break_unless (test, proto2.get_stats ().latency[3]
+                                    == 1);
+            // Dump through trace registry.
+            std::string dump;
+            ucoo::TraceRegistry::dump ("proto", [&dump] (const char *str,
+                                                         int str_size) {
+                                       dump += str;
+                                       return true;
+                                       });
+            test.info ("%s", dump.c_str ());
+            test_fail_break_unless (test, dump.find (
+                    "received=2 sent=0 errors=0 overflows=0\n"
+                    "latency: <4:0 <16:2 <64:0") != std::string::npos);
+            test_fail_break_unless (test, dump.find (
+                    "received=1") != std::string::npos);
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "query");
+        do {
+            std::string input ("!a\n!0\n!Q\n!Q01\n!Q02\n!Q\n!Q03\n");
+            char out[512];
+            ucoo::TestChunkStream stream (input.data (), input.size (), 64,
+                                          out, sizeof (out));
+            LogHandler handler;
+            ucoo::Proto proto (handler, stream);
+            proto.accept ();
+            test_fail_break_unless (test, handler.log == "a;?;Q03;");
+            test_fail_break_unless (test, stream.output ()
+                                    == "!Q00000002000000000000000100000000\n"
+                                    "!Q01" + std::string (28, '0') + "\n"
+                                    "!Q02\n"
+                                    "!Q00000001000000010000000000000000\n");
+        } while (0);
+    }
+    tsuite.group ("binary");
+    // Encode frames used for binary mode tests.
+    std::string frames, switch_frame;
+    {
+        char out[512];
+        ucoo::TestChunkStream stream ("", 0, 1, out, sizeof (out));
+        LogHandler handler;
+        ucoo::Proto proto (handler, stream);
+        proto.set_mode (ucoo::Proto::Mode::BINARY);
+        static const uint8_t zeros[] = { 0, 0, 1, 0 };
+        proto.send ('a');
+        proto.send ('b', "hbl", 0x1234, 0, 0x00ff00aa);
+        proto.send_buf ('c', zeros, sizeof (zeros));
+        frames = stream.output ();
+        proto.send ('T');
+        switch_frame = stream.output ().substr (frames.size ());
+    }
+    static const char *frames_log[] = { "a;", "b12340000ff00aa;",
+        "c00000100;" };
+    std::string all_log = std::string (frames_log[0]) + frames_log[1]
+        + frames_log[2];
+    {
+        ucoo::Test test (tsuite, "round trip");
+        do {
+            // Zero is only used as frame delimiter.
+            test_fail_break_unless (test, std::count (frames.begin (),
+                                                      frames.end (), '\0')
+                                    == 3);
+            // Arguments are not hex encoded, same frames in text mode would
+            // use 31 bytes.
+            test_fail_break_unless (test, frames.size () <= 24);
+            test_fail_break_unless (test, check (test, frames,
+                                                 all_log.c_str (),
+                                                 ucoo::Proto::Mode::BINARY));
+            // Empty frames are ignored.
+            test_fail_break_unless (test, check (
+                    test, std::string (3, '\0') + frames, all_log.c_str (),
+                    ucoo::Proto::Mode::BINARY));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "errors");
+        do {
+            // Corrupted frames are rejected, other frames are decoded.
+            bool ok = true;
+            int frame = 0;
+            for (int i = 0; ok && i < static_cast<int> (frames.size ()); i++)
+            {
+                if (frames[i] == '\0')
+                {
+                    frame++;
+                    continue;
+                }
+                std::string corrupted = frames;
+                corrupted[i] ^= 0x10;
+                std::string expected;
+                for (int j = 0; j < 3; j++)
+                    expected += j == frame ? "?;" : frames_log[j];
+                ok = check (test, corrupted, expected.c_str (),
+                            ucoo::Proto::Mode::BINARY);
+            }
+            test_fail_break_unless (test, ok);
+            // Too long frame.
+            std::string long_frame (1, 20);
+            long_frame += std::string (19, 'a');
+            long_frame += '\0';
+            test_fail_break_unless (test, check (test, long_frame + frames,
+                                                 ("?;" + all_log).c_str (),
+                                                 ucoo::Proto::Mode::BINARY));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "mode switch");
+        do {
+            // Switch to binary, then back to text, from the handler.
+            test_fail_break_unless (test, check (
+                    test, "!a01\n!M\n" + frames + switch_frame + "!b\n",
+                    ("a01;M;" + all_log + "T;b;").c_str ()));
+        } while (0);
+    }
+    return tsuite.report () ? 0 : 1;
+}
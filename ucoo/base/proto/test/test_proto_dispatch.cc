@@ -0,0 +1,129 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/proto/proto_dispatch.hh"
+
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <cstring>
+#include <string>
+
+/// Stream returning data from a string.
+class StringStream : public ucoo::Stream
+{
+  public:
+    StringStream (const char *data) : data_ (data) { }
+    int read (char *buf, int count) override
+    {
+        int r = std::min<int> (count, data_.size ());
+        data_.copy (buf, r);
+        data_.erase (0, r);
+        return r;
+    }
+    int write (const char *buf, int count) override
+    {
+        written.append (buf, count);
+        return count;
+    }
+    int poll () override { return data_.size (); }
+  public:
+    std::string written;
+  private:
+    std::string data_;
+};
+
+/// Receive commands.
+class Receiver : public ucoo::Proto::Handler
+{
+  public:
+    void position (ucoo::Proto &proto, int16_t x, int16_t y, uint32_t t)
+    {
+        log += "p" + std::to_string (x) + "," + std::to_string (y) + ","
+            + std::to_string (t) + ";";
+    }
+    void state (ucoo::Proto &proto, uint8_t s, int8_t v)
+    {
+        log += "s" + std::to_string (s) + "," + std::to_string (v) + ";";
+        proto.send ('s', "BB", s, v);
+    }
+    void proto_handle (ucoo::Proto &proto, char cmd, const uint8_t *args,
+                       int size) override
+    {
+        log += "fallback:";
+        log += cmd;
+        log += std::to_string (size) + ";";
+    }
+  public:
+    std::string log;
+};
+
+static std::string ping_log;
+
+static void
+ping (ucoo::Proto &proto)
+{
+    ping_log += "ping;";
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("proto");
+    tsuite.group ("dispatch");
+    {
+        ucoo::Test test (tsuite, "decode and call");
+        do {
+            Receiver receiver;
+            ucoo::ProtoDispatcher dispatcher (&receiver);
+            dispatcher.add<'h', 'h', 'L'> ('p', { &receiver,
+                                                  &Receiver::position });
+            dispatcher.add<'B', 'b'> ('S', { &receiver, &Receiver::state });
+            dispatcher.add ('z', ucoo::ProtoDispatcher::Callback<> (ping));
+            StringStream stream ("!pfffe0002fffffffe\n!Sfe80\n!z\n!Z\n"
+                                 "!p01\n!0\n");
+            ucoo::Proto proto (dispatcher, stream);
+            proto.accept ();
+            test_fail_break_unless (test, receiver.log
+                                    == "p-2,2,4294967294;s254,-128;"
+                                    "fallback:Z0;fallback:p1;fallback:?0;");
+            test_fail_break_unless (test, ping_log == "ping;");
+            test_fail_break_unless (test, stream.written == "!sfe80\n");
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "remove");
+        do {
+            Receiver receiver;
+            ucoo::ProtoDispatcher dispatcher;
+            dispatcher.add<'B', 'b'> ('S', { &receiver, &Receiver::state });
+            dispatcher.remove ('S');
+            StringStream stream ("!S0102\n");
+            ucoo::Proto proto (dispatcher, stream);
+            proto.accept ();
+            test_fail_break_unless (test, receiver.log == "");
+        } while (0);
+    }
+    return tsuite.report () ? 0 : 1;
+}
@@ -22,6 +22,7 @@
 //
 // }}}
 #include "stdio.hh"
+#include "ucoo/common.hh"
 
 #include <unistd.h>
 
@@ -48,21 +49,91 @@ stream_io_write (void *cookie, const char *buf, size_t n)
     return r;
 }
 
+/// Offset type used by the seek callback, which depends on the C library
+/// and its configuration (newlib only uses 64 bit offsets when
+/// __LARGE64_FILES is defined), take it from the callback type.
+template<typename Seek>
+struct StreamIoOff;
+
+template<typename Off>
+struct StreamIoOff<int (void *, Off *, int)>
+{
+    typedef Off type;
+};
+
+typedef StreamIoOff<cookie_seek_function_t>::type stream_io_off_t;
+
+/// Callback to seek a stream.
+int
+stream_io_seek (void *cookie, stream_io_off_t *offset, int whence)
+{
+    Stream *stream = static_cast<Stream *> (cookie);
+    Stream::Whence w;
+    switch (whence)
+    {
+    case SEEK_SET:
+        w = Stream::Whence::SET;
+        break;
+    case SEEK_CUR:
+        w = Stream::Whence::CUR;
+        break;
+    case SEEK_END:
+        w = Stream::Whence::END;
+        break;
+    default:
+        return -1;
+    }
+    int r = stream->seek (*offset, w);
+    if (r == -1)
+        return -1;
+    *offset = r;
+    return 0;
+}
+
+/// Callback to close a stream, flush it.
+int
+stream_io_close (void *cookie)
+{
+    Stream *stream = static_cast<Stream *> (cookie);
+    stream->flush ();
+    return 0;
+}
+
 /// Table of callback for fopencookie.
 static const cookie_io_functions_t stream_io_functions =
 {
     stream_io_read,
     stream_io_write,
-    NULL,
-    NULL,
+    stream_io_seek,
+    stream_io_close,
 };
 
 FILE *
-fstreamopen (Stream &stream, const char *mode)
+fstreamopen (Stream &stream, const char *mode,
+             StdioBuffering buffering/*DEFAULT*/, char *buf/*nullptr*/,
+             int size/*0*/)
 {
     // fopencookie is a glibc extension also implemented in newlib, nice!
-    return fopencookie (static_cast<void *> (&stream), mode,
-                        stream_io_functions);
+    FILE *file = fopencookie (static_cast<void *> (&stream), mode,
+                              stream_io_functions);
+    // A given buffer is used with full buffering by default.
+    if (file && (buffering != StdioBuffering::DEFAULT || buf))
+    {
+        static const int modes[] = { _IOFBF, _IONBF, _IOLBF, _IOFBF };
+        int r = setvbuf (file, buf, modes[static_cast<int> (buffering)],
+                         buf ? size : (size ? size : BUFSIZ));
+        assert (r == 0);
+    }
+    return file;
+}
+
+int
+fstreamflush (FILE *file, Stream &stream)
+{
+    if (fflush (file) != 0)
+        return EOF;
+    stream.flush ();
+    return 0;
 }
 
 } // namespace ucoo
@@ -29,10 +29,37 @@
 
 namespace ucoo {
 
+/// Buffering used by a stdio stream.
+enum class StdioBuffering {
+    /// Let the C library choose, or FULL if a buffer is given.
+    DEFAULT,
+    /// No buffering, every stdio call is passed to the stream.
+    NONE,
+    /// Data is passed to the stream at end of line or when buffer is full.
+    LINE,
+    /// Data is passed to the stream when buffer is full.
+    FULL,
+};
+
 /// Open a stdio stream connecter to STREAM.  The MODE parameter uses the same
 /// syntax as stdio fopen.
+///
+/// BUFFERING selects when data is passed to STREAM.  If BUF is given, it is
+/// used as stdio buffer of SIZE bytes and must stay valid until the stdio
+/// stream is closed, else the C library allocates one.
+///
+/// Stream::flush is called when the stdio stream is closed or flushed with
+/// fstreamflush, and fseek is forwarded to Stream::seek.
 FILE *
-fstreamopen (Stream &stream, const char *mode);
+fstreamopen (Stream &stream, const char *mode,
+             StdioBuffering buffering = StdioBuffering::DEFAULT,
+             char *buf = nullptr, int size = 0);
+
+/// Flush a stdio stream opened with fstreamopen, then flush STREAM, the
+/// stream it was opened on.  Return 0 on success or EOF on error, like
+/// fflush.
+int
+fstreamflush (FILE *file, Stream &stream);
 
 } // namespace ucoo
 
@@ -0,0 +1,116 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "bench.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdarg>
+#include <cinttypes>
+
+namespace ucoo {
+
+BenchSuite::BenchSuite (const char *bench_suite)
+    : bench_suite_ (bench_suite), bench_group_ ("none"), in_bench_ (false)
+{
+}
+
+void
+BenchSuite::group (const char *bench_group)
+{
+    bench_group_ = bench_group;
+}
+
+Bench::Bench (BenchSuite &suite, const char *bench)
+    : suite_ (suite), bench_ (bench), start_ns_ (0), time_ns_ (0),
+      calls_ (0), bytes_ (0)
+{
+    assert (!suite_.in_bench_);
+    suite_.in_bench_ = true;
+}
+
+/// Return a percentile of the N first elements of SAMPLES, reorder them.
+static uint32_t
+bench_percentile (uint32_t *samples, int n, int percent)
+{
+    if (!n)
+        return 0;
+    uint32_t *nth = samples + (n - 1) * percent / 100;
+    std::nth_element (samples, nth, samples + n);
+    return *nth;
+}
+
+Bench::~Bench ()
+{
+    int n = std::min<uint32_t> (calls_, samples_nb);
+    uint32_t p50 = bench_percentile (samples_, n, 50);
+    uint32_t p99 = bench_percentile (samples_, n, 99);
+    // Avoid floating point formatting, not always available.
+    uint64_t time_ns = std::max<uint64_t> (time_ns_, 1);
+    uint64_t mbps_milli = bytes_ * 1000000 / time_ns;
+    uint64_t calls_per_s = static_cast<uint64_t> (calls_) * 1000000000
+        / time_ns;
+    printf ("%s:%s:%s:B: calls=%" PRIu32 " bytes=%" PRIu64
+            " time_ns=%" PRIu64 " mbps=%" PRIu64 ".%03u calls_per_s=%" PRIu64
+            " p50_ns=%" PRIu32 " p99_ns=%" PRIu32 "\n",
+            suite_.bench_suite_, suite_.bench_group_, bench_, calls_,
+            bytes_, time_ns_, mbps_milli / 1000,
+            static_cast<unsigned> (mbps_milli % 1000), calls_per_s, p50, p99);
+    suite_.in_bench_ = false;
+}
+
+void
+Bench::stop (int bytes)
+{
+    uint64_t time_ns = bench_time_ns () - start_ns_;
+    samples_[calls_ % samples_nb] = std::min<uint64_t> (time_ns, UINT32_MAX);
+    time_ns_ += time_ns;
+    calls_++;
+    bytes_ += bytes;
+}
+
+void
+Bench::add (uint64_t time_ns, int calls, int bytes)
+{
+    // Only an average is known, use it as samples.
+    uint32_t sample = calls ? std::min<uint64_t> (time_ns / calls, UINT32_MAX)
+        : 0;
+    for (int i = 0; i < calls && i < samples_nb; i++)
+        samples_[(calls_ + i) % samples_nb] = sample;
+    time_ns_ += time_ns;
+    calls_ += calls;
+    bytes_ += bytes;
+}
+
+void
+Bench::info (const char *info_fmt, ...)
+{
+    va_list ap;
+    printf ("%s:%s:%s:I: ", suite_.bench_suite_, suite_.bench_group_, bench_);
+    va_start (ap, info_fmt);
+    vprintf (info_fmt, ap);
+    va_end (ap);
+    putchar ('\n');
+}
+
+} // namespace ucoo
@@ -0,0 +1,99 @@
+#ifndef ucoo_base_test_bench_hh
+#define ucoo_base_test_bench_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/common.hh"
+
+namespace ucoo {
+
+/// Get a monotonic time stamp in nanoseconds, for benchmarks.  On ARM, this
+/// uses the cycle counter which must be polled at least once per wrap
+/// around period (about 25 s at 168 MHz).
+uint64_t
+bench_time_ns ();
+
+/// Benchmark suite context.
+///
+/// Results are reported on stdout, one line per benchmark, using the same
+/// layout as test results so that they can be parsed by the same tools:
+///
+///  suite:group:bench:B: calls=N bytes=N time_ns=N mbps=F calls_per_s=F
+///  p50_ns=N p99_ns=N
+class BenchSuite
+{
+  public:
+    /// Create a new benchmark suite.
+    BenchSuite (const char *bench_suite);
+    /// Enter a new benchmark group.
+    void group (const char *bench_group);
+  private:
+    friend class Bench;
+    /// Benchmark suite name.
+    const char *bench_suite_;
+    /// Benchmark group name.
+    const char *bench_group_;
+    /// Running a benchmark.
+    bool in_bench_;
+};
+
+/// Benchmark context, measure a series of timed calls.
+class Bench
+{
+  public:
+    /// Number of latency samples kept to compute percentiles.
+    static const int samples_nb = 256;
+  public:
+    /// Start a new benchmark, results are reported at object destruction.
+    Bench (BenchSuite &suite, const char *bench);
+    /// Stop benchmark and report.
+    ~Bench ();
+    /// Start a timed call.
+    void start () { start_ns_ = bench_time_ns (); }
+    /// Stop a timed call, giving the number of processed bytes if relevant.
+    void stop (int bytes = 0);
+    /// Account for processed bytes and calls measured out of start/stop.
+    void add (uint64_t time_ns, int calls, int bytes = 0);
+    /// Give extra information about the current benchmark.
+    void __attribute__ ((format (printf, 2, 3)))
+        info (const char *info_fmt, ...);
+  private:
+    /// Attached benchmark suite.
+    BenchSuite &suite_;
+    /// Benchmark name.
+    const char *bench_;
+    /// Time stamp of the current call start.
+    uint64_t start_ns_;
+    /// Total measured time.
+    uint64_t time_ns_;
+    /// Total number of calls.
+    uint32_t calls_;
+    /// Total number of bytes.
+    uint64_t bytes_;
+    /// Latency samples, used as a circular buffer, keep the last ones.
+    uint32_t samples_[samples_nb];
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_test_bench_hh
@@ -0,0 +1,53 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "bench.hh"
+
+#include "ucoo/arch/reg.hh"
+#include "ucoo/arch/rcc.stm32.hh"
+
+namespace ucoo {
+
+uint64_t
+bench_time_ns ()
+{
+    static bool enabled;
+    static uint32_t last;
+    static uint64_t high;
+    if (!enabled)
+    {
+        reg::CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        reg::DWT->CYCCNT = 0;
+        reg::DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+        enabled = true;
+    }
+    // Extend the 32 bit cycle counter.
+    uint32_t now = reg::DWT->CYCCNT;
+    if (now < last)
+        high += 1ull << 32;
+    last = now;
+    uint32_t hclock_mhz = rcc_ahb_freq_hz / 1000000;
+    return (high | now) * 1000 / hclock_mhz;
+}
+
+} // namespace ucoo
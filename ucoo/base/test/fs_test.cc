@@ -0,0 +1,71 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "fs_test.hh"
+
+#include <algorithm>
+
+namespace ucoo {
+
+bool
+test_fs_write (FileSystem &fs, const char *name, const char *data, int size,
+               int chunk)
+{
+    Stream *s = fs.open (name, FileSystem::Mode::WRITE);
+    if (!s)
+        return false;
+    bool ok = true;
+    for (int i = 0; ok && i < size; i += chunk)
+    {
+        int l = std::min (chunk, size - i);
+        ok = s->write (data + i, l) == l;
+    }
+    ok = ok && s->flush ();
+    fs.close (s);
+    return ok;
+}
+
+std::string
+test_fs_read (FileSystem &fs, const char *name)
+{
+    std::string content;
+    Stream *s = fs.open (name);
+    if (!s)
+        return "<none>";
+    char buf[100];
+    int r;
+    while ((r = s->read (buf, sizeof (buf))) > 0)
+        content.append (buf, r);
+    fs.close (s);
+    return r == -2 ? content : "<error>";
+}
+
+bool
+TestFsLister::add (const char *name, int name_size)
+{
+    names.append (name, name_size);
+    names += ' ';
+    return true;
+}
+
+} // namespace ucoo
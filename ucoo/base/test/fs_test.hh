@@ -0,0 +1,52 @@
+#ifndef ucoo_base_test_fs_test_hh
+#define ucoo_base_test_fs_test_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/intf/file_system.hh"
+
+#include <string>
+
+namespace ucoo {
+
+/// Write a file by chunks of CHUNK bytes, then flush it.  Return false on
+/// failure.
+bool
+test_fs_write (FileSystem &fs, const char *name, const char *data, int size,
+               int chunk);
+
+/// Read a file using the Stream interface only, return its content, or
+/// "<none>" if it can not be opened, or "<error>" on read error.
+std::string
+test_fs_read (FileSystem &fs, const char *name);
+
+/// Collect names given to a FileSystem::ListCallback, separated by spaces.
+struct TestFsLister
+{
+    std::string names;
+    bool add (const char *name, int name_size);
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_test_fs_test_hh
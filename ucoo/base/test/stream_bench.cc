@@ -0,0 +1,94 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "stream_bench.hh"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace ucoo {
+
+StreamBench::StreamBench (BenchSuite &suite, int bytes, int max_calls)
+    : suite_ (suite), bytes_ (bytes), max_calls_ (max_calls)
+{
+}
+
+void
+StreamBench::run (const char *name, Provider &provider)
+{
+    suite_.group (name);
+    for (Op op : { Op::WRITE, Op::READ })
+    {
+        for (bool block : { true, false })
+        {
+            for (int chunk = chunk_min; chunk <= chunk_max; chunk *= 2)
+                run (provider, op, block, chunk);
+        }
+    }
+}
+
+void
+StreamBench::run (Provider &provider, Op op, bool block, int chunk)
+{
+    Stream *s = provider.open (op);
+    if (!s)
+        return;
+    static char buf[chunk_max];
+    if (op == Op::WRITE)
+        std::fill (buf, buf + chunk, '.');
+    char name[32];
+    snprintf (name, sizeof (name), "%s:%s:%d",
+              op == Op::WRITE ? "write" : "read",
+              block ? "block" : "nonblock", chunk);
+    Bench bench (suite_, name);
+    s->block (block);
+    int bytes = 0;
+    for (int calls = 0; s && bytes < bytes_ && calls < max_calls_; calls++)
+    {
+        bench.start ();
+        int r = op == Op::WRITE ? s->write (buf, chunk) : s->read (buf, chunk);
+        bench.stop (std::max (r, 0));
+        if (r == -2)
+        {
+            // End of file, start again.
+            provider.close (s);
+            s = provider.open (op);
+            if (s)
+                s->block (block);
+        }
+        else if (r == -1)
+        {
+            bench.info ("error");
+            break;
+        }
+        else
+            bytes += r;
+    }
+    if (s)
+    {
+        s->block ();
+        provider.close (s);
+    }
+}
+
+} // namespace ucoo
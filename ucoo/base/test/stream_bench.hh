@@ -0,0 +1,76 @@
+#ifndef ucoo_base_test_stream_bench_hh
+#define ucoo_base_test_stream_bench_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/intf/stream.hh"
+
+namespace ucoo {
+
+/// Run a common benchmark matrix on any Stream: read and write, blocking
+/// and non blocking, using chunk sizes from 1 to 4096 bytes.
+///
+/// Benchmarks are named "op:mode:chunk", for example "write:block:64".
+class StreamBench
+{
+  public:
+    /// Benchmarked operation.
+    enum class Op { READ, WRITE };
+    /// Streams under benchmark are provided by this interface.
+    class Provider
+    {
+      public:
+        /// Destructor.
+        virtual ~Provider () { }
+        /// Open a stream for the given operation, return nullptr if this
+        /// operation is not supported.
+        virtual Stream *open (Op op) = 0;
+        /// Release a stream when a benchmark is done, or on end of file.
+        virtual void close (Stream *stream) { }
+    };
+    /// Smallest chunk size.
+    static const int chunk_min = 1;
+    /// Largest chunk size.
+    static const int chunk_max = 4096;
+  public:
+    /// Constructor, BYTES is the amount of data to transfer for each
+    /// benchmark and MAX_CALLS limits the number of calls.
+    StreamBench (BenchSuite &suite, int bytes = 64 * 1024,
+                 int max_calls = 16 * 1024);
+    /// Run the whole matrix, using the given group name.
+    void run (const char *name, Provider &provider);
+    /// Run one benchmark.
+    void run (Provider &provider, Op op, bool block, int chunk);
+  private:
+    /// Benchmark suite used to report results.
+    BenchSuite &suite_;
+    /// Amount of data to transfer for each benchmark.
+    int bytes_;
+    /// Maximum number of calls for each benchmark.
+    int max_calls_;
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_test_stream_bench_hh
@@ -0,0 +1,100 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "stream_test.hh"
+
+#include <algorithm>
+
+namespace ucoo {
+
+TestChunkStream::TestChunkStream (const char *data, int size, int chunk,
+                                  char *out/*nullptr*/, int out_size/*0*/)
+    : writes (0), data_ (data), size_ (size), chunk_ (chunk), out_ (out),
+      out_size_ (out_size), written_ (0)
+{
+}
+
+int
+TestChunkStream::read (char *buf, int count)
+{
+    int r = std::min (std::min (count, chunk_), size_);
+    std::copy (data_, data_ + r, buf);
+    data_ += r;
+    size_ -= r;
+    return r;
+}
+
+int
+TestChunkStream::write (const char *buf, int count)
+{
+    int r = std::min (count, room ());
+    std::copy (buf, buf + r, out_ + written_);
+    written_ += r;
+    writes++;
+    return count;
+}
+
+int
+TestChunkStream::poll ()
+{
+    return size_;
+}
+
+std::string
+TestChunkStream::output () const
+{
+    return std::string (out_, written_);
+}
+
+TestMemStream::TestMemStream ()
+    : read_ (0), write_ (0)
+{
+}
+
+int
+TestMemStream::read (char *buf, int count)
+{
+    int r = std::min (count, write_ - read_);
+    if (r == 0)
+        return block_ ? -2 : 0;
+    std::copy (buf_ + read_, buf_ + read_ + r, buf);
+    read_ += r;
+    return r;
+}
+
+int
+TestMemStream::write (const char *buf, int count)
+{
+    int r = std::min (count, room ());
+    std::copy (buf, buf + r, buf_ + write_);
+    write_ += r;
+    return r;
+}
+
+int
+TestMemStream::poll ()
+{
+    return write_ - read_;
+}
+
+} // namespace ucoo
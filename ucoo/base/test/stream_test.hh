@@ -0,0 +1,94 @@
+#ifndef ucoo_base_test_stream_test_hh
+#define ucoo_base_test_stream_test_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/intf/stream.hh"
+
+#include <string>
+
+namespace ucoo {
+
+/// Stream returning data from a buffer, in chunks of limited size, and
+/// writing to a separate output buffer.
+class TestChunkStream : public Stream
+{
+  public:
+    /// Constructor, DATA is read by chunks of at most CHUNK bytes, written
+    /// data is stored in OUT, which can receive OUT_SIZE bytes.
+    TestChunkStream (const char *data, int size, int chunk,
+                     char *out = nullptr, int out_size = 0);
+    /// See Stream::read.
+    int read (char *buf, int count) override;
+    /// See Stream::write.  Data which does not fit in output buffer is
+    /// dropped.
+    int write (const char *buf, int count) override;
+    /// See Stream::poll.  Return number of bytes left to read.
+    int poll () override;
+    /// Return free space in output buffer.
+    int room () const { return out_size_ - written_; }
+    /// Return written data which fit in output buffer.
+    std::string output () const;
+    /// Forget written data.
+    void clear () { written_ = 0; }
+  public:
+    /// Number of write calls.
+    int writes;
+  private:
+    const char *data_;
+    int size_;
+    int chunk_;
+    char *out_;
+    int out_size_;
+    int written_;
+};
+
+/// Stream reading and writing to a memory buffer, written data can then be
+/// read back.
+class TestMemStream : public Stream
+{
+  public:
+    /// Constructor, empty buffer.
+    TestMemStream ();
+    /// See Stream::read.
+    int read (char *buf, int count) override;
+    /// See Stream::write.  Only write what fits in buffer.
+    int write (const char *buf, int count) override;
+    /// See Stream::poll.
+    int poll () override;
+    /// Return written data.
+    const char *data () const { return buf_; }
+    /// Return number of written bytes.
+    int written () const { return write_; }
+    /// Return free space in buffer.
+    int room () const { return sizeof (buf_) - write_; }
+    /// Forget all data.
+    void clear () { read_ = write_ = 0; }
+  private:
+    int read_, write_;
+    char buf_[16384];
+};
+
+} // namespace ucoo
+
+#endif // ucoo_base_test_stream_test_hh
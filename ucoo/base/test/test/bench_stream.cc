@@ -0,0 +1,178 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/base/test/stream_bench.hh"
+#include "ucoo/base/test/test.hh"
+#include "ucoo/base/fs/romfs/romfs.hh"
+#include "ucoo/base/stdio/stdio.hh"
+#include "ucoo/arch/arch.hh"
+
+#ifdef TARGET_host
+# include "ucoo/arch/host/host_stream.hh"
+# include <fcntl.h>
+#endif
+
+#include "bench_fs.h"
+
+#include <cstdio>
+
+/// Stream on top of a stdio file, used to benchmark fstreamopen.
+class FileStream : public ucoo::Stream
+{
+  public:
+    FileStream (ucoo::Stream &stream)
+        : stream_ (stream), file_ (ucoo::fstreamopen (stream, "r+"))
+    {
+        ucoo::assert (file_);
+    }
+    ~FileStream () { fclose (file_); }
+    void block (bool block = true) override
+    {
+        Stream::block (block);
+        stream_.block (block);
+    }
+    int read (char *buf, int count) override
+    {
+        int r = fread (buf, 1, count, file_);
+        if (r == 0 && feof (file_))
+            return -2;
+        clearerr (file_);
+        return r;
+    }
+    int write (const char *buf, int count) override
+    {
+        return fwrite (buf, 1, count, file_);
+    }
+    int poll () override { return stream_.poll (); }
+  private:
+    ucoo::Stream &stream_;
+    FILE *file_;
+};
+
+/// Provide always the same stream.
+class SingleProvider : public ucoo::StreamBench::Provider
+{
+  public:
+    SingleProvider (ucoo::Stream *read, ucoo::Stream *write)
+        : read_ (read), write_ (write) { }
+    ucoo::Stream *open (ucoo::StreamBench::Op op) override
+    {
+        return op == ucoo::StreamBench::Op::READ ? read_ : write_;
+    }
+  private:
+    ucoo::Stream *read_, *write_;
+};
+
+/// Provide streams from a ROM file system.
+class RomFSProvider : public ucoo::StreamBench::Provider
+{
+  public:
+    RomFSProvider (ucoo::RomFS &romfs, const char *filename)
+        : romfs_ (romfs), filename_ (filename) { }
+    ucoo::Stream *open (ucoo::StreamBench::Op op) override
+    {
+        if (op == ucoo::StreamBench::Op::READ)
+            return romfs_.open (filename_);
+        else
+            return nullptr;
+    }
+    void close (ucoo::Stream *stream) override
+    {
+        romfs_.close (stream);
+    }
+  private:
+    ucoo::RomFS &romfs_;
+    const char *filename_;
+};
+
+/// Measure formatted output through fstreamopen.
+static void
+bench_fprintf (ucoo::BenchSuite &bsuite, ucoo::Stream &stream,
+               const char *name, ucoo::StdioBuffering buffering,
+               char *buf = nullptr, int size = 0)
+{
+    FILE *file = ucoo::fstreamopen (stream, "w", buffering, buf, size);
+    ucoo::assert (file);
+    {
+        ucoo::Bench bench (bsuite, name);
+        for (int i = 0; i < 1000; i++)
+        {
+            bench.start ();
+            int r = fprintf (file, "x=%d y=%d %s\n", i, -i, "ok");
+            bench.stop (r);
+        }
+        // Account for final flush.
+        bench.start ();
+        fclose (file);
+        bench.stop ();
+    }
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("stream");
+    ucoo::StreamBench sbench (bsuite);
+#ifdef TARGET_host
+    // Read from /dev/zero, write to /dev/null, this measures the call
+    // overhead.
+    ucoo::HostStream host (open ("/dev/zero", O_RDONLY),
+                           open ("/dev/null", O_WRONLY));
+    ucoo::Stream &stream = host;
+    const char *stream_name = "HostStream";
+    const bool readable = true;
+#else
+    // Only write to test stream, reading would need a cooperating peer.
+    ucoo::Stream &stream = ucoo::test_stream ();
+    const char *stream_name = "test_stream";
+    const bool readable = false;
+#endif
+    {
+        SingleProvider provider (readable ? &stream : nullptr, &stream);
+        sbench.run (stream_name, provider);
+    }
+    {
+        ucoo::RomFS romfs (bench_fs, sizeof (bench_fs));
+        RomFSProvider provider (romfs, "test_test.cc");
+        sbench.run ("RomFSStream", provider);
+    }
+    {
+        FileStream file (stream);
+        SingleProvider provider (readable ? &file : nullptr, &file);
+        sbench.run ("fstreamopen", provider);
+    }
+    {
+        static char buf[256];
+        bsuite.group ("fprintf");
+        bench_fprintf (bsuite, stream, "default",
+                       ucoo::StdioBuffering::DEFAULT);
+        bench_fprintf (bsuite, stream, "none", ucoo::StdioBuffering::NONE);
+        bench_fprintf (bsuite, stream, "line", ucoo::StdioBuffering::LINE,
+                       buf, sizeof (buf));
+        bench_fprintf (bsuite, stream, "full", ucoo::StdioBuffering::FULL,
+                       buf, sizeof (buf));
+    }
+    return 0;
+}
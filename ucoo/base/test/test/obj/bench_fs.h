@@ -0,0 +1,123 @@
+/* Auto-generated ROM FS from:
+ *  - test_test.cc
+ */
+
+static const uint32_t bench_fs[] = {
+    0x466d6f52, 0x00000001, 0x00000000, 0x0000000c,
+    0x00000713, 0x74736574, 0x7365745f, 0x63632e74,
+    0x75202f2f, 0x6c6f6f63, 0x2d206269, 0x63694d20,
+    0x6f636f72, 0x6f72746e, 0x72656c6c, 0x6a626f20,
+    0x20746365, 0x6569726f, 0x6465746e, 0x62696c20,
+    0x79726172, 0x7b7b202e, 0x2f2f0a7b, 0x202f2f0a,
+    0x79706f43, 0x68676972, 0x43282074, 0x30322029,
+    0x4e203231, 0x6c6f6369, 0x53207361, 0x646f6863,
+    0x2f0a7465, 0x2f2f0a2f, 0x72655020, 0x7373696d,
+    0x206e6f69, 0x68207369, 0x62657265, 0x72672079,
+    0x65746e61, 0x66202c64, 0x20656572, 0x6320666f,
+    0x67726168, 0x74202c65, 0x6e61206f, 0x65702079,
+    0x6e6f7372, 0x74626f20, 0x696e6961, 0x6120676e,
+    0x202f2f0a, 0x79706f63, 0x20666f20, 0x73696874,
+    0x666f7320, 0x72617774, 0x6e612065, 0x73612064,
+    0x69636f73, 0x64657461, 0x636f6420, 0x6e656d75,
+    0x69746174, 0x66206e6f, 0x73656c69, 0x68742820,
+    0x53222065, 0x7774666f, 0x22657261, 0x2f0a2c29,
+    0x6f74202f, 0x61656420, 0x6e69206c, 0x65687420,
+    0x666f5320, 0x72617774, 0x69772065, 0x756f6874,
+    0x65722074, 0x69727473, 0x6f697463, 0x69202c6e,
+    0x756c636e, 0x676e6964, 0x74697720, 0x74756f68,
+    0x6d696c20, 0x74617469, 0x0a6e6f69, 0x74202f2f,
+    0x72206568, 0x74686769, 0x6f742073, 0x65737520,
+    0x6f63202c, 0x202c7970, 0x69646f6d, 0x202c7966,
+    0x6772656d, 0x70202c65, 0x696c6275, 0x202c6873,
+    0x74736964, 0x75626972, 0x202c6574, 0x6c627573,
+    0x6e656369, 0x0a2c6573, 0x61202f2f, 0x6f2f646e,
+    0x65732072, 0x63206c6c, 0x6569706f, 0x666f2073,
+    0x65687420, 0x666f5320, 0x72617774, 0x61202c65,
+    0x7420646e, 0x6570206f, 0x74696d72, 0x72657020,
+    0x736e6f73, 0x206f7420, 0x6d6f6877, 0x65687420,
+    0x202f2f0a, 0x74666f53, 0x65726177, 0x20736920,
+    0x6e727566, 0x65687369, 0x6f742064, 0x206f6420,
+    0x202c6f73, 0x6a627573, 0x20746365, 0x74206f74,
+    0x66206568, 0x6f6c6c6f, 0x676e6977, 0x6e6f6320,
+    0x69746964, 0x3a736e6f, 0x0a2f2f0a, 0x54202f2f,
+    0x61206568, 0x65766f62, 0x706f6320, 0x67697279,
+    0x6e207468, 0x6369746f, 0x6e612065, 0x68742064,
+    0x70207369, 0x696d7265, 0x6f697373, 0x6f6e206e,
+    0x65636974, 0x61687320, 0x62206c6c, 0x6e692065,
+    0x64756c63, 0x69206465, 0x2f2f0a6e, 0x6c6c6120,
+    0x706f6320, 0x20736569, 0x7320726f, 0x74736275,
+    0x69746e61, 0x70206c61, 0x6974726f, 0x20736e6f,
+    0x7420666f, 0x53206568, 0x7774666f, 0x2e657261,
+    0x0a2f2f0a, 0x54202f2f, 0x53204548, 0x5754464f,
+    0x20455241, 0x50205349, 0x49564f52, 0x20444544,
+    0x20534122, 0x2c225349, 0x54495720, 0x54554f48,
+    0x52415720, 0x544e4152, 0x464f2059, 0x594e4120,
+    0x4e494b20, 0x45202c44, 0x45525058, 0x4f205353,
+    0x2f2f0a52, 0x504d4920, 0x4445494c, 0x4e49202c,
+    0x44554c43, 0x20474e49, 0x20545542, 0x20544f4e,
+    0x494d494c, 0x20444554, 0x54204f54, 0x57204548,
+    0x41525241, 0x4549544e, 0x464f2053, 0x52454d20,
+    0x4e414843, 0x49424154, 0x5954494c, 0x2f2f0a2c,
+    0x54494620, 0x5353454e, 0x524f4620, 0x50204120,
+    0x49545241, 0x414c5543, 0x55502052, 0x534f5052,
+    0x4e412045, 0x4f4e2044, 0x464e494e, 0x474e4952,
+    0x4e454d45, 0x49202e54, 0x4f4e204e, 0x45564520,
+    0x5320544e, 0x4c4c4148, 0x45485420, 0x202f2f0a,
+    0x48545541, 0x2053524f, 0x4320524f, 0x5259504f,
+    0x54484749, 0x4c4f4820, 0x53524544, 0x20454220,
+    0x4241494c, 0x4620454c, 0x4120524f, 0x4320594e,
+    0x4d49414c, 0x4144202c, 0x4547414d, 0x524f2053,
+    0x48544f20, 0x2f0a5245, 0x494c202f, 0x4c494241,
+    0x2c595449, 0x45485720, 0x52454854, 0x204e4920,
+    0x41204e41, 0x4f495443, 0x464f204e, 0x4e4f4320,
+    0x43415254, 0x54202c54, 0x2054524f, 0x4f20524f,
+    0x52454854, 0x45534957, 0x5241202c, 0x4e495349,
+    0x2f2f0a47, 0x4f524620, 0x4f202c4d, 0x4f205455,
+    0x524f2046, 0x204e4920, 0x4e4e4f43, 0x49544345,
+    0x57204e4f, 0x20485449, 0x20454854, 0x54464f53,
+    0x45524157, 0x20524f20, 0x20454854, 0x20455355,
+    0x4f20524f, 0x52454854, 0x202f2f0a, 0x4c414544,
+    0x53474e49, 0x204e4920, 0x20454854, 0x54464f53,
+    0x45524157, 0x2f2f0a2e, 0x202f2f0a, 0x0a7d7d7d,
+    0x636e6923, 0x6564756c, 0x63752220, 0x622f6f6f,
+    0x2f657361, 0x74736574, 0x7365742f, 0x68682e74,
+    0x69230a22, 0x756c636e, 0x22206564, 0x6f6f6375,
+    0x6372612f, 0x72612f68, 0x682e6863, 0x0a0a2268,
+    0x0a746e69, 0x6e69616d, 0x6e692820, 0x72612074,
+    0x202c6367, 0x736e6f63, 0x68632074, 0x2a207261,
+    0x6772612a, 0x7b0a2976, 0x2020200a, 0x6f637520,
+    0x613a3a6f, 0x5f686372, 0x74696e69, 0x72612820,
+    0x202c6367, 0x76677261, 0x200a3b29, 0x75202020,
+    0x3a6f6f63, 0x7365543a, 0x69755374, 0x74206574,
+    0x5f747365, 0x74697573, 0x22282065, 0x74736574,
+    0x7365745f, 0x3b292274, 0x2020200a, 0x202f2f20,
+    0x6c616552, 0x202c796c, 0x74616877, 0x64206120,
+    0x20626d75, 0x74736574, 0x20200a21, 0x65742020,
+    0x735f7473, 0x65746975, 0x6f72672e, 0x28207075,
+    0x6f726722, 0x6f207075, 0x2922656e, 0x20200a3b,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x6f6f6375,
+    0x65543a3a, 0x74207473, 0x20747365, 0x73657428,
+    0x75735f74, 0x2c657469, 0x68742220, 0x69662065,
+    0x20747372, 0x74736574, 0x0a3b2922, 0x20202020,
+    0x20202020, 0x74736574, 0x6961662e, 0x2228206c,
+    0x6e20684f, 0x7420216f, 0x20747365, 0x22216425,
+    0x3231202c, 0x0a3b2933, 0x20202020, 0x20200a7d,
+    0x0a7b2020, 0x20202020, 0x20202020, 0x6f6f6375,
+    0x65543a3a, 0x74207473, 0x20747365, 0x73657428,
+    0x75735f74, 0x2c657469, 0x72742220, 0x67612079,
+    0x226e6961, 0x200a3b29, 0x20202020, 0x74202020,
+    0x2e747365, 0x6f666e69, 0x77222820, 0x696b726f,
+    0x6820676e, 0x65647261, 0x2e2e2e72, 0x0a3b2922,
+    0x20202020, 0x20200a7d, 0x65742020, 0x735f7473,
+    0x65746975, 0x6f72672e, 0x28207075, 0x6f726722,
+    0x74207075, 0x29226f77, 0x20200a3b, 0x0a7b2020,
+    0x20202020, 0x20202020, 0x6f6f6375, 0x65543a3a,
+    0x74207473, 0x20747365, 0x73657428, 0x75735f74,
+    0x2c657469, 0x69732220, 0x656c706d, 0x73657420,
+    0x3b292274, 0x2020200a, 0x200a7d20, 0x72202020,
+    0x72757465, 0x6574206e, 0x735f7473, 0x65746975,
+    0x7065722e, 0x2074726f, 0x3f202928, 0x3a203020,
+    0x0a3b3120, 0x000a0a7d,
+};
+
+static const int bench_fs_size = sizeof (bench_fs);
\ No newline at end of file
@@ -23,6 +23,7 @@
 // }}}
 #include "adc.host.hh"
 
+#include <map>
 #include <string>
 
 namespace ucoo {
@@ -66,9 +67,8 @@ AdcHostShared::register_instance (Host &host, AdcHost &instance,
 void
 AdcHostShared::handle_adc_channel (mex::Msg &msg)
 {
-    int ivalue, namelen;
-    msg.pop ("l") >> ivalue;
-    namelen = msg.len ();
+    int32_t ivalue = std::get<0> (msg.pop<int32_t> ());
+    int namelen = msg.len ();
     std::string name (msg.pop (namelen), namelen);
     Instances::iterator i = instances_.find (name);
     assert (i != instances_.end ());
@@ -0,0 +1,11 @@
+#ifndef obj_config_ucoo_base_test_hh
+#define obj_config_ucoo_base_test_hh
+// Generated from configuration.
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_USB_INSTANCE (UsbDriverDwcOtg::Instance::OTG_FS)
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_UART_SPEED (115200)
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_UART_INSTANCE (Uart::Instance::USART1)
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_USB_VENDOR (u"APBTeam")
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_USE_USB (true)
+#define CONFIG_UCOO_BASE_TEST_TEST_STREAM_USB_PRODUCT (u"test")
+#define CONFIG_UCOO_BASE_TEST_WAIT (false)
+#endif
@@ -24,6 +24,7 @@
 #include "gpio.host.hh"
 
 #include <cstring>
+#include <map>
 
 namespace ucoo {
 
@@ -95,7 +96,8 @@ void
 GpioShared::send (Gpio &instance)
 {
     mex::Msg msg (gpio_output_mtype_);
-    msg.push ("BB") << instance.direction_output_ << instance.output_;
+    msg.push<uint8_t, uint8_t> (instance.direction_output_,
+                                instance.output_);
     msg.push (instance.name_, std::strlen (instance.name_));
     node_.send (msg);
 }
@@ -103,9 +105,8 @@ GpioShared::send (Gpio &instance)
 void
 GpioShared::handle_gpio_input (mex::Msg &msg)
 {
-    int input, namelen;
-    msg.pop ("B") >> input;
-    namelen = msg.len ();
+    uint8_t input = std::get<0> (msg.pop<uint8_t> ());
+    int namelen = msg.len ();
     std::string name (msg.pop (namelen), namelen);
     Instances::iterator i = instances_.find (name);
     assert (i != instances_.end ());
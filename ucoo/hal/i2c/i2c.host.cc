@@ -37,8 +37,12 @@ class I2cHostShared
     void register_instance (Host &host, I2cHost &instance);
     /// Send message, return new master status.
     int send (uint8_t addr, const char *buf, int count);
-    /// Receive message, return new master status.
-    int recv (uint8_t addr, char *buf, int count);
+    /// Receive message for INSTANCE, return new master status.  If the
+    /// slave is not in this program, a request is sent and STATUS_BUSY is
+    /// returned, the instance is updated once the response is received.
+    int recv (I2cHost &instance, uint8_t addr, char *buf, int count);
+    /// Wait until response to request REQ is received.
+    void wait (int req);
     /// Handle read requests from master.
     void handle_read (mex::Msg &msg);
     /// Handle write requests from master.
@@ -84,14 +88,14 @@ I2cHostShared::send (uint8_t addr, const char *buf, int count)
     }
     // Else, send message.
     mex::Msg msg (write_mtype_);
-    msg.push ("B") << addr;
+    msg.push<uint8_t> (addr);
     msg.push (buf, count);
     node_.send (msg);
     return count;
 }
 
 int
-I2cHostShared::recv (uint8_t addr, char *buf, int count)
+I2cHostShared::recv (I2cHost &instance, uint8_t addr, char *buf, int count)
 {
     // Test for this slave in the same program.
     for (Instances::const_iterator i = instances_.begin ();
@@ -103,23 +107,28 @@ I2cHostShared::recv (uint8_t addr, char *buf, int count)
             return (*i)->slave_data_handler_->to_send (buf, count);
         }
     }
-    // Else, send request and wait for response.
+    // Else, send request, response is handled by the instance, so that
+    // several buses can have a transfer in flight.
     mex::Msg msg (read_mtype_);
-    msg.push ("BB") << addr << count;
-    std::auto_ptr<mex::Msg> rsp = node_.request (msg);
-    int rcount = rsp->len ();
-    assert (rcount <= count);
-    const char *rbuf = rsp->pop (rcount);
-    std::copy (rbuf, rbuf + rcount, buf);
-    return rcount;
+    msg.push<uint8_t, uint8_t> (addr, count);
+    instance.recv_buf_ = buf;
+    instance.recv_count_ = count;
+    instance.recv_req_ = node_.request_async (msg, instance,
+                                              &I2cHost::handle_recv);
+    return I2cMaster::STATUS_BUSY;
+}
+
+void
+I2cHostShared::wait (int req)
+{
+    node_.request_wait (req);
 }
 
 void
 I2cHostShared::handle_read (mex::Msg &msg)
 {
-    uint8_t addr;
-    int size;
-    msg.pop ("BB") >> addr >> size;
+    uint8_t addr, size;
+    std::tie (addr, size) = msg.pop<uint8_t, uint8_t> ();
     for (Instances::const_iterator i = instances_.begin ();
          i != instances_.end (); ++i)
     {
@@ -139,8 +148,7 @@ I2cHostShared::handle_read (mex::Msg &msg)
 void
 I2cHostShared::handle_write (mex::Msg &msg)
 {
-    uint8_t addr;
-    msg.pop ("B") >> addr;
+    uint8_t addr = std::get<0> (msg.pop<uint8_t> ());
     for (Instances::const_iterator i = instances_.begin ();
          i != instances_.end (); ++i)
     {
@@ -158,7 +166,8 @@ I2cHostShared *I2cHost::shared_;
 
 I2cHost::I2cHost (Host &host, int n)
     : n_ (n), slave_addr_ (0), slave_data_handler_ (0),
-      master_status_ (STATUS_ERROR)
+      master_status_ (STATUS_ERROR),
+      recv_buf_ (nullptr), recv_count_ (0), recv_req_ (-1)
 {
     if (!shared_)
     {
@@ -173,6 +182,7 @@ I2cHost::I2cHost (Host &host, int n)
 void
 I2cHost::send (uint8_t addr, const char *buf, int count)
 {
+    assert (master_status_ != STATUS_BUSY);
     // Update status, there is no background task.
     master_status_ = shared_->send (addr, buf, count);
     // If needed, call callback.
@@ -183,10 +193,12 @@ I2cHost::send (uint8_t addr, const char *buf, int count)
 void
 I2cHost::recv (uint8_t addr, char *buf, int count)
 {
-    // Update status, there is no background task.
-    master_status_ = shared_->recv (addr, buf, count);
+    assert (master_status_ != STATUS_BUSY);
+    // Update status, transfer may be finished later if the slave is not
+    // in this program.
+    master_status_ = shared_->recv (*this, addr, buf, count);
     // If needed, call callback.
-    if (finished_handler_)
+    if (master_status_ != STATUS_BUSY && finished_handler_)
         finished_handler_->finished (master_status_);
 }
 
@@ -215,10 +227,26 @@ I2cHost::status ()
 int
 I2cHost::wait ()
 {
-    // Transfers are immediate.
+    // Only remote receptions are not immediate.
+    if (master_status_ == STATUS_BUSY)
+        shared_->wait (recv_req_);
     return status ();
 }
 
+void
+I2cHost::handle_recv (mex::Msg &rsp)
+{
+    int rcount = rsp.len ();
+    assert (rcount <= recv_count_);
+    const char *rbuf = rsp.pop (rcount);
+    std::copy (rbuf, rbuf + rcount, recv_buf_);
+    recv_req_ = -1;
+    master_status_ = rcount;
+    // If needed, call callback.
+    if (finished_handler_)
+        finished_handler_->finished (master_status_);
+}
+
 void
 I2cHost::register_data (uint8_t addr, DataHandler &data_handler)
 {
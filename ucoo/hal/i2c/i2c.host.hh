@@ -50,6 +50,8 @@ class I2cHost : public I2c
     /// See I2cSlave::register_data.
     void register_data (uint8_t addr, DataHandler &data_handler);
   private:
+    /// Handle response to a remote reception.
+    void handle_recv (mex::Msg &rsp);
     /// I2C number.
     int n_;
     /// Slave address.
@@ -58,6 +60,12 @@ class I2cHost : public I2c
     DataHandler *slave_data_handler_;
     /// Current master transfer status.
     int master_status_;
+    /// Reception buffer, while waiting for a remote response.
+    char *recv_buf_;
+    /// Reception buffer size.
+    int recv_count_;
+    /// Pending remote reception request, or -1.
+    int recv_req_;
     /// Shared context.
     static I2cHostShared *shared_;
     friend class I2cHostShared;
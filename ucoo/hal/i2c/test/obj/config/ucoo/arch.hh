@@ -0,0 +1,5 @@
+#ifndef obj_config_ucoo_arch_hh
+#define obj_config_ucoo_arch_hh
+// Generated from configuration.
+#define CONFIG_UCOO_ARCH_SUPPLY_RANGE (UNUSED)
+#endif
@@ -0,0 +1,6 @@
+#ifndef obj_config_ucoo_hal_i2c_hh
+#define obj_config_ucoo_hal_i2c_hh
+// Generated from configuration.
+#define CONFIG_UCOO_HAL_I2C_TRACE (false)
+#define CONFIG_UCOO_HAL_I2C_SLAVE_BUFFER_SIZE (64)
+#endif
@@ -43,6 +43,11 @@ self_programming_erase (uint32_t addr, int count);
 void
 self_programming_write (uint32_t addr, const char *buf, int count);
 
+/// Return a pointer to read flash content at given address.  On target,
+/// flash is memory mapped and this is the address itself.
+const char *
+self_programming_map (uint32_t addr);
+
 } // namespace ucoo
 
 #endif // ucoo_hal_self_programming_self_programming_hh
@@ -0,0 +1,323 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/hal/self_programming/self_programming.host.hh"
+#include "ucoo/common.hh"
+
+#include "config/ucoo/hal/self_programming.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace ucoo {
+
+/// STM32F4 sectors sizes for one bank, in KB.
+static const int stm32f4_sectors_kb[] = {
+    16, 16, 16, 16, 64, 128, 128, 128, 128, 128, 128, 128 };
+
+/// Current layout.
+static SelfProgrammingHostLayout flash_layout;
+
+/// Emulated flash memory, or nullptr if not setup yet.
+static char *flash;
+
+/// Emulated flash size.
+static int flash_size;
+
+/// Offset of each sector, plus flash size.
+static std::vector<uint32_t> flash_sectors;
+
+/// Number of erase cycles for each sector.
+static std::vector<int> flash_erase_counts;
+
+/// Modelled timings.
+static int flash_erase_ns_per_kb, flash_write_ns_per_word;
+
+/// Wait for modelled time?
+static bool flash_sleep = CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_SLEEP;
+
+/// Total modelled time.
+static uint64_t flash_busy_ns;
+
+/// Total number of programmed bytes.
+static int flash_programmed;
+
+/// Remaining bytes to program before power loss, or negative if powered.
+static int flash_power_cut = -1;
+
+/// Make sure flash is setup, using configuration.
+static void
+flash_init ()
+{
+    if (!flash)
+        self_programming_host_setup (
+            CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_LAYOUT == 4
+            ? SelfProgrammingHostLayout::STM32F4
+            : SelfProgrammingHostLayout::STM32F1,
+            CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_FLASH_SIZE,
+            CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_ERASE_SIZE,
+            CONFIG_UCOO_HAL_SELF_PROGRAMMING_HOST_FILE);
+}
+
+/// Map flash memory, from a file or anonymous memory.
+static char *
+flash_map (int size, const char *filename)
+{
+    void *p;
+    bool erase = true;
+    if (filename && filename[0])
+    {
+        int fd = open (filename, O_RDWR | O_CREAT, 0666);
+        if (fd == -1)
+            halt_perror ();
+        struct stat st;
+        if (fstat (fd, &st) == -1)
+            halt_perror ();
+        erase = st.st_size != size;
+        if (erase && ftruncate (fd, size) == -1)
+            halt_perror ();
+        p = mmap (nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close (fd);
+    }
+    else
+        p = mmap (nullptr, size, PROT_READ | PROT_WRITE,
+                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED)
+        halt_perror ();
+    if (erase)
+        std::memset (p, 0xff, size);
+    return static_cast<char *> (p);
+}
+
+/// Find sector index from offset, which must be a sector start.
+static int
+flash_sector (uint32_t offset)
+{
+    auto it = std::lower_bound (flash_sectors.begin (),
+                                flash_sectors.end () - 1, offset);
+    assert (it != flash_sectors.end () - 1 && *it == offset);
+    return it - flash_sectors.begin ();
+}
+
+/// Account for modelled time, and wait if requested.
+static void
+flash_busy (uint64_t ns)
+{
+    flash_busy_ns += ns;
+    if (flash_sleep && ns)
+    {
+        struct timespec ts;
+        ts.tv_sec = ns / 1000000000;
+        ts.tv_nsec = ns % 1000000000;
+        while (nanosleep (&ts, &ts) == -1 && errno == EINTR)
+            ;
+    }
+}
+
+void
+self_programming_host_setup (SelfProgrammingHostLayout layout,
+                             int size, int page_size/*2048*/,
+                             const char *filename/*nullptr*/)
+{
+    if (flash)
+        munmap (flash, flash_size);
+    flash_layout = layout;
+    flash_size = size;
+    flash_sectors.clear ();
+    uint32_t offset = 0;
+    switch (flash_layout)
+    {
+    case SelfProgrammingHostLayout::STM32F1:
+        assert (page_size == 1024 || page_size == 2048);
+        for (; static_cast<int> (offset) < flash_size; offset += page_size)
+            flash_sectors.push_back (offset);
+        // Typical: 20 ms per 2 KB page, 52.5 us per half word.
+        self_programming_host_timings (10000000, 105000, flash_sleep);
+        break;
+    case SelfProgrammingHostLayout::STM32F4:
+        for (int bank = 0; bank < 2; bank++)
+        {
+            for (int kb : stm32f4_sectors_kb)
+            {
+                if (static_cast<int> (offset) >= flash_size)
+                    break;
+                flash_sectors.push_back (offset);
+                offset += kb * 1024;
+            }
+        }
+        // Typical: 1 s per 128 KB sector, 16 us per byte.
+        self_programming_host_timings (8000000, 64000, flash_sleep);
+        break;
+    default:
+        assert_unreachable ();
+    }
+    // Flash size must end on a sector boundary.
+    assert (static_cast<int> (offset) == flash_size);
+    flash_sectors.push_back (offset);
+    flash_erase_counts.assign (flash_sectors.size () - 1, 0);
+    flash = flash_map (flash_size, filename);
+    flash_busy_ns = 0;
+    flash_programmed = 0;
+}
+
+void
+self_programming_host_timings (int erase_ns_per_kb, int write_ns_per_word,
+                               bool sleep/*false*/)
+{
+    flash_erase_ns_per_kb = erase_ns_per_kb;
+    flash_write_ns_per_word = write_ns_per_word;
+    flash_sleep = sleep;
+}
+
+uint64_t
+self_programming_host_busy_ns ()
+{
+    return flash_busy_ns;
+}
+
+int
+self_programming_flash_size ()
+{
+    flash_init ();
+    return flash_size;
+}
+
+int
+self_programming_erase_size (uint32_t addr)
+{
+    flash_init ();
+    int sector = flash_sector (addr - self_programming_host_base);
+    return flash_sectors[sector + 1] - flash_sectors[sector];
+}
+
+void
+self_programming_erase (uint32_t addr, int count)
+{
+    flash_init ();
+    uint32_t offset = addr - self_programming_host_base;
+    assert (static_cast<int> (offset + count) <= flash_size);
+    int sector = flash_sector (offset);
+    while (count > 0)
+    {
+        int size = flash_sectors[sector + 1] - flash_sectors[sector];
+        if (flash_power_cut != 0)
+        {
+            std::memset (flash + offset, 0xff, size);
+            flash_erase_counts[sector]++;
+            flash_busy (static_cast<uint64_t> (flash_erase_ns_per_kb)
+                        * size / 1024);
+        }
+        offset += size;
+        count -= size;
+        sector++;
+    }
+    // Must end on a sector boundary.
+    assert (count == 0);
+}
+
+void
+self_programming_write (uint32_t addr, const char *buf, int count)
+{
+    flash_init ();
+    uint32_t offset = addr - self_programming_host_base;
+    // Same constraints as target code.
+    int align = flash_layout == SelfProgrammingHostLayout::STM32F1 ? 2 : 4;
+    assert (addr % align == 0);
+    assert (reinterpret_cast<uintptr_t> (buf) % align == 0);
+    assert (count % align == 0);
+    assert (static_cast<int> (offset + count) <= flash_size);
+    if (flash_power_cut >= 0)
+    {
+        count = std::min (count, flash_power_cut);
+        flash_power_cut -= count;
+    }
+    // Flash must be erased before being programmed, except when clearing
+    // it, which is allowed by hardware and used to invalidate data.  On
+    // STM32F1, this is checked for each half word.
+    int unit = flash_layout == SelfProgrammingHostLayout::STM32F1 ? 2 : 1;
+    for (int i = 0; i < count; i += unit)
+    {
+        bool erased = true, clear = true;
+        for (int j = i; j < i + unit; j++)
+        {
+            erased = erased && flash[offset + j] == '\xff';
+            clear = clear && buf[j] == '\0';
+        }
+        assert (erased || clear);
+    }
+    std::copy (buf, buf + count, flash + offset);
+    flash_programmed += count;
+    flash_busy (static_cast<uint64_t> (flash_write_ns_per_word) * count
+                / 4);
+}
+
+const char *
+self_programming_map (uint32_t addr)
+{
+    flash_init ();
+    assert (static_cast<int> (addr - self_programming_host_base)
+            <= flash_size);
+    return flash + (addr - self_programming_host_base);
+}
+
+void
+self_programming_host_reset ()
+{
+    flash_init ();
+    std::memset (flash, 0xff, flash_size);
+    std::fill (flash_erase_counts.begin (), flash_erase_counts.end (), 0);
+    flash_busy_ns = 0;
+    flash_programmed = 0;
+}
+
+void
+self_programming_host_power_cut (int count)
+{
+    flash_power_cut = count;
+}
+
+int
+self_programming_host_erase_count (uint32_t addr)
+{
+    flash_init ();
+    uint32_t offset = addr - self_programming_host_base;
+    assert (static_cast<int> (offset) < flash_size);
+    auto it = std::upper_bound (flash_sectors.begin (),
+                                flash_sectors.end (), offset);
+    return flash_erase_counts[it - flash_sectors.begin () - 1];
+}
+
+int
+self_programming_host_programmed ()
+{
+    return flash_programmed;
+}
+
+} // namespace ucoo
@@ -0,0 +1,89 @@
+#ifndef ucoo_hal_self_programming_self_programming_host_hh
+#define ucoo_hal_self_programming_self_programming_host_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/hal/self_programming/self_programming.hh"
+
+namespace ucoo {
+
+/// Host emulation, flash start address, same as on STM32.
+static const uint32_t self_programming_host_base = 0x8000000;
+
+/// Host emulation, flash layout.
+enum class SelfProgrammingHostLayout
+{
+    /// Pages of the same size (1 KB or 2 KB), programmed by half words.
+    STM32F1,
+    /// Sectors of 16 KB, 64 KB, then 128 KB, repeated for the second bank
+    /// of 2 MB devices, programmed by words.
+    STM32F4,
+};
+
+/// Host emulation, replace flash with a new one, with given layout and size.
+/// For STM32F1 layout, PAGE_SIZE gives the page size.  If FILENAME is
+/// given, flash content is mapped from this file, which is created if
+/// needed and erased if its size does not match, else it is kept in memory.
+/// Erase counters are cleared and timings are set to typical values for the
+/// layout.
+///
+/// Default flash is taken from configuration.
+void
+self_programming_host_setup (SelfProgrammingHostLayout layout,
+                             int size, int page_size = 2048,
+                             const char *filename = nullptr);
+
+/// Host emulation, set timings used to model flash operations, the time to
+/// erase 1 KB and to program a word, in nanoseconds.  If SLEEP is true,
+/// really wait for the modelled time.
+void
+self_programming_host_timings (int erase_ns_per_kb, int write_ns_per_word,
+                               bool sleep = false);
+
+/// Host emulation, return the total modelled time spent erasing and
+/// programming flash, in nanoseconds.
+uint64_t
+self_programming_host_busy_ns ();
+
+/// Host emulation, erase the whole flash and clear counters.
+void
+self_programming_host_reset ();
+
+/// Host emulation, simulate a power loss after COUNT more programmed bytes:
+/// once reached, programming and erasing are ignored.  Use a negative count
+/// to restore power.
+void
+self_programming_host_power_cut (int count);
+
+/// Host emulation, return the number of erase cycles of sector at given
+/// address.
+int
+self_programming_host_erase_count (uint32_t addr);
+
+/// Host emulation, return the total number of programmed bytes.
+int
+self_programming_host_programmed ();
+
+} // namespace ucoo
+
+#endif // ucoo_hal_self_programming_self_programming_host_hh
@@ -116,4 +116,10 @@ self_programming_write (uint32_t addr, const char *buf, int count)
     reg::FLASH->CR = FLASH_CR_LOCK;
 }
 
+const char *
+self_programming_map (uint32_t addr)
+{
+    return reinterpret_cast<const char *> (addr);
+}
+
 } // namespace ucoo
@@ -0,0 +1,157 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/hal/self_programming/self_programming.host.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+using ucoo::SelfProgrammingHostLayout;
+
+static const uint32_t base = ucoo::self_programming_host_base;
+
+/// Check that a flash area is erased.
+static bool
+erased (uint32_t addr, int count)
+{
+    const char *p = ucoo::self_programming_map (addr);
+    for (int i = 0; i < count; i++)
+        if (p[i] != '\xff')
+            return false;
+    return true;
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("self_programming");
+    static const uint32_t words[2] = { 0x12345678, 0x00ff00ff };
+    const char *wordsp = reinterpret_cast<const char *> (words);
+    do {
+        ucoo::Test test (tsuite, "stm32f1 layout");
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F1,
+                                           64 * 1024, 1024);
+        test_fail_break_unless (
+            test, ucoo::self_programming_flash_size () == 64 * 1024);
+        test_fail_break_unless (
+            test, ucoo::self_programming_erase_size (base) == 1024
+            && ucoo::self_programming_erase_size (base + 63 * 1024) == 1024);
+        test_fail_break_unless (test, erased (base, 64 * 1024));
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "stm32f4 layout");
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F4,
+                                           2048 * 1024);
+        static const struct { uint32_t offset; int size; } sectors[] = {
+            { 0, 16 * 1024 }, { 0xc000, 16 * 1024 }, { 0x10000, 64 * 1024 },
+            { 0x20000, 128 * 1024 }, { 0xe0000, 128 * 1024 },
+            { 0x100000, 16 * 1024 }, { 0x110000, 64 * 1024 },
+            { 0x1e0000, 128 * 1024 },
+        };
+        for (auto &s : sectors)
+            test_fail_break_unless (
+                test, ucoo::self_programming_erase_size (base + s.offset)
+                == s.size);
+        // Erase several sectors at once.
+        ucoo::self_programming_erase (base, 128 * 1024);
+        test_fail_break_unless (
+            test, ucoo::self_programming_host_erase_count (base + 0x4000) == 1
+            && ucoo::self_programming_host_erase_count (base + 0x1ffff) == 1
+            && ucoo::self_programming_host_erase_count (base + 0x20000) == 0);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "program and erase");
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F1,
+                                           64 * 1024);
+        uint32_t addr = base + 2048 + 8;
+        ucoo::self_programming_write (addr, wordsp, sizeof (words));
+        const char *p = ucoo::self_programming_map (addr);
+        test_fail_break_unless (
+            test, std::memcmp (p, wordsp, sizeof (words)) == 0
+            && erased (base, 2048 + 8) && erased (addr + 8, 2048 - 16));
+        // Clearing is allowed without erase.
+        static const uint32_t zero = 0;
+        ucoo::self_programming_write (
+            addr, reinterpret_cast<const char *> (&zero), 4);
+        test_fail_break_unless (test, p[0] == 0 && p[3] == 0);
+        ucoo::self_programming_erase (base + 2048, 2048);
+        test_fail_break_unless (
+            test, erased (base + 2048, 2048)
+            && ucoo::self_programming_host_erase_count (addr) == 1
+            && ucoo::self_programming_host_programmed () == 12);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "power cut");
+        ucoo::self_programming_host_reset ();
+        ucoo::self_programming_host_power_cut (6);
+        ucoo::self_programming_write (base, wordsp, sizeof (words));
+        ucoo::self_programming_erase (base + 2048, 2048);
+        ucoo::self_programming_host_power_cut (-1);
+        const char *p = ucoo::self_programming_map (base);
+        test_fail_break_unless (
+            test, std::memcmp (p, wordsp, 6) == 0 && erased (base + 6, 2)
+            && ucoo::self_programming_host_erase_count (base + 2048) == 0);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "timings");
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F1,
+                                           64 * 1024);
+        ucoo::self_programming_erase (base, 2048);
+        ucoo::self_programming_write (base, wordsp, sizeof (words));
+        test_fail_break_unless (
+            test, ucoo::self_programming_host_busy_ns ()
+            == 20000000 + 2 * 105000);
+        ucoo::self_programming_host_timings (1000, 10);
+        ucoo::self_programming_erase (base, 4096);
+        test_fail_break_unless (
+            test, ucoo::self_programming_host_busy_ns ()
+            == 20000000 + 2 * 105000 + 4000);
+    } while (0);
+    do {
+        ucoo::Test test (tsuite, "file backed");
+        char filename[] = "/tmp/test_self_programming.XXXXXX";
+        int fd = mkstemp (filename);
+        test_fail_break_unless (test, fd != -1);
+        close (fd);
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F4,
+                                           128 * 1024, 2048, filename);
+        test_fail_break_unless (test, erased (base, 128 * 1024));
+        ucoo::self_programming_write (base + 0x10000, wordsp, sizeof (words));
+        // Content is kept.
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F4,
+                                           128 * 1024, 2048, filename);
+        bool kept = std::memcmp (ucoo::self_programming_map (base + 0x10000),
+                                 wordsp, sizeof (words)) == 0;
+        // Size changed, erased.
+        ucoo::self_programming_host_setup (SelfProgrammingHostLayout::STM32F4,
+                                           256 * 1024, 2048, filename);
+        bool reset = erased (base, 256 * 1024);
+        unlink (filename);
+        test_fail_break_unless (test, kept && reset);
+    } while (0);
+    return tsuite.report () ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+#ifndef obj_config_ucoo_arch_host_mex_hh
+#define obj_config_ucoo_arch_host_mex_hh
+// Generated from configuration.
+#define CONFIG_UCOO_ARCH_HOST_MEX_RING_SPIN (64)
+#define CONFIG_UCOO_ARCH_HOST_MEX_RING_SIZE (131072)
+#define CONFIG_UCOO_ARCH_HOST_MEX_DEFAULT_ADDRESS ("localhost", "2442")
+#define CONFIG_UCOO_ARCH_HOST_MEX_FREE_BUFFERS (16)
+#define CONFIG_UCOO_ARCH_HOST_MEX_BUFFER_SIZE (64)
+#define CONFIG_UCOO_ARCH_HOST_MEX_SOCKET_BUFFER_SIZE (4096)
+#endif
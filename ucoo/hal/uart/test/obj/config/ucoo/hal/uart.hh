@@ -0,0 +1,6 @@
+#ifndef obj_config_ucoo_hal_uart_hh
+#define obj_config_ucoo_hal_uart_hh
+// Generated from configuration.
+#define CONFIG_UCOO_HAL_UART_TX_BUFFER (8)
+#define CONFIG_UCOO_HAL_UART_RX_BUFFER (32)
+#endif
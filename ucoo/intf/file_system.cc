@@ -22,9 +22,12 @@
 //
 // }}}
 #include "ucoo/intf/file_system.hh"
-#ifdef TARGET_newlib
+#if defined (TARGET_newlib)
 # include "ucoo/arch/syscalls.newlib.hh"
 # include "ucoo/common.hh"
+#elif defined (TARGET_host)
+# include "ucoo/arch/syscalls.host.hh"
+# include "ucoo/common.hh"
 #endif
 
 namespace ucoo {
@@ -35,7 +38,7 @@ FileSystem::enable (bool root)
     disable ();
     enabled_ = true;
     root_ = root;
-#ifdef TARGET_newlib
+#if defined (TARGET_newlib) || defined (TARGET_host)
     if (root_)
     {
         assert (!syscalls_file_system);
@@ -44,10 +47,30 @@ FileSystem::enable (bool root)
 #endif
 }
 
+const char *
+FileSystem::map (const char *filename, int &size, Error &error)
+{
+    error = Error::NOT_SUPPORTED;
+    return nullptr;
+}
+
+bool
+FileSystem::stat (const char *filename, Stat &stat, Error &error)
+{
+    error = Error::NOT_SUPPORTED;
+    return false;
+}
+
+int
+FileSystem::list (const char *prefix, const ListCallback &callback)
+{
+    return -1;
+}
+
 void
 FileSystem::disable ()
 {
-#ifdef TARGET_newlib
+#if defined (TARGET_newlib) || defined (TARGET_host)
     if (enabled_ && root_)
         syscalls_file_system = nullptr;
 #endif
@@ -24,6 +24,7 @@
 //
 // }}}
 #include "ucoo/intf/stream.hh"
+#include "ucoo/utils/function.hh"
 
 namespace ucoo {
 
@@ -52,9 +53,23 @@ class FileSystem
         NO_SPACE_LEFT,
         /// Read only file system.
         READ_ONLY,
+        /// Operation not supported by this file system or file.
+        NOT_SUPPORTED,
     };
+    /// File information.
+    struct Stat
+    {
+        /// File size, as read.
+        int size;
+    };
+    /// Callback called with each listed file name, which is not zero
+    /// terminated, and its size.  Return false to stop listing.
+    typedef Function<bool (const char *name, int name_size)> ListCallback;
   public:
-    /// Enable (and register to newlib syscalls).
+    /// Default constructor, not enabled.
+    FileSystem () : enabled_ (false), root_ (false) { }
+    /// Enable (and register to newlib syscalls, or to syscalls_file_system
+    /// on host).
     virtual void enable (bool root = true);
     /// Disable (and unregister from newlib syscalls).
     virtual void disable ();
@@ -69,6 +84,25 @@ class FileSystem
     }
     /// Close a previously open file.
     virtual void close (Stream *file) = 0;
+    /// Give direct access to file content, for file systems which keep files
+    /// in addressable memory.  Return a pointer to file content and store
+    /// its size in SIZE, or return nullptr on failure.  Content stays
+    /// available as long as the file system exists.  Default is not
+    /// supported.
+    virtual const char *map (const char *filename, int &size, Error &error);
+    /// Get file information, return false on failure.  Default is not
+    /// supported.
+    virtual bool stat (const char *filename, Stat &stat, Error &error);
+    /// Call CALLBACK for each file whose name starts with PREFIX, in name
+    /// order.  Return the number of listed files, or -1 if not supported
+    /// (the default).
+    virtual int list (const char *prefix, const ListCallback &callback);
+    /// Give direct access to file content, no error code.
+    const char *map (const char *filename, int &size)
+    {
+        Error error;
+        return map (filename, size, error);
+    }
     /// Remove a file, does not complain if the file does not exists.
     virtual void unlink (const char *filename) = 0;
   private:
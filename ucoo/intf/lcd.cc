@@ -33,7 +33,7 @@ Lcd::printf (const char *fmt, ...)
     // Buffer needs extra bytes for '\0' & '\n'.
     va_list ap;
     va_start (ap, fmt);
-    char buf[get_lines() * (get_columns() + 1) + 1];
+    char buf[get_lines () * (get_columns () + 1) + 1];
     vsnprintf (buf, sizeof (buf), fmt, ap);
     buf[sizeof (buf) - 1] = '\0';
     va_end (ap);
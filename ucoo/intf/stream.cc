@@ -60,4 +60,27 @@ Stream::putc (int c)
         return -1;
 }
 
+int
+Stream::seek (int offset, Whence whence/*SET*/)
+{
+    return -1;
+}
+
+int
+Stream::size ()
+{
+    int pos = tell ();
+    if (pos < 0)
+        return -1;
+    int size = seek (0, Whence::END);
+    seek (pos);
+    return size;
+}
+
+bool
+Stream::flush ()
+{
+    return true;
+}
+
 } // namespace ucoo
@@ -30,6 +30,16 @@ namespace ucoo {
 /// connected socket, or higher encapsulated protocol.
 class Stream
 {
+  public:
+    /// Origin of a seek operation.
+    enum class Whence {
+        /// From the start of stream.
+        SET,
+        /// From the current position.
+        CUR,
+        /// From the end of stream.
+        END,
+    };
   public:
     /// Set whether operations on this stream should block when no data is
     /// available.
@@ -52,6 +62,20 @@ class Stream
     int putc (int c);
     /// Return the number of available bytes to be read.
     virtual int poll () = 0;
+    /// Change the current position to OFFSET bytes from WHENCE.  Return the
+    /// new position from the start of stream, or -1 on error or if the stream
+    /// is not seekable (the default).
+    virtual int seek (int offset, Whence whence = Whence::SET);
+    /// Return the current position from the start of stream, or -1 if the
+    /// stream is not seekable.
+    int tell () { return seek (0, Whence::CUR); }
+    /// Return the stream size, or -1 if unknown.  Default implementation
+    /// uses seek.
+    virtual int size ();
+    /// Push any pending written data to the underlying device.  Return false
+    /// if some data could not be sent yet, call again later.  Default does
+    /// nothing.
+    virtual bool flush ();
   protected:
     /// Default constructor.
     Stream ();
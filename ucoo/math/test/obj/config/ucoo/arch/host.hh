@@ -0,0 +1,6 @@
+#ifndef obj_config_ucoo_arch_host_hh
+#define obj_config_ucoo_arch_host_hh
+// Generated from configuration.
+#define CONFIG_UCOO_ARCH_HOST_FS_BUFFER_SIZE (4096)
+#define CONFIG_UCOO_ARCH_HOST_FS_STREAMS (8)
+#endif
@@ -36,15 +36,14 @@ namespace ucoo {
 static inline uint8_t
 crc8_update (uint8_t crc, uint8_t data)
 {
-    uint8_t i;
+    // Process four bits at a time.
+    static const uint8_t nibble_table[16] = {
+        0x00, 0x9d, 0x23, 0xbe, 0x46, 0xdb, 0x65, 0xf8,
+        0x8c, 0x11, 0xaf, 0x32, 0xca, 0x57, 0xe9, 0x74,
+    };
     crc = crc ^ data;
-    for (i = 0; i < 8; i++)
-    {
-        if (crc & 0x01)
-            crc = (crc >> 1) ^ 0x8C;
-        else
-            crc >>= 1;
-    }
+    crc = (crc >> 4) ^ nibble_table[crc & 0xf];
+    crc = (crc >> 4) ^ nibble_table[crc & 0xf];
     return crc;
 }
 
@@ -0,0 +1,459 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/utils/format.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ucoo {
+
+FormatOutput::FormatOutput (char *buf, int size)
+    : buf_ (buf), p_ (buf), end_ (buf + (size ? size - 1 : 0)), count_ (0),
+      error_ (false)
+{
+    if (size == 0)
+        buf_ = nullptr;
+}
+
+FormatOutput::FormatOutput (char *buf, int size, const Write &write)
+    : buf_ (buf), p_ (buf), end_ (buf + size), count_ (0), write_ (write),
+      error_ (false)
+{
+}
+
+void
+FormatOutput::put (char c, int n)
+{
+    if (n <= 0)
+        return;
+    count_ += n;
+    while (n)
+    {
+        if (p_ == end_)
+        {
+            overflow ();
+            if (p_ == end_)
+                return;
+        }
+        int l = std::min<int> (n, end_ - p_);
+        std::memset (p_, c, l);
+        p_ += l;
+        n -= l;
+    }
+}
+
+void
+FormatOutput::put (const char *s, int n)
+{
+    count_ += n;
+    while (n)
+    {
+        if (p_ == end_)
+        {
+            overflow ();
+            if (p_ == end_)
+                return;
+        }
+        int l = std::min<int> (n, end_ - p_);
+        std::memcpy (p_, s, l);
+        p_ += l;
+        s += l;
+        n -= l;
+    }
+}
+
+int
+FormatOutput::finish ()
+{
+    if (write_)
+    {
+        overflow ();
+        return error_ ? -1 : count_;
+    }
+    else
+    {
+        if (buf_)
+            *p_ = '\0';
+        return count_;
+    }
+}
+
+void
+FormatOutput::overflow ()
+{
+    if (write_)
+    {
+        const char *p = buf_;
+        while (!error_ && p != p_)
+        {
+            int r = write_ (p, p_ - p);
+            if (r <= 0)
+                error_ = true;
+            else
+                p += r;
+        }
+        p_ = buf_;
+    }
+}
+
+namespace {
+
+/// Parsed conversion specification.
+struct FormatSpec
+{
+    bool left, zero, plus, space, alt;
+    int width, precision;
+    char conv;
+};
+
+/// Convert an unsigned number to text, right aligned, ending at END, return
+/// text start.
+template<typename T>
+char *
+format_unsigned (char *end, T v, unsigned base, bool upper)
+{
+    char *p = end;
+    if (base == 16)
+    {
+        const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+        do
+        {
+            *--p = digits[v & 0xf];
+            v >>= 4;
+        } while (v);
+    }
+    else
+    {
+        // Constant divisor, this is optimised to a multiplication.
+        do
+        {
+            *--p = '0' + v % 10;
+            v /= 10;
+        } while (v);
+    }
+    return p;
+}
+
+/// Output a converted number with sign, prefix and padding.
+void
+format_number (FormatOutput &out, const FormatSpec &spec, char sign,
+               const char *prefix, const char *digits, int digits_nb)
+{
+    int prefix_nb = (sign ? 1 : 0) + (prefix ? 2 : 0);
+    int pad = spec.width - prefix_nb - digits_nb;
+    if (!spec.left && !spec.zero)
+        out.put (' ', pad);
+    if (sign)
+        out.put (sign);
+    if (prefix)
+        out.put (prefix, 2);
+    if (!spec.left && spec.zero)
+        out.put ('0', pad);
+    out.put (digits, digits_nb);
+    if (spec.left)
+        out.put (' ', pad);
+}
+
+/// Output a string with padding.
+void
+format_string (FormatOutput &out, const FormatSpec &spec, const char *s,
+               int n)
+{
+    if (!spec.left)
+        out.put (' ', spec.width - n);
+    out.put (s, n);
+    if (spec.left)
+        out.put (' ', spec.width - n);
+}
+
+/// Output an integer argument.
+void
+format_integer (FormatOutput &out, const FormatSpec &spec,
+                const FormatArg &arg)
+{
+    char buf[24];
+    char *end = buf + sizeof (buf);
+    char *p;
+    char sign = 0;
+    const char *prefix = nullptr;
+    unsigned base = 10;
+    bool upper = false;
+    switch (spec.conv)
+    {
+    case 'X':
+        upper = true;
+        // Fall through.
+    case 'x':
+        base = 16;
+        if (spec.alt)
+            prefix = upper ? "0X" : "0x";
+        break;
+    case 'p':
+        base = 16;
+        prefix = "0x";
+        break;
+    }
+    bool is_signed = spec.conv == 'd' || spec.conv == 'i';
+    bool is_64 = arg.type == FormatArg::Type::INT64
+        || arg.type == FormatArg::Type::UINT64;
+    if (!is_64)
+    {
+        uint32_t u = arg.v.u;
+        if (is_signed && arg.type != FormatArg::Type::UINT && arg.v.i < 0)
+        {
+            sign = '-';
+            u = -u;
+        }
+        p = format_unsigned (end, u, base, upper);
+    }
+    else
+    {
+        uint64_t u = arg.v.u64;
+        if (is_signed && arg.type == FormatArg::Type::INT64 && arg.v.i64 < 0)
+        {
+            sign = '-';
+            u = -u;
+        }
+        p = format_unsigned (end, u, base, upper);
+    }
+    if (!sign && is_signed)
+        sign = spec.plus ? '+' : spec.space ? ' ' : 0;
+    // Minimum number of digits.
+    while (end - p < spec.precision && p != buf)
+        *--p = '0';
+    format_number (out, spec, sign, prefix, p, end - p);
+}
+
+/// Output a fixed point argument.
+void
+format_fixed (FormatOutput &out, const FormatSpec &spec, const FormatArg &arg)
+{
+    static const uint32_t pow10[] = { 1, 10, 100, 1000, 10000, 100000,
+        1000000, 10000000, 100000000, 1000000000 };
+    char buf[32];
+    char *end = buf + sizeof (buf);
+    int precision = spec.precision < 0 ? 6 : spec.precision > 9 ? 9
+        : spec.precision;
+    int frac_bits = arg.frac_bits;
+    char sign = spec.plus ? '+' : spec.space ? ' ' : 0;
+    // Take absolute value, keeping all bits of 64 bit integers.
+    uint64_t u;
+    bool negative;
+    switch (arg.type)
+    {
+    case FormatArg::Type::UINT:
+        u = arg.v.u;
+        negative = false;
+        break;
+    case FormatArg::Type::UINT64:
+        u = arg.v.u64;
+        negative = false;
+        break;
+    case FormatArg::Type::INT64:
+        u = arg.v.u64;
+        negative = arg.v.i64 < 0;
+        break;
+    default:
+        u = static_cast<int64_t> (arg.v.i);
+        negative = arg.v.i < 0;
+        break;
+    }
+    if (negative)
+    {
+        sign = '-';
+        u = -u;
+    }
+    uint64_t int_part = frac_bits < 32 ? u >> frac_bits : 0;
+    uint64_t frac_part = u - (int_part << frac_bits);
+    // Scale and round fractional part.
+    uint64_t frac = frac_part * pow10[precision];
+    if (frac_bits)
+        frac = (frac + (static_cast<uint64_t> (1) << (frac_bits - 1)))
+            >> frac_bits;
+    if (frac >= pow10[precision])
+    {
+        frac -= pow10[precision];
+        int_part++;
+    }
+    char *p = end;
+    if (precision)
+    {
+        uint32_t f = frac;
+        for (int i = 0; i < precision; i++)
+        {
+            *--p = '0' + f % 10;
+            f /= 10;
+        }
+        *--p = '.';
+    }
+    else if (spec.alt)
+        *--p = '.';
+    p = format_unsigned (p, int_part, 10, false);
+    format_number (out, spec, sign, nullptr, p, end - p);
+}
+
+} // namespace
+
+int
+vformat (FormatOutput &out, const char *fmt, const FormatArg *args,
+         int args_nb)
+{
+    const FormatArg none_arg;
+    int arg_index = 0;
+    while (*fmt)
+    {
+        // Copy plain text.
+        const char *start = fmt;
+        while (*fmt && *fmt != '%')
+            fmt++;
+        out.put (start, fmt - start);
+        if (!*fmt)
+            break;
+        start = fmt++;
+        // Parse flags.
+        FormatSpec spec = { false, false, false, false, false, 0, -1, 0 };
+        for (;; fmt++)
+        {
+            if (*fmt == '-')
+                spec.left = true;
+            else if (*fmt == '0')
+                spec.zero = true;
+            else if (*fmt == '+')
+                spec.plus = true;
+            else if (*fmt == ' ')
+                spec.space = true;
+            else if (*fmt == '#')
+                spec.alt = true;
+            else
+                break;
+        }
+        // Parse width and precision.
+        while (*fmt >= '0' && *fmt <= '9')
+            spec.width = spec.width * 10 + *fmt++ - '0';
+        if (*fmt == '.')
+        {
+            fmt++;
+            spec.precision = 0;
+            while (*fmt >= '0' && *fmt <= '9')
+                spec.precision = spec.precision * 10 + *fmt++ - '0';
+        }
+        // Skip length modifiers.
+        while (*fmt == 'h' || *fmt == 'l' || *fmt == 'L' || *fmt == 'q'
+               || *fmt == 'j' || *fmt == 'z' || *fmt == 't')
+            fmt++;
+        spec.conv = *fmt;
+        if (!spec.conv)
+        {
+            out.put (start, fmt - start);
+            break;
+        }
+        fmt++;
+        if (spec.conv == '%')
+        {
+            out.put ('%');
+            continue;
+        }
+        const FormatArg &arg = arg_index < args_nb ? args[arg_index++]
+            : none_arg;
+        switch (spec.conv)
+        {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'c':
+        case 's':
+        case 'p':
+        case 'f':
+            break;
+        default:
+            // Unknown conversion, copy it.
+            out.put (start, fmt - start);
+            continue;
+        }
+        switch (arg.type)
+        {
+        case FormatArg::Type::NONE:
+            break;
+        case FormatArg::Type::STRING:
+            {
+                const char *s = arg.v.s ? arg.v.s : "(null)";
+                int n = 0;
+                while (s[n] && (spec.precision < 0 || n < spec.precision))
+                    n++;
+                format_string (out, spec, s, n);
+            }
+            break;
+        case FormatArg::Type::FIXED:
+            if (spec.conv == 'f')
+            {
+                format_fixed (out, spec, arg);
+                break;
+            }
+            // Fall through.
+        default:
+            if (spec.conv == 'c' || (spec.conv == 's'
+                                     && arg.type == FormatArg::Type::CHAR))
+            {
+                char c = arg.v.i;
+                format_string (out, spec, &c, 1);
+            }
+            else if (spec.conv == 'f')
+            {
+                FormatArg fixed = arg;
+                if (fixed.type != FormatArg::Type::FIXED)
+                    fixed.frac_bits = 0;
+                format_fixed (out, spec, fixed);
+            }
+            else
+            {
+                FormatSpec ispec = spec;
+                if (spec.conv == 's')
+                    ispec.conv = 'd';
+                if (spec.precision >= 0)
+                    ispec.zero = false;
+                if (arg.type == FormatArg::Type::POINTER)
+                {
+                    FormatArg parg (reinterpret_cast<uintptr_t> (arg.v.p));
+                    format_integer (out, ispec, parg);
+                }
+                else if (arg.type == FormatArg::Type::FIXED)
+                {
+                    // Integer part only, rounded toward zero.
+                    FormatArg iarg (arg.v.i < 0
+                                    ? -(-arg.v.i >> arg.frac_bits)
+                                    : arg.v.i >> arg.frac_bits);
+                    format_integer (out, ispec, iarg);
+                }
+                else
+                    format_integer (out, ispec, arg);
+            }
+            break;
+        }
+    }
+    return out.finish ();
+}
+
+} // namespace ucoo
@@ -0,0 +1,218 @@
+#ifndef ucoo_utils_format_hh
+#define ucoo_utils_format_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/intf/lcd.hh"
+#include "ucoo/intf/sink.hh"
+#include "ucoo/intf/stream.hh"
+#include "ucoo/utils/function.hh"
+#include "ucoo/common.hh"
+
+#include <type_traits>
+
+namespace ucoo {
+
+/// Fixed point number, to be formatted with %f.
+struct FormatFixed
+{
+    /// Raw value.
+    int32_t value;
+    /// Number of bits after the point.
+    int frac_bits;
+};
+
+/// Make a fixed point number to be formatted.
+inline FormatFixed
+format_fixed (int32_t value, int frac_bits)
+{
+    return FormatFixed { value, frac_bits };
+}
+
+/// Formatting argument, remember its type so that the format string can
+/// not read garbage.
+class FormatArg
+{
+  public:
+    /// Argument type.
+    enum class Type : uint8_t {
+        NONE,
+        INT,
+        UINT,
+        INT64,
+        UINT64,
+        CHAR,
+        STRING,
+        POINTER,
+        FIXED,
+    };
+  public:
+    /// No argument.
+    FormatArg () : type (Type::NONE) { v.u64 = 0; }
+    /// Character, printed as a character by %s or %c.
+    FormatArg (char c) : type (Type::CHAR) { v.i = c; }
+    /// Any integer type.
+    template<typename T, typename = typename std::enable_if<
+        std::is_integral<T>::value>::type>
+    FormatArg (T i)
+    {
+        if (sizeof (T) <= sizeof (int32_t))
+        {
+            if (std::is_signed<T>::value)
+            {
+                type = Type::INT;
+                v.i = i;
+            }
+            else
+            {
+                type = Type::UINT;
+                v.u = i;
+            }
+        }
+        else
+        {
+            if (std::is_signed<T>::value)
+            {
+                type = Type::INT64;
+                v.i64 = i;
+            }
+            else
+            {
+                type = Type::UINT64;
+                v.u64 = i;
+            }
+        }
+    }
+    /// String, zero terminated.
+    FormatArg (const char *s) : type (Type::STRING) { v.s = s; }
+    /// Any pointer.
+    FormatArg (const void *p) : type (Type::POINTER) { v.p = p; }
+    /// Fixed point number.
+    FormatArg (const FormatFixed &f) : type (Type::FIXED), frac_bits (f.frac_bits)
+        { v.i = f.value; }
+    /// Floating point numbers are not supported, use fixed point.
+    FormatArg (float) = delete;
+    FormatArg (double) = delete;
+  public:
+    /// Argument type.
+    Type type;
+    /// Number of bits after point for fixed point numbers.
+    int8_t frac_bits;
+    /// Argument value.
+    union
+    {
+        int32_t i;
+        uint32_t u;
+        int64_t i64;
+        uint64_t u64;
+        const char *s;
+        const void *p;
+    } v;
+};
+
+/// Formatting output, collect characters in a buffer, either truncate or
+/// pass the buffer content to a write function when full.
+class FormatOutput
+{
+  public:
+    /// Write function type.
+    typedef Function<int (const char *buf, int count)> Write;
+  public:
+    /// Output to a buffer of SIZE bytes, output is truncated if too long
+    /// and zero terminated if SIZE is not zero.
+    FormatOutput (char *buf, int size);
+    /// Output to a write function, using BUF of SIZE bytes as temporary
+    /// buffer.
+    FormatOutput (char *buf, int size, const Write &write);
+    /// Output a character.
+    void put (char c)
+    {
+        if (p_ == end_)
+            overflow ();
+        if (p_ != end_)
+            *p_++ = c;
+        count_++;
+    }
+    /// Output a character several times.
+    void put (char c, int n);
+    /// Output a string of N characters.
+    void put (const char *s, int n);
+    /// Terminate output, return the number of output characters (even if
+    /// truncated) or -1 on write error.
+    int finish ();
+  private:
+    /// Called when buffer is full.
+    void overflow ();
+  private:
+    /// Buffer start, current position and end.
+    char *buf_, *p_, *end_;
+    /// Number of output characters.
+    int count_;
+    /// Write function, or empty when writing to a buffer.
+    Write write_;
+    /// Set on write error.
+    bool error_;
+};
+
+/// Format arguments according to FMT and send them to OUT.  This is the non
+/// template engine used by format functions.
+///
+/// FMT syntax is a subset of printf one: %[flags][width][.precision]conv
+/// where flags are any of "-0+ #", conv is one of "diuxXcspf%".  Length
+/// modifiers are accepted and ignored, as the argument type is known.  %f
+/// takes a fixed point number, see format_fixed.
+///
+/// Return the number of output characters or -1 on write error.
+int
+vformat (FormatOutput &out, const char *fmt, const FormatArg *args,
+         int args_nb);
+
+/// Format to a buffer of SIZE bytes, always zero terminated if SIZE is not
+/// zero.  Return the length of the full output, as snprintf.
+template<typename... Args>
+int
+format (char *buf, int size, const char *fmt, const Args &... args);
+
+/// Format to a sink.  Return the number of written characters or -1 on
+/// error.
+template<typename... Args>
+int
+format (Sink &sink, const char *fmt, const Args &... args);
+
+/// Format to a stream.  Return the number of written characters or -1 on
+/// error.
+template<typename... Args>
+int
+format (Stream &stream, const char *fmt, const Args &... args);
+
+/// Format to a character LCD, output is truncated to the screen size.
+/// Return the length of the full output.
+template<typename... Args>
+int
+format (Lcd &lcd, const char *fmt, const Args &... args);
+
+} // namespace ucoo
+
+#include "ucoo/utils/format.tcc"
+
+#endif // ucoo_utils_format_hh
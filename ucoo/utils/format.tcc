@@ -0,0 +1,76 @@
+#ifndef ucoo_utils_format_tcc
+#define ucoo_utils_format_tcc
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+
+namespace ucoo {
+
+/// Size of temporary buffer used when formatting to a sink or a stream.
+static const int format_write_buffer_size = 64;
+
+template<typename... Args>
+int
+format (char *buf, int size, const char *fmt, const Args &... args)
+{
+    FormatOutput out (buf, size);
+    const FormatArg fargs[] = { args..., FormatArg () };
+    return vformat (out, fmt, fargs, sizeof... (args));
+}
+
+template<typename... Args>
+int
+format (Sink &sink, const char *fmt, const Args &... args)
+{
+    char buf[format_write_buffer_size];
+    FormatOutput out (buf, sizeof (buf),
+                      FormatOutput::Write (&sink, &Sink::write));
+    const FormatArg fargs[] = { args..., FormatArg () };
+    return vformat (out, fmt, fargs, sizeof... (args));
+}
+
+template<typename... Args>
+int
+format (Stream &stream, const char *fmt, const Args &... args)
+{
+    char buf[format_write_buffer_size];
+    FormatOutput out (buf, sizeof (buf),
+                      FormatOutput::Write (&stream, &Stream::write));
+    const FormatArg fargs[] = { args..., FormatArg () };
+    return vformat (out, fmt, fargs, sizeof... (args));
+}
+
+template<typename... Args>
+int
+format (Lcd &lcd, const char *fmt, const Args &... args)
+{
+    // Buffer needs extra bytes for '\0' & '\n'.
+    char buf[lcd.get_lines () * (lcd.get_columns () + 1) + 1];
+    int r = format (buf, sizeof (buf), fmt, args...);
+    lcd.puts (buf);
+    return r;
+}
+
+} // namespace ucoo
+
+#endif // ucoo_utils_format_tcc
@@ -0,0 +1,116 @@
+#ifndef ucoo_utils_tee_hh
+#define ucoo_utils_tee_hh
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/common.hh"
+#include "ucoo/intf/sink.hh"
+#include "ucoo/intf/stream.hh"
+#include "ucoo/utils/function.hh"
+
+namespace ucoo {
+
+/// Fan out data written to this sink to several branches.  Data is written
+/// once in a shared ring buffer and each branch drains it at its own pace,
+/// so that a slow output does not dictate the writer timing.
+///
+/// Each branch has a policy used when it lags more than the ring buffer
+/// size: either drop the oldest data (counted in branch dropped bytes), or
+/// block the writer which then drains this branch until there is room.
+///
+/// This is not thread safe, writer and branches should be in the same
+/// thread.
+template<int size>
+class Tee : public Sink
+{
+    static_assert ((size & (size - 1)) == 0, "size must be a power of two");
+  public:
+    /// What to do when a branch is too slow.
+    enum class Policy
+    {
+        /// Drop the oldest data for this branch.
+        DROP,
+        /// Block writer until branch has drained enough data.
+        BLOCK,
+    };
+    /// One output of the tee.
+    class Branch
+    {
+      public:
+        /// Connect a sink to the tee.
+        Branch (Tee &tee, Sink &sink, Policy policy = Policy::DROP);
+        /// Connect a stream to the tee.
+        Branch (Tee &tee, Stream &stream, Policy policy = Policy::DROP);
+        /// Disconnect from the tee.
+        ~Branch ();
+        /// Write as much pending data as the output accepts.  Return the
+        /// number of written bytes or -1 on error.
+        int drain ();
+        /// Return the number of bytes waiting to be drained.
+        int pending () const { return tee_.head_ - tail_; }
+        /// Return the number of dropped bytes.
+        uint32_t dropped () const { return dropped_; }
+      private:
+        /// Register to tee.
+        void link ();
+      private:
+        friend class Tee;
+        /// Attached tee.
+        Tee &tee_;
+        /// Output write function.
+        Function<int (const char *, int)> write_;
+        /// Policy when lagging.
+        Policy policy_;
+        /// Position of next byte to drain, always incremented.
+        uint32_t tail_;
+        /// Number of dropped bytes.
+        uint32_t dropped_;
+        /// Next branch in tee list.
+        Branch *next_;
+    };
+  public:
+    /// Constructor, no branch yet.
+    Tee ();
+    /// See Sink::write.  If a blocking branch lags, drain it first.  Return
+    /// less than COUNT only if a blocking branch does not make progress.
+    int write (const char *buf, int count) override;
+    /// Drain all branches.
+    void drain ();
+  private:
+    /// Copy COUNT bytes to ring buffer, COUNT must not be larger than size.
+    /// SKIP bytes which were written before them are not kept.  Drop
+    /// oldest data for lagging branches.
+    void push (const char *buf, int count, int skip);
+    /// Position of next byte to write, always incremented.
+    uint32_t head_;
+    /// First branch.
+    Branch *first_;
+    /// Shared ring buffer.
+    char buffer_[size];
+};
+
+} // namespace ucoo
+
+#include "tee.tcc"
+
+#endif // ucoo_utils_tee_hh
@@ -0,0 +1,164 @@
+#ifndef ucoo_utils_tee_tcc
+#define ucoo_utils_tee_tcc
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include <algorithm>
+
+namespace ucoo {
+
+template<int size>
+Tee<size>::Branch::Branch (Tee &tee, Sink &sink, Policy policy)
+    : tee_ (tee), write_ (&sink, &Sink::write), policy_ (policy)
+{
+    link ();
+}
+
+template<int size>
+Tee<size>::Branch::Branch (Tee &tee, Stream &stream, Policy policy)
+    : tee_ (tee), write_ (&stream, &Stream::write), policy_ (policy)
+{
+    link ();
+}
+
+template<int size>
+Tee<size>::Branch::~Branch ()
+{
+    Branch **b = &tee_.first_;
+    while (*b != this)
+        b = &(*b)->next_;
+    *b = next_;
+}
+
+template<int size>
+void
+Tee<size>::Branch::link ()
+{
+    // Only new data is received.
+    tail_ = tee_.head_;
+    dropped_ = 0;
+    next_ = tee_.first_;
+    tee_.first_ = this;
+}
+
+template<int size>
+int
+Tee<size>::Branch::drain ()
+{
+    int written = 0;
+    while (tail_ != tee_.head_)
+    {
+        // Write contiguous data, there can be two parts.
+        int index = tail_ % size;
+        int count = std::min<uint32_t> (tee_.head_ - tail_, size - index);
+        int r = write_ (tee_.buffer_ + index, count);
+        if (r == -1)
+            return -1;
+        tail_ += r;
+        written += r;
+        if (r != count)
+            break;
+    }
+    return written;
+}
+
+template<int size>
+Tee<size>::Tee ()
+    : head_ (0), first_ (nullptr)
+{
+}
+
+template<int size>
+int
+Tee<size>::write (const char *buf, int count)
+{
+    bool blocking = false;
+    for (Branch *b = first_; b; b = b->next_)
+        blocking = blocking || b->policy_ == Policy::BLOCK;
+    if (!blocking)
+    {
+        // Only the last bytes are kept, skipped bytes are dropped for every
+        // branch.
+        int skip = std::max (count - size, 0);
+        push (buf + skip, count - skip, skip);
+        return count;
+    }
+    // Write by chunks, making room for blocking branches.
+    int written = 0;
+    while (written < count)
+    {
+        int chunk = std::min (count - written, size);
+        for (Branch *b = first_; b; b = b->next_)
+        {
+            if (b->policy_ == Policy::BLOCK)
+            {
+                while (size - b->pending () < chunk)
+                {
+                    if (b->drain () <= 0)
+                        break;
+                }
+                chunk = std::min (chunk, size - b->pending ());
+            }
+        }
+        if (!chunk)
+            break;
+        push (buf + written, chunk, 0);
+        written += chunk;
+    }
+    return written;
+}
+
+template<int size>
+void
+Tee<size>::push (const char *buf, int count, int skip)
+{
+    // Drop oldest data for lagging branches.
+    for (Branch *b = first_; b; b = b->next_)
+    {
+        int over = b->pending () + skip + count - size;
+        if (over > 0)
+        {
+            b->tail_ += over;
+            b->dropped_ += over;
+        }
+    }
+    head_ += skip;
+    // Copy to ring buffer, there can be two parts.
+    int index = head_ % size;
+    int first_count = std::min (count, size - index);
+    std::copy (buf, buf + first_count, buffer_ + index);
+    std::copy (buf + first_count, buf + count, buffer_);
+    head_ += count;
+}
+
+template<int size>
+void
+Tee<size>::drain ()
+{
+    for (Branch *b = first_; b; b = b->next_)
+        b->drain ();
+}
+
+} // namespace ucoo
+
+#endif // ucoo_utils_tee_tcc
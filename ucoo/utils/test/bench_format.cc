@@ -0,0 +1,128 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/utils/format.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/bench.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <cstdio>
+
+/// Number of formatted strings per benchmark.
+static const int bench_nb = 2000;
+
+/// Sink dropping everything.
+class NullSink : public ucoo::Sink
+{
+  public:
+    int write (const char *buf, int count) override { return count; }
+};
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::test_stream_setup ();
+    ucoo::BenchSuite bsuite ("format");
+    char buf[128];
+    bsuite.group ("trace");
+    {
+        ucoo::Bench bench (bsuite, "snprintf");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            bench.start ();
+            int r = snprintf (buf, sizeof (buf), "pos %d %d a=%04x s=%u", i,
+                              -i, i * 7, 3);
+            bench.stop (r);
+        }
+    }
+    {
+        ucoo::Bench bench (bsuite, "format");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            bench.start ();
+            int r = ucoo::format (buf, sizeof (buf), "pos %d %d a=%04x s=%u",
+                                  i, -i, i * 7, 3);
+            bench.stop (r);
+        }
+    }
+    bsuite.group ("string");
+    {
+        ucoo::Bench bench (bsuite, "snprintf");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            bench.start ();
+            int r = snprintf (buf, sizeof (buf), "[%-10s] %s", "name",
+                              "some longer text to copy");
+            bench.stop (r);
+        }
+    }
+    {
+        ucoo::Bench bench (bsuite, "format");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            bench.start ();
+            int r = ucoo::format (buf, sizeof (buf), "[%-10s] %s", "name",
+                                  "some longer text to copy");
+            bench.stop (r);
+        }
+    }
+    bsuite.group ("fixed");
+    {
+        // Newlib nano does not have float support by default, compare
+        // integer emulation to fixed point.
+        ucoo::Bench bench (bsuite, "snprintf");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            int32_t v = i * 1234;
+            bench.start ();
+            int r = snprintf (buf, sizeof (buf), "%d.%03d", v >> 16,
+                              ((v & 0xffff) * 1000) >> 16);
+            bench.stop (r);
+        }
+    }
+    {
+        ucoo::Bench bench (bsuite, "format");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            int32_t v = i * 1234;
+            bench.start ();
+            int r = ucoo::format (buf, sizeof (buf), "%.3f",
+                                  ucoo::format_fixed (v, 16));
+            bench.stop (r);
+        }
+    }
+    bsuite.group ("sink");
+    {
+        NullSink sink;
+        ucoo::Bench bench (bsuite, "format");
+        for (int i = 0; i < bench_nb; i++)
+        {
+            bench.start ();
+            int r = ucoo::format (sink, "pos %d %d a=%04x s=%u\n", i, -i,
+                                  i * 7, 3);
+            bench.stop (r);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/utils/format.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <cstring>
+#include <string>
+
+/// Sink collecting data, accept at most 7 bytes per write.
+class StringSink : public ucoo::Sink
+{
+  public:
+    int write (const char *buf, int count) override
+    {
+        int r = std::min (count, 7);
+        str.append (buf, r);
+        writes++;
+        return r;
+    }
+  public:
+    std::string str;
+    int writes = 0;
+};
+
+/// Two lines of eight characters LCD, collecting output.
+class StringLcd : public ucoo::Lcd
+{
+  public:
+    void puts (const char *str) override { this->str += str; }
+    void go (int line, int column) override { }
+    void clear () override { str.clear (); }
+    int get_lines () const override { return 2; }
+    int get_columns () const override { return 8; }
+  public:
+    std::string str;
+};
+
+/// Check formatting to a buffer, return false on mismatch.
+template<typename... Args>
+static bool
+check (ucoo::Test &test, const char *expected, const char *fmt,
+       const Args &... args)
+{
+    char buf[64];
+    int r = ucoo::format (buf, sizeof (buf), fmt, args...);
+    if (r != static_cast<int> (std::strlen (expected))
+        || std::strcmp (buf, expected) != 0)
+    {
+        test.fail ();
+        test.info ("\"%s\": \"%s\" (%d) != \"%s\"", fmt, buf, r, expected);
+        return false;
+    }
+    return true;
+}
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("format");
+    {
+        ucoo::Test test (tsuite, "integers");
+        do {
+            test_fail_break_unless (test, check (test, "hello", "hello"));
+            test_fail_break_unless (test, check (test, "42 -42 100%",
+                                                 "%d %i %d%%", 42, -42, 100));
+            test_fail_break_unless (test, check (test, "4294967295 ffffffff",
+                                                 "%u %x", -1, -1));
+            test_fail_break_unless (test, check (test, "ABCD 0xabcd",
+                                                 "%X %#x", 0xabcd, 0xabcd));
+            test_fail_break_unless (test, check (test, "-2147483648",
+                                                 "%d", INT32_MIN));
+            test_fail_break_unless (test, check (test, "255 200",
+                                                 "%d %d", uint8_t (255),
+                                                 int16_t (200)));
+            test_fail_break_unless (test, check (test, "-9000000000 ffffffffff",
+                                                 "%lld %llx", -9000000000ll,
+                                                 0xffffffffffull));
+            test_fail_break_unless (test, check (test, "1 0", "%d %d", true,
+                                                 false));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "padding");
+        do {
+            test_fail_break_unless (test, check (test, "[   42][42   ]",
+                                                 "[%5d][%-5d]", 42, 42));
+            test_fail_break_unless (test, check (test, "[-0042][+42][ 42]",
+                                                 "[%05d][%+d][% d]", -42, 42,
+                                                 42));
+            test_fail_break_unless (test, check (test, "[0000beef][   007]",
+                                                 "[%08x][%6.3d]", 0xbeef, 7));
+            test_fail_break_unless (test, check (test, "[  abc][abc  ][ab]",
+                                                 "[%5s][%-5s][%.2s]", "abc",
+                                                 "abc", "abc"));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "strings and characters");
+        do {
+            test_fail_break_unless (test, check (test, "x=a, s=str",
+                                                 "x=%c, s=%s", 'a', "str"));
+            test_fail_break_unless (test, check (test, "a b 98",
+                                                 "%s %c %s", 'a', 98, 98));
+            test_fail_break_unless (test, check (test, "(null)", "%s",
+                                                 static_cast<const char *>
+                                                 (nullptr)));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "fixed point");
+        do {
+            using ucoo::format_fixed;
+            test_fail_break_unless (test, check (test, "1.500000",
+                                                 "%f", format_fixed (3, 1)));
+            test_fail_break_unless (test, check (test, "-1.25 -1",
+                                                 "%.2f %d",
+                                                 format_fixed (-(5 << 14), 16),
+                                                 format_fixed (-(5 << 14), 16)));
+            test_fail_break_unless (test, check (test, "3.142 [  +3.1]",
+                                                 "%.3f [%+6.1f]",
+                                                 format_fixed (205887, 16),
+                                                 format_fixed (205887, 16)));
+            test_fail_break_unless (test, check (test, "1.00 0.0 42.0",
+                                                 "%.2f %.1f %.1f",
+                                                 format_fixed (0xffff, 16),
+                                                 format_fixed (1, 24), 42));
+            // Integers keep all their bits.
+            test_fail_break_unless (test, check (test,
+                                                 "3000000000.0 -5000000000.0",
+                                                 "%.1f %.1f", 3000000000u,
+                                                 INT64_C (-5000000000)));
+            test_fail_break_unless (test, check (
+                    test, "18446744073709551615.0", "%.1f", UINT64_MAX));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "errors");
+        do {
+            test_fail_break_unless (test, check (test, "a  %k %",
+                                                 "a %d %k %"));
+            test_fail_break_unless (test, check (test, "1 ", "%d %d", 1));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "truncation");
+        do {
+            char buf[8];
+            int r = ucoo::format (buf, sizeof (buf), "%s-%d", "abcdef", 42);
+            test_fail_break_unless (test, r == 9
+                                    && std::strcmp (buf, "abcdef-") == 0);
+            r = ucoo::format (buf, 0, "%d", 42);
+            test_fail_break_unless (test, r == 2);
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "sink output");
+        do {
+            StringSink sink;
+            std::string expected;
+            for (int i = 0; i < 20; i++)
+                expected += "line " + std::to_string (i) + "\n";
+            int r = ucoo::format (sink, "%s", expected.c_str ());
+            test_fail_break_unless (test, r
+                                    == static_cast<int> (expected.size ()));
+            test_fail_break_unless (test, sink.str == expected);
+            // Data is passed in chunks.
+            test_fail_break_unless (test, sink.writes < r / 7 + 4);
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "lcd output");
+        do {
+            StringLcd lcd;
+            int r = ucoo::format (lcd, "x=%d\ny=%d", 42, -1);
+            test_fail_break_unless (test, r == 9 && lcd.str == "x=42\ny=-1");
+            lcd.clear ();
+            r = ucoo::format (lcd, "%s", "0123456789abcdefghij");
+            test_fail_break_unless (test, r == 20
+                                    && lcd.str == "0123456789abcdefgh");
+        } while (0);
+    }
+    return tsuite.report () ? 0 : 1;
+}
@@ -0,0 +1,150 @@
+// ucoolib - Microcontroller object oriented library. {{{
+//
+// Copyright (C) 2016 Nicolas Schodet
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// }}}
+#include "ucoo/utils/tee.hh"
+#include "ucoo/arch/arch.hh"
+#include "ucoo/base/test/test.hh"
+
+#include <algorithm>
+#include <cstring>
+
+/// Sink storing data, accepting a limited number of bytes per write.
+class TestSink : public ucoo::Sink
+{
+  public:
+    TestSink (int limit = 64) : limit_ (limit), size_ (0) { }
+    int write (const char *buf, int count) override
+    {
+        int r = std::min (count, limit_);
+        r = std::min<int> (r, sizeof (data_) - size_);
+        std::copy (buf, buf + r, data_ + size_);
+        size_ += r;
+        return r;
+    }
+    bool check (const char *str) const
+    {
+        return size_ == static_cast<int> (std::strlen (str))
+            && std::memcmp (data_, str, size_) == 0;
+    }
+  public:
+    int limit_;
+    int size_;
+    char data_[64];
+};
+
+int
+main (int argc, const char **argv)
+{
+    ucoo::arch_init (argc, argv);
+    ucoo::TestSuite tsuite ("tee");
+    using Tee = ucoo::Tee<8>;
+    {
+        ucoo::Test test (tsuite, "fan out");
+        Tee tee;
+        TestSink s1, s2;
+        Tee::Branch b1 (tee, s1), b2 (tee, s2);
+        do
+        {
+            test_fail_break_unless (test, tee.write ("hello", 5) == 5);
+            test_fail_break_unless (test, b1.pending () == 5);
+            test_fail_break_unless (test, b1.drain () == 5);
+            test_fail_break_unless (test, b1.pending () == 0
+                                    && b2.pending () == 5);
+            tee.drain ();
+            test_fail_break_unless (test, tee.write (" world", 6) == 6);
+            tee.drain ();
+            test_fail_break_unless (test, s1.check ("hello world"));
+            test_fail_break_unless (test, s2.check ("hello world"));
+            test_fail_break_unless (test, b1.dropped () == 0
+                                    && b2.dropped () == 0);
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "drop");
+        Tee tee;
+        TestSink fast, slow (0);
+        Tee::Branch bf (tee, fast), bs (tee, slow, Tee::Policy::DROP);
+        do
+        {
+            tee.write ("abcdef", 6);
+            bf.drain ();
+            bs.drain ();
+            tee.write ("ghijkl", 6);
+            bf.drain ();
+            test_fail_break_unless (test, fast.check ("abcdefghijkl"));
+            test_fail_break_unless (test, bs.dropped () == 4
+                                    && bs.pending () == 8);
+            slow.limit_ = 64;
+            bs.drain ();
+            test_fail_break_unless (test, slow.check ("efghijkl"));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "drop large");
+        Tee tee;
+        TestSink s1, s2;
+        Tee::Branch b1 (tee, s1, Tee::Policy::DROP),
+            b2 (tee, s2, Tee::Policy::DROP);
+        do
+        {
+            tee.write ("abc", 3);
+            b1.drain ();
+            test_fail_break_unless (test, tee.write ("0123456789", 10) == 10);
+            test_fail_break_unless (test, b1.dropped () == 2
+                                    && b2.dropped () == 5);
+            tee.drain ();
+            test_fail_break_unless (test, s1.check ("abc23456789"));
+            test_fail_break_unless (test, s2.check ("23456789"));
+        } while (0);
+    }
+    {
+        ucoo::Test test (tsuite, "block");
+        Tee tee;
+        TestSink fast, slow (3);
+        Tee::Branch bf (tee, fast), bs (tee, slow, Tee::Policy::BLOCK);
+        do
+        {
+            test_fail_break_unless (test, tee.write ("abcdef", 6) == 6);
+            bf.drain ();
+            test_fail_break_unless (test, tee.write ("ghijkl", 6) == 6);
+            test_fail_break_unless (test, slow.size_ == 6);
+            tee.drain ();
+            tee.drain ();
+            test_fail_break_unless (test, fast.check ("abcdefghijkl"));
+            test_fail_break_unless (test, slow.check ("abcdefghijkl"));
+            test_fail_break_unless (test, bs.dropped () == 0);
+            // Larger than ring buffer, blocking branch makes progress.
+            test_fail_break_unless (test, tee.write ("0123456789", 10) == 10);
+            while (bs.pending ())
+                tee.drain ();
+            test_fail_break_unless (test, slow.check ("abcdefghijkl0123456789"));
+            test_fail_break_unless (test, bs.dropped () == 0);
+            // Fast branch is not drained while writing, it lags.
+            test_fail_break_unless (test, fast.check ("abcdefghijkl23456789"));
+            test_fail_break_unless (test, bf.dropped () == 2);
+            slow.limit_ = 0;
+            test_fail_break_unless (test, tee.write ("0123456789", 10) == 8);
+        } while (0);
+    }
+    return tsuite.report () ? 0 : 1;
+}
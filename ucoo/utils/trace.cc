@@ -22,6 +22,7 @@
 //
 // }}}
 #include "ucoo/utils/trace.hh"
+#include "ucoo/utils/format.hh"
 #include <cstring>
 
 namespace ucoo {
@@ -34,6 +35,17 @@ TraceRegistry::register_trace_buffer (TraceBufferBase &b)
     self.first = &b;
 }
 
+void
+TraceRegistry::unregister_trace_buffer (TraceBufferBase &b)
+{
+    TraceRegistry &self = get_instance ();
+    TraceBufferBase **p = &self.first;
+    while (*p && *p != &b)
+        p = &(*p)->next_;
+    if (*p)
+        *p = b.next_;
+}
+
 bool
 TraceRegistry::dump_all (std::function<bool (const char *str, int str_size)>
                          dump_callback)
@@ -55,7 +67,7 @@ TraceRegistry::dump (const char *name,
         {
             {
                 char buf[128];
-                int r = snprintf (buf, sizeof (buf) - 1, "---[%s]---", b->name_);
+                int r = format (buf, sizeof (buf) - 1, "---[%s]---", b->name_);
                 if (r >= static_cast<int> (sizeof (buf) - 1))
                     r = sizeof (buf) - 2;
                 buf[r++] = '\n';
@@ -132,6 +132,9 @@ class TraceRegistry
     /// Register a trace buffer (called automatically on trace buffer
     /// construction).
     static void register_trace_buffer (TraceBufferBase &b);
+    /// Unregister a trace buffer, for buffers which do not live until the
+    /// end of the program.
+    static void unregister_trace_buffer (TraceBufferBase &b);
     /// Dump all active traces as text.
     static bool dump_all (std::function<bool (
             const char *str, int str_size)> dump_callback);
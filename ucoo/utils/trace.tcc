@@ -23,7 +23,7 @@
 // DEALINGS IN THE SOFTWARE.
 //
 // }}}
-#include <cstdio>
+#include "ucoo/utils/format.hh"
 
 namespace ucoo {
 
@@ -109,13 +109,13 @@ TraceBuffer<Timestamp>::dump (std::function<bool (
             char buf[128];
             int buf_size;
             buf_size = timestamp_.dump (entries[i], entries[iprev], buf);
-            int r = snprintf (buf + buf_size, sizeof (buf) - buf_size - 1,
-                              entries[i].str,
-                              entries[i].args[0], entries[i].args[1],
-                              entries[i].args[2], entries[i].args[3]);
+            int r = format (buf + buf_size, sizeof (buf) - buf_size - 1,
+                            entries[i].str,
+                            entries[i].args[0], entries[i].args[1],
+                            entries[i].args[2], entries[i].args[3]);
             if (r >= static_cast<int> (sizeof (buf) - buf_size - 1))
             {
-                buf_size = sizeof (buf - 5);
+                buf_size = sizeof (buf) - 5;
                 buf[buf_size++] = '.';
                 buf[buf_size++] = '.';
                 buf[buf_size++] = '.';